@@ -23,7 +23,9 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/mutex.h"
+#include "common/system.h"
 #include "common/textconsole.h"
+#include "common/timer.h"
 #include "common/queue.h"
 #include "common/util.h"
 
@@ -466,6 +468,209 @@ AudioStream *makeLimitingAudioStream(AudioStream *parentStream, const Timestamp
 	return new LimitingAudioStream(parentStream, length, disposeAfterUse);
 }
 
+// Full memory barrier for the decode-ahead ring buffer below. Without it
+// the ring cannot be shared safely between the timer and audio threads,
+// and makeAsyncBufferedAudioStream() degrades to a no-op.
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+#define AUDIOSTREAM_FULL_BARRIER() __sync_synchronize()
+#define AUDIOSTREAM_HAVE_BARRIER
+#endif
+
+#ifdef AUDIOSTREAM_HAVE_BARRIER
+
+/**
+ * An AudioStream wrapper that decodes its parent stream ahead of playback
+ * into a ring buffer, so that the expensive decoding (and any disk access
+ * it causes) happens on the timer thread rather than inside the audio
+ * callback. The callback side of readBuffer() is nothing but memcpys.
+ *
+ * The ring is single-producer/single-consumer: producers (the timer proc,
+ * and the underrun path in readBuffer) are serialized by _mutex, while the
+ * consumer side runs lock-free, so the audio callback never waits for a
+ * decode in progress.
+ */
+class AsyncBufferedAudioStream : public AudioStream {
+public:
+	AsyncBufferedAudioStream(AudioStream *parent, uint32 bufferedSamples, DisposeAfterUse::Flag disposeAfterUse);
+	~AsyncBufferedAudioStream();
+
+	int readBuffer(int16 *buffer, const int numSamples);
+
+	bool isStereo() const { return _stereo; }
+	int getRate() const { return _rate; }
+	bool endOfData() const { return (_read == _write) && _parentEndOfData; }
+	bool endOfStream() const { return (_read == _write) && _parentEndOfStream; }
+
+	// Called from the shared timer proc, and internally.
+	void fill();
+
+	Common::Mutex _mutex;
+
+private:
+	Common::DisposablePtr<AudioStream> _parent;
+	const bool _stereo;
+	const int _rate;
+
+	int16 *_buffer;
+	uint32 _size;       // ring capacity, power of two
+	volatile uint32 _read;
+	volatile uint32 _write;
+
+	// Parent state mirrored by whoever read from it last (under _mutex),
+	// so the audio thread never pokes the parent without the lock.
+	volatile bool _parentEndOfData;
+	volatile bool _parentEndOfStream;
+
+	int copyFromRing(int16 *buffer, int numSamples);
+};
+
+/**
+ * All live AsyncBufferedAudioStreams, serviced by a single shared timer
+ * proc (the timer manager does not allow installing the same callback
+ * more than once). Created on first use, since a Common::Mutex cannot be
+ * constructed before the backend is up.
+ */
+static Common::Mutex *s_asyncStreamsMutex = 0;
+static Common::Array<AsyncBufferedAudioStream *> *s_asyncStreams = 0;
+
+static void asyncStreamTimerProc(void *refCon) {
+	Common::StackLock lock(*s_asyncStreamsMutex);
+	for (uint i = 0; i < s_asyncStreams->size(); ++i) {
+		AsyncBufferedAudioStream *stream = (*s_asyncStreams)[i];
+		Common::StackLock streamLock(stream->_mutex);
+		stream->fill();
+	}
+}
+
+static void registerAsyncStream(AsyncBufferedAudioStream *stream) {
+	if (!s_asyncStreamsMutex) {
+		s_asyncStreamsMutex = new Common::Mutex();
+		s_asyncStreams = new Common::Array<AsyncBufferedAudioStream *>();
+	}
+
+	Common::StackLock lock(*s_asyncStreamsMutex);
+	if (s_asyncStreams->empty())
+		g_system->getTimerManager()->installTimerProc(&asyncStreamTimerProc, 20 * 1000, 0, "asyncBufferedAudioStream");
+	s_asyncStreams->push_back(stream);
+}
+
+static void unregisterAsyncStream(AsyncBufferedAudioStream *stream) {
+	Common::StackLock lock(*s_asyncStreamsMutex);
+	for (uint i = 0; i < s_asyncStreams->size(); ++i) {
+		if ((*s_asyncStreams)[i] == stream) {
+			s_asyncStreams->remove_at(i);
+			break;
+		}
+	}
+	if (s_asyncStreams->empty())
+		g_system->getTimerManager()->removeTimerProc(&asyncStreamTimerProc);
+}
+
+AsyncBufferedAudioStream::AsyncBufferedAudioStream(AudioStream *parent, uint32 bufferedSamples, DisposeAfterUse::Flag disposeAfterUse)
+	: _parent(parent, disposeAfterUse), _stereo(parent->isStereo()), _rate(parent->getRate()),
+	  _read(0), _write(0), _parentEndOfData(false), _parentEndOfStream(false) {
+
+	_size = 2;
+	while (_size < bufferedSamples)
+		_size <<= 1;
+	_buffer = new int16[_size];
+
+	// Prime the ring so playback can start right away.
+	fill();
+
+	registerAsyncStream(this);
+}
+
+AsyncBufferedAudioStream::~AsyncBufferedAudioStream() {
+	unregisterAsyncStream(this);
+	delete[] _buffer;
+}
+
+void AsyncBufferedAudioStream::fill() {
+	int16 chunk[2048];
+
+	for (;;) {
+		const uint32 space = _size - (_write - _read);
+		if (space == 0)
+			break;
+
+		const int n = (int)MIN<uint32>(space, ARRAYSIZE(chunk));
+		const int got = _parent->readBuffer(chunk, n);
+		_parentEndOfData = _parent->endOfData();
+		_parentEndOfStream = _parent->endOfStream();
+		if (got <= 0)
+			break;
+
+		uint32 pos = _write & (_size - 1);
+		const uint32 first = MIN<uint32>(got, _size - pos);
+		memcpy(_buffer + pos, chunk, first * sizeof(int16));
+		if ((uint32)got > first)
+			memcpy(_buffer, chunk + first, (got - first) * sizeof(int16));
+
+		// Publish the data before moving the write index.
+		AUDIOSTREAM_FULL_BARRIER();
+		_write = _write + got;
+
+		if (got < n)
+			break;
+	}
+}
+
+int AsyncBufferedAudioStream::copyFromRing(int16 *buffer, int numSamples) {
+	const uint32 write = _write;
+	// Pair with the barrier in fill() before touching the data.
+	AUDIOSTREAM_FULL_BARRIER();
+
+	const uint32 n = MIN<uint32>(write - _read, numSamples);
+	if (n == 0)
+		return 0;
+
+	const uint32 pos = _read & (_size - 1);
+	const uint32 first = MIN<uint32>(n, _size - pos);
+	memcpy(buffer, _buffer + pos, first * sizeof(int16));
+	if (n > first)
+		memcpy(buffer + first, _buffer, (n - first) * sizeof(int16));
+
+	// The data must be fully out before the space is reusable.
+	AUDIOSTREAM_FULL_BARRIER();
+	_read = _read + n;
+
+	return (int)n;
+}
+
+int AsyncBufferedAudioStream::readBuffer(int16 *buffer, const int numSamples) {
+	int copied = copyFromRing(buffer, numSamples);
+
+	if (copied < numSamples && !_parentEndOfData) {
+		// The ring ran dry: decode the rest synchronously so no samples
+		// are dropped. The timer proc cannot interfere while we hold the
+		// lock, but it may have refilled the ring in the meantime, so
+		// drain that first to keep the samples in order.
+		Common::StackLock lock(_mutex);
+
+		copied += copyFromRing(buffer + copied, numSamples - copied);
+		if (copied < numSamples && !_parentEndOfData) {
+			copied += _parent->readBuffer(buffer + copied, numSamples - copied);
+			_parentEndOfData = _parent->endOfData();
+			_parentEndOfStream = _parent->endOfStream();
+		}
+	}
+
+	return copied;
+}
+
+#endif // AUDIOSTREAM_HAVE_BARRIER
+
+AudioStream *makeAsyncBufferedAudioStream(AudioStream *stream, uint32 bufferedSamples, DisposeAfterUse::Flag disposeAfterUse) {
+#ifdef AUDIOSTREAM_HAVE_BARRIER
+	return new AsyncBufferedAudioStream(stream, bufferedSamples, disposeAfterUse);
+#else
+	// No safe way to share the ring between threads: hand the stream
+	// back unchanged (and thus also unowned, mind disposeAfterUse).
+	return stream;
+#endif
+}
+
 /**
  * An AudioStream that plays nothing and immediately returns that
  * the endOfStream() has been reached
@@ -371,6 +371,27 @@ Timestamp convertTimeToStreamPos(const Timestamp &where, int rate, bool isStereo
  */
 AudioStream *makeLimitingAudioStream(AudioStream *parentStream, const Timestamp &length, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::YES);
 
+/**
+ * Factory function for an AudioStream wrapper that decodes the wrapped
+ * stream ahead of time into a ring buffer, using the timer manager as its
+ * worker. On backends with a threaded timer the decoding (e.g. MP3 or
+ * Vorbis frame decode, possibly hitting the disk) thus moves off the
+ * audio callback path, which then only copies samples out of the ring.
+ * If the buffer ever runs dry, the wrapper transparently decodes
+ * synchronously, so no data is lost either way.
+ *
+ * Note that the wrapped stream is read ahead of playback time: do not use
+ * this with streams whose side effects you need to observe in sync with
+ * playback (e.g. a QueuingAudioStream being fed interactively).
+ *
+ * @param stream          The stream to buffer
+ * @param bufferedSamples Ring buffer capacity in samples (rounded up to a
+ *                        power of two); about half a second is a good value
+ * @param disposeAfterUse Whether the wrapped stream should be destroyed on
+ *                        destruction of the returned stream
+ */
+AudioStream *makeAsyncBufferedAudioStream(AudioStream *stream, uint32 bufferedSamples, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::YES);
+
 /**
  * An AudioStream designed to work in terms of packets.
  *
@@ -444,14 +444,22 @@ const int16 Ima_ADPCMStream::_imaTable[89] = {
 	32767
 };
 
+void Ima_ADPCMStream::buildTables() {
+	for (int idx = 0; idx < ARRAYSIZE(_imaTable); idx++) {
+		for (int code = 0; code < 16; code++) {
+			const int32 E = (2 * (code & 0x7) + 1) * _imaTable[idx] / 8;
+			_imaDiffTable[idx][code] = (code & 0x08) ? -E : E;
+			_imaNextStepIndex[idx][code] = CLIP<int32>(idx + _stepAdjustTable[code], 0, ARRAYSIZE(_imaTable) - 1);
+		}
+	}
+}
+
 int16 Ima_ADPCMStream::decodeIMA(byte code, int channel) {
-	int32 E = (2 * (code & 0x7) + 1) * _imaTable[_status.ima_ch[channel].stepIndex] / 8;
-	int32 diff = (code & 0x08) ? -E : E;
-	int32 samp = CLIP<int32>(_status.ima_ch[channel].last + diff, -32768, 32767);
+	const int32 stepIndex = _status.ima_ch[channel].stepIndex;
+	int32 samp = CLIP<int32>(_status.ima_ch[channel].last + _imaDiffTable[stepIndex][code], -32768, 32767);
 
 	_status.ima_ch[channel].last = samp;
-	_status.ima_ch[channel].stepIndex += _stepAdjustTable[code];
-	_status.ima_ch[channel].stepIndex = CLIP<int32>(_status.ima_ch[channel].stepIndex, 0, ARRAYSIZE(_imaTable) - 1);
+	_status.ima_ch[channel].stepIndex = _imaNextStepIndex[stepIndex][code];
 
 	return samp;
 }
@@ -103,12 +103,24 @@ protected:
 
 public:
 	Ima_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
-		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {}
+		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) { buildTables(); }
 
 	/**
 	 * This table is used by decodeIMA.
 	 */
 	static const int16 _imaTable[89];
+
+private:
+	/**
+	 * Predictor deltas and step index transitions for every (step index,
+	 * code) pair, precomputed from _imaTable and _stepAdjustTable, so
+	 * decodeIMA() needs neither the multiply/divide nor the step index
+	 * clamp per sample.
+	 */
+	int32 _imaDiffTable[89][16];
+	byte _imaNextStepIndex[89][16];
+
+	void buildTables();
 };
 
 class DVI_ADPCMStream : public Ima_ADPCMStream {
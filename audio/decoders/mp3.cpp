@@ -24,6 +24,7 @@
 
 #ifdef USE_MAD
 
+#include "common/array.h"
 #include "common/debug.h"
 #include "common/mutex.h"
 #include "common/ptr.h"
@@ -108,6 +109,25 @@ protected:
 	Timestamp _length;
 
 private:
+	enum {
+		/** Interval (in milliseconds) between two seek index checkpoints */
+		kSeekIndexIntervalMs = 10000
+	};
+
+	/**
+	 * A seek checkpoint: the position of a frame boundary in _inStream
+	 * and the playback time at that boundary. The index is built for free
+	 * during the header scan which computes the stream length, and allows
+	 * seek() to restart parsing near the destination instead of at the
+	 * very beginning of the stream.
+	 */
+	struct SeekIndexEntry {
+		uint32 pos;
+		mad_timer_t time;
+	};
+
+	Common::Array<SeekIndexEntry> _seekIndex;
+
 	static Common::SeekableReadStream *skipID3(Common::SeekableReadStream *stream, DisposeAfterUse::Flag dispose);
 };
 
@@ -337,9 +357,27 @@ MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag
 	_channels = MAD_NCHANNELS(&_frame.header);
 	_rate = _frame.header.samplerate;
 
-	// Calculate the length of the stream
-	while (_state != MP3_STATE_EOS)
+	// Calculate the length of the stream, collecting seek checkpoints
+	// along the way. The first checkpoint is the stream start; further
+	// ones are taken at the first frame boundary past each multiple of
+	// the index interval.
+	SeekIndexEntry entry;
+	entry.pos = 0;
+	entry.time = mad_timer_zero;
+	_seekIndex.push_back(entry);
+
+	while (_state != MP3_STATE_EOS) {
+		if (_stream.next_frame &&
+				(uint32)mad_timer_count(_curTime, MAD_UNITS_MILLISECONDS) >= _seekIndex.size() * (uint32)kSeekIndexIntervalMs) {
+			// _stream.next_frame is the boundary of the frame that will be
+			// parsed next; work out where it lives in the source stream.
+			entry.pos = _inStream->pos() - (_stream.bufend - _stream.next_frame);
+			entry.time = _curTime;
+			_seekIndex.push_back(entry);
+		}
+
 		readHeader(*_inStream);
+	}
 
 	// To rule out any invalid sample rate to be encountered here, say in case the
 	// MP3 stream is invalid, we just check the MAD error code here.
@@ -377,9 +415,23 @@ bool MP3Stream::seek(const Timestamp &where) {
 	mad_timer_t destination;
 	mad_timer_set(&destination, time / 1000, time % 1000, 1000);
 
-	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0) {
-		_inStream->seek(0);
+	// Look up the last seek checkpoint at or before the destination
+	uint idx = 0;
+	if (!_seekIndex.empty()) {
+		idx = MIN<uint>(time / kSeekIndexIntervalMs, _seekIndex.size() - 1);
+		while (idx > 0 && mad_timer_compare(_seekIndex[idx].time, destination) > 0)
+			--idx;
+	}
+
+	// Restart parsing from that checkpoint when we would otherwise have to
+	// start over from the beginning, or when the checkpoint is closer to
+	// the destination than the current position.
+	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0 ||
+			(!_seekIndex.empty() && mad_timer_compare(_seekIndex[idx].time, _curTime) > 0)) {
+		_inStream->seek(_seekIndex.empty() ? 0 : _seekIndex[idx].pos);
 		initStream(*_inStream);
+		if (!_seekIndex.empty())
+			_curTime = _seekIndex[idx].time;
 	}
 
 	while (mad_timer_compare(destination, _curTime) > 0 && _state != MP3_STATE_EOS)
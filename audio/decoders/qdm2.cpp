@@ -206,6 +206,12 @@ private:
 	float _noiseSamples[128];
 	void initNoiseSamples(void);
 
+	// sin() over one FFT period, in 512 steps. Tone phases are integral
+	// step counts, so the tone synthesizer can look its sines and cosines
+	// up here instead of calling into libm for every tone of every frame.
+	float _fftSineTable[512];
+	void fftSineTableInit(void);
+
 	void average_quantized_coeffs(void);
 	void build_sb_samples_from_noise(int sb);
 	void fix_coding_method_array(int sb, int channels, sb_int8_array coding_method);
@@ -934,6 +940,14 @@ void QDM2Stream::initNoiseSamples(void) {
 	}
 }
 
+void QDM2Stream::fftSineTableInit(void) {
+	uint16 i;
+	const double iscale = 2.0 * M_PI / 512.0;
+
+	for (i = 0; i < ARRAYSIZE(_fftSineTable); i++)
+		_fftSineTable[i] = sin(i * iscale);
+}
+
 static const uint16 qdm2_vlc_offs[18] = {
 	0, 260, 566, 598, 894, 1166, 1230, 1294, 1678, 1950, 2214, 2278, 2310, 2570, 2834, 3124, 3448, 3838
 };
@@ -1209,6 +1223,7 @@ QDM2Stream::QDM2Stream(Common::SeekableReadStream *extraData, DisposeAfterUse::F
 	softclipTableInit();
 	rndTableInit();
 	initNoiseSamples();
+	fftSineTableInit();
 
 	_compressedData = new uint8[_packetSize + FF_INPUT_BUFFER_PADDING_SIZE];
 
@@ -2323,14 +2338,14 @@ void QDM2Stream::qdm2_fft_generate_tone(FFTTone *tone)
 	float level, f[6];
 	int i;
 	QDM2Complex c;
-	const double iscale = 2.0 * M_PI / 512.0;
 
 	tone->phase += tone->phase_shift;
 
 	// calculate current level (maximum amplitude) of tone
 	level = fft_tone_envelope_table[tone->duration][tone->time_index] * tone->level;
-	c.im = level * sin(tone->phase*iscale);
-	c.re = level * cos(tone->phase*iscale);
+	// the phase is a count of 1/512th turns, so look the sine and cosine up
+	c.im = level * _fftSineTable[tone->phase & 511];
+	c.re = level * _fftSineTable[(tone->phase + 128) & 511];
 
 	// generate FFT coefficients for tone
 	if (tone->duration >= 3 || tone->cutoff >= 3) {
@@ -2364,7 +2379,6 @@ void QDM2Stream::qdm2_fft_generate_tone(FFTTone *tone)
 
 void QDM2Stream::qdm2_fft_tone_synthesizer(uint8 sub_packet) {
 	int i, j, ch;
-	const double iscale = 0.25 * M_PI;
 
 	for (ch = 0; ch < _channels; ch++) {
 		memset(_fft.complex[ch], 0, _frameSize * sizeof(QDM2Complex));
@@ -2382,8 +2396,9 @@ void QDM2Stream::qdm2_fft_tone_synthesizer(uint8 sub_packet) {
 			ch = (_channels == 1) ? 0 : _fftCoefs[i].channel;
 			level = (_fftCoefs[i].exp < 0) ? 0.0 : fft_tone_level_table[_superblocktype_2_3 ? 0 : 1][_fftCoefs[i].exp & 63];
 
-			c.re = level * cos(_fftCoefs[i].phase * iscale);
-			c.im = level * sin(_fftCoefs[i].phase * iscale);
+			// the coefficient phase counts eighth turns, i.e. 64 table steps
+			c.re = level * _fftSineTable[(_fftCoefs[i].phase * 64 + 128) & 511];
+			c.im = level * _fftSineTable[(_fftCoefs[i].phase * 64) & 511];
 			_fft.complex[ch][_fftCoefs[i].offset + 0].re += c.re;
 			_fft.complex[ch][_fftCoefs[i].offset + 0].im += c.im;
 			_fft.complex[ch][_fftCoefs[i].offset + 1].re -= c.re;
@@ -21,7 +21,7 @@
  */
 
 #include "common/endian.h"
-#include "common/memstream.h"
+#include "common/stream.h"
 #include "common/textconsole.h"
 #include "common/util.h"
 
@@ -176,6 +176,79 @@ bool RawStream<is16Bit, isUnsigned, isLE>::seek(const Timestamp &where) {
 	return true;
 }
 
+#pragma mark -
+#pragma mark --- MemoryRawStream ---
+#pragma mark -
+
+/**
+ * A variant of RawStream for playing raw PCM data directly out of a
+ * memory buffer. Since the whole sound is guaranteed to be in memory,
+ * the samples are converted for the mixer straight from the source
+ * data, skipping both the intermediate sample buffer of RawStream and
+ * the bookkeeping of a wrapping MemoryReadStream. This matters for
+ * games which play lots of short, fully loaded sound effects.
+ */
+template<bool is16Bit, bool isUnsigned, bool isLE>
+class MemoryRawStream : public SeekableAudioStream {
+public:
+	MemoryRawStream(int rate, bool stereo, DisposeAfterUse::Flag disposeBuffer, const byte *buffer, uint32 size)
+		: _rate(rate), _isStereo(stereo), _playtime(0, size / (stereo ? 2 : 1) / (is16Bit ? 2 : 1), rate),
+		  _buffer(buffer), _size(size), _pos(0), _disposeBuffer(disposeBuffer) {
+	}
+
+	~MemoryRawStream() {
+		// The buffer is freed, not deleted, to stay interchangeable
+		// with handing it to a disposing MemoryReadStream.
+		if (_disposeBuffer == DisposeAfterUse::YES)
+			free(const_cast<byte *>(_buffer));
+	}
+
+	int readBuffer(int16 *buffer, const int numSamples);
+
+	bool isStereo() const  { return _isStereo; }
+	bool endOfData() const { return _pos >= _size; }
+
+	int getRate() const         { return _rate; }
+	Timestamp getLength() const { return _playtime; }
+
+	bool seek(const Timestamp &where);
+private:
+	const int _rate;                            ///< Sample rate of stream
+	const bool _isStereo;                       ///< Whether this is an stereo stream
+	const Timestamp _playtime;                  ///< Calculated total play time
+	const byte *_buffer;                        ///< Buffer with the sample data
+	const uint32 _size;                         ///< Size of the buffer in bytes
+	uint32 _pos;                                ///< Current position in the buffer
+	const DisposeAfterUse::Flag _disposeBuffer; ///< Whether the buffer is freed on destruction
+};
+
+template<bool is16Bit, bool isUnsigned, bool isLE>
+int MemoryRawStream<is16Bit, isUnsigned, isLE>::readBuffer(int16 *buffer, const int numSamples) {
+	const int samples = MIN<int>(numSamples, (_size - _pos) / (is16Bit ? 2 : 1));
+
+	// Convert the requested samples directly out of the source buffer.
+	const byte *src = _buffer + _pos;
+	for (int i = 0; i < samples; ++i) {
+		buffer[i] = READ_ENDIAN_SAMPLE(is16Bit, isUnsigned, src, isLE);
+		src += (is16Bit ? 2 : 1);
+	}
+
+	_pos += samples * (is16Bit ? 2 : 1);
+	return samples;
+}
+
+template<bool is16Bit, bool isUnsigned, bool isLE>
+bool MemoryRawStream<is16Bit, isUnsigned, isLE>::seek(const Timestamp &where) {
+	if (where > _playtime) {
+		_pos = _size;
+		return false;
+	}
+
+	const uint32 seekSample = convertTimeToStreamPos(where, getRate(), isStereo()).totalNumberOfFrames();
+	_pos = seekSample * (is16Bit ? 2 : 1);
+	return true;
+}
+
 #pragma mark -
 #pragma mark --- Raw stream factories ---
 #pragma mark -
@@ -215,10 +288,30 @@ SeekableAudioStream *makeRawStream(Common::SeekableReadStream *stream,
 	}
 }
 
+#define MAKE_MEMORY_RAW_STREAM(UNSIGNED) \
+		if (is16Bit) { \
+			if (isLE) \
+				return new MemoryRawStream<true, UNSIGNED, true>(rate, isStereo, disposeAfterUse, buffer, size); \
+			else  \
+				return new MemoryRawStream<true, UNSIGNED, false>(rate, isStereo, disposeAfterUse, buffer, size); \
+		} else \
+			return new MemoryRawStream<false, UNSIGNED, false>(rate, isStereo, disposeAfterUse, buffer, size)
+
 SeekableAudioStream *makeRawStream(const byte *buffer, uint32 size,
                                    int rate, byte flags,
                                    DisposeAfterUse::Flag disposeAfterUse) {
-	return makeRawStream(new Common::MemoryReadStream(buffer, size, disposeAfterUse), rate, flags, DisposeAfterUse::YES);
+	const bool isStereo   = (flags & Audio::FLAG_STEREO) != 0;
+	const bool is16Bit    = (flags & Audio::FLAG_16BITS) != 0;
+	const bool isUnsigned = (flags & Audio::FLAG_UNSIGNED) != 0;
+	const bool isLE       = (flags & Audio::FLAG_LITTLE_ENDIAN) != 0;
+
+	assert(size % ((is16Bit ? 2 : 1) * (isStereo ? 2 : 1)) == 0);
+
+	if (isUnsigned) {
+		MAKE_MEMORY_RAW_STREAM(true);
+	} else {
+		MAKE_MEMORY_RAW_STREAM(false);
+	}
 }
 
 class PacketizedRawStream : public StatelessPacketizedAudioStream {
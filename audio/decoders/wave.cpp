@@ -23,6 +23,7 @@
 #include "common/debug.h"
 #include "common/textconsole.h"
 #include "common/stream.h"
+#include "common/substream.h"
 
 #include "audio/audiostream.h"
 #include "audio/decoders/wave.h"
@@ -215,15 +216,18 @@ SeekableAudioStream *makeWAVStream(Common::SeekableReadStream *stream, DisposeAf
 		size &= ~(sampleSize - 1);
 	}
 
-	// Raw PCM. Just read everything at once.
-	// TODO: More elegant would be to wrap the stream.
+	// Raw PCM. When ownership of the source stream is handed over to us,
+	// serve the sample data directly out of it through a sub stream - as
+	// makeAIFFStream does - instead of copying it into a fresh buffer.
+	if (disposeAfterUse == DisposeAfterUse::YES)
+		return makeRawStream(new Common::SeekableSubReadStream(stream, stream->pos(), stream->pos() + size, DisposeAfterUse::YES), rate, flags);
+
+	// The caller keeps ownership and may free the source stream as soon as
+	// we return, so in this case the sample data has to be copied.
 	byte *data = (byte *)malloc(size);
 	assert(data);
 	stream->read(data, size);
 
-	if (disposeAfterUse == DisposeAfterUse::YES)
-		delete stream;
-
 	return makeRawStream(data, size, rate, flags);
 }
 
@@ -23,6 +23,7 @@
 #include "audio/decoders/xa.h"
 #include "audio/audiostream.h"
 #include "common/stream.h"
+#include "common/util.h"
 
 namespace Audio {
 
@@ -44,10 +45,10 @@ private:
 	void seekToPos(uint pos);
 
 	byte _predictor;
-	double _samples[28];
+	int32 _samples[28];
 	byte _samplesRemaining;
 	int _rate;
-	double _s1, _s2;
+	int32 _s1, _s2;
 	uint _loopPoint;
 	bool _endOfData;
 };
@@ -56,7 +57,7 @@ XAStream::XAStream(Common::SeekableReadStream *stream, int rate, DisposeAfterUse
 		: _stream(stream), _disposeAfterUse(disposeAfterUse) {
 	_samplesRemaining = 0;
 	_predictor = 0;
-	_s1 = _s2 = 0.0;
+	_s1 = _s2 = 0;
 	_rate = rate;
 	_loopPoint = 0;
 	_endOfData = false;
@@ -68,23 +69,20 @@ XAStream::~XAStream() {
 		delete _stream;
 }
 
-static const double s_xaDataTable[5][2] = {
-	{  0.0, 0.0 },
-	{  60.0 / 64.0,  0.0 },
-	{  115.0 / 64.0, -52.0 / 64.0 },
-	{  98.0 / 64.0, -55.0 / 64.0 },
-	{  122.0 / 64.0, -60.0 / 64.0 }
-};
+// The XA ADPCM prediction filters, in 6 bit fixed point as used by the
+// actual PSX hardware (i.e. 60/64, 115/64 - 52/64, ...).
+static const int32 s_xaFilterK0[5] = { 0, 60, 115, 98, 122 };
+static const int32 s_xaFilterK1[5] = { 0,  0, -52, -55, -60 };
 
 int XAStream::readBuffer(int16 *buffer, const int numSamples) {
 	int32 samplesDecoded = 0;
 
 	for (int i = 28 - _samplesRemaining; i < 28 && samplesDecoded < numSamples; i++) {
-		_samples[i] = _samples[i] + _s1 * s_xaDataTable[_predictor][0] + _s2 * s_xaDataTable[_predictor][1];
+		int32 sample = _samples[i] + ((_s1 * s_xaFilterK0[_predictor] + _s2 * s_xaFilterK1[_predictor] + 32) >> 6);
+		sample = CLIP<int32>(sample, -32768, 32767);
 		_s2 = _s1;
-		_s1 = _samples[i];
-		int16 d = (int) (_samples[i] + 0.5);
-		buffer[samplesDecoded] = d;
+		_s1 = sample;
+		buffer[samplesDecoded] = (int16)sample;
 		samplesDecoded++;
 		_samplesRemaining--;
 	}
@@ -115,22 +113,17 @@ int XAStream::readBuffer(int16 *buffer, const int numSamples) {
 
 		for (i = 0; i < 28; i += 2) {
 			byte d = _stream->readByte();
-			int16 s = (d & 0xf) << 12;
-			if (s & 0x8000)
-				s |= 0xffff0000;
-			_samples[i] = (double)(s >> shift);
-			s = (d & 0xf0) << 8;
-			if (s & 0x8000)
-				s |= 0xffff0000;
-			_samples[i + 1] = (double)(s >> shift);
+			// Sign extension of the nibble falls out of the int16 cast
+			_samples[i] = (int16)((d & 0x0f) << 12) >> shift;
+			_samples[i + 1] = (int16)((d & 0xf0) << 8) >> shift;
 		}
 
 		for (i = 0; i < 28 && samplesDecoded < numSamples; i++) {
-			_samples[i] = _samples[i] + _s1 * s_xaDataTable[_predictor][0] + _s2 * s_xaDataTable[_predictor][1];
+			int32 sample = _samples[i] + ((_s1 * s_xaFilterK0[_predictor] + _s2 * s_xaFilterK1[_predictor] + 32) >> 6);
+			sample = CLIP<int32>(sample, -32768, 32767);
 			_s2 = _s1;
-			_s1 = _samples[i];
-			int16 d = (int) (_samples[i] + 0.5);
-			buffer[samplesDecoded] = d;
+			_s1 = sample;
+			buffer[samplesDecoded] = (int16)sample;
 			samplesDecoded++;
 		}
 
@@ -153,7 +146,7 @@ void XAStream::seekToPos(uint pos) {
 	_stream->seek(pos);
 	_samplesRemaining = 0;
 	_predictor = 0;
-	_s1 = _s2 = 0.0;
+	_s1 = _s2 = 0;
 	_endOfData = false;
 }
 
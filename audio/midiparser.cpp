@@ -45,13 +45,19 @@ _sendSustainOffOnNotesOff(false),
 _numTracks(0),
 _activeTrack(255),
 _abortParse(false),
-_jumpingToTick(false) {
+_jumpingToTick(false),
+_jumpCacheValid(false),
+_jumpCacheTick(0),
+_jumpCacheTrack(0),
+_jumpCacheEntryTempo(0),
+_jumpCacheTempo(0) {
 	memset(_activeNotes, 0, sizeof(_activeNotes));
 	memset(_tracks, 0, sizeof(_tracks));
 	_nextEvent.start = NULL;
 	_nextEvent.delta = 0;
 	_nextEvent.event = 0;
 	_nextEvent.length = 0;
+	_jumpCacheEvent = _nextEvent;
 }
 
 void MidiParser::property(int prop, int value) {
@@ -310,6 +316,7 @@ void MidiParser::allNotesOff() {
 
 void MidiParser::resetTracking() {
 	_position.clear();
+	_jumpCacheValid = false;
 }
 
 bool MidiParser::setTrack(int track) {
@@ -392,40 +399,62 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 
 	Tracker currentPos(_position);
 	EventInfo currentEvent(_nextEvent);
+	const uint32 entryTempo = _tempo;
+
+	if (!fireEvents && _jumpCacheValid && tick == _jumpCacheTick &&
+			_tracks[_activeTrack] == _jumpCacheTrack && entryTempo == _jumpCacheEntryTempo) {
+		// A silent jump to this tick was done before with the same tempo
+		// in effect, so restore its result instead of replaying the track.
+		_position = _jumpCachePosition;
+		_nextEvent = _jumpCacheEvent;
+		setTempo(_jumpCacheTempo);
+	} else {
+		resetTracking();
+		_position._playPos = _tracks[_activeTrack];
+		parseNextEvent(_nextEvent);
+		if (tick > 0) {
+			while (true) {
+				EventInfo &info = _nextEvent;
+				if (_position._lastEventTick + info.delta >= tick) {
+					_position._playTime += (tick - _position._lastEventTick) * _psecPerTick;
+					_position._playTick = tick;
+					break;
+				}
 
-	resetTracking();
-	_position._playPos = _tracks[_activeTrack];
-	parseNextEvent(_nextEvent);
-	if (tick > 0) {
-		while (true) {
-			EventInfo &info = _nextEvent;
-			if (_position._lastEventTick + info.delta >= tick) {
-				_position._playTime += (tick - _position._lastEventTick) * _psecPerTick;
-				_position._playTick = tick;
-				break;
-			}
+				_position._lastEventTick += info.delta;
+				_position._lastEventTime += info.delta * _psecPerTick;
+				_position._playTick = _position._lastEventTick;
+				_position._playTime = _position._lastEventTime;
+
+				// Some special processing for the fast-forward case
+				if (info.command() == 0x9 && dontSendNoteOn) {
+					// Don't send note on; doing so creates a "warble" with
+					// some instruments on the MT-32. Refer to patch #3117577
+				} else if (info.event == 0xFF && info.ext.type == 0x2F) {
+					// End of track
+					// This means that we failed to find the right tick.
+					_position = currentPos;
+					_nextEvent = currentEvent;
+					_jumpingToTick = false;
+					return false;
+				} else {
+					processEvent(info, fireEvents);
+				}
 
-			_position._lastEventTick += info.delta;
-			_position._lastEventTime += info.delta * _psecPerTick;
-			_position._playTick = _position._lastEventTick;
-			_position._playTime = _position._lastEventTime;
-
-			// Some special processing for the fast-forward case
-			if (info.command() == 0x9 && dontSendNoteOn) {
-				// Don't send note on; doing so creates a "warble" with
-				// some instruments on the MT-32. Refer to patch #3117577
-			} else if (info.event == 0xFF && info.ext.type == 0x2F) {
-				// End of track
-				// This means that we failed to find the right tick.
-				_position = currentPos;
-				_nextEvent = currentEvent;
-				_jumpingToTick = false;
-				return false;
-			} else {
-				processEvent(info, fireEvents);
+				parseNextEvent(_nextEvent);
 			}
 
-			parseNextEvent(_nextEvent);
+			if (!fireEvents) {
+				// Remember where this silent jump ended up; loops tend to
+				// come back to the same tick over and over.
+				_jumpCacheValid = true;
+				_jumpCacheTick = tick;
+				_jumpCacheTrack = _tracks[_activeTrack];
+				_jumpCacheEntryTempo = entryTempo;
+				_jumpCacheTempo = _tempo;
+				_jumpCachePosition = _position;
+				_jumpCacheEvent = _nextEvent;
+			}
 		}
 	}
 
@@ -289,6 +289,17 @@ protected:
 	bool   _abortParse;    ///< If a jump or other operation interrupts parsing, flag to abort.
 	bool   _jumpingToTick; ///< True if currently inside jumpToTick
 
+	///< Cached result of the last silent jumpToTick(), so that a loop which
+	///< repeatedly jumps to the same target tick (e.g. SCI loop points) does
+	///< not have to replay the whole track from the start on every pass.
+	bool      _jumpCacheValid;
+	uint32    _jumpCacheTick;       ///< Target tick the cache was built for.
+	byte     *_jumpCacheTrack;      ///< Start of the track the cache was built for.
+	uint32    _jumpCacheEntryTempo; ///< Tempo in effect when the cached jump started.
+	uint32    _jumpCacheTempo;      ///< Tempo in effect at the cached position.
+	Tracker   _jumpCachePosition;   ///< Position at the target tick.
+	EventInfo _jumpCacheEvent;      ///< Pre-parsed event at the target tick.
+
 protected:
 	static uint32 readVLQ(byte * &data);
 	virtual void resetTracking();
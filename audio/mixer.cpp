@@ -32,6 +32,14 @@
 #include "audio/timestamp.h"
 
 
+// Full memory barrier used by the lock-free command queue. Without a
+// suitable primitive the queue degrades to always reporting "full", which
+// routes every command through the plain mutex path.
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+#define MIXER_FULL_BARRIER() __sync_synchronize()
+#define MIXER_HAVE_BARRIER
+#endif
+
 namespace Audio {
 
 #pragma mark -
@@ -95,6 +103,15 @@ public:
 	 */
 	void setVolume(const byte volume);
 
+	/**
+	 * Fades the channel's own volume to the given value. The linear ramp
+	 * is advanced in mix(), a few milliseconds of output at a time.
+	 *
+	 * @param volume     volume to fade to
+	 * @param durationMs duration of the fade in milliseconds
+	 */
+	void fadeVolume(const byte volume, const uint32 durationMs);
+
 	/**
 	 * Gets the channel's own volume.
 	 *
@@ -145,6 +162,15 @@ public:
 	SoundHandle getHandle() const { return _handle; }
 
 private:
+	enum {
+		/**
+		 * Block size (in sample pairs) in which mix() advances a volume
+		 * fade. Roughly 3 ms at 44 kHz; the per-sample work stays in the
+		 * rate converter.
+		 */
+		kFadeChunkSamples = 128
+	};
+
 	const Mixer::SoundType _type;
 	SoundHandle _handle;
 	bool _permanent;
@@ -154,6 +180,11 @@ private:
 	byte _volume;
 	int8 _balance;
 
+	uint32 _fadeSamplesLeft;
+	uint32 _fadeSamplesTotal;
+	byte _fadeStartVolume;
+	byte _fadeTargetVolume;
+
 	void updateChannelVolumes();
 	st_volume_t _volL, _volR;
 
@@ -175,7 +206,8 @@ private:
 
 // TODO: parameter "system" is unused
 MixerImpl::MixerImpl(OSystem *system, uint sampleRate)
-	: _mutex(), _sampleRate(sampleRate), _mixerReady(false), _handleSeed(0), _soundTypeSettings() {
+	: _mutex(), _sampleRate(sampleRate), _mixerReady(false), _handleSeed(0), _soundTypeSettings(),
+	  _cmdRead(0), _cmdWrite(0) {
 
 	assert(sampleRate > 0);
 
@@ -196,6 +228,76 @@ uint MixerImpl::getOutputRate() const {
 	return _sampleRate;
 }
 
+bool MixerImpl::postCommand(byte type, SoundHandle handle, int value) {
+#ifdef MIXER_HAVE_BARRIER
+	// _cmdMutex only serializes concurrent producers; the consumer side
+	// never takes it, so posting cannot block on the audio callback.
+	Common::StackLock lock(_cmdMutex);
+
+	const uint32 write = _cmdWrite;
+	if (write - _cmdRead >= kCommandQueueSize)
+		return false;
+
+	ChannelCommand &cmd = _commands[write % kCommandQueueSize];
+	cmd.type = type;
+	cmd.handle = handle;
+	cmd.value = value;
+
+	// Make sure the command data is visible before publishing it.
+	MIXER_FULL_BARRIER();
+	_cmdWrite = write + 1;
+	return true;
+#else
+	return false;
+#endif
+}
+
+void MixerImpl::processQueuedCommands() {
+	const uint32 write = _cmdWrite;
+#ifdef MIXER_HAVE_BARRIER
+	// Pair with the barrier in postCommand before touching command data.
+	MIXER_FULL_BARRIER();
+#endif
+	while (_cmdRead != write) {
+		applyCommand(_commands[_cmdRead % kCommandQueueSize]);
+		_cmdRead = _cmdRead + 1;
+	}
+}
+
+void MixerImpl::applyCommand(const ChannelCommand &cmd) {
+	// Simply ignore commands for handles of sounds that already
+	// terminated. Handle values are unique (see insertChannel), so a
+	// reused channel slot can never match a stale command.
+	const int index = cmd.handle._val % NUM_CHANNELS;
+	if (!_channels[index] || _channels[index]->getHandle()._val != cmd.handle._val)
+		return;
+
+	switch (cmd.type) {
+	case kCmdStopHandle:
+		delete _channels[index];
+		_channels[index] = 0;
+		break;
+	case kCmdPauseHandle:
+		_channels[index]->pause(true);
+		break;
+	case kCmdUnpauseHandle:
+		_channels[index]->pause(false);
+		break;
+	case kCmdSetVolume:
+		_channels[index]->setVolume((byte)cmd.value);
+		break;
+	case kCmdFadeVolume:
+		// Target volume in the low byte, fade duration in ms above it
+		_channels[index]->fadeVolume((byte)(cmd.value & 0xFF), (uint32)cmd.value >> 8);
+		break;
+	case kCmdSetBalance:
+		_channels[index]->setBalance((int8)cmd.value);
+		break;
+	default:
+		break;
+	}
+}
+
 void MixerImpl::insertChannel(SoundHandle *handle, Channel *chan) {
 	int index = -1;
 	for (int i = 0; i != NUM_CHANNELS; i++) {
@@ -230,6 +332,7 @@ void MixerImpl::playStream(
 			bool permanent,
 			bool reverseStereo) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 
 	if (stream == 0) {
 		warning("stream is 0");
@@ -270,6 +373,7 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 
 	int16 *buf = (int16 *)samples;
 	// we store stereo, 16-bit samples
@@ -302,6 +406,7 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 
 void MixerImpl::stopAll() {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != 0 && !_channels[i]->isPermanent()) {
 			delete _channels[i];
@@ -312,6 +417,7 @@ void MixerImpl::stopAll() {
 
 void MixerImpl::stopID(int id) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != 0 && _channels[i]->getId() == id) {
 			delete _channels[i];
@@ -321,15 +427,17 @@ void MixerImpl::stopID(int id) {
 }
 
 void MixerImpl::stopHandle(SoundHandle handle) {
+	// Stops are applied synchronously: client code is allowed to release
+	// the resources backing the stream as soon as this returns, so the
+	// channel must be gone before the next mix callback runs.
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 
-	// Simply ignore stop requests for handles of sounds that already terminated
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	delete _channels[index];
-	_channels[index] = 0;
+	ChannelCommand cmd;
+	cmd.type = kCmdStopHandle;
+	cmd.handle = handle;
+	cmd.value = 0;
+	applyCommand(cmd);
 }
 
 void MixerImpl::muteSoundType(SoundType type, bool mute) {
@@ -348,16 +456,43 @@ bool MixerImpl::isSoundTypeMuted(SoundType type) const {
 }
 
 void MixerImpl::setChannelVolume(SoundHandle handle, byte volume) {
+	if (postCommand(kCmdSetVolume, handle, volume))
+		return;
+
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
+	ChannelCommand cmd;
+	cmd.type = kCmdSetVolume;
+	cmd.handle = handle;
+	cmd.value = volume;
+	applyCommand(cmd);
+}
+
+void MixerImpl::fadeChannelVolume(SoundHandle handle, byte volume, uint32 fadeDurationMs) {
+	// The duration shares the command value with the target volume; clamp
+	// it to the 24 bits that fit (over four and a half hours).
+	if (fadeDurationMs > 0xFFFFFF)
+		fadeDurationMs = 0xFFFFFF;
+	const int value = (int)((fadeDurationMs << 8) | volume);
+
+	if (postCommand(kCmdFadeVolume, handle, value))
 		return;
 
-	_channels[index]->setVolume(volume);
+	Common::StackLock lock(_mutex);
+	processQueuedCommands();
+
+	ChannelCommand cmd;
+	cmd.type = kCmdFadeVolume;
+	cmd.handle = handle;
+	cmd.value = value;
+	applyCommand(cmd);
 }
 
 byte MixerImpl::getChannelVolume(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	processQueuedCommands();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -366,16 +501,23 @@ byte MixerImpl::getChannelVolume(SoundHandle handle) {
 }
 
 void MixerImpl::setChannelBalance(SoundHandle handle, int8 balance) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
+	if (postCommand(kCmdSetBalance, handle, balance))
 		return;
 
-	_channels[index]->setBalance(balance);
+	Common::StackLock lock(_mutex);
+	processQueuedCommands();
+
+	ChannelCommand cmd;
+	cmd.type = kCmdSetBalance;
+	cmd.handle = handle;
+	cmd.value = balance;
+	applyCommand(cmd);
 }
 
 int8 MixerImpl::getChannelBalance(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	processQueuedCommands();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -389,6 +531,7 @@ uint32 MixerImpl::getSoundElapsedTime(SoundHandle handle) {
 
 Timestamp MixerImpl::getElapsedTime(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
@@ -399,6 +542,7 @@ Timestamp MixerImpl::getElapsedTime(SoundHandle handle) {
 
 void MixerImpl::pauseAll(bool paused) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != 0) {
 			_channels[i]->pause(paused);
@@ -408,6 +552,7 @@ void MixerImpl::pauseAll(bool paused) {
 
 void MixerImpl::pauseID(int id, bool paused) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != 0 && _channels[i]->getId() == id) {
 			_channels[i]->pause(paused);
@@ -417,18 +562,23 @@ void MixerImpl::pauseID(int id, bool paused) {
 }
 
 void MixerImpl::pauseHandle(SoundHandle handle, bool paused) {
-	Common::StackLock lock(_mutex);
-
-	// Simply ignore (un)pause requests for sounds that already terminated
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
+	const byte type = paused ? kCmdPauseHandle : kCmdUnpauseHandle;
+	if (postCommand(type, handle, 0))
 		return;
 
-	_channels[index]->pause(paused);
+	Common::StackLock lock(_mutex);
+	processQueuedCommands();
+
+	ChannelCommand cmd;
+	cmd.type = type;
+	cmd.handle = handle;
+	cmd.value = 0;
+	applyCommand(cmd);
 }
 
 bool MixerImpl::isSoundIDActive(int id) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.updateSubsystems();
@@ -442,6 +592,7 @@ bool MixerImpl::isSoundIDActive(int id) {
 
 int MixerImpl::getSoundID(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 	const int index = handle._val % NUM_CHANNELS;
 	if (_channels[index] && _channels[index]->getHandle()._val == handle._val)
 		return _channels[index]->getId();
@@ -450,6 +601,7 @@ int MixerImpl::getSoundID(SoundHandle handle) {
 
 bool MixerImpl::isSoundHandleActive(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.updateSubsystems();
@@ -461,6 +613,7 @@ bool MixerImpl::isSoundHandleActive(SoundHandle handle) {
 
 bool MixerImpl::hasActiveChannelOfType(SoundType type) {
 	Common::StackLock lock(_mutex);
+	processQueuedCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++)
 		if (_channels[i] && _channels[i]->getType() == type)
 			return true;
@@ -504,6 +657,7 @@ Channel::Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream,
     : _type(type), _mixer(mixer), _id(id), _permanent(permanent), _volume(Mixer::kMaxChannelVolume),
       _balance(0), _pauseLevel(0), _samplesConsumed(0), _samplesDecoded(0), _mixerTimeStamp(0),
       _pauseStartTime(0), _pauseTime(0), _converter(0), _volL(0), _volR(0),
+      _fadeSamplesLeft(0), _fadeSamplesTotal(0), _fadeStartVolume(0), _fadeTargetVolume(0),
       _stream(stream, autofreeStream) {
 	assert(mixer);
 	assert(stream);
@@ -517,10 +671,28 @@ Channel::~Channel() {
 }
 
 void Channel::setVolume(const byte volume) {
+	// An explicit volume change supersedes any fade in progress
+	_fadeSamplesLeft = 0;
 	_volume = volume;
 	updateChannelVolumes();
 }
 
+void Channel::fadeVolume(const byte volume, const uint32 durationMs) {
+	// Split the multiplication so that long fades at high output rates
+	// cannot overflow the 32 bit sample count.
+	const uint32 rate = _mixer->getOutputRate();
+	_fadeSamplesTotal = (durationMs / 1000) * rate + (durationMs % 1000) * rate / 1000;
+
+	if (_fadeSamplesTotal == 0) {
+		setVolume(volume);
+		return;
+	}
+
+	_fadeSamplesLeft = _fadeSamplesTotal;
+	_fadeStartVolume = _volume;
+	_fadeTargetVolume = volume;
+}
+
 byte Channel::getVolume() {
 	return _volume;
 }
@@ -618,7 +790,38 @@ int Channel::mix(int16 *data, uint len) {
 		_samplesConsumed = _samplesDecoded;
 		_mixerTimeStamp = g_system->getMillis(true);
 		_pauseTime = 0;
-		res = _converter->flow(*_stream, data, len, _volL, _volR);
+
+		if (_fadeSamplesLeft == 0) {
+			res = _converter->flow(*_stream, data, len, _volL, _volR);
+		} else {
+			// A volume fade is active. Mix in small blocks, stepping the
+			// volume along the linear ramp between the blocks, so that the
+			// mixing itself still runs with constant gains.
+			while (len > 0 && !_stream->endOfData()) {
+				uint n = MIN((uint)kFadeChunkSamples, len);
+				if (_fadeSamplesLeft > 0 && _fadeSamplesLeft < n)
+					n = _fadeSamplesLeft;
+
+				if (_fadeSamplesLeft > 0) {
+					if (_fadeSamplesLeft <= n) {
+						// Fade complete; continue at the target volume
+						_fadeSamplesLeft = 0;
+						_volume = _fadeTargetVolume;
+					} else {
+						_fadeSamplesLeft -= n;
+						const uint32 done = _fadeSamplesTotal - _fadeSamplesLeft;
+						_volume = _fadeStartVolume +
+							((int)_fadeTargetVolume - (int)_fadeStartVolume) * (int32)done / (int32)_fadeSamplesTotal;
+					}
+					updateChannelVolumes();
+				}
+
+				res += _converter->flow(*_stream, data, n, _volL, _volR);
+				data += 2 * n;
+				len -= n;
+			}
+		}
+
 		_samplesDecoded += res;
 	}
 
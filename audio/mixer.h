@@ -218,6 +218,22 @@ public:
 	 */
 	virtual byte getChannelVolume(SoundHandle handle) = 0;
 
+	/**
+	 * Fade the channel volume for the given handle to the given value.
+	 *
+	 * The ramp is linear and advanced inside the mix loop, so a fade is a
+	 * single call instead of a timer callback adjusting the volume in
+	 * steps. The channel keeps playing at the target volume once the fade
+	 * has completed. A fade in progress is superseded by a later
+	 * setChannelVolume or fadeChannelVolume call.
+	 *
+	 * @param handle the sound to affect
+	 * @param volume the volume to fade to (0 - kMaxChannelVolume)
+	 * @param fadeDurationMs duration of the fade in milliseconds;
+	 *                       0 acts like setChannelVolume
+	 */
+	virtual void fadeChannelVolume(SoundHandle handle, byte volume, uint32 fadeDurationMs) = 0;
+
 	/**
 	 * Set the channel balance for the given handle.
 	 *
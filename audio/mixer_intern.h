@@ -70,6 +70,59 @@ private:
 	SoundTypeSettings _soundTypeSettings[4];
 	Channel *_channels[NUM_CHANNELS];
 
+	/**
+	 * Queued channel control commands.
+	 *
+	 * Cheap per-handle operations (pause, volume, balance) are not
+	 * applied directly but posted into this wait-free ring buffer and
+	 * consumed under _mutex, by the audio callback or by the next mixer
+	 * call that inspects channel state. That way the frequent control
+	 * calls from the game thread never contend with the audio callback
+	 * on _mutex, which audibly stalls the callback on slow single-core
+	 * systems. Stopping a sound stays synchronous, since callers may
+	 * free the resources backing a stream right after stopHandle()
+	 * returns.
+	 *
+	 * _cmdMutex serializes producers only; it is never taken from the
+	 * audio callback.
+	 */
+	enum {
+		kCommandQueueSize = 64 // must be a power of two
+	};
+
+	enum CommandType {
+		kCmdStopHandle,
+		kCmdPauseHandle,
+		kCmdUnpauseHandle,
+		kCmdSetVolume,
+		kCmdSetBalance,
+		kCmdFadeVolume
+	};
+
+	struct ChannelCommand {
+		byte type;
+		SoundHandle handle;
+		int value;
+	};
+
+	ChannelCommand _commands[kCommandQueueSize];
+	volatile uint32 _cmdRead;
+	volatile uint32 _cmdWrite;
+	Common::Mutex _cmdMutex;
+
+	/**
+	 * Try to post a command into the queue. Returns false if the queue
+	 * is full (or lock-free operation is not supported on this
+	 * platform), in which case the caller falls back to applying the
+	 * command directly under _mutex.
+	 */
+	bool postCommand(byte type, SoundHandle handle, int value);
+
+	// Drain the command queue. Caller must hold _mutex.
+	void processQueuedCommands();
+
+	// Apply a single command. Caller must hold _mutex.
+	void applyCommand(const ChannelCommand &cmd);
 
 public:
 
@@ -105,6 +158,7 @@ public:
 
 	virtual void setChannelVolume(SoundHandle handle, byte volume);
 	virtual byte getChannelVolume(SoundHandle handle);
+	virtual void fadeChannelVolume(SoundHandle handle, byte volume, uint32 fadeDurationMs);
 	virtual void setChannelBalance(SoundHandle handle, int8 balance);
 	virtual int8 getChannelBalance(SoundHandle handle);
 
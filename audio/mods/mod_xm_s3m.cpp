@@ -101,9 +101,14 @@ private:
 	Channel *_channels;
 	int _dataLeft;
 
-	// mix buffer to keep a partially consumed decoded tick.
+	// Persistent mix buffer, reused across readBuffer() calls so the
+	// audio thread does not allocate. Grown on demand when a tempo drop
+	// lengthens the tick. A partially consumed decoded tick is kept in
+	// place and carried over via _mixBufferPos/_mixBufferSamples.
 	int *_mixBuffer;
-	int _mixBufferSamples;	// number of samples kept in _mixBuffer
+	int _mixBufferSize;		// allocated size, in ints
+	int _mixBufferPos;		// start of the partially consumed tick
+	int _mixBufferSamples;	// number of samples left from that tick
 
 	static const int FP_SHIFT;
 	static const int FP_ONE;
@@ -189,6 +194,7 @@ ModXmS3mStream::ModXmS3mStream(Common::SeekableReadStream *stream, int rate, int
 
 	// assign values
 	_loadSuccess = true;
+	_mixBufferPos = 0;
 	_mixBufferSamples = 0;
 	_sampleRate = rate;
 	_interpolation = interpolation;
@@ -196,6 +202,7 @@ ModXmS3mStream::ModXmS3mStream(Common::SeekableReadStream *stream, int rate, int
 	_channels = new Channel[_module.numChannels];
 	_dataLeft = calculateDuration() * 4; // stereo and uint16
 	_mixBuffer = nullptr;
+	_mixBufferSize = 0;
 }
 
 ModXmS3mStream::~ModXmS3mStream() {
@@ -1247,13 +1254,6 @@ void ModXmS3mStream::downsample(int *buf, int count) {
 
 /* Generates audio and returns the number of stereo samples written into mixBuf. */
 int ModXmS3mStream::getAudio(int *mixBuf) {
-	if (_mixBuffer) {
-		memcpy(mixBuf, _mixBuffer, _mixBufferSamples * sizeof(int));
-		delete []_mixBuffer;
-		_mixBuffer = nullptr;
-		return _mixBufferSamples;
-	}
-
 	int tickLen = calculateTickLength();
 	/* Clear output buffer. */
 	memset(mixBuf, 0, (tickLen + 65) * 4 * sizeof(int));
@@ -1272,16 +1272,30 @@ int ModXmS3mStream::getAudio(int *mixBuf) {
 int ModXmS3mStream::readBuffer(int16 *buffer, const int numSamples) {
 	int samplesRead = 0;
 	while (samplesRead < numSamples && _dataLeft >= 0) {
-		int *mixBuf = new int[calculateMixBufLength()];
-		int samples = getAudio(mixBuf);
+		int offset, samples;
+		if (_mixBufferSamples > 0) {
+			// Continue with the leftover of the last decoded tick.
+			offset = _mixBufferPos;
+			samples = _mixBufferSamples;
+			_mixBufferSamples = 0;
+		} else {
+			const int mixBufLen = calculateMixBufLength();
+			if (mixBufLen > _mixBufferSize) {
+				delete[] _mixBuffer;
+				_mixBuffer = new int[mixBufLen];
+				_mixBufferSize = mixBufLen;
+			}
+			offset = 0;
+			samples = getAudio(_mixBuffer);
+		}
 		if (samplesRead + samples > numSamples) {
+			// Keep the unconsumed part of the tick for the next call.
 			_mixBufferSamples = samplesRead + samples - numSamples;
 			samples -= _mixBufferSamples;
-			_mixBuffer = new int[_mixBufferSamples];
-			memcpy(_mixBuffer, mixBuf + samples, _mixBufferSamples * sizeof(int));
+			_mixBufferPos = offset + samples;
 		}
 		for (int idx = 0; idx < samples; ++idx) {
-			int ampl = mixBuf[idx];
+			int ampl = _mixBuffer[offset + idx];
 			if (ampl > 32767) {
 				ampl = 32767;
 			}
@@ -1291,7 +1305,6 @@ int ModXmS3mStream::readBuffer(int16 *buffer, const int numSamples) {
 			*buffer++ = ampl;
 		}
 		samplesRead += samples;
-		delete []mixBuf; // free
 	}
 	_dataLeft -= samplesRead * 2;
 
@@ -57,6 +57,8 @@ void Paula::clearVoice(byte voice) {
 	_voice[voice].volume = 0;
 	_voice[voice].offset = Offset(0);
 	_voice[voice].dmaCount = 0;
+	_voice[voice].cachedPeriod = 0;
+	_voice[voice].cachedStep = 0;
 }
 
 int Paula::readBuffer(int16 *buffer, const int numSamples) {
@@ -76,21 +78,36 @@ int Paula::readBuffer(int16 *buffer, const int numSamples) {
 
 template<bool stereo>
 inline int mixBuffer(int16 *&buf, const int8 *data, Paula::Offset &offset, frac_t rate, int neededSamples, uint bufSize, byte volume, byte panning) {
-	int samples;
-	for (samples = 0; samples < neededSamples && offset.int_off < bufSize; ++samples) {
-		const int32 tmp = ((int32) data[offset.int_off]) * volume;
+	// Compute up front how many samples can be generated before the offset
+	// runs past the end of the channel data, so that the mixing loop below
+	// does not have to check the position on every sample. The shift can
+	// not overflow since setChannelSampleLen() limits lengths to 32k.
+	int samples = neededSamples;
+	if (offset.int_off >= bufSize) {
+		samples = 0;
+	} else if (rate > 0) {
+		const uint32 fracLeft = ((bufSize - offset.int_off) << FRAC_BITS) - offset.rem_off;
+		const uint32 samplesLeft = (fracLeft + rate - 1) / rate;
+		if ((uint32)samples > samplesLeft)
+			samples = samplesLeft;
+	}
+
+	// Fold the volume and panning scales into one gain per output channel
+	const int32 leftGain = stereo ? volume * (255 - panning) : 0;
+	const int32 rightGain = stereo ? volume * panning : 0;
+
+	for (int i = 0; i < samples; ++i) {
+		const int32 tmp = data[offset.int_off];
 		if (stereo) {
-			*buf++ += (tmp * (255 - panning)) >> 7;
-			*buf++ += (tmp * (panning)) >> 7;
+			*buf++ += (tmp * leftGain) >> 7;
+			*buf++ += (tmp * rightGain) >> 7;
 		} else
-			*buf++ += tmp;
+			*buf++ += tmp * volume;
 
 		// Step to next source sample
 		offset.rem_off += rate;
-		if (offset.rem_off >= (frac_t)FRAC_ONE) {
-			offset.int_off += fracToInt(offset.rem_off);
-			offset.rem_off &= FRAC_LO_MASK;
-		}
+		offset.int_off += fracToInt(offset.rem_off);
+		offset.rem_off &= FRAC_LO_MASK;
 	}
 
 	return samples;
@@ -123,8 +140,13 @@ int Paula::readBufferIntern(int16 *buffer, const int numSamples) {
 			// by the requested the requested output sampling rate _rate
 			// (typically 44.1 kHz or 22.05 kHz) obtaining the value _periodScale.
 			// This is then divided by the "period" of the channel we are
-			// processing, to obtain the correct output 'rate'.
-			frac_t rate = doubleToFrac(_periodScale / _voice[voice].period);
+			// processing, to obtain the correct output 'rate'. The division
+			// is floating point, so only redo it when the period changed.
+			if (_voice[voice].period != _voice[voice].cachedPeriod) {
+				_voice[voice].cachedPeriod = _voice[voice].period;
+				_voice[voice].cachedStep = doubleToFrac(_periodScale / _voice[voice].period);
+			}
+			frac_t rate = _voice[voice].cachedStep;
 			// Cap the volume
 			_voice[voice].volume = MIN((byte) 0x40, _voice[voice].volume);
 
@@ -91,6 +91,11 @@ protected:
 		Offset offset;
 		byte panning; // For stereo mixing: 0 = far left, 255 = far right
 		int dmaCount;
+
+		// The period converted to an output sample step, cached so the
+		// (floating point) conversion only happens when the period changes
+		int16 cachedPeriod;
+		frac_t cachedStep;
 	};
 
 	bool _end;
@@ -129,6 +129,11 @@ int MidiDriver_FluidSynth::open() {
 	setNum("synth.gain", gain);
 	setNum("synth.sample-rate", _outputRate);
 
+	// Cap the number of simultaneous voices. Large General MIDI soundfonts
+	// layer several samples per note, so dense scores can otherwise push the
+	// synth past what slower CPUs manage in real time.
+	setInt("synth.polyphony", ConfMan.getInt("fluidsynth_misc_polyphony"));
+
 	_synth = new_fluid_synth(_settings);
 
 	if (ConfMan.getBool("fluidsynth_chorus_activate")) {
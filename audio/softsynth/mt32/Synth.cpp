@@ -483,23 +483,38 @@ bool Synth::loadPCMROM(const ROMImage &pcmROMImage) {
 		return false;
 	}
 	const Bit8u *fileData = file->getData();
-	for (size_t i = 0; i < pcmROMSize; i++) {
-		Bit8u s = *(fileData++);
-		Bit8u c = *(fileData++);
 
-		int order[16] = {0, 9, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 8};
-
-		Bit16s log = 0;
+	// The ROM stores the bits of each 16-bit sample shuffled across its two
+	// bytes as given by the order table. Since every output bit depends on a
+	// bit of either the first byte or the second byte (never both), the
+	// permutation splits into two 256-entry lookup tables whose entries are
+	// simply ORed together. This avoids running the per-bit reordering loop
+	// for each of the 512K samples, which was a measurable part of the synth
+	// startup time.
+	static const int order[16] = {0, 9, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 8};
+	Bit16s sTable[256];
+	Bit16s cTable[256];
+	for (int b = 0; b < 256; b++) {
+		Bit16s sLog = 0;
+		Bit16s cLog = 0;
 		for (int u = 0; u < 15; u++) {
 			int bit;
 			if (order[u] < 8) {
-				bit = (s >> (7 - order[u])) & 0x1;
+				bit = (b >> (7 - order[u])) & 0x1;
+				sLog = sLog | Bit16s(bit << (15 - u));
 			} else {
-				bit = (c >> (7 - (order[u] - 8))) & 0x1;
+				bit = (b >> (7 - (order[u] - 8))) & 0x1;
+				cLog = cLog | Bit16s(bit << (15 - u));
 			}
-			log = log | Bit16s(bit << (15 - u));
 		}
-		pcmROMData[i] = log;
+		sTable[b] = sLog;
+		cTable[b] = cLog;
+	}
+
+	for (size_t i = 0; i < pcmROMSize; i++) {
+		Bit8u s = *(fileData++);
+		Bit8u c = *(fileData++);
+		pcmROMData[i] = sTable[s] | cTable[c];
 	}
 	return true;
 }
@@ -1055,6 +1055,21 @@ void YM3812UpdateOne(FM_OPL *OPL, int16 *buffer, int length) {
 		vib_table = OPL->vib_table;
 	}
 	R_CH = rythm ? &S_CH[6] : E_CH;
+
+	/* Collect the channels that can still produce output. A channel is
+	   silent once both operators' envelopes have run off and the feedback
+	   history is flushed; nothing can reactivate it within this block
+	   (key-on only happens through OPLWriteReg), so the check can be
+	   hoisted out of the sample loop below. */
+	OPL_CH *A_CH[9];
+	int numActive = 0;
+	for (CH = S_CH; CH < R_CH; CH++) {
+		if (CH->SLOT[SLOT1].evs || CH->SLOT[SLOT1].evc < EG_OFF ||
+		    CH->SLOT[SLOT2].evs || CH->SLOT[SLOT2].evc < EG_OFF ||
+		    CH->op1_out[0] || CH->op1_out[1])
+			A_CH[numActive++] = CH;
+	}
+
 	for (i = 0; i < length; i++) {
 		/*            channel A         channel B         channel C      */
 		/* LFO */
@@ -1062,8 +1077,8 @@ void YM3812UpdateOne(FM_OPL *OPL, int16 *buffer, int length) {
 		vib = vib_table[(vibCnt += vibIncr) >> VIB_SHIFT];
 		outd[0] = 0;
 		/* FM part */
-		for (CH = S_CH; CH < R_CH; CH++)
-			OPL_CALC_CH(CH);
+		for (int c = 0; c < numActive; c++)
+			OPL_CALC_CH(A_CH[c]);
 		/* Rythn part */
 		if (rythm)
 			OPL_CALC_RH(OPL, S_CH);
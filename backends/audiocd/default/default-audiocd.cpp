@@ -24,6 +24,7 @@
 #include "audio/audiostream.h"
 #include "common/config-manager.h"
 #include "common/system.h"
+#include "common/textconsole.h"
 
 DefaultAudioCDManager::DefaultAudioCDManager() {
 	_cd.playing = false;
@@ -35,6 +36,8 @@ DefaultAudioCDManager::DefaultAudioCDManager() {
 	_cd.balance = 0;
 	_mixer = g_system->getMixer();
 	_emulating = false;
+	_trackStream = 0;
+	_trackStreamNr = -1;
 	assert(_mixer);
 }
 
@@ -52,6 +55,10 @@ bool DefaultAudioCDManager::open() {
 void DefaultAudioCDManager::close() {
 	// Only need to stop for emulation
 	stop();
+
+	delete _trackStream;
+	_trackStream = 0;
+	_trackStreamNr = -1;
 }
 
 bool DefaultAudioCDManager::play(int track, int numLoops, int startFrame, int duration, bool onlyEmulate) {
@@ -65,27 +72,61 @@ bool DefaultAudioCDManager::play(int track, int numLoops, int startFrame, int du
 
 		// Try to load the track from a compressed data file, and if found, use
 		// that. If not found, attempt to start regular Audio CD playback of
-		// the requested track.
-		char trackName[2][16];
-		sprintf(trackName[0], "track%d", track);
-		sprintf(trackName[1], "track%02d", track);
+		// the requested track. When the same track is played again (engines
+		// like SCUMM restart the current track for every speech segment), the
+		// decoder from the previous play call is reused instead.
 		Audio::SeekableAudioStream *stream = 0;
 
-		for (int i = 0; !stream && i < 2; ++i)
-			stream = Audio::SeekableAudioStream::openStreamFile(trackName[i]);
+		if (track == _trackStreamNr) {
+			stream = _trackStream;
+		} else {
+			char trackName[2][16];
+			sprintf(trackName[0], "track%d", track);
+			sprintf(trackName[1], "track%02d", track);
+
+			for (int i = 0; !stream && i < 2; ++i)
+				stream = Audio::SeekableAudioStream::openStreamFile(trackName[i]);
+
+			delete _trackStream;
+			_trackStream = stream;
+			_trackStreamNr = stream ? track : -1;
+		}
 
 		if (stream != 0) {
 			Audio::Timestamp start = Audio::Timestamp(0, startFrame, 75);
 			Audio::Timestamp end = duration ? Audio::Timestamp(0, startFrame + duration, 75) : stream->getLength();
 
+			if (start >= end) {
+				warning("DefaultAudioCDManager::play: start (%d) >= end (%d)", start.msecs(), end.msecs());
+				return false;
+			}
+
 			/*
 			FIXME: Seems numLoops == 0 and numLoops == 1 both indicate a single repetition,
 			while all other positive numbers indicate precisely the number of desired
 			repetitions. Finally, -1 means infinitely many
 			*/
+			uint loops = (numLoops < 1) ? numLoops + 1 : numLoops;
+
+			// The mixer disposes the stream it is given when playback ends,
+			// so wrap the cached decoder in wrappers which do not take
+			// ownership of it.
+			Audio::AudioStream *playStream;
+			if (startFrame == 0 && duration == 0)
+				playStream = new Audio::LoopingAudioStream(stream, loops, DisposeAfterUse::NO);
+			else
+				playStream = new Audio::LoopingAudioStream(new Audio::SubSeekableAudioStream(stream, start, end, DisposeAfterUse::NO), loops, DisposeAfterUse::YES);
+
+			// Decode the compressed track ahead of the audio callback, so
+			// that a slow frame decode or a disk seek in the MP3/Vorbis/FLAC
+			// decoder cannot stall the callback. Half a second of buffer is
+			// plenty to ride out either.
+			playStream = Audio::makeAsyncBufferedAudioStream(playStream,
+					(playStream->getRate() * (playStream->isStereo() ? 2 : 1)) / 2);
+
 			_emulating = true;
 			_mixer->playStream(Audio::Mixer::kMusicSoundType, &_handle,
-			                        Audio::makeLoopingAudioStream(stream, start, end, (numLoops < 1) ? numLoops + 1 : numLoops), -1, _cd.volume, _cd.balance);
+			                        playStream, -1, _cd.volume, _cd.balance);
 			return true;
 		}
 	}
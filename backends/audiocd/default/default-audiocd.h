@@ -26,6 +26,10 @@
 #include "backends/audiocd/audiocd.h"
 #include "audio/mixer.h"
 
+namespace Audio {
+class SeekableAudioStream;
+} // End of namespace Audio
+
 namespace Common {
 class String;
 } // End of namespace Common
@@ -73,6 +77,15 @@ protected:
 
 	Status _cd;
 	Audio::Mixer *_mixer;
+
+private:
+	/**
+	 * The decoder of the most recently played track, kept across play calls
+	 * so that restarting the same track (e.g. for each speech segment in the
+	 * Loom talkie) does not locate and reopen the track file every time.
+	 */
+	Audio::SeekableAudioStream *_trackStream;
+	int _trackStreamNr;	///< Track number _trackStream belongs to, or -1
 };
 
 #endif
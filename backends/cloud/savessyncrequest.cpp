@@ -42,18 +42,28 @@ SavesSyncRequest::SavesSyncRequest(Storage *storage, Storage::BoolCallback callb
 
 SavesSyncRequest::~SavesSyncRequest() {
 	_ignoreCallback = true;
-	if (_workingRequest)
-		_workingRequest->finish();
+	finishActiveRequests();
 	delete _boolCallback;
 }
 
+void SavesSyncRequest::finishActiveRequests() {
+	//caller sets _ignoreCallback, so finish() does not trigger our callbacks
+	if (_workingRequest) {
+		_workingRequest->finish();
+		_workingRequest = nullptr;
+	}
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i)
+		_activeDownloads[i].request->finish();
+	_activeDownloads.clear();
+	for (uint32 i = 0; i < _activeUploads.size(); ++i)
+		_activeUploads[i].request->finish();
+	_activeUploads.clear();
+}
+
 void SavesSyncRequest::start() {
 	//cleanup
 	_ignoreCallback = true;
-	if (_workingRequest)
-		_workingRequest->finish();
-	_currentDownloadingFile = StorageFile();
-	_currentUploadingFile = "";
+	finishActiveRequests();
 	_filesToDownload.clear();
 	_filesToUpload.clear();
 	_localFilesTimestamps.clear();
@@ -137,7 +147,7 @@ void SavesSyncRequest::directoryListedCallback(Storage::ListDirectoryResponse re
 	_totalFilesToHandle = _filesToDownload.size() + _filesToUpload.size();
 
 	//start downloading files
-	downloadNextFile();
+	downloadNextFiles();
 }
 
 void SavesSyncRequest::directoryListedErrorCallback(Networking::ErrorResponse error) {
@@ -226,108 +236,168 @@ void SavesSyncRequest::directoryCreatedErrorCallback(Networking::ErrorResponse e
 	finishError(error);
 }
 
-void SavesSyncRequest::downloadNextFile() {
-	if (_filesToDownload.empty()) {
-		_currentDownloadingFile = StorageFile("", 0, 0, false); //so getFilesToDownload() would return an empty array
-		sendCommand(GUI::kSavesSyncEndedCmd, 0);
-		uploadNextFile();
-		return;
-	}
+void SavesSyncRequest::downloadNextFiles() {
+	//top up the transfer slots from the queue
+	while (!_filesToDownload.empty() && _activeDownloads.size() < kMaxConcurrentTransfers) {
+		ActiveDownload transfer;
+		transfer.file = _filesToDownload.back();
+		_filesToDownload.pop_back();
+
+		debug(9, "SavesSyncRequest: downloading %s (%d %%)", transfer.file.name().c_str(), (int)(getProgress() * 100));
+		transfer.request = _storage->downloadById(
+			transfer.file.id(),
+			DefaultSaveFileManager::concatWithSavesPath(transfer.file.name()),
+			new Common::Callback<SavesSyncRequest, Storage::BoolResponse>(this, &SavesSyncRequest::fileDownloadedCallback),
+			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileDownloadedErrorCallback)
+		);
+		if (!transfer.request) {
+			finishError(Networking::ErrorResponse(this));
+			return;
+		}
+		if (_state == Networking::FINISHED)
+			return; //a Request above failed synchronously and finished us
 
-	_currentDownloadingFile = _filesToDownload.back();
-	_filesToDownload.pop_back();
+		_activeDownloads.push_back(transfer);
+	}
 
 	sendCommand(GUI::kSavesSyncProgressCmd, (int)(getDownloadingProgress() * 100));
 
-	debug(9, "SavesSyncRequest: downloading %s (%d %%)", _currentDownloadingFile.name().c_str(), (int)(getProgress() * 100));
-	_workingRequest = _storage->downloadById(
-		_currentDownloadingFile.id(),
-		DefaultSaveFileManager::concatWithSavesPath(_currentDownloadingFile.name()),
-		new Common::Callback<SavesSyncRequest, Storage::BoolResponse>(this, &SavesSyncRequest::fileDownloadedCallback),
-		new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileDownloadedErrorCallback)
-	);
-	if (!_workingRequest)
-		finishError(Networking::ErrorResponse(this));
+	if (_filesToDownload.empty() && _activeDownloads.empty()) {
+		//all downloads complete (or there were none) - saves are safe to use now
+		sendCommand(GUI::kSavesSyncEndedCmd, 0);
+		uploadNextFiles();
+	}
 }
 
 void SavesSyncRequest::fileDownloadedCallback(Storage::BoolResponse response) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	//find the transfer this Request belonged to
+	StorageFile file;
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i) {
+		if (_activeDownloads[i].request == response.request) {
+			file = _activeDownloads[i].file;
+			_activeDownloads.remove_at(i);
+			break;
+		}
+	}
+
 	//stop syncing if download failed
 	if (!response.value) {
 		//delete the incomplete file
-		g_system->getSavefileManager()->removeSavefile(_currentDownloadingFile.name());
+		if (file.name() != "")
+			g_system->getSavefileManager()->removeSavefile(file.name());
 		finishError(Networking::ErrorResponse(this, false, true, "", -1));
 		return;
 	}
 
 	//update local timestamp for downloaded file
 	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
-	_localFilesTimestamps[_currentDownloadingFile.name()] = _currentDownloadingFile.timestamp();
+	_localFilesTimestamps[file.name()] = file.timestamp();
 	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
 
 	//continue downloading files
-	downloadNextFile();
+	downloadNextFiles();
 }
 
 void SavesSyncRequest::fileDownloadedErrorCallback(Networking::ErrorResponse error) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	//find the transfer this Request belonged to
+	StorageFile file;
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i) {
+		if (_activeDownloads[i].request == error.request) {
+			file = _activeDownloads[i].file;
+			_activeDownloads.remove_at(i);
+			break;
+		}
+	}
+
+	//delete the incomplete file (finishError() only sweeps the transfers
+	//which are still listed in _activeDownloads)
+	if (file.name() != "")
+		g_system->getSavefileManager()->removeSavefile(file.name());
+
 	//stop syncing if download failed
 	finishError(error);
 }
 
-void SavesSyncRequest::uploadNextFile() {
-	if (_filesToUpload.empty()) {
+void SavesSyncRequest::uploadNextFiles() {
+	if (_filesToUpload.empty() && _activeUploads.empty()) {
 		finishSync(true);
 		return;
 	}
 
-	_currentUploadingFile = _filesToUpload.back();
-	_filesToUpload.pop_back();
+	while (!_filesToUpload.empty() && _activeUploads.size() < kMaxConcurrentTransfers) {
+		ActiveUpload transfer;
+		transfer.name = _filesToUpload.back();
+		_filesToUpload.pop_back();
+
+		debug(9, "SavesSyncRequest: uploading %s (%d %%)", transfer.name.c_str(), (int)(getProgress() * 100));
+		if (_storage->uploadStreamSupported()) {
+			transfer.request = _storage->upload(
+				_storage->savesDirectoryPath() + transfer.name,
+				g_system->getSavefileManager()->openRawFile(transfer.name),
+				new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
+				new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
+			);
+		} else {
+			transfer.request = _storage->upload(
+				_storage->savesDirectoryPath() + transfer.name,
+				DefaultSaveFileManager::concatWithSavesPath(transfer.name),
+				new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
+				new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
+			);
+		}
+		if (!transfer.request) {
+			finishError(Networking::ErrorResponse(this));
+			return;
+		}
+		if (_state == Networking::FINISHED)
+			return; //a Request above failed synchronously and finished us
 
-	debug(9, "SavesSyncRequest: uploading %s (%d %%)", _currentUploadingFile.c_str(), (int)(getProgress() * 100));
-	if (_storage->uploadStreamSupported()) {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			g_system->getSavefileManager()->openRawFile(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
-		);
-	} else {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			DefaultSaveFileManager::concatWithSavesPath(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback)
-		);
+		_activeUploads.push_back(transfer);
 	}
-	if (!_workingRequest) finishError(Networking::ErrorResponse(this));
 }
 
 void SavesSyncRequest::fileUploadedCallback(Storage::UploadResponse response) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	//find the transfer this Request belonged to
+	Common::String name;
+	for (uint32 i = 0; i < _activeUploads.size(); ++i) {
+		if (_activeUploads[i].request == response.request) {
+			name = _activeUploads[i].name;
+			_activeUploads.remove_at(i);
+			break;
+		}
+	}
+
 	//update local timestamp for the uploaded file
-	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
-	_localFilesTimestamps[_currentUploadingFile] = response.value.timestamp();
-	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
+	if (name != "") {
+		_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
+		_localFilesTimestamps[name] = response.value.timestamp();
+		DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
+	}
 
 	//continue uploading files
-	uploadNextFile();
+	uploadNextFiles();
 }
 
 void SavesSyncRequest::fileUploadedErrorCallback(Networking::ErrorResponse error) {
-	_workingRequest = nullptr;
 	if (_ignoreCallback)
 		return;
 
+	for (uint32 i = 0; i < _activeUploads.size(); ++i) {
+		if (_activeUploads[i].request == error.request) {
+			_activeUploads.remove_at(i);
+			break;
+		}
+	}
+
 	//stop syncing if upload failed
 	finishError(error);
 }
@@ -343,11 +413,11 @@ double SavesSyncRequest::getDownloadingProgress() const {
 		return 0; //directory not listed yet
 	}
 
-	if (_totalFilesToHandle == _filesToUpload.size())
+	if (_totalFilesToHandle == _filesToUpload.size() + _activeUploads.size())
 		return 1; //nothing to download => download complete
 
-	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size();
-	uint32 filesLeftToDownload = _filesToDownload.size() + (_currentDownloadingFile.name() != "" ? 1 : 0);
+	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size() - _activeUploads.size();
+	uint32 filesLeftToDownload = _filesToDownload.size() + _activeDownloads.size();
 	return (double)(totalFilesToDownload - filesLeftToDownload) / (double)(totalFilesToDownload);
 }
 
@@ -358,35 +428,35 @@ double SavesSyncRequest::getProgress() const {
 		return 0; //directory not listed yet
 	}
 
-	return (double)(_totalFilesToHandle - _filesToDownload.size() - _filesToUpload.size()) / (double)(_totalFilesToHandle);
+	return (double)(_totalFilesToHandle - _filesToDownload.size() - _activeDownloads.size() - _filesToUpload.size() - _activeUploads.size()) / (double)(_totalFilesToHandle);
 }
 
 Common::Array<Common::String> SavesSyncRequest::getFilesToDownload() {
 	Common::Array<Common::String> result;
 	for (uint32 i = 0; i < _filesToDownload.size(); ++i)
 		result.push_back(_filesToDownload[i].name());
-	if (_currentDownloadingFile.name() != "")
-		result.push_back(_currentDownloadingFile.name());
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i)
+		result.push_back(_activeDownloads[i].file.name());
 	return result;
 }
 
 void SavesSyncRequest::finishError(Networking::ErrorResponse error) {
 	debug(9, "SavesSync::finishError");
-	//if we were downloading a file - remember the name
-	//and make the Request close() it, so we can delete it
-	Common::String name = _currentDownloadingFile.name();
-	if (_workingRequest) {
-		_ignoreCallback = true;
-		_workingRequest->finish();
-		_workingRequest = nullptr;
-		_ignoreCallback = false;
-	}
+	//if we were downloading files - remember their names
+	//and make the Requests close() them, so we can delete them
+	Common::Array<Common::String> incompleteFiles;
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i)
+		incompleteFiles.push_back(_activeDownloads[i].file.name());
+
+	_ignoreCallback = true;
+	finishActiveRequests();
+	_ignoreCallback = false;
+
 	//unlock all the files by making getFilesToDownload() return empty array
-	_currentDownloadingFile = StorageFile();
 	_filesToDownload.clear();
-	//delete the incomplete file
-	if (name != "")
-		g_system->getSavefileManager()->removeSavefile(name);
+	//delete the incomplete files
+	for (uint32 i = 0; i < incompleteFiles.size(); ++i)
+		g_system->getSavefileManager()->removeSavefile(incompleteFiles[i]);
 	Request::finishError(error);
 }
 
@@ -32,13 +32,28 @@
 namespace Cloud {
 
 class SavesSyncRequest: public Networking::Request, public GUI::CommandSender {
+	/** Files transferred at the same time. Higher values saturate the
+	 *  uplink better when syncing many small slots, but each transfer
+	 *  is a separate HTTP request, so keep it modest. */
+	enum { kMaxConcurrentTransfers = 4 };
+
+	/** A download/upload Request which is still in flight. */
+	struct ActiveDownload {
+		Request *request;
+		StorageFile file;
+	};
+	struct ActiveUpload {
+		Request *request;
+		Common::String name;
+	};
+
 	Storage *_storage;
 	Storage::BoolCallback _boolCallback;
 	Common::HashMap<Common::String, uint32> _localFilesTimestamps;
 	Common::Array<StorageFile> _filesToDownload;
 	Common::Array<Common::String> _filesToUpload;
-	StorageFile _currentDownloadingFile;
-	Common::String _currentUploadingFile;
+	Common::Array<ActiveDownload> _activeDownloads;
+	Common::Array<ActiveUpload> _activeUploads;
 	Request *_workingRequest;
 	bool _ignoreCallback;
 	uint32 _totalFilesToHandle;
@@ -53,8 +68,9 @@ class SavesSyncRequest: public Networking::Request, public GUI::CommandSender {
 	void fileDownloadedErrorCallback(Networking::ErrorResponse error);
 	void fileUploadedCallback(Storage::UploadResponse response);
 	void fileUploadedErrorCallback(Networking::ErrorResponse error);
-	void downloadNextFile();
-	void uploadNextFile();
+	void downloadNextFiles();
+	void uploadNextFiles();
+	void finishActiveRequests();
 	virtual void finishError(Networking::ErrorResponse error);
 	void finishSync(bool success);
 
@@ -183,6 +183,20 @@ public:
 	 */
 	virtual Common::SeekableReadStream *createReadStream() = 0;
 
+	/**
+	 * Creates a SeekableReadStream instance mapping the file referred by
+	 * this node directly into memory, if the backend supports it. Reads
+	 * from the returned stream then do not copy any data around; seeking
+	 * is a simple pointer adjustment.
+	 *
+	 * The default implementation simply falls back to the regular buffered
+	 * stream returned by createReadStream(), so callers may treat this as
+	 * a hint and need not special-case backends without mapping support.
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual Common::SeekableReadStream *createMemoryMappedStream() { return createReadStream(); }
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
@@ -33,6 +33,9 @@
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/stdiostream.h"
 #include "common/algorithm.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/memstream.h"
 
 #include <sys/param.h>
 #include <sys/stat.h>
@@ -45,6 +48,15 @@
 #include <stdio.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <time.h>
+
+#ifdef POSIX
+#include <pthread.h>
+#endif
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#include <sys/mman.h>
+#endif
 
 #ifdef __OS2__
 #define INCL_DOS
@@ -52,6 +64,124 @@
 #endif
 
 
+namespace {
+
+/**
+ * A process-lifetime cache of directory listings. Game detection and
+ * SearchMan walk the same directory trees over and over, and each walk
+ * used to re-read the directory and re-stat its entries. A cached
+ * listing is only served while the directory's mtime is unchanged, so
+ * external modifications are picked up on the next call.
+ *
+ * The cache is guarded by a raw pthread mutex: Common::Mutex cannot be
+ * used here, since directories are already listed (e.g. for the theme
+ * files) before the backend's mutex manager exists, while the cloud
+ * code lists the saves directory from the timer thread later on.
+ */
+class DirectoryCache {
+public:
+	struct Entry {
+		Common::String name;
+		bool isDirectory;
+	};
+
+	typedef Common::Array<Entry> EntryList;
+
+	/**
+	 * A directory modification timestamp at the finest granularity the
+	 * system provides. Plain st_mtime only resolves whole seconds, which
+	 * would let a modification in the same second as a cached listing go
+	 * unnoticed forever.
+	 */
+	struct Timestamp {
+		time_t sec;
+		long nsec;
+
+		Timestamp() : sec(0), nsec(0) {}
+
+		explicit Timestamp(const struct stat &st) {
+			sec = st.st_mtime;
+#if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200809L
+			nsec = st.st_mtim.tv_nsec;
+#else
+			nsec = 0;
+#endif
+		}
+
+		bool operator==(const Timestamp &other) const {
+			return sec == other.sec && nsec == other.nsec;
+		}
+	};
+
+	DirectoryCache() {
+#ifdef POSIX
+		pthread_mutex_init(&_mutex, NULL);
+#endif
+	}
+
+	bool lookup(const Common::String &path, const Timestamp &mtime, EntryList &entries) {
+		lock();
+		CacheMap::iterator it = _cache.find(path);
+		bool found = (it != _cache.end() && it->_value.mtime == mtime);
+		if (found)
+			entries = it->_value.entries;
+		unlock();
+		return found;
+	}
+
+	void store(const Common::String &path, const Timestamp &mtime, const EntryList &entries) {
+		// On filesystems with one-second timestamp resolution, a directory
+		// modified again within the mtime's second keeps the same stamp,
+		// which would alias the cached listing. Don't cache a listing
+		// until its mtime second has passed.
+		if (mtime.sec >= time(NULL))
+			return;
+
+		lock();
+		// Keep the cache from growing without bound on huge collections.
+		if (_cache.size() >= kMaxCachedDirectories)
+			_cache.clear();
+		CachedListing &listing = _cache[path];
+		listing.mtime = mtime;
+		listing.entries = entries;
+		unlock();
+	}
+
+private:
+	enum { kMaxCachedDirectories = 1024 };
+
+	struct CachedListing {
+		Timestamp mtime;
+		EntryList entries;
+	};
+
+	typedef Common::HashMap<Common::String, CachedListing> CacheMap;
+
+	void lock() {
+#ifdef POSIX
+		pthread_mutex_lock(&_mutex);
+#endif
+	}
+
+	void unlock() {
+#ifdef POSIX
+		pthread_mutex_unlock(&_mutex);
+#endif
+	}
+
+	CacheMap _cache;
+#ifdef POSIX
+	pthread_mutex_t _mutex;
+#endif
+};
+
+DirectoryCache &dirCache() {
+	static DirectoryCache cache;
+	return cache;
+}
+
+} // End of anonymous namespace
+
 void POSIXFilesystemNode::setFlags() {
 	struct stat st;
 
@@ -153,70 +283,103 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 	}
 #endif
 
-	DIR *dirp = opendir(_path.c_str());
-	struct dirent *dp;
-
-	if (dirp == NULL)
+	struct stat dirst;
+	if (stat(_path.c_str(), &dirst) != 0)
 		return false;
 
-	// loop over dir entries using readdir
-	while ((dp = readdir(dirp)) != NULL) {
-		// Skip 'invisible' files if necessary
-		if (dp->d_name[0] == '.' && !hidden) {
-			continue;
-		}
-		// Skip '.' and '..' to avoid cycles
-		if ((dp->d_name[0] == '.' && dp->d_name[1] == 0) || (dp->d_name[0] == '.' && dp->d_name[1] == '.')) {
-			continue;
-		}
+	const DirectoryCache::Timestamp dirMTime(dirst);
 
-		// Start with a clone of this node, with the correct path set
-		POSIXFilesystemNode entry(*this);
-		entry._displayName = dp->d_name;
-		if (_path.lastChar() != '/')
-			entry._path += '/';
-		entry._path += entry._displayName;
+	DirectoryCache::EntryList entries;
+	if (!dirCache().lookup(_path, dirMTime, entries)) {
+		DIR *dirp = opendir(_path.c_str());
+		struct dirent *dp;
+
+		if (dirp == NULL)
+			return false;
+
+		// loop over dir entries using readdir
+		while ((dp = readdir(dirp)) != NULL) {
+			// Skip '.' and '..' to avoid cycles
+			if ((dp->d_name[0] == '.' && dp->d_name[1] == 0) || (dp->d_name[0] == '.' && dp->d_name[1] == '.')) {
+				continue;
+			}
+
+			Common::String childPath(_path);
+			if (childPath.lastChar() != '/')
+				childPath += '/';
+			childPath += dp->d_name;
+
+			bool isValid, isDirectory;
 
 #if defined(SYSTEM_NOT_SUPPORTING_D_TYPE)
-		/* TODO: d_type is not part of POSIX, so it might not be supported
-		 * on some of our targets. For those systems where it isn't supported,
-		 * add this #elif case, which tries to use stat() instead.
-		 *
-		 * The d_type method is used to avoid costly recurrent stat() calls in big
-		 * directories.
-		 */
-		entry.setFlags();
+			/* TODO: d_type is not part of POSIX, so it might not be supported
+			 * on some of our targets. For those systems where it isn't supported,
+			 * add this #elif case, which tries to use stat() instead.
+			 *
+			 * The d_type method is used to avoid costly recurrent stat() calls in big
+			 * directories.
+			 */
+			struct stat st;
+			isValid = (stat(childPath.c_str(), &st) == 0);
+			isDirectory = isValid ? S_ISDIR(st.st_mode) : false;
 #else
-		if (dp->d_type == DT_UNKNOWN) {
-			// Fall back to stat()
-			entry.setFlags();
-		} else {
-			entry._isValid = (dp->d_type == DT_DIR) || (dp->d_type == DT_REG) || (dp->d_type == DT_LNK);
-			if (dp->d_type == DT_LNK) {
+			if (dp->d_type == DT_UNKNOWN) {
+				// Fall back to stat()
 				struct stat st;
-				if (stat(entry._path.c_str(), &st) == 0)
-					entry._isDirectory = S_ISDIR(st.st_mode);
-				else
-					entry._isDirectory = false;
+				isValid = (stat(childPath.c_str(), &st) == 0);
+				isDirectory = isValid ? S_ISDIR(st.st_mode) : false;
 			} else {
-				entry._isDirectory = (dp->d_type == DT_DIR);
+				isValid = (dp->d_type == DT_DIR) || (dp->d_type == DT_REG) || (dp->d_type == DT_LNK);
+				if (dp->d_type == DT_LNK) {
+					struct stat st;
+					if (stat(childPath.c_str(), &st) == 0)
+						isDirectory = S_ISDIR(st.st_mode);
+					else
+						isDirectory = false;
+				} else {
+					isDirectory = (dp->d_type == DT_DIR);
+				}
 			}
-		}
 #endif
 
-		// Skip files that are invalid for some reason (e.g. because we couldn't
-		// properly stat them).
-		if (!entry._isValid)
+			// Skip files that are invalid for some reason (e.g. because we couldn't
+			// properly stat them).
+			if (!isValid)
+				continue;
+
+			DirectoryCache::Entry cacheEntry;
+			cacheEntry.name = dp->d_name;
+			cacheEntry.isDirectory = isDirectory;
+			entries.push_back(cacheEntry);
+		}
+		closedir(dirp);
+
+		// The cache keeps every visible and hidden entry; the hidden and
+		// mode filters are applied below when the list is served.
+		dirCache().store(_path, dirMTime, entries);
+	}
+
+	for (DirectoryCache::EntryList::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+		// Skip 'invisible' files if necessary
+		if (i->name.firstChar() == '.' && !hidden)
 			continue;
 
 		// Honor the chosen mode
-		if ((mode == Common::FSNode::kListFilesOnly && entry._isDirectory) ||
-			(mode == Common::FSNode::kListDirectoriesOnly && !entry._isDirectory))
+		if ((mode == Common::FSNode::kListFilesOnly && i->isDirectory) ||
+			(mode == Common::FSNode::kListDirectoriesOnly && !i->isDirectory))
 			continue;
 
+		// Start with a clone of this node, with the correct path set
+		POSIXFilesystemNode entry(*this);
+		entry._displayName = i->name;
+		if (_path.lastChar() != '/')
+			entry._path += '/';
+		entry._path += entry._displayName;
+		entry._isValid = true;
+		entry._isDirectory = i->isDirectory;
+
 		myList.push_back(new POSIXFilesystemNode(entry));
 	}
-	closedir(dirp);
 
 	return true;
 }
@@ -254,6 +417,57 @@ Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
 	return StdioStream::makeFromPath(getPath(), false);
 }
 
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+namespace {
+
+/**
+ * A read stream backed by a read-only memory mapping of a file. The data
+ * itself lives in the operating system's page cache; all we own is the
+ * mapping, which is torn down again when the stream is destroyed.
+ */
+class MemoryMappedPosixStream : public Common::MemoryReadStream {
+public:
+	MemoryMappedPosixStream(void *map, uint32 size)
+		: Common::MemoryReadStream((const byte *)map, size), _map(map), _mapSize(size) {}
+
+	~MemoryMappedPosixStream() {
+		munmap(_map, _mapSize);
+	}
+
+private:
+	void *_map;
+	size_t _mapSize;
+};
+
+} // End of anonymous namespace
+#endif
+
+Common::SeekableReadStream *POSIXFilesystemNode::createMemoryMappedStream() {
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+	int fd = open(_path.c_str(), O_RDONLY);
+	if (fd >= 0) {
+		struct stat st;
+
+		// Only regular, non-empty files which fit the 32 bit stream
+		// interface can be mapped; everything else takes the buffered path.
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+		    st.st_size > 0 && (uint64)st.st_size <= 0x7FFFFFFFULL) {
+			void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			if (map != MAP_FAILED) {
+				// The mapping holds its own reference to the file,
+				// so the descriptor is not needed anymore.
+				close(fd);
+				return new MemoryMappedPosixStream(map, (uint32)st.st_size);
+			}
+		}
+		close(fd);
+	}
+#endif
+
+	// Graceful fallback for platforms or files we cannot map.
+	return createReadStream();
+}
+
 Common::WriteStream *POSIXFilesystemNode::createWriteStream() {
 	return StdioStream::makeFromPath(getPath(), true);
 }
@@ -38,6 +38,7 @@ void Context::reset() {
 	shadersSupported = false;
 	multitextureSupported = false;
 	framebufferObjectSupported = false;
+	unpackRowLengthSupported = false;
 
 #define GL_FUNC_DEF(ret, name, param) name = nullptr;
 #include "backends/graphics/opengl/opengl-func.h"
@@ -138,9 +139,17 @@ void OpenGLGraphicsManager::initializeGLContext() {
 			g_context.multitextureSupported = true;
 		} else if (token == "GL_EXT_framebuffer_object") {
 			g_context.framebufferObjectSupported = true;
+		} else if (token == "GL_EXT_unpack_subimage") {
+			g_context.unpackRowLengthSupported = true;
 		}
 	}
 
+	if (g_context.type == kContextGL) {
+		// Desktop GL always supports setting GL_UNPACK_ROW_LENGTH; for the
+		// GLES contexts it needs the GL_EXT_unpack_subimage extension.
+		g_context.unpackRowLengthSupported = true;
+	}
+
 	if (g_context.type == kContextGLES2) {
 		// GLES2 always has (limited) NPOT support.
 		g_context.NPOTSupported = true;
@@ -177,6 +186,7 @@ void OpenGLGraphicsManager::initializeGLContext() {
 	debug(5, "OpenGL: Shader support: %d", g_context.shadersSupported);
 	debug(5, "OpenGL: Multitexture support: %d", g_context.multitextureSupported);
 	debug(5, "OpenGL: FBO support: %d", g_context.framebufferObjectSupported);
+	debug(5, "OpenGL: Unpack row length support: %d", g_context.unpackRowLengthSupported);
 }
 
 } // End of namespace OpenGL
@@ -52,7 +52,7 @@ namespace OpenGL {
 
 OpenGLGraphicsManager::OpenGLGraphicsManager()
     : _currentState(), _oldState(), _transactionMode(kTransactionNone), _screenChangeID(1 << (sizeof(int) * 8 - 2)),
-      _pipeline(nullptr),
+      _pipeline(nullptr), _scalerPipeline(nullptr),
       _defaultFormat(), _defaultFormatAlpha(),
       _gameScreen(nullptr), _gameScreenShakeOffset(0), _overlay(nullptr),
       _cursor(nullptr),
@@ -420,8 +420,16 @@ void OpenGLGraphicsManager::updateScreen() {
 
 	const GLfloat shakeOffset = _gameScreenShakeOffset * (GLfloat)_gameDrawRect.height() / _gameScreen->getHeight();
 
-	// First step: Draw the (virtual) game screen.
-	g_context.getActivePipeline()->drawTexture(_gameScreen->getGLTexture(), _gameDrawRect.left, _gameDrawRect.top + shakeOffset, _gameDrawRect.width(), _gameDrawRect.height());
+	// First step: Draw the (virtual) game screen. When filtering is enabled
+	// and shaders are supported, route it through the sharp upscale shader,
+	// which scales on the GPU and avoids the plain bilinear blur.
+	if (_scalerPipeline && _currentState.filtering) {
+		Pipeline *oldPipeline = g_context.setPipeline(_scalerPipeline);
+		g_context.getActivePipeline()->drawTexture(_gameScreen->getGLTexture(), _gameDrawRect.left, _gameDrawRect.top + shakeOffset, _gameDrawRect.width(), _gameDrawRect.height());
+		g_context.setPipeline(oldPipeline);
+	} else {
+		g_context.getActivePipeline()->drawTexture(_gameScreen->getGLTexture(), _gameDrawRect.left, _gameDrawRect.top + shakeOffset, _gameDrawRect.width(), _gameDrawRect.height());
+	}
 
 	// Second step: Draw the overlay if visible.
 	if (_overlayVisible) {
@@ -863,6 +871,8 @@ void OpenGLGraphicsManager::notifyContextCreate(const Graphics::PixelFormat &def
 	if (g_context.shadersSupported) {
 		ShaderMan.notifyCreate();
 		_pipeline = new ShaderPipeline(ShaderMan.query(ShaderManager::kDefault));
+		_scalerPipeline = new ShaderPipeline(ShaderMan.query(ShaderManager::kSharpUpscale));
+		_scalerPipeline->setFramebuffer(&_backBuffer);
 	}
 #endif
 
@@ -960,10 +970,12 @@ void OpenGLGraphicsManager::notifyContextDestroy() {
 	}
 #endif
 
-	// Destroy rendering pipeline.
+	// Destroy rendering pipelines.
 	g_context.setPipeline(nullptr);
 	delete _pipeline;
 	_pipeline = nullptr;
+	delete _scalerPipeline;
+	_scalerPipeline = nullptr;
 
 	// Rest our context description since the context is gone soon.
 	g_context.reset();
@@ -1118,6 +1130,21 @@ void OpenGLGraphicsManager::recalculateDisplayAreas() {
 	                          _gameDrawRect.width(),
 	                          _gameDrawRect.height());
 
+#if !USE_FORCED_GLES
+	// Update the sharp upscale shader state for the new output size.
+	if (_scalerPipeline) {
+		const GLTexture &gameScreenTexture = _gameScreen->getGLTexture();
+
+		if (gameScreenTexture.getLogicalWidth() != 0 && gameScreenTexture.getLogicalHeight() != 0) {
+			Shader *scalerShader = ShaderMan.query(ShaderManager::kSharpUpscale);
+			scalerShader->setUniform2F("textureSize", gameScreenTexture.getWidth(), gameScreenTexture.getHeight());
+			scalerShader->setUniform2F("scaleFactor",
+			                           MAX<GLfloat>(_gameDrawRect.width()  / gameScreenTexture.getLogicalWidth(),  1),
+			                           MAX<GLfloat>(_gameDrawRect.height() / gameScreenTexture.getLogicalHeight(), 1));
+		}
+	}
+#endif
+
 	// Update the cursor position to adjust for new display area.
 	setMousePosition(_cursorX, _cursorY);
 
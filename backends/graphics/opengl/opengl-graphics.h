@@ -278,6 +278,12 @@ private:
 	 */
 	Pipeline *_pipeline;
 
+	/**
+	 * OpenGL pipeline used for drawing the game screen through the sharp
+	 * upscale shader, when shaders are supported.
+	 */
+	Pipeline *_scalerPipeline;
+
 protected:
 	/**
 	 * Query the address of an OpenGL function by name.
@@ -78,6 +78,28 @@ const char *const g_lookUpFragmentShader =
 	"}\n";
 
 
+// Sharp bilinear scaling: sample on the texel grid, but shrink the
+// bilinear interpolation window to the size of one output pixel. This
+// keeps pixel edges as crisp as nearest neighbor filtering without its
+// shimmering on non-integral scale factors.
+const char *const g_sharpUpscaleFragmentShader =
+	"varying vec2 texCoord;\n"
+	"varying vec4 blendColor;\n"
+	"\n"
+	"uniform sampler2D texture;\n"
+	"uniform vec2 textureSize;\n"
+	"uniform vec2 scaleFactor;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tvec2 texel = texCoord * textureSize;\n"
+	"\tvec2 texelFloored = floor(texel);\n"
+	"\tvec2 s = fract(texel);\n"
+	"\tvec2 regionRange = 0.5 - 0.5 / scaleFactor;\n"
+	"\tvec2 centerDist = s - 0.5;\n"
+	"\tvec2 f = (centerDist - clamp(centerDist, -regionRange, regionRange)) * scaleFactor + 0.5;\n"
+	"\tgl_FragColor = blendColor * texture2D(texture, (texelFloored + f) / textureSize);\n"
+	"}\n";
+
 // Taken from: https://en.wikibooks.org/wiki/OpenGL_Programming/Modern_OpenGL_Tutorial_03#OpenGL_ES_2_portability
 const char *const g_precisionDefines =
 	"#ifdef GL_ES\n"
@@ -104,6 +126,10 @@ void ShaderUniformFloat::set(GLint location) const {
 	GL_CALL(glUniform1f(location, _value));
 }
 
+void ShaderUniformVector2::set(GLint location) const {
+	GL_CALL(glUniform2f(location, _x, _y));
+}
+
 void ShaderUniformMatrix44::set(GLint location) const {
 	GL_CALL(glUniformMatrix4fv(location, 1, GL_FALSE, _matrix));
 }
@@ -310,6 +336,10 @@ void ShaderManager::notifyCreate() {
 		_builtIn[kDefault] = new Shader(g_defaultVertexShader, g_defaultFragmentShader);
 		_builtIn[kCLUT8LookUp] = new Shader(g_defaultVertexShader, g_lookUpFragmentShader);
 		_builtIn[kCLUT8LookUp]->setUniform1I("palette", 1);
+		_builtIn[kSharpUpscale] = new Shader(g_defaultVertexShader, g_sharpUpscaleFragmentShader);
+		// Set neutral values until a user sets up the real texture state.
+		_builtIn[kSharpUpscale]->setUniform2F("textureSize", 1.0f, 1.0f);
+		_builtIn[kSharpUpscale]->setUniform2F("scaleFactor", 1.0f, 1.0f);
 
 		for (uint i = 0; i < kMaxUsages; ++i) {
 			_builtIn[i]->setUniform1I("texture", 0);
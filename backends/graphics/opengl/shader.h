@@ -74,6 +74,19 @@ private:
 	const GLfloat _value;
 };
 
+/**
+ * 2 component vector value for a shader uniform.
+ */
+class ShaderUniformVector2 : public ShaderUniformValue {
+public:
+	ShaderUniformVector2(GLfloat x, GLfloat y) : _x(x), _y(y) {}
+
+	virtual void set(GLint location) const override;
+
+private:
+	const GLfloat _x, _y;
+};
+
 /**
  * 4x4 Matrix value for a shader uniform.
  */
@@ -163,6 +176,19 @@ public:
 	bool setUniform1I(const Common::String &name, GLint value) {
 		return setUniform(name, new ShaderUniformInteger(value));
 	}
+
+	/**
+	 * Bind 2 component vector value to uniform.
+	 *
+	 * @param name  The name of the uniform to be set.
+	 * @param x     The first component of the vector to be set.
+	 * @param y     The second component of the vector to be set.
+	 * @return 'false' on error (i.e. uniform unknown or otherwise),
+	 *         'true' otherwise.
+	 */
+	bool setUniform2F(const Common::String &name, GLfloat x, GLfloat y) {
+		return setUniform(name, new ShaderUniformVector2(x, y));
+	}
 protected:
 	/**
 	 * Vertex shader sources.
@@ -249,6 +275,17 @@ public:
 		/** CLUT8 look up shader. */
 		kCLUT8LookUp,
 
+		/**
+		 * Sharp upscale shader.
+		 *
+		 * This upscales with sharp pixel edges, but uses the hardware's
+		 * bilinear filtering inside a pixel to smooth the transitions.
+		 * It needs the "textureSize" and "scaleFactor" uniforms set up
+		 * for the texture it is used with, and the texture must use
+		 * linear filtering.
+		 */
+		kSharpUpscale,
+
 		/** Number of built-in shaders. Should not be used for query. */
 		kMaxUsages
 	};
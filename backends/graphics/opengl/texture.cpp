@@ -147,16 +147,15 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 	bind();
 
 	// Update the actual texture.
-	// Although we have the area of the texture buffer we want to update we
-	// cannot take advantage of the left/right boundries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
+	// glTexSubImage2D does not take a pitch, so uploading only the dirty
+	// rect needs GL_UNPACK_ROW_LENGTH to skip over the unchanged parts of
+	// each line. Plain OpenGL always supports that; the GLES contexts only
+	// do with the GL_EXT_unpack_subimage extension. Without it we are left
 	// with the following options:
 	//
-	// 1) (As we do right now) Simply always update the whole texture lines of
-	//    rect changed. This is simplest to implement. In case performance is
-	//    really an issue we can think of switching to another method.
+	// 1) (As we do in that case) Simply always update the whole texture lines
+	//    of rect changed. This is simplest to implement. In case performance
+	//    is really an issue we can think of switching to another method.
 	//
 	// 2) Copy the dirty rect to a temporary buffer and upload that by using
 	//    glTexSubImage2D. This is what the Android backend does. It is more
@@ -164,8 +163,15 @@ void GLTexture::updateArea(const Common::Rect &area, const Graphics::Surface &sr
 	//
 	// 3) Use glTexSubImage2D per line changed. This is what the old OpenGL
 	//    graphics manager did but it is much slower! Thus, we do not use it.
-	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
-	                       _glFormat, _glType, src.getBasePtr(0, area.top)));
+	if (g_context.unpackRowLengthSupported) {
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, src.pitch / src.format.bytesPerPixel));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                       _glFormat, _glType, src.getBasePtr(area.left, area.top)));
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+	} else {
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
+		                       _glFormat, _glType, src.getBasePtr(0, area.top)));
+	}
 }
 
 //
@@ -502,7 +508,7 @@ TextureCLUT8GPU::TextureCLUT8GPU()
       _paletteTexture(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE),
       _target(new TextureTarget()), _clut8Pipeline(new CLUT8LookUpPipeline()),
       _clut8Vertices(), _clut8Data(), _userPixelData(), _palette(),
-      _paletteDirty(false) {
+      _paletteDirtyStart(0), _paletteDirtyEnd(0) {
 	// Allocate space for 256 colors.
 	_paletteTexture.setSize(256, 1);
 
@@ -533,7 +539,7 @@ void TextureCLUT8GPU::recreate() {
 	// time.
 	if (_clut8Data.getPixels()) {
 		flagDirty();
-		_paletteDirty = true;
+		flagPaletteDirty(0, 256);
 	}
 }
 
@@ -583,12 +589,14 @@ Graphics::PixelFormat TextureCLUT8GPU::getFormat() const {
 void TextureCLUT8GPU::setColorKey(uint colorKey) {
 	_palette[colorKey * 4 + 3] = 0x00;
 
-	_paletteDirty = true;
+	flagPaletteDirty(colorKey, 1);
 }
 
 void TextureCLUT8GPU::setPalette(uint start, uint colors, const byte *palData) {
 	byte *dst = _palette + start * 4;
 
+	flagPaletteDirty(start, colors);
+
 	while (colors-- > 0) {
 		memcpy(dst, palData, 3);
 		dst[3] = 0xFF;
@@ -596,8 +604,16 @@ void TextureCLUT8GPU::setPalette(uint start, uint colors, const byte *palData) {
 		dst += 4;
 		palData += 3;
 	}
+}
 
-	_paletteDirty = true;
+void TextureCLUT8GPU::flagPaletteDirty(uint start, uint colors) {
+	if (_paletteDirtyStart == _paletteDirtyEnd) {
+		_paletteDirtyStart = start;
+		_paletteDirtyEnd = start + colors;
+	} else {
+		_paletteDirtyStart = MIN(_paletteDirtyStart, start);
+		_paletteDirtyEnd = MAX(_paletteDirtyEnd, start + colors);
+	}
 }
 
 const GLTexture &TextureCLUT8GPU::getGLTexture() const {
@@ -605,7 +621,7 @@ const GLTexture &TextureCLUT8GPU::getGLTexture() const {
 }
 
 void TextureCLUT8GPU::updateGLTexture() {
-	const bool needLookUp = Surface::isDirty() || _paletteDirty;
+	const bool needLookUp = Surface::isDirty() || _paletteDirtyStart != _paletteDirtyEnd;
 
 	// Update CLUT8 texture if necessary.
 	if (Surface::isDirty()) {
@@ -613,10 +629,12 @@ void TextureCLUT8GPU::updateGLTexture() {
 		clearDirty();
 	}
 
-	// Update palette if necessary.
-	if (_paletteDirty) {
+	// Update the changed part of the palette if necessary. During palette
+	// animation only a handful of colors change per frame, so there is no
+	// point in uploading the full palette then.
+	if (_paletteDirtyStart != _paletteDirtyEnd) {
 		Graphics::Surface palSurface;
-		palSurface.init(256, 1, 256, _palette,
+		palSurface.init(256, 1, 256 * 4, _palette,
 #ifdef SCUMM_LITTLE_ENDIAN
 		                Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24) // ABGR8888
 #else
@@ -624,8 +642,8 @@ void TextureCLUT8GPU::updateGLTexture() {
 #endif
 		               );
 
-		_paletteTexture.updateArea(Common::Rect(256, 1), palSurface);
-		_paletteDirty = false;
+		_paletteTexture.updateArea(Common::Rect(_paletteDirtyStart, 0, _paletteDirtyEnd, 1), palSurface);
+		_paletteDirtyStart = _paletteDirtyEnd = 0;
 	}
 
 	// In case any data changed, do color look up and store result in _target.
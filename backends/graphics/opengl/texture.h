@@ -354,7 +354,7 @@ public:
 
 	virtual void allocate(uint width, uint height);
 
-	virtual bool isDirty() const { return _paletteDirty || Surface::isDirty(); }
+	virtual bool isDirty() const { return _paletteDirtyStart != _paletteDirtyEnd || Surface::isDirty(); }
 
 	virtual uint getWidth() const { return _userPixelData.w; }
 	virtual uint getHeight() const { return _userPixelData.h; }
@@ -392,7 +392,12 @@ private:
 	Graphics::Surface _userPixelData;
 
 	byte _palette[4 * 256];
-	bool _paletteDirty;
+
+	// Dirty range of the palette, [_paletteDirtyStart, _paletteDirtyEnd).
+	// An empty range means the palette texture is up to date.
+	uint _paletteDirtyStart, _paletteDirtyEnd;
+
+	void flagPaletteDirty(uint start, uint colors);
 };
 #endif // !USE_FORCED_GLES
 
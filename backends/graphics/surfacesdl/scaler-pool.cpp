@@ -0,0 +1,112 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/graphics/surfacesdl/scaler-pool.h"
+
+ScalerThreadPool::ScalerThreadPool() : _workerCount(0), _quit(false) {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// One band is always scaled by the calling thread, so spawn one worker
+	// less than there are cores.
+	int wanted = SDL_GetCPUCount() - 1;
+	if (wanted > kMaxWorkers)
+		wanted = kMaxWorkers;
+
+	for (int i = 0; i < wanted; ++i) {
+		Worker &w = _workers[i];
+		w.pool = this;
+		w.startSem = SDL_CreateSemaphore(0);
+		w.doneSem = SDL_CreateSemaphore(0);
+		if (!w.startSem || !w.doneSem)
+			break;
+		w.thread = SDL_CreateThread(workerFunc, "scummvm scaler", &w);
+		if (!w.thread)
+			break;
+		++_workerCount;
+	}
+#endif
+}
+
+ScalerThreadPool::~ScalerThreadPool() {
+	_quit = true;
+	for (int i = 0; i < _workerCount; ++i) {
+		SDL_SemPost(_workers[i].startSem);
+		SDL_WaitThread(_workers[i].thread, 0);
+		SDL_DestroySemaphore(_workers[i].startSem);
+		SDL_DestroySemaphore(_workers[i].doneSem);
+	}
+}
+
+int ScalerThreadPool::workerFunc(void *arg) {
+	Worker *w = (Worker *)arg;
+
+	while (true) {
+		SDL_SemWait(w->startSem);
+		if (w->pool->_quit)
+			break;
+		w->job.proc(w->job.srcPtr, w->job.srcPitch, w->job.dstPtr, w->job.dstPitch,
+		            w->job.width, w->job.height);
+		SDL_SemPost(w->doneSem);
+	}
+	return 0;
+}
+
+void ScalerThreadPool::run(ScalerProc *proc, const byte *srcPtr, uint32 srcPitch,
+                           byte *dstPtr, uint32 dstPitch, int width, int height, int scale) {
+	int bands = _workerCount + 1;
+	if (bands > height / kMinRowsPerBand)
+		bands = height / kMinRowsPerBand;
+
+	if (bands <= 1) {
+		proc(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+		return;
+	}
+
+	const int rowsPerBand = height / bands;
+	int busy = 0;
+
+	for (int i = 0; i < bands - 1; ++i) {
+		Job &job = _workers[i].job;
+		job.proc = proc;
+		job.srcPtr = srcPtr + (i * rowsPerBand) * srcPitch;
+		job.srcPitch = srcPitch;
+		job.dstPtr = dstPtr + (i * rowsPerBand * scale) * dstPitch;
+		job.dstPitch = dstPitch;
+		job.width = width;
+		job.height = rowsPerBand;
+		SDL_SemPost(_workers[i].startSem);
+		++busy;
+	}
+
+	// The last band picks up the rounding remainder.
+	const int doneRows = (bands - 1) * rowsPerBand;
+	proc(srcPtr + doneRows * srcPitch, srcPitch,
+	     dstPtr + (doneRows * scale) * dstPitch, dstPitch, width, height - doneRows);
+
+	for (int i = 0; i < busy; ++i)
+		SDL_SemWait(_workers[i].doneSem);
+}
+
+#endif
@@ -0,0 +1,88 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_SURFACESDL_SCALER_POOL_H
+#define BACKENDS_GRAPHICS_SURFACESDL_SCALER_POOL_H
+
+#include "backends/platform/sdl/sdl-sys.h"
+#include "graphics/scaler.h"
+
+/**
+ * A small pool of SDL worker threads that runs a ScalerProc over a frame
+ * split into horizontal bands.
+ *
+ * The source surfaces handed to the scalers already carry the extra border
+ * rows/columns the pattern-matching scalers (2xSaI, hq2x/3x, ...) peek at,
+ * so a band only ever *reads* across its boundary into rows owned by a
+ * neighbouring band and never writes outside its own destination rows.
+ * That makes a plain row partition safe without copying overlap strips.
+ *
+ * On SDL 1.2, or when only one CPU is available, the pool stays disabled
+ * and run() degrades to a direct call of the scaler.
+ */
+class ScalerThreadPool {
+public:
+	ScalerThreadPool();
+	~ScalerThreadPool();
+
+	/**
+	 * Scale a region, distributing bands of rows over the worker threads.
+	 * Blocks until all bands have been scaled. The calling thread always
+	 * processes the last band itself.
+	 */
+	void run(ScalerProc *proc, const byte *srcPtr, uint32 srcPitch,
+	         byte *dstPtr, uint32 dstPitch, int width, int height, int scale);
+
+private:
+	enum {
+		kMaxWorkers = 7,
+		// Bands below this height are cheaper to scale inline than to
+		// hand out, given the semaphore round trip per worker.
+		kMinRowsPerBand = 32
+	};
+
+	struct Job {
+		ScalerProc *proc;
+		const byte *srcPtr;
+		uint32 srcPitch;
+		byte *dstPtr;
+		uint32 dstPitch;
+		int width;
+		int height;
+	};
+
+	struct Worker {
+		ScalerThreadPool *pool;
+		SDL_Thread *thread;
+		SDL_sem *startSem;
+		SDL_sem *doneSem;
+		Job job;
+	};
+
+	static int workerFunc(void *arg);
+
+	Worker _workers[kMaxWorkers];
+	int _workerCount;
+	bool _quit;
+};
+
+#endif
@@ -31,6 +31,7 @@
 #include "common/system.h"
 
 #include "backends/events/sdl/sdl-events.h"
+#include "backends/graphics/surfacesdl/scaler-pool.h"
 
 #include "backends/platform/sdl/sdl-sys.h"
 
@@ -276,6 +277,9 @@ protected:
 	int _scalerType;
 	int _transactionMode;
 
+	// Worker threads used to scale large dirty regions in parallel bands
+	ScalerThreadPool _scalerPool;
+
 	// Indicates whether it is needed to free _hwSurface in destructor
 	bool _displayDisabled;
 
@@ -33,7 +33,12 @@
 
 namespace Common {
 
-Keymap::Keymap(const Keymap& km) : _actions(km._actions), _keymap(), _nonkeymap(), _configDomain(0) {
+uint32 Keymap::makeMappingStamp() {
+	static uint32 stampCounter = 0;
+	return ++stampCounter;
+}
+
+Keymap::Keymap(const Keymap& km) : _actions(km._actions), _keymap(), _nonkeymap(), _configDomain(0), _mappingStamp(makeMappingStamp()) {
 	List<Action *>::iterator it;
 
 	for (it = _actions.begin(); it != _actions.end(); ++it) {
@@ -78,6 +83,8 @@ void Keymap::registerMapping(Action *action, const HardwareInput *hwInput) {
 		// now map it
 		_nonkeymap[hwInput->inputCode] = action;
 	}
+
+	_mappingStamp = makeMappingStamp();
 }
 
 void Keymap::unregisterMapping(Action *action) {
@@ -88,6 +95,8 @@ void Keymap::unregisterMapping(Action *action) {
 			_keymap.erase(hwInput->key);
 		else if (hwInput->type == kHardwareInputTypeGeneric)
 			_nonkeymap.erase(hwInput->inputCode);
+
+		_mappingStamp = makeMappingStamp();
 	}
 }
 
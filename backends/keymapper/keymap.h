@@ -50,7 +50,7 @@ template<> struct Hash<KeyState>
 
 class Keymap {
 public:
-	Keymap(const String& name) : _name(name) {}
+	Keymap(const String& name) : _name(name), _configDomain(0), _mappingStamp(makeMappingStamp()) {}
 	Keymap(const Keymap& km);
 	~Keymap();
 
@@ -81,6 +81,26 @@ public:
 	 */
 	Action *getMappedAction(const HardwareInputCode code) const;
 
+	/**
+	 * Get the whole key mapping of this keymap.
+	 * Used by the Keymapper to compile its event lookup table.
+	 */
+	const HashMap<KeyState, Action *> &getKeyMappings() const { return _keymap; }
+
+	/**
+	 * Get the whole non-key mapping of this keymap.
+	 * @see getKeyMappings
+	 */
+	const HashMap<HardwareInputCode, Action *> &getNonKeyMappings() const { return _nonkeymap; }
+
+	/**
+	 * A stamp which changes whenever this keymap's mappings change.
+	 * Stamps are never reused, not even by other Keymap instances, so
+	 * comparing a remembered stamp against the current one is a safe
+	 * way to detect that a cached view of the mappings went stale.
+	 */
+	uint32 getMappingStamp() const { return _mappingStamp; }
+
 	void setConfigDomain(ConfigManager::Domain *dom);
 
 	/**
@@ -132,11 +152,15 @@ private:
 	Action *findAction(const char *id);
 	const Action *findAction(const char *id) const;
 
+	/** Hands out process-wide unique mapping stamps. */
+	static uint32 makeMappingStamp();
+
 	String _name;
 	List<Action *> _actions;
 	HashMap<KeyState, Action *> _keymap;
 	HashMap<HardwareInputCode, Action *> _nonkeymap;
 	ConfigManager::Domain *_configDomain;
+	uint32 _mappingStamp;
 
 };
 
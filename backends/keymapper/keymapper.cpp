@@ -59,7 +59,8 @@ Keymap *Keymapper::Domain::getKeymap(const String& name) {
 }
 
 Keymapper::Keymapper(EventManager *evtMgr)
-	: _eventMan(evtMgr), _enabled(true), _remapping(false), _hardwareInputs(0), _actionToRemap(0) {
+	: _eventMan(evtMgr), _enabled(true), _remapping(false), _hardwareInputs(0), _actionToRemap(0),
+	  _eventCacheValid(false) {
 	ConfigManager::Domain *confDom = ConfMan.getDomain(ConfigManager::kKeymapperDomain);
 
 	_globalDomain.setConfigDomain(confDom);
@@ -220,6 +221,57 @@ List<Event> Keymapper::mapKeyUp(const KeyState& key) {
 	return mapKey(key, false);
 }
 
+bool Keymapper::isEventCacheUpToDate() const {
+	if (!_eventCacheValid || _cacheSources.size() != _activeMaps.size())
+		return false;
+
+	for (uint i = 0; i < _cacheSources.size(); i++) {
+		if (_cacheSources[i].keymap != _activeMaps[i].keymap ||
+		    _cacheSources[i].mappingStamp != _activeMaps[i].keymap->getMappingStamp())
+			return false;
+	}
+
+	return true;
+}
+
+void Keymapper::rebuildEventCache() {
+	_keyCache.clear();
+	_nonKeyCache.clear();
+	_cacheSources.clear();
+
+	// Walk the stack top-down, so upper keymaps take precedence. Nothing
+	// below the first non-transparent keymap is reachable, just like in
+	// the per-event search this cache replaces.
+	for (int i = _activeMaps.size() - 1; i >= 0; --i) {
+		MapRecord mr = _activeMaps[i];
+		debug(5, "Keymapper::rebuildEventCache keymap: %s", mr.keymap->getName().c_str());
+
+		const HashMap<KeyState, Action *> &keys = mr.keymap->getKeyMappings();
+		for (HashMap<KeyState, Action *>::const_iterator it = keys.begin(); it != keys.end(); ++it) {
+			if (!_keyCache.contains(it->_key))
+				_keyCache[it->_key] = it->_value;
+		}
+
+		const HashMap<HardwareInputCode, Action *> &nonKeys = mr.keymap->getNonKeyMappings();
+		for (HashMap<HardwareInputCode, Action *>::const_iterator it = nonKeys.begin(); it != nonKeys.end(); ++it) {
+			if (!_nonKeyCache.contains(it->_key))
+				_nonKeyCache[it->_key] = it->_value;
+		}
+
+		if (!mr.transparent)
+			break;
+	}
+
+	for (Stack<MapRecord>::size_type i = 0; i < _activeMaps.size(); i++) {
+		CacheSource source;
+		source.keymap = _activeMaps[i].keymap;
+		source.mappingStamp = _activeMaps[i].keymap->getMappingStamp();
+		_cacheSources.push_back(source);
+	}
+
+	_eventCacheValid = true;
+}
+
 List<Event> Keymapper::mapKey(const KeyState& key, bool keyDown) {
 	if (!_enabled || _activeMaps.empty())
 		return List<Event>();
@@ -227,15 +279,13 @@ List<Event> Keymapper::mapKey(const KeyState& key, bool keyDown) {
 	Action *action = 0;
 
 	if (keyDown) {
-		// Search for key in active keymap stack
-		for (int i = _activeMaps.size() - 1; i >= 0; --i) {
-			MapRecord mr = _activeMaps[i];
-			debug(5, "Keymapper::mapKey keymap: %s", mr.keymap->getName().c_str());
-			action = mr.keymap->getMappedAction(key);
-
-			if (action || !mr.transparent)
-				break;
-		}
+		if (!isEventCacheUpToDate())
+			rebuildEventCache();
+
+		// Search for key in the compiled lookup table
+		HashMap<KeyState, Action *>::iterator it = _keyCache.find(key);
+		if (it != _keyCache.end())
+			action = it->_value;
 
 		if (action)
 			_keysDown[key] = action;
@@ -261,15 +311,13 @@ List<Event> Keymapper::mapNonKey(const HardwareInputCode code) {
 
 	Action *action = 0;
 
-	// Search for nonkey in active keymap stack
-	for (int i = _activeMaps.size() - 1; i >= 0; --i) {
-		MapRecord mr = _activeMaps[i];
-		debug(5, "Keymapper::mapKey keymap: %s", mr.keymap->getName().c_str());
-		action = mr.keymap->getMappedAction(code);
+	if (!isEventCacheUpToDate())
+		rebuildEventCache();
 
-		if (action || !mr.transparent)
-			break;
-	}
+	// Search for nonkey in the compiled lookup table
+	HashMap<HardwareInputCode, Action *>::iterator it = _nonKeyCache.find(code);
+	if (it != _nonKeyCache.end())
+		action = it->_value;
 
 	if (!action)
 		return List<Event>();
@@ -210,6 +210,25 @@ private:
 
 	void initKeymap(Domain &domain, Keymap *keymap);
 
+	/** Remembers what the compiled event cache was built from. */
+	struct CacheSource {
+		Keymap *keymap;
+		uint32 mappingStamp;
+	};
+
+	/**
+	 * Check whether the compiled event cache still matches the active
+	 * keymap stack and the mappings of the keymaps on it.
+	 */
+	bool isEventCacheUpToDate() const;
+
+	/**
+	 * Compile the active keymap stack into flat input -> action tables,
+	 * so that resolving an incoming event is a single lookup instead of
+	 * a search through the stack.
+	 */
+	void rebuildEventCache();
+
 	Domain _globalDomain;
 	Domain _gameDomain;
 
@@ -231,6 +250,11 @@ private:
 	Stack<MapRecord> _activeMaps;
 	HashMap<KeyState, Action *> _keysDown;
 
+	bool _eventCacheValid;
+	Array<CacheSource> _cacheSources;
+	HashMap<KeyState, Action *> _keyCache;
+	HashMap<HardwareInputCode, Action *> _nonKeyCache;
+
 };
 
 } // End of namespace Common
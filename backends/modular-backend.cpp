@@ -29,6 +29,7 @@
 #include "gui/EventRecorder.h"
 
 #include "audio/mixer.h"
+#include "common/profiler.h"
 #include "graphics/pixelformat.h"
 
 ModularBackend::ModularBackend()
@@ -36,7 +37,7 @@ ModularBackend::ModularBackend()
 	_mutexManager(0),
 	_graphicsManager(0),
 	_mixer(0) {
-
+	_updateScreenProfileZone = ProfMan.registerZone("updateScreen");
 }
 
 ModularBackend::~ModularBackend() {
@@ -162,11 +163,17 @@ void ModularBackend::updateScreen() {
 	g_eventRec.preDrawOverlayGui();
 #endif
 
+	ProfMan.beginZone(_updateScreenProfileZone);
 	_graphicsManager->updateScreen();
+	ProfMan.endZone(_updateScreenProfileZone);
 
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.postDrawOverlayGui();
 #endif
+
+	// updateScreen() is the closest thing to a frame boundary common to
+	// all engines, so close the profiler frame here
+	ProfMan.frameTick();
 }
 
 void ModularBackend::setShakePos(int shakeOffset) {
@@ -143,6 +143,9 @@ protected:
 	GraphicsManager *_graphicsManager;
 	Audio::Mixer *_mixer;
 
+	/** Profiler zone covering the graphics manager's screen update. */
+	int _updateScreenProfileZone;
+
 	//@}
 };
 
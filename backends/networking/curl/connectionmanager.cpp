@@ -37,9 +37,49 @@ DECLARE_SINGLETON(Networking::ConnectionManager);
 
 namespace Networking {
 
-ConnectionManager::ConnectionManager(): _multi(0), _timerStarted(false), _frame(0) {
+static void curlShareLockCallback(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr) {
+	Common::Mutex *mutexes = (Common::Mutex *)userptr;
+	if (mutexes && data < CURL_LOCK_DATA_LAST)
+		mutexes[data].lock();
+}
+
+static void curlShareUnlockCallback(CURL *handle, curl_lock_data data, void *userptr) {
+	Common::Mutex *mutexes = (Common::Mutex *)userptr;
+	if (mutexes && data < CURL_LOCK_DATA_LAST)
+		mutexes[data].unlock();
+}
+
+ConnectionManager::ConnectionManager(): _multi(0), _share(0), _shareMutexes(nullptr), _timerStarted(false), _frame(0) {
 	curl_global_init(CURL_GLOBAL_ALL);
 	_multi = curl_multi_init();
+
+#if LIBCURL_VERSION_NUM >= 0x072B00
+	//let requests to the same host multiplex over one connection (HTTP/2)
+	curl_multi_setopt(_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#elif LIBCURL_VERSION_NUM >= 0x071000
+	curl_multi_setopt(_multi, CURLMOPT_PIPELINING, 1L);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x071003
+	//keep finished connections around, so sequential requests reuse them
+	curl_multi_setopt(_multi, CURLMOPT_MAXCONNECTS, 10L);
+#endif
+
+	//share DNS cache and SSL sessions between the easy handles, so a new
+	//Request doesn't pay for resolving and handshaking with a host we
+	//already talked to (easy handles are created outside handle(), hence
+	//the lock callbacks)
+	_shareMutexes = new Common::Mutex[CURL_LOCK_DATA_LAST];
+	_share = curl_share_init();
+	if (_share) {
+		curl_share_setopt(_share, CURLSHOPT_LOCKFUNC, curlShareLockCallback);
+		curl_share_setopt(_share, CURLSHOPT_UNLOCKFUNC, curlShareUnlockCallback);
+		curl_share_setopt(_share, CURLSHOPT_USERDATA, _shareMutexes);
+		curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+#if LIBCURL_VERSION_NUM >= 0x071700
+		//sharing SSL sessions is supported since curl 7.23.0
+		curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#endif
+	}
 }
 
 ConnectionManager::~ConnectionManager() {
@@ -60,12 +100,23 @@ ConnectionManager::~ConnectionManager() {
 
 	//cleanup
 	curl_multi_cleanup(_multi);
+	if (_share)
+		curl_share_cleanup(_share);
 	curl_global_cleanup();
 	_multi = nullptr;
+	_share = nullptr;
 	_handleMutex.unlock();
+	delete[] _shareMutexes;
+	_shareMutexes = nullptr;
 }
 
 void ConnectionManager::registerEasyHandle(CURL *easy) const {
+	if (_share)
+		curl_easy_setopt(easy, CURLOPT_SHARE, _share);
+#if LIBCURL_VERSION_NUM >= 0x071900
+	//ask the OS to keep the connection alive between transfers
+	curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+#endif
 	curl_multi_add_handle(_multi, easy);
 }
 
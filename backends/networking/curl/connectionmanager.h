@@ -31,6 +31,7 @@
 
 typedef void CURL;
 typedef void CURLM;
+typedef void CURLSH;
 struct curl_slist;
 
 namespace Networking {
@@ -75,6 +76,8 @@ class ConnectionManager : public Common::Singleton<ConnectionManager> {
 	};
 
 	CURLM *_multi;
+	CURLSH *_share;
+	Common::Mutex *_shareMutexes; //one per curl_lock_data kind, used by the share lock callbacks
 	bool _timerStarted;
 	Common::Array<RequestWithCallback> _requests, _addedRequests;
 	Common::Mutex _handleMutex, _addedRequestsMutex;
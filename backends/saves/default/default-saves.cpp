@@ -51,6 +51,74 @@
 const char *DefaultSaveFileManager::TIMESTAMPS_FILENAME = "timestamps";
 #endif
 
+namespace {
+
+/**
+ * A write stream which writes into a temporary file and only moves it over
+ * the real savefile once all data has been written out successfully. This
+ * way a failed or interrupted save cannot truncate an existing savefile.
+ */
+class SafeSaveWriteStream : public Common::WriteStream {
+public:
+	SafeSaveWriteStream(Common::WriteStream *w, const Common::String &tempPath, const Common::String &targetPath)
+		: _wrapped(w), _tempPath(tempPath), _targetPath(targetPath), _pos(0), _error(false) {
+		assert(w != 0);
+	}
+
+	virtual ~SafeSaveWriteStream() {
+		finalize();
+	}
+
+	virtual uint32 write(const void *dataPtr, uint32 dataSize) {
+		const uint32 written = _wrapped->write(dataPtr, dataSize);
+		_pos += written;
+		return written;
+	}
+
+	virtual bool flush() { return _wrapped ? _wrapped->flush() : !_error; }
+	virtual bool err() const { return _wrapped ? _wrapped->err() : _error; }
+	virtual void clearErr() { if (_wrapped) _wrapped->clearErr(); }
+	virtual int32 pos() const { return _pos; }
+
+	virtual void finalize() {
+		if (!_wrapped)
+			return;
+
+		_wrapped->finalize();
+		_error = _wrapped->err();
+
+		// The temporary file has to be closed before it can be renamed.
+		delete _wrapped;
+		_wrapped = 0;
+
+		if (_error) {
+			remove(_tempPath.c_str());
+			return;
+		}
+
+		// Move the temporary file over the real savefile. On systems where
+		// rename() does not replace an existing file (e.g. Windows), remove
+		// the old file first; that briefly loses atomicity but never leaves
+		// a partially written savefile behind.
+		if (rename(_tempPath.c_str(), _targetPath.c_str()) != 0) {
+			remove(_targetPath.c_str());
+			if (rename(_tempPath.c_str(), _targetPath.c_str()) != 0) {
+				remove(_tempPath.c_str());
+				_error = true;
+			}
+		}
+	}
+
+private:
+	Common::WriteStream *_wrapped;
+	Common::String _tempPath;
+	Common::String _targetPath;
+	uint32 _pos;
+	bool _error;
+};
+
+} // End of anonymous namespace
+
 DefaultSaveFileManager::DefaultSaveFileManager() {
 }
 
@@ -166,9 +234,26 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 		fileNode = file->_value;
 	}
 
-	// Open the file for saving.
-	Common::WriteStream *const sf = fileNode.createWriteStream();
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	// Open the file for saving. The data is written into a temporary file
+	// first and only moved over the real savefile once it is complete, so
+	// an interrupted save cannot destroy an existing savefile.
+	const Common::String tempPath = fileNode.getPath() + ".tmp";
+	Common::WriteStream *sf = Common::FSNode(tempPath).createWriteStream();
+	if (sf)
+		sf = new SafeSaveWriteStream(sf, tempPath, fileNode.getPath());
+
+	// The deflate level can be tuned from the config file; lower levels
+	// noticeably cut down the time spent compressing big savegames.
+	int compressionLevel = -1;	// the zlib default
+	if (ConfMan.hasKey("savefile_deflate_level")) {
+		compressionLevel = ConfMan.getInt("savefile_deflate_level");
+		if (compressionLevel < -1 || compressionLevel > 9) {
+			warning("Ignoring invalid savefile_deflate_level %d", compressionLevel);
+			compressionLevel = -1;
+		}
+	}
+
+	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf, compressionLevel) : sf);
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
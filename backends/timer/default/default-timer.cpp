@@ -109,6 +109,20 @@ void DefaultTimerManager::handler() {
 	}
 }
 
+uint32 DefaultTimerManager::timeToNextFire() {
+	Common::StackLock lock(_mutex);
+
+	// The queue is sorted by deadline, so only the front entry matters
+	TimerSlot *slot = _head->next;
+	if (!slot)
+		return kNoTimerPending;
+
+	uint32 curTime = g_system->getMillis(true);
+	if (slot->nextFireTime <= curTime)
+		return 0;
+	return slot->nextFireTime - curTime;
+}
+
 bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, void *refCon, const Common::String &id) {
 	assert(interval > 0);
 	Common::StackLock lock(_mutex);
@@ -48,6 +48,24 @@ public:
 	 * Timer callback, to be invoked at regular time intervals by the backend.
 	 */
 	void handler();
+
+	/**
+	 * Returns the number of milliseconds until the earliest scheduled
+	 * timer is due, 0 if one is already overdue, or kNoTimerPending if
+	 * no timers are installed at all.
+	 *
+	 * Backends which drive handler() from their own timer or thread can
+	 * use this to sleep until the next deadline instead of waking up at
+	 * a fixed rate just to find out that nothing is due yet. Note that
+	 * installing a new timer can move the earliest deadline forward, so
+	 * such backends must recheck after installTimerProc (see the SDL
+	 * timer manager for an example).
+	 */
+	uint32 timeToNextFire();
+
+	enum {
+		kNoTimerPending = 0xFFFFFFFF
+	};
 };
 
 #endif
@@ -30,8 +30,19 @@
 #include "common/textconsole.h"
 
 static Uint32 timer_handler(Uint32 interval, void *param) {
-	((DefaultTimerManager *)param)->handler();
-	return interval;
+	DefaultTimerManager *tm = (DefaultTimerManager *)param;
+
+	tm->handler();
+
+	// Sleep until the next deadline instead of polling the timer queue
+	// at a fixed rate. The wait is capped so we stay responsive, and
+	// installTimerProc reschedules us when a nearer deadline appears.
+	uint32 next = tm->timeToNextFire();
+	if (next < 1)
+		next = 1;
+	else if (next > 1000)
+		next = 1000;
+	return next;
 }
 
 SdlTimerManager::SdlTimerManager() {
@@ -49,4 +60,15 @@ SdlTimerManager::~SdlTimerManager() {
 	SDL_RemoveTimer(_timerID);
 }
 
+bool SdlTimerManager::installTimerProc(TimerProc proc, int32 interval, void *refCon, const Common::String &id) {
+	bool result = DefaultTimerManager::installTimerProc(proc, interval, refCon, id);
+
+	// The timer thread may currently be sleeping until a deadline that
+	// lies beyond the one just installed, so force a reschedule.
+	SDL_RemoveTimer(_timerID);
+	_timerID = SDL_AddTimer(1, &timer_handler, this);
+
+	return result;
+}
+
 #endif
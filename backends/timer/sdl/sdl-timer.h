@@ -29,13 +29,17 @@
 
 /**
  * SDL timer manager. Setups the timer callback for
- * DefaultTimerManager.
+ * DefaultTimerManager. The callback reschedules itself for the next
+ * deadline reported by the timer queue rather than ticking at a fixed
+ * rate, so the timer thread sleeps as long as nothing is due.
  */
 class SdlTimerManager : public DefaultTimerManager {
 public:
 	SdlTimerManager();
 	virtual ~SdlTimerManager();
 
+	virtual bool installTimerProc(TimerProc proc, int32 interval, void *refCon, const Common::String &id);
+
 protected:
 	SDL_TimerID _timerID;
 };
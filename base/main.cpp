@@ -507,9 +507,17 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 		// Try to find a plugin which feels responsible for the specified game.
 		const Plugin *plugin = detectPlugin();
 		if (plugin) {
+#ifdef DYNAMIC_MODULES
 			// Unload all plugins not needed for this game,
 			// to save memory
+			//
+			// This only pays off when the plugins are dynamic modules. In a
+			// static build the engine code stays linked in regardless, so
+			// unloading merely destroys all the MetaEngine instances, which
+			// would then have to be recreated one by one on every return to
+			// the launcher.
 			PluginManager::instance().unloadPluginsExcept(PLUGIN_TYPE_ENGINE, plugin);
+#endif
 
 #ifdef ENABLE_EVENTRECORDER
 			Common::String recordMode = ConfMan.get("record_mode");
@@ -590,7 +598,9 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 				ConfMan.setActiveDomain("");
 			}
 
+#ifdef DYNAMIC_MODULES
 			PluginManager::instance().loadAllPlugins(); // only for cached manager
+#endif
 		} else {
 			GUI::displayErrorDialog(_("Could not find any engine capable of running the selected game"));
 
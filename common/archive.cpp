@@ -98,6 +98,7 @@ void SearchSet::add(const String &name, Archive *archive, int priority, bool aut
 	if (find(name) == _list.end()) {
 		Node node(priority, name, archive, autoFree);
 		insert(node);
+		_memberCache.clear();
 	} else {
 		if (autoFree)
 			delete archive;
@@ -173,6 +174,7 @@ void SearchSet::remove(const String &name) {
 		if (it->_autoFree)
 			delete it->_arc;
 		_list.erase(it);
+		_memberCache.clear();
 	}
 }
 
@@ -187,6 +189,7 @@ void SearchSet::clear() {
 	}
 
 	_list.clear();
+	_memberCache.clear();
 }
 
 void SearchSet::setPriority(const String &name, int priority) {
@@ -203,19 +206,35 @@ void SearchSet::setPriority(const String &name, int priority) {
 	_list.erase(it);
 	node._priority = priority;
 	insert(node);
+	_memberCache.clear();
 }
 
-bool SearchSet::hasFile(const String &name) const {
-	if (name.empty())
-		return false;
+Archive *SearchSet::getArchiveContaining(const String &name) const {
+	MemberCacheMap::iterator ci = _memberCache.find(name);
+	if (ci != _memberCache.end()) {
+		// Revalidate the hit, since an archive's contents may have
+		// changed behind our back (e.g. files appearing on disk).
+		if (ci->_value->hasFile(name))
+			return ci->_value;
+		_memberCache.erase(name);
+	}
 
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
-			return true;
+		if (it->_arc->hasFile(name)) {
+			_memberCache[name] = it->_arc;
+			return it->_arc;
+		}
 	}
 
-	return false;
+	return 0;
+}
+
+bool SearchSet::hasFile(const String &name) const {
+	if (name.empty())
+		return false;
+
+	return getArchiveContaining(name) != 0;
 }
 
 int SearchSet::listMatchingMembers(ArchiveMemberList &list, const String &pattern) const {
@@ -242,11 +261,9 @@ const ArchiveMemberPtr SearchSet::getMember(const String &name) const {
 	if (name.empty())
 		return ArchiveMemberPtr();
 
-	ArchiveNodeList::const_iterator it = _list.begin();
-	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
-			return it->_arc->getMember(name);
-	}
+	Archive *arc = getArchiveContaining(name);
+	if (arc)
+		return arc->getMember(name);
 
 	return ArchiveMemberPtr();
 }
@@ -255,8 +272,20 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const String &name) con
 	if (name.empty())
 		return 0;
 
+	Archive *arc = getArchiveContaining(name);
+	if (arc) {
+		SeekableReadStream *stream = arc->createReadStreamForMember(name);
+		if (stream)
+			return stream;
+		// The archive claimed the member but could not open it; drop the
+		// cached entry and try the remaining archives the old-fashioned way.
+		_memberCache.erase(name);
+	}
+
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
+		if (it->_arc == arc)
+			continue;
 		SeekableReadStream *stream = it->_arc->createReadStreamForMember(name);
 		if (stream)
 			return stream;
@@ -24,6 +24,8 @@
 #define COMMON_ARCHIVE_H
 
 #include "common/str.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "common/ptr.h"
 #include "common/singleton.h"
@@ -152,6 +154,20 @@ class SearchSet : public Archive {
 	// Add an archive keeping the list sorted by descending priority.
 	void insert(const Node& node);
 
+	/**
+	 * Cache of resolved member lookups, mapping a (case-insensitive)
+	 * member name to the archive it was found in. Membership is resolved
+	 * lazily on the first lookup of a name, so archives which cannot
+	 * enumerate their contents cheaply need not be scanned up front.
+	 * The cache is flushed whenever the set of archives changes.
+	 */
+	typedef HashMap<String, Archive *, IgnoreCase_Hash, IgnoreCase_EqualTo> MemberCacheMap;
+	mutable MemberCacheMap _memberCache;
+
+	// Look up the highest priority archive containing the given member,
+	// using and updating _memberCache.
+	Archive *getArchiveContaining(const String &name) const;
+
 public:
 	virtual ~SearchSet() { clear(); }
 
@@ -84,6 +84,15 @@ public:
 		}
 	}
 
+#if __cplusplus >= 201103L
+	/** Constructs an array by stealing the storage of the given array. */
+	Array(Array<T> &&old) : _capacity(old._capacity), _size(old._size), _storage(old._storage) {
+		old._capacity = 0;
+		old._size = 0;
+		old._storage = 0;
+	}
+#endif
+
 	/**
 	 * Construct an array by copying data from a regular array.
 	 */
@@ -210,6 +219,24 @@ public:
 		return *this;
 	}
 
+#if __cplusplus >= 201103L
+	Array<T> &operator=(Array<T> &&old) {
+		if (this == &old)
+			return *this;
+
+		freeStorage(_storage, _size);
+		_capacity = old._capacity;
+		_size = old._size;
+		_storage = old._storage;
+
+		old._capacity = 0;
+		old._size = 0;
+		old._storage = 0;
+
+		return *this;
+	}
+#endif
+
 	size_type size() const {
 		return _size;
 	}
@@ -273,16 +300,24 @@ public:
 		allocCapacity(newCapacity);
 
 		if (oldStorage) {
-			// Copy old data
-			uninitialized_copy(oldStorage, oldStorage + _size, _storage);
+			// Relocate the old data
+			uninitialized_relocate(oldStorage, oldStorage + _size, _storage);
 			freeStorage(oldStorage, _size);
 		}
 	}
 
 	void resize(size_type newSize) {
-		reserve(newSize);
-		for (size_type i = _size; i < newSize; ++i)
-			new ((void *)&_storage[i]) T();
+		if (newSize < _size) {
+			// Shrinking only destroys the excess elements; the capacity is
+			// kept so containers that are refilled every frame don't have
+			// to reallocate.
+			for (size_type i = newSize; i < _size; ++i)
+				_storage[i].~T();
+		} else {
+			reserve(newSize);
+			for (size_type i = _size; i < newSize; ++i)
+				new ((void *)&_storage[i]) T();
+		}
 		_size = newSize;
 	}
 
@@ -320,6 +355,20 @@ protected:
 		free(storage);
 	}
 
+	/**
+	 * Transfers elements to a new, uninitialized block of storage. The
+	 * elements are moved instead of copied where the compiler supports it,
+	 * so reallocation does not deep-copy e.g. strings or nested arrays.
+	 * The source elements still need to be destroyed by the caller.
+	 */
+	static T *uninitialized_relocate(T *first, T *last, T *dst) {
+#if __cplusplus >= 201103L
+		return uninitialized_move(first, last, dst);
+#else
+		return uninitialized_copy(first, last, dst);
+#endif
+	}
+
 	/**
 	 * Insert a range of elements coming from this or another array.
 	 * Unlike std::vector::insert, this method does not accept
@@ -339,7 +388,8 @@ protected:
 		const size_type n = last - first;
 		if (n) {
 			const size_type idx = pos - _storage;
-			if (_size + n > _capacity || (_storage <= first && first <= _storage + _size)) {
+			const bool selfInsert = (_storage <= first && first <= _storage + _size);
+			if (_size + n > _capacity || selfInsert) {
 				T *const oldStorage = _storage;
 
 				// If there is not enough space, allocate more.
@@ -347,14 +397,22 @@ protected:
 				// storage to avoid conflicts.
 				allocCapacity(roundUpCapacity(_size + n));
 
-				// Copy the data from the old storage till the position where
-				// we insert new data
-				uninitialized_copy(oldStorage, oldStorage + idx, _storage);
-				// Copy the data we insert
-				uninitialized_copy(first, last, _storage + idx);
-				// Afterwards copy the old data from the position where we
-				// insert.
-				uninitialized_copy(oldStorage + idx, oldStorage + _size, _storage + idx + n);
+				if (selfInsert) {
+					// The inserted range aliases the old storage, so the old
+					// elements must stay intact until they have been copied.
+					uninitialized_copy(oldStorage, oldStorage + idx, _storage);
+					uninitialized_copy(first, last, _storage + idx);
+					uninitialized_copy(oldStorage + idx, oldStorage + _size, _storage + idx + n);
+				} else {
+					// Relocate the data from the old storage till the position
+					// where we insert new data
+					uninitialized_relocate(oldStorage, oldStorage + idx, _storage);
+					// Copy the data we insert
+					uninitialized_copy(first, last, _storage + idx);
+					// Afterwards relocate the old data from the position where
+					// we insert.
+					uninitialized_relocate(oldStorage + idx, oldStorage + _size, _storage + idx + n);
+				}
 
 				freeStorage(oldStorage, _size);
 			} else if (idx + n <= _size) {
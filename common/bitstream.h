@@ -49,10 +49,10 @@ private:
 	STREAM *_stream;			///< The input stream.
 	DisposeAfterUse::Flag _disposeAfterUse; ///< Should we delete the stream on destruction?
 
-	uint32 _value;   ///< Current value.
-	uint8  _inValue; ///< Position within the current value.
-	uint32 _size;    ///< Total bitstream size (in bits)
-	uint32 _pos;     ///< Current bitstream position (in bits)
+	uint64 _bitCache; ///< Cache of bits in stream order, ready to be consumed.
+	uint8  _bitsLeft; ///< Number of valid bits in the cache.
+	uint32 _size;     ///< Total bitstream size (in bits)
+	uint32 _pos;      ///< Current bitstream position (in bits)
 
 	/** Read a data value. */
 	inline uint32 readData() {
@@ -76,24 +76,31 @@ private:
 		return 0;
 	}
 
-	/** Read the next data value. */
-	inline void readValue() {
-		if (_size - _pos < valueBits)
-			error("BitStreamImpl::readValue(): End of bit stream reached");
+	/** Load another data value into the bit cache. */
+	inline void fillCache() {
+		if (_size - (_pos + _bitsLeft) < valueBits)
+			error("BitStreamImpl::fillCache(): End of bit stream reached");
 
-		_value = readData();
+		uint64 data = readData();
 		if (_stream->err() || _stream->eos())
-			error("BitStreamImpl::readValue(): Read error");
+			error("BitStreamImpl::fillCache(): Read error");
 
-		// If we're reading the bits MSB first, we need to shift the value to that position
+		// Append the new value behind the bits still in the cache, so that
+		// the cache always holds the next bits of the stream in consumption
+		// order. Since the cache is filled on demand with at most 32 bits
+		// pending, a fresh value always fits.
 		if (isMSB2LSB)
-			_value <<= 32 - valueBits;
-		}
+			_bitCache |= data << (64 - valueBits - _bitsLeft);
+		else
+			_bitCache |= data << _bitsLeft;
+
+		_bitsLeft += valueBits;
+	}
 
 public:
 	/** Create a bit stream using this input data stream and optionally delete it on destruction. */
 	BitStreamImpl(STREAM *stream, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::NO) :
-		_stream(stream), _disposeAfterUse(disposeAfterUse), _value(0), _inValue(0), _pos(0) {
+		_stream(stream), _disposeAfterUse(disposeAfterUse), _bitCache(0), _bitsLeft(0), _pos(0) {
 
 		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
 			error("BitStreamImpl: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
@@ -103,7 +110,7 @@ public:
 
 	/** Create a bit stream using this input data stream. */
 	BitStreamImpl(STREAM &stream) :
-		_stream(&stream), _disposeAfterUse(DisposeAfterUse::NO), _value(0), _inValue(0), _pos(0) {
+		_stream(&stream), _disposeAfterUse(DisposeAfterUse::NO), _bitCache(0), _bitsLeft(0), _pos(0) {
 
 		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
 			error("BitStreamImpl: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
@@ -116,35 +123,26 @@ public:
 			delete _stream;
 	}
 
-private:
-	uint32 getBit_internal() {
-		// Get the current bit
-		uint32 b = 0;
-		if (isMSB2LSB)
-			b = ((_value & 0x80000000) == 0) ? 0 : 1;
-		else
-			b = ((_value & 1) == 0) ? 0 : 1;
-
-		// Shift to the next bit
-		if (isMSB2LSB)
-			_value <<= 1;
-		else
-			_value >>= 1;
-
-		return b;
+	/** Return whether the bit order is MSB to LSB. */
+	static bool isMSB2LSBOrder() {
+		return isMSB2LSB;
 	}
 
-public:
 	/** Read a bit from the bit stream. */
 	uint32 getBit() {
-		// Check if we need the next value
-		if (_inValue == 0)
-			readValue();
+		if (_bitsLeft == 0)
+			fillCache();
 
-		uint32 b = getBit_internal();
+		uint32 b;
+		if (isMSB2LSB) {
+			b = (uint32)(_bitCache >> 63);
+			_bitCache <<= 1;
+		} else {
+			b = (uint32)(_bitCache & 1);
+			_bitCache >>= 1;
+		}
 
-		// Increase the position within the current value
-		_inValue = (_inValue + 1) % valueBits;
+		_bitsLeft--;
 		_pos++;
 
 		return b;
@@ -167,63 +165,35 @@ public:
 		if (n > 32)
 			error("BitStreamImpl::getBits(): Too many bits requested to be read");
 
-		// Read the number of bits
-		uint32 v = 0;
-
-		uint8 nOrig = n;
-		if (_inValue) {
-			int count = MIN((int)n, valueBits - _inValue);
-			for (int i = 0; i < count; ++i) {
-				if (isMSB2LSB) {
-					v = (v << 1) | getBit_internal();
-				} else {
-					v = (v >> 1) | (getBit_internal() << 31);
-				}
-			}
+		while (_bitsLeft < n)
+			fillCache();
 
-			n -= count;
-		}
-
-		while (n > 0) {
-			// NB: readValue doesn't care that _inValue is incorrect here
-			readValue();
-
-			int count = MIN((int)n, valueBits);
-			for (int i = 0; i < count; ++i) {
-				if (isMSB2LSB) {
-					v = (v << 1) | getBit_internal();
-				} else {
-					v = (v >> 1) | (getBit_internal() << 31);
-				}
-			}
-
-			n -= count;
+		// All requested bits are cached now, so they can be extracted in
+		// one go instead of one at a time
+		uint32 v;
+		if (isMSB2LSB) {
+			v = (uint32)(_bitCache >> (64 - n));
+			_bitCache <<= n;
+		} else {
+			v = (uint32)(_bitCache & (((uint64)1 << n) - 1));
+			_bitCache >>= n;
 		}
 
-		_inValue = (_inValue + nOrig) % valueBits;
-		_pos += nOrig;
-
-		if (!isMSB2LSB)
-			v >>= (32 - nOrig);
+		_bitsLeft -= n;
+		_pos += n;
 
 		return v;
 	}
 
 	/** Read a bit from the bit stream, without changing the stream's position. */
 	uint32 peekBit() {
-		uint32 value   = _value;
-		uint8  inValue = _inValue;
-		uint32 curStreamPos  = _stream->pos();
-		uint32 curPos = _pos;
-
-		uint32 v = getBit();
+		if (_bitsLeft == 0)
+			fillCache();
 
-		_pos     = curPos;
-		_stream->seek(curStreamPos);
-		_inValue = inValue;
-		_value   = value;
+		if (isMSB2LSB)
+			return (uint32)(_bitCache >> 63);
 
-		return v;
+		return (uint32)(_bitCache & 1);
 	}
 
 	/**
@@ -232,19 +202,19 @@ public:
 	 * The bit order is the same as in getBits().
 	 */
 	uint32 peekBits(uint8 n) {
-		uint32 value   = _value;
-		uint8  inValue = _inValue;
-		uint32 curStreamPos  = _stream->pos();
-		uint32 curPos = _pos;
+		if (n == 0)
+			return 0;
 
-		uint32 v = getBits(n);
+		if (n > 32)
+			error("BitStreamImpl::peekBits(): Too many bits requested to be peeked");
 
-		_pos     = curPos;
-		_stream->seek(curStreamPos);
-		_inValue = inValue;
-		_value   = value;
+		while (_bitsLeft < n)
+			fillCache();
 
-		return v;
+		if (isMSB2LSB)
+			return (uint32)(_bitCache >> (64 - n));
+
+		return (uint32)(_bitCache & (((uint64)1 << n) - 1));
 	}
 
 	/**
@@ -272,21 +242,27 @@ public:
 	void rewind() {
 		_stream->seek(0);
 
-		_value   = 0;
-		_inValue = 0;
-		_pos     = 0;
+		_bitCache = 0;
+		_bitsLeft = 0;
+		_pos      = 0;
 	}
 
 	/** Skip the specified amount of bits. */
 	void skip(uint32 n) {
-		while (n-- > 0)
-			getBit();
+		while (n > 32) {
+			getBits(32);
+			n -= 32;
+		}
+
+		if (n > 0)
+			getBits(n);
 	}
 
 	/** Skip the bits to closest data value border. */
 	void align() {
-		while (_inValue)
-			getBit();
+		uint32 inValue = _pos % valueBits;
+		if (inValue)
+			skip(valueBits - inValue);
 	}
 
 	/** Return the stream position in bits. */
@@ -52,7 +52,7 @@ char const *const ConfigManager::kCloudDomain = "cloud";
 #pragma mark -
 
 
-ConfigManager::ConfigManager() : _activeDomain(0) {
+ConfigManager::ConfigManager() : _activeDomain(0), _dirty(true) {
 }
 
 void ConfigManager::defragment() {
@@ -78,6 +78,7 @@ void ConfigManager::copyFrom(ConfigManager &source) {
 	_activeDomainName = source._activeDomainName;
 	_activeDomain = &_gameDomains[_activeDomainName];
 	_filename = source._filename;
+	_dirty = source._dirty;
 }
 
 
@@ -254,10 +255,18 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 	}
 
 	addDomain(domainName, domain); // Add the last domain found
+
+	// What we just loaded is by definition what is on disk
+	_dirty = false;
 }
 
 void ConfigManager::flushToDisk() {
 #ifndef __DC__
+	// Several GUI paths flush unconditionally; skip the full rewrite of
+	// the config file when nothing changed since the last flush.
+	if (!_dirty)
+		return;
+
 	WriteStream *stream;
 
 	if (_filename.empty()) {
@@ -316,6 +325,8 @@ void ConfigManager::flushToDisk() {
 
 	delete stream;
 
+	_dirty = false;
+
 #endif // !__DC__
 }
 
@@ -390,6 +401,13 @@ const ConfigManager::Domain *ConfigManager::getDomain(const String &domName) con
 }
 
 ConfigManager::Domain *ConfigManager::getDomain(const String &domName) {
+	// Callers holding a mutable domain may modify it behind our back,
+	// so pessimistically treat the config as changed.
+	_dirty = true;
+	return getDomainIntern(domName);
+}
+
+ConfigManager::Domain *ConfigManager::getDomainIntern(const String &domName) {
 	assert(!domName.empty());
 	assert(isValidDomainName(domName));
 
@@ -451,13 +469,17 @@ bool ConfigManager::hasKey(const String &key, const String &domName) const {
 }
 
 void ConfigManager::removeKey(const String &key, const String &domName) {
-	Domain *domain = getDomain(domName);
+	Domain *domain = getDomainIntern(domName);
 
 	if (!domain)
 		error("ConfigManager::removeKey(%s, %s) called on non-existent domain",
 		      key.c_str(), domName.c_str());
 
-	domain->erase(key);
+	if (domain->contains(key)) {
+		domain->erase(key);
+		if (domain != &_transientDomain)
+			_dirty = true;
+	}
 }
 
 
@@ -530,15 +552,21 @@ bool ConfigManager::getBool(const String &key, const String &domName) const {
 
 
 void ConfigManager::set(const String &key, const String &value) {
+	// Write the new key/value pair into the active domain, resp. into
+	// the application domain if no game domain is active.
+	Domain *domain = _activeDomain ? _activeDomain : &_appDomain;
+
+	// Setting an unchanged value must not mark the config as modified,
+	// so closing an options dialog without touching anything does not
+	// trigger a full config file rewrite later on.
+	if (!_transientDomain.contains(key) && domain->contains(key) && domain->getVal(key) == value)
+		return;
+
 	// Remove the transient domain value, if any.
 	_transientDomain.erase(key);
 
-	// Write the new key/value pair into the active domain, resp. into
-	// the application domain if no game domain is active.
-	if (_activeDomain)
-		(*_activeDomain)[key] = value;
-	else
-		_appDomain[key] = value;
+	(*domain)[key] = value;
+	_dirty = true;
 }
 
 void ConfigManager::set(const String &key, const String &value, const String &domName) {
@@ -550,13 +578,18 @@ void ConfigManager::set(const String &key, const String &value, const String &do
 		return;
 	}
 
-	Domain *domain = getDomain(domName);
+	Domain *domain = getDomainIntern(domName);
 
 	if (!domain)
 		error("ConfigManager::set(%s,%s,%s) called on non-existent domain",
 		      key.c_str(), value.c_str(), domName.c_str());
 
+	if (domain->contains(key) && domain->getVal(key) == value)
+		return;
+
 	(*domain)[key] = value;
+	if (domain != &_transientDomain)
+		_dirty = true;
 
 	// TODO/FIXME: We used to erase the given key from the transient domain
 	// here. Do we still want to do that?
@@ -640,6 +673,8 @@ void ConfigManager::addGameDomain(const String &domName) {
 	// Add it to the _domainSaveOrder, if it's not already in there
 	if (find(_domainSaveOrder.begin(), _domainSaveOrder.end(), domName) == _domainSaveOrder.end())
 		_domainSaveOrder.push_back(domName);
+
+	_dirty = true;
 }
 
 void ConfigManager::addMiscDomain(const String &domName) {
@@ -647,6 +682,7 @@ void ConfigManager::addMiscDomain(const String &domName) {
 	assert(isValidDomainName(domName));
 
 	_miscDomains[domName];
+	_dirty = true;
 }
 
 void ConfigManager::removeGameDomain(const String &domName) {
@@ -657,12 +693,14 @@ void ConfigManager::removeGameDomain(const String &domName) {
 		_activeDomain = 0;
 	}
 	_gameDomains.erase(domName);
+	_dirty = true;
 }
 
 void ConfigManager::removeMiscDomain(const String &domName) {
 	assert(!domName.empty());
 	assert(isValidDomainName(domName));
 	_miscDomains.erase(domName);
+	_dirty = true;
 }
 
 
@@ -698,6 +736,7 @@ void ConfigManager::renameDomain(const String &oldName, const String &newName, D
 		newDom[iter->_key] = iter->_value;
 
 	map.erase(oldName);
+	_dirty = true;
 }
 
 bool ConfigManager::hasGameDomain(const String &domName) const {
@@ -152,7 +152,9 @@ public:
 	void				flushToDisk();
 
 	void				setActiveDomain(const String &domName);
-	Domain *			getActiveDomain() { return _activeDomain; }
+	// Handing out a mutable domain pessimistically marks the config as
+	// changed; several callers modify the returned domain directly.
+	Domain *			getActiveDomain() { _dirty = true; return _activeDomain; }
 	const Domain *		getActiveDomain() const { return _activeDomain; }
 	const String &		getActiveDomainName() const { return _activeDomainName; }
 
@@ -168,7 +170,8 @@ public:
 	bool				hasMiscDomain(const String &domName) const;
 
 	const DomainMap &	getGameDomains() const { return _gameDomains; }
-	DomainMap::iterator beginGameDomains() { return _gameDomains.begin(); }
+	// Like getActiveDomain(), mutable iterators mark the config as changed.
+	DomainMap::iterator beginGameDomains() { _dirty = true; return _gameDomains.begin(); }
 	DomainMap::iterator endGameDomains() { return _gameDomains.end(); }
 
 	static void			defragment();	// move in memory to reduce fragmentation
@@ -183,6 +186,16 @@ private:
 	void			writeDomain(WriteStream &stream, const String &name, const Domain &domain);
 	void			renameDomain(const String &oldName, const String &newName, DomainMap &map);
 
+	Domain *		getDomainIntern(const String &domName);
+
+	/**
+	 * Set whenever the configuration is modified, cleared after a
+	 * successful flush or (re)load. flushToDisk skips the full rewrite
+	 * of the config file when this is still clear; with hundreds of
+	 * game entries, that rewrite is by far the most expensive part.
+	 */
+	bool			_dirty;
+
 	Domain			_transientDomain;
 	DomainMap		_gameDomains;
 	DomainMap		_miscDomains;		// Any other domains
@@ -25,6 +25,7 @@
 #include "common/debug.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
+#include "common/stream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -161,6 +162,7 @@ void CoroutineScheduler::reset() {
 		delete pProc->state;
 		pProc->state = 0;
 		Common::fill(&pProc->pidWaiting[0], &pProc->pidWaiting[CORO_MAX_PID_WAITING], 0);
+		pProc->waitEndTime = 0;
 		pProc = pProc->pNext;
 	}
 
@@ -219,14 +221,52 @@ void CoroutineScheduler::checkStack() {
 }
 #endif
 
+bool CoroutineScheduler::waitCanComplete(PROCESS *pProc, uint32 currentTime) {
+	// Processes not blocked inside a wait or sleep call are always ready
+	if (!pProc->pidWaiting[0] && !pProc->waitEndTime)
+		return true;
+
+	// A timed wait becomes ready once its expiry time is reached. This
+	// also covers plain sleep() calls, which only wait on the clock
+	if (pProc->waitEndTime != CORO_INFINITE && currentTime >= pProc->waitEndTime)
+		return true;
+
+	// Otherwise the process is ready as soon as one of the pids it is
+	// waiting on could satisfy the wait - either the process/event is
+	// gone, or it is an event that has been signalled. The wait call
+	// itself re-tests the full condition once it is dispatched
+	for (int i = 0; i < CORO_MAX_PID_WAITING && pProc->pidWaiting[i]; ++i) {
+		PROCESS *pWaitProc = getProcess(pProc->pidWaiting[i]);
+		if (pWaitProc == NULL) {
+			EVENT *pEvent = getEvent(pProc->pidWaiting[i]);
+			if (pEvent == NULL || pEvent->signalled)
+				return true;
+		}
+	}
+
+	return false;
+}
+
 void CoroutineScheduler::schedule() {
 	// start dispatching active process list
 	PROCESS *pNext;
 	PROCESS *pProc = active->pNext;
+	uint32 currentTime = g_system->getMillis();
+
 	while (pProc != NULL) {
 		pNext = pProc->pNext;
 
 		if (--pProc->sleepTime <= 0) {
+			// Don't re-enter a process that is blocked inside a wait or
+			// sleep call whose condition cannot be satisfied yet; doing
+			// so would only re-test the condition and yield again
+			if (!waitCanComplete(pProc, currentTime)) {
+				// keep the process ready for the following cycles
+				pProc->sleepTime = 0;
+				pProc = pNext;
+				continue;
+			}
+
 			// process is ready for dispatch, activate it
 			pCurrent = pProc;
 			pProc->coroAddr(pProc->state, pProc->param);
@@ -358,6 +398,7 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 	pCurrent->pidWaiting[0] = pid;
 
 	_ctx->endTime = (duration == CORO_INFINITE) ? CORO_INFINITE : g_system->getMillis() + duration;
+	pCurrent->waitEndTime = _ctx->endTime;
 	if (expired)
 		// Presume it will expire
 		*expired = true;
@@ -394,6 +435,7 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 
 	// Signal waiting is done
 	Common::fill(&pCurrent->pidWaiting[0], &pCurrent->pidWaiting[CORO_MAX_PID_WAITING], 0);
+	pCurrent->waitEndTime = 0;
 
 	CORO_END_CODE;
 }
@@ -419,6 +461,7 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 	Common::copy(pidList, pidList + nCount, pCurrent->pidWaiting);
 
 	_ctx->endTime = (duration == CORO_INFINITE) ? CORO_INFINITE : g_system->getMillis() + duration;
+	pCurrent->waitEndTime = _ctx->endTime;
 	if (expired)
 		// Presume that delay will expire
 		*expired = true;
@@ -461,6 +504,7 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 
 	// Signal waiting is done
 	Common::fill(&pCurrent->pidWaiting[0], &pCurrent->pidWaiting[CORO_MAX_PID_WAITING], 0);
+	pCurrent->waitEndTime = 0;
 
 	CORO_END_CODE;
 }
@@ -478,6 +522,7 @@ void CoroutineScheduler::sleep(CORO_PARAM, uint32 duration) {
 	CORO_BEGIN_CODE(_ctx);
 
 	_ctx->endTime = g_system->getMillis() + duration;
+	pCurrent->waitEndTime = _ctx->endTime;
 
 	// Outer loop for doing checks until expiry
 	while (g_system->getMillis() < _ctx->endTime) {
@@ -485,6 +530,8 @@ void CoroutineScheduler::sleep(CORO_PARAM, uint32 duration) {
 		CORO_SLEEP(1);
 	}
 
+	pCurrent->waitEndTime = 0;
+
 	CORO_END_CODE;
 }
 
@@ -537,6 +584,10 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 	// wake process up as soon as possible
 	pProc->sleepTime = 1;
 
+	// process is not waiting on anything yet
+	Common::fill(&pProc->pidWaiting[0], &pProc->pidWaiting[CORO_MAX_PID_WAITING], 0);
+	pProc->waitEndTime = 0;
+
 	// set new process id
 	pProc->pid = pid;
 
@@ -714,6 +765,69 @@ void CoroutineScheduler::resetEvent(uint32 pidEvent) {
 		evt->signalled = false;
 }
 
+/** Parameter block of a process started by beginAsyncRead() */
+struct ASYNC_READ {
+	SeekableReadStream *stream;
+	byte *dest;
+	uint32 size;
+	uint32 pidEvent;
+};
+
+/** How much an asynchronous read may transfer per scheduler cycle */
+static const uint32 ASYNC_READ_CHUNK = 64 * 1024;
+
+/**
+ * Process that performs a time-sliced read for beginAsyncRead(),
+ * signalling the completion event once everything was transferred (or
+ * the stream ran out early, which the caller can detect on the stream).
+ */
+static void asyncReadProcess(CORO_PARAM, const void *param) {
+	// The parameter block was copied into the process, so it persists
+	// across yields; the read position lives in the coroutine context
+	const ASYNC_READ *req = (const ASYNC_READ *)param;
+
+	CORO_BEGIN_CONTEXT;
+		uint32 pos;
+		uint32 chunk;
+	CORO_END_CONTEXT(_ctx);
+
+	CORO_BEGIN_CODE(_ctx);
+
+	_ctx->pos = 0;
+	while (_ctx->pos < req->size) {
+		_ctx->chunk = MIN(req->size - _ctx->pos, ASYNC_READ_CHUNK);
+		_ctx->chunk = req->stream->read(req->dest + _ctx->pos, _ctx->chunk);
+		_ctx->pos += _ctx->chunk;
+
+		// A short read means error or end of stream; give up
+		if (_ctx->chunk == 0)
+			break;
+
+		if (_ctx->pos < req->size)
+			CORO_SLEEP(1);
+	}
+
+	CoroScheduler.setEvent(req->pidEvent);
+
+	CORO_END_CODE;
+}
+
+uint32 CoroutineScheduler::beginAsyncRead(SeekableReadStream *stream, byte *dest, uint32 size) {
+	ASYNC_READ req;
+
+	// The request must fit into the process parameter area
+	assert(sizeof(req) <= CORO_PARAM_SIZE);
+
+	req.stream = stream;
+	req.dest = dest;
+	req.size = size;
+	req.pidEvent = createEvent(true, false);
+
+	createProcess(asyncReadProcess, &req, sizeof(req));
+
+	return req.pidEvent;
+}
+
 void CoroutineScheduler::pulseEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
 	if (!evt)
@@ -30,6 +30,8 @@
 
 namespace Common {
 
+class SeekableReadStream;
+
 /**
  * @defgroup Coroutine support for simulating multi-threading.
  *
@@ -306,6 +308,7 @@ struct PROCESS {
 	CORO_ADDR  coroAddr;    ///< the entry point of the coroutine
 
 	int sleepTime;      ///< number of scheduler cycles to sleep
+	uint32 waitEndTime; ///< time the active wait or sleep expires, CORO_INFINITE for none, 0 when not waiting
 	uint32 pid;         ///< process ID
 	uint32 pidWaiting[CORO_MAX_PID_WAITING];    ///< Process ID(s) process is currently waiting on
 	char param[CORO_PARAM_SIZE];    ///< process specific info
@@ -382,6 +385,12 @@ private:
 
 	PROCESS *getProcess(uint32 pid);
 	EVENT *getEvent(uint32 pid);
+
+	/**
+	 * Checks whether a process blocked inside a wait or sleep call could
+	 * make progress if it were dispatched on this scheduler cycle
+	 */
+	bool waitCanComplete(PROCESS *pProc, uint32 currentTime);
 public:
 	/**
 	 * Kills all processes and places them on the free list.
@@ -553,6 +562,26 @@ public:
 	 * @remarks     Should not be run inside of another process
 	 */
 	void pulseEvent(uint32 pidEvent);
+
+	/* Asynchronous I/O methods */
+	/**
+	 * Starts reading size bytes from the given stream into dest as a
+	 * background process. Since there are no portable I/O threads, the
+	 * read is time-sliced: the process reads one bounded chunk per
+	 * scheduler cycle, so other coroutines (e.g. script waits) keep
+	 * running while the data trickles in.
+	 *
+	 * Returns the pid of a manual-reset event that is signalled once
+	 * the read has finished; wait for it with waitForSingleObject() and
+	 * release it with closeEvent(). The stream stays owned by the
+	 * caller, must not be used by it until the event fires, and can be
+	 * checked with err()/eos() afterwards if a short read is possible.
+	 *
+	 * @param stream        Stream to read from, at its current position
+	 * @param dest          Destination buffer, must outlive the read
+	 * @param size          Number of bytes to read
+	 */
+	uint32 beginAsyncRead(SeekableReadStream *stream, byte *dest, uint32 size);
 };
 
 //@}
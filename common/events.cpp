@@ -0,0 +1,59 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/events.h"
+#include "common/system.h"
+#include "common/util.h"
+
+namespace Common {
+
+uint EventManager::pollAllEvents(List<Event> &events) {
+	Event event;
+	uint count = 0;
+
+	while (pollEvent(event)) {
+		events.push_back(event);
+		count++;
+	}
+
+	return count;
+}
+
+bool EventManager::waitEventWithTimeout(Event &event, uint timeoutMillis) {
+	uint32 end = g_system->getMillis() + timeoutMillis;
+
+	for (;;) {
+		if (pollEvent(event))
+			return true;
+
+		uint32 now = g_system->getMillis();
+		if (now >= end)
+			return false;
+
+		// Without a blocking wait from the OS all we can do is sleep in
+		// small slices, which still caps the wakeup rate well below that
+		// of clients hammering pollEvent in a tight loop.
+		g_system->delayMillis(MIN<uint32>(10, end - now));
+	}
+}
+
+} // End of namespace Common
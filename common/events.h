@@ -398,6 +398,29 @@ public:
 	 */
 	virtual bool pollEvent(Event &event) = 0;
 
+	/**
+	 * Drains all pending events into the given list, so a client can
+	 * handle a whole tick's worth of input with a single call instead
+	 * of polling once per event.
+	 * @param events	list the pending events are appended to.
+	 * @return the number of events that were appended.
+	 */
+	uint pollAllEvents(List<Event> &events);
+
+	/**
+	 * Wait for the next event, but give up after the given timeout.
+	 *
+	 * The generic implementation simply polls in small sleep slices;
+	 * ports whose OS offers a blocking event wait should override this
+	 * so an idle event loop (e.g. the launcher or a paused game) can
+	 * sleep properly instead of waking up just to poll.
+	 *
+	 * @param event	point to an Event struct, which will be filled with the event data.
+	 * @param timeoutMillis	how long to wait at most, in milliseconds.
+	 * @return true if an event was retrieved before the timeout expired.
+	 */
+	virtual bool waitEventWithTimeout(Event &event, uint timeoutMillis);
+
 	/**
 	 * Pushes a "fake" event into the event queue
 	 */
@@ -31,6 +31,17 @@
 #include "common/util.h"
 #include "common/textconsole.h"
 
+// Vectorized split-radix pass, processing two complex values per step.
+// This is the shared workhorse behind DCT and RDFT as well, so QDM2 and
+// Bink audio benefit from it too. The scalar pass remains the fallback.
+#ifdef __SSE2__
+#include <emmintrin.h>
+#define USE_FFT_SIMD
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define USE_FFT_SIMD
+#endif
+
 namespace Common {
 
 FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
@@ -173,11 +184,92 @@ static void name(Complex *z, const float *wre, unsigned int n) { \
 	} while(--n);\
 }
 
+#ifdef USE_FFT_SIMD
+
+/**
+ * Vectorized equivalent of one split-radix pass. Each step handles a
+ * pair of adjacent complex values, i.e. one TRANSFORM of the scalar
+ * code per two lanes, with the butterflies rewritten lanewise:
+ * with p = (t1+t5, t2+t6) and q = (t2-t6, -(t1-t5)) the outputs are
+ * a0+p, a1+q, a0-p and a1-q, which matches the scalar arithmetic
+ * operation for operation. Since all loads happen before any store,
+ * this also provides the aliasing guarantee of the _BIG variant.
+ */
+static void passSIMD(Complex *z, const float *wre, unsigned int n) {
+	int o1 = 2 * n;
+	int o2 = 4 * n;
+	int o3 = 6 * n;
+	const float *wim = wre + o1;
+
+	for (unsigned int i = 0; i < n; i++) {
+		// The first pair starts with TRANSFORM_ZERO, i.e. w = (1, 0)
+		const float wre0 = (i == 0) ? 1.0f : wre[0];
+		const float wim0 = (i == 0) ? 0.0f : wim[0];
+
+#ifdef __SSE2__
+		const __m128 wr = _mm_set_ps(wre[1], wre[1], wre0, wre0);
+		const __m128 wi = _mm_set_ps(-wim[-1], wim[-1], -wim0, wim0);
+
+		const __m128 z0 = _mm_loadu_ps(&z[0].re);
+		const __m128 z1 = _mm_loadu_ps(&z[o1].re);
+		const __m128 z2 = _mm_loadu_ps(&z[o2].re);
+		const __m128 z3 = _mm_loadu_ps(&z[o3].re);
+
+		// t1/t2 and t5/t6 of the scalar TRANSFORM
+		const __m128 sw2 = _mm_shuffle_ps(z2, z2, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 sw3 = _mm_shuffle_ps(z3, z3, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 t12 = _mm_add_ps(_mm_mul_ps(z2, wr), _mm_mul_ps(sw2, wi));
+		const __m128 t56 = _mm_sub_ps(_mm_mul_ps(z3, wr), _mm_mul_ps(sw3, wi));
+
+		const __m128 p = _mm_add_ps(t12, t56);
+		const __m128 d = _mm_sub_ps(t12, t56);
+		const __m128 signIm = _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0x80000000, 0));
+		const __m128 q = _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), signIm);
+
+		_mm_storeu_ps(&z[0].re,  _mm_add_ps(z0, p));
+		_mm_storeu_ps(&z[o1].re, _mm_add_ps(z1, q));
+		_mm_storeu_ps(&z[o2].re, _mm_sub_ps(z0, p));
+		_mm_storeu_ps(&z[o3].re, _mm_sub_ps(z1, q));
+#else
+		const float wrA[4] = { wre0, wre0, wre[1], wre[1] };
+		const float wiA[4] = { wim0, -wim0, wim[-1], -wim[-1] };
+		const float32x4_t wr = vld1q_f32(wrA);
+		const float32x4_t wi = vld1q_f32(wiA);
+
+		const float32x4_t z0 = vld1q_f32(&z[0].re);
+		const float32x4_t z1 = vld1q_f32(&z[o1].re);
+		const float32x4_t z2 = vld1q_f32(&z[o2].re);
+		const float32x4_t z3 = vld1q_f32(&z[o3].re);
+
+		const float32x4_t t12 = vaddq_f32(vmulq_f32(z2, wr), vmulq_f32(vrev64q_f32(z2), wi));
+		const float32x4_t t56 = vsubq_f32(vmulq_f32(z3, wr), vmulq_f32(vrev64q_f32(z3), wi));
+
+		const float32x4_t p = vaddq_f32(t12, t56);
+		const float32x4_t d = vsubq_f32(t12, t56);
+		const uint32x4_t signIm = { 0, 0x80000000, 0, 0x80000000 };
+		const float32x4_t q = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vrev64q_f32(d)), signIm));
+
+		vst1q_f32(&z[0].re,  vaddq_f32(z0, p));
+		vst1q_f32(&z[o1].re, vaddq_f32(z1, q));
+		vst1q_f32(&z[o2].re, vsubq_f32(z0, p));
+		vst1q_f32(&z[o3].re, vsubq_f32(z1, q));
+#endif
+
+		z += 2;
+		wre += 2;
+		wim -= 2;
+	}
+}
+
+#else
+
 PASS(pass)
 #undef BUTTERFLIES
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+#endif // USE_FFT_SIMD
+
 void FFT::fft4(Complex *z) {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
 
@@ -242,10 +334,14 @@ void FFT::fft(int n, int logn, Complex *z) {
 		fft((n / 4), logn - 2, z + (n / 4) * 2);
 		fft((n / 4), logn - 2, z + (n / 4) * 3);
 		assert(_cosTables[logn - 4]);
+#ifdef USE_FFT_SIMD
+		passSIMD(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+#else
 		if (n > 1024)
 			pass_big(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
 		else
 			pass(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+#endif
 	}
 }
 
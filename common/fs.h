@@ -222,6 +222,18 @@ public:
 	 */
 	virtual SeekableReadStream *createReadStream() const;
 
+	/**
+	 * Creates a SeekableReadStream instance which maps the file referred
+	 * by this node into memory, on backends which support memory mapped
+	 * files. Reads from such a stream are zero-copy operations backed by
+	 * the operating system's page cache, which makes it attractive for
+	 * large, frequently seeked resource files. On backends without
+	 * mapping support this transparently degrades to createReadStream().
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual SeekableReadStream *createMemoryMappedStream() const;
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
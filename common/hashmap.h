@@ -114,6 +114,7 @@ private:
 #endif
 
 	Node **_storage;	///< hashtable of size arrsize.
+	size_type *_hashes;	///< cached key hash per slot, so probing can reject mismatches without touching the node
 	size_type _mask;		///< Capacity of the HashMap minus one; must be a power of two of minus one
 	size_type _size;
 	size_type _deleted; ///< Number of deleted elements (_dummyNodes)
@@ -317,6 +318,7 @@ HashMap<Key, Val, HashFunc, EqualFunc>::HashMap()
 	_storage = new Node *[HASHMAP_MIN_CAPACITY];
 	assert(_storage != NULL);
 	memset(_storage, 0, HASHMAP_MIN_CAPACITY * sizeof(Node *));
+	_hashes = new size_type[HASHMAP_MIN_CAPACITY];
 
 	_size = 0;
 	_deleted = 0;
@@ -353,6 +355,7 @@ HashMap<Key, Val, HashFunc, EqualFunc>::~HashMap() {
 	  freeNode(_storage[ctr]);
 
 	delete[] _storage;
+	delete[] _hashes;
 #ifdef DEBUG_HASH_COLLISIONS
 	extern void updateHashCollisionStats(int, int, int, int, int);
 	updateHashCollisionStats(_collisions, _dummyHits, _lookups, _mask+1, _size);
@@ -372,6 +375,8 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::assign(const HM_t &map) {
 	_storage = new Node *[_mask+1];
 	assert(_storage != NULL);
 	memset(_storage, 0, (_mask+1) * sizeof(Node *));
+	_hashes = new size_type[_mask+1];
+	memcpy(_hashes, map._hashes, (_mask+1) * sizeof(size_type));
 
 	// Simply clone the map given to us, one by one.
 	_size = 0;
@@ -405,11 +410,13 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::clear(bool shrinkArray) {
 
 	if (shrinkArray && _mask >= HASHMAP_MIN_CAPACITY) {
 		delete[] _storage;
+		delete[] _hashes;
 
 		_mask = HASHMAP_MIN_CAPACITY;
 		_storage = new Node *[HASHMAP_MIN_CAPACITY];
 		assert(_storage != NULL);
 		memset(_storage, 0, HASHMAP_MIN_CAPACITY * sizeof(Node *));
+		_hashes = new size_type[HASHMAP_MIN_CAPACITY];
 	}
 
 	_size = 0;
@@ -425,6 +432,7 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity
 #endif
 	const size_type old_mask = _mask;
 	Node **old_storage = _storage;
+	size_type *old_hashes = _hashes;
 
 	// allocate a new array
 	_size = 0;
@@ -433,6 +441,7 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity
 	_storage = new Node *[newCapacity];
 	assert(_storage != NULL);
 	memset(_storage, 0, newCapacity * sizeof(Node *));
+	_hashes = new size_type[newCapacity];
 
 	// rehash all the old elements
 	for (size_type ctr = 0; ctr <= old_mask; ++ctr) {
@@ -442,14 +451,16 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity
 		// Insert the element from the old table into the new table.
 		// Since we know that no key exists twice in the old table, we
 		// can do this slightly better than by calling lookup, since we
-		// don't have to call _equal().
-		const size_type hash = _hash(old_storage[ctr]->_key);
+		// don't have to call _equal(). The hash was cached when the node
+		// was first inserted, so it need not be recomputed either.
+		const size_type hash = old_hashes[ctr];
 		size_type idx = hash & _mask;
 		for (size_type perturb = hash; _storage[idx] != NULL && _storage[idx] != HASHMAP_DUMMY_NODE; perturb >>= HASHMAP_PERTURB_SHIFT) {
 			idx = (5 * idx + perturb + 1) & _mask;
 		}
 
 		_storage[idx] = old_storage[ctr];
+		_hashes[idx] = hash;
 		_size++;
 	}
 
@@ -458,6 +469,7 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity
 	assert(_size == old_size);
 
 	delete[] old_storage;
+	delete[] old_hashes;
 
 	return;
 }
@@ -473,7 +485,7 @@ typename HashMap<Key, Val, HashFunc, EqualFunc>::size_type HashMap<Key, Val, Has
 #ifdef DEBUG_HASH_COLLISIONS
 			_dummyHits++;
 #endif
-		} else if (_equal(_storage[ctr]->_key, key))
+		} else if (_hashes[ctr] == hash && _equal(_storage[ctr]->_key, key))
 			break;
 
 		ctr = (5 * ctr + perturb + 1) & _mask;
@@ -509,7 +521,7 @@ typename HashMap<Key, Val, HashFunc, EqualFunc>::size_type HashMap<Key, Val, Has
 #endif
 			if (first_free != _mask + 1)
 				first_free = ctr;
-		} else if (_equal(_storage[ctr]->_key, key)) {
+		} else if (_hashes[ctr] == hash && _equal(_storage[ctr]->_key, key)) {
 			found = true;
 			break;
 		}
@@ -536,6 +548,7 @@ typename HashMap<Key, Val, HashFunc, EqualFunc>::size_type HashMap<Key, Val, Has
 			_deleted--;
 		_storage[ctr] = allocNode(key);
 		assert(_storage[ctr] != NULL);
+		_hashes[ctr] = hash;
 		_size++;
 
 		// Keep the load factor below a certain threshold.
@@ -29,6 +29,8 @@
 
 namespace Common {
 
+const uint8 Huffman::kMaxPrefixBits;
+
 Huffman::Symbol::Symbol(uint32 c, uint32 s) : code(c), symbol(s) {
 }
 
@@ -58,6 +60,37 @@ Huffman::Huffman(uint8 maxLength, uint32 codeCount, const uint32 *codes, const u
 		// And put the pointer to the symbol/code struct into the symbol list.
 		_symbols[i] = &_codes[lengths[i] - 1].back();
 	}
+
+	buildPrefixTables(maxLength);
+}
+
+void Huffman::buildPrefixTables(uint8 maxLength) {
+	_prefixBits = MIN(maxLength, kMaxPrefixBits);
+
+	const uint32 tableSize = 1 << _prefixBits;
+
+	PrefixEntry empty;
+	empty.symbol = 0;
+	empty.length = 0;
+
+	_prefixMSB.resize(tableSize);
+	for (uint32 i = 0; i < tableSize; i++)
+		_prefixMSB[i] = empty;
+
+	// Every code of at most _prefixBits length covers all table slots
+	// sharing its bits; the remaining bits of the slot index enumerate
+	// whatever may follow the code in the stream
+	for (uint8 length = 1; length <= _prefixBits; length++) {
+		for (CodeList::const_iterator cCode = _codes[length - 1].begin(); cCode != _codes[length - 1].end(); ++cCode) {
+			PrefixEntry entry;
+			entry.symbol = &*cCode;
+			entry.length = length;
+
+			const uint32 fillCount = 1 << (_prefixBits - length);
+			for (uint32 fill = 0; fill < fillCount; fill++)
+				_prefixMSB[(cCode->code << (_prefixBits - length)) | fill] = entry;
+		}
+	}
 }
 
 Huffman::~Huffman() {
@@ -56,6 +56,21 @@ public:
 	/** Return the next symbol in the bitstream. */
 	template<class BITSTREAM>
 	uint32 getSymbol(BITSTREAM &bits) const {
+		// Fast path: peek at the next few bits and look the code up in the
+		// prefix table, then skip the matched code's actual length. Codes
+		// longer than the table's prefix width fall back to the bit-by-bit
+		// search below, as do reads too close to the stream's end to peek.
+		// Only MSB-first streams take this path; LSB-first streams always
+		// decode bit by bit.
+		if (BITSTREAM::isMSB2LSBOrder() && bits.size() - bits.pos() >= _prefixBits) {
+			const PrefixEntry &entry = _prefixMSB[bits.peekBits(_prefixBits)];
+
+			if (entry.symbol) {
+				bits.skip(entry.length);
+				return entry.symbol->symbol;
+			}
+		}
+
 		uint32 code = 0;
 
 		for (uint32 i = 0; i < _codes.size(); i++) {
@@ -78,15 +93,36 @@ private:
 		Symbol(uint32 c, uint32 s);
 	};
 
+	/** An entry of the prefix lookup tables. A zero symbol pointer marks a
+	 *  prefix not covered by the table. */
+	struct PrefixEntry {
+		const Symbol *symbol;
+		uint8 length;
+	};
+
+	/** Maximal number of bits the prefix tables are indexed with. */
+	static const uint8 kMaxPrefixBits = 8;
+
 	typedef List<Symbol> CodeList;
 	typedef Array<CodeList> CodeLists;
 	typedef Array<Symbol *> SymbolList;
+	typedef Array<PrefixEntry> PrefixTable;
+
+	/** Fill the prefix lookup tables. */
+	void buildPrefixTables(uint8 maxLength);
 
 	/** Lists of codes and their symbols, sorted by code length. */
 	CodeLists _codes;
 
 	/** Sorted list of pointers to the symbols. */
 	SymbolList _symbols;
+
+	/** Number of bits the prefix table is indexed with. */
+	uint8 _prefixBits;
+
+	/** Lookup table for codes of at most _prefixBits length, indexed by
+	 *  the next _prefixBits bits of an MSB-first stream. */
+	PrefixTable _prefixMSB;
 };
 
 } // End of namespace Common
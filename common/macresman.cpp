@@ -25,6 +25,7 @@
 #include "common/util.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/hashmap.h"
 #include "common/macresman.h"
 #include "common/md5.h"
 #include "common/substream.h"
@@ -46,6 +47,14 @@ namespace Common {
 #define MBI_RFLEN 87
 #define MAXNAMELEN 63
 
+struct MacResManager::ResIndex {
+	typedef HashMap<uint32, int> TypeMap;
+	typedef HashMap<uint16, int> IdMap;
+
+	TypeMap typeMap;
+	Array<IdMap> idMaps;
+};
+
 MacResManager::MacResManager() {
 	memset(this, 0, sizeof(MacResManager));
 	close();
@@ -70,6 +79,7 @@ void MacResManager::close() {
 	delete[] _resLists; _resLists = 0;
 	delete[] _resTypes; _resTypes = 0;
 	delete _stream; _stream = 0;
+	delete _index; _index = 0;
 	_resMap.numTypes = 0;
 }
 
@@ -479,15 +489,33 @@ SeekableReadStream *MacResManager::getDataFork() {
 	return NULL;
 }
 
-MacResIDArray MacResManager::getResIDArray(uint32 typeID) {
-	int typeNum = -1;
-	MacResIDArray res;
+int MacResManager::typeNumForID(uint32 typeID) const {
+	if (_index)
+		return _index->typeMap.contains(typeID) ? _index->typeMap.getVal(typeID) : -1;
 
 	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+		if (_resTypes[i].id == typeID)
+			return i;
+
+	return -1;
+}
+
+int MacResManager::resNumForID(int typeNum, uint16 resID) const {
+	if (_index) {
+		const ResIndex::IdMap &ids = _index->idMaps[typeNum];
+		return ids.contains(resID) ? ids.getVal(resID) : -1;
+	}
+
+	for (int i = 0; i < _resTypes[typeNum].items; i++)
+		if (_resLists[typeNum][i].id == resID)
+			return i;
+
+	return -1;
+}
+
+MacResIDArray MacResManager::getResIDArray(uint32 typeID) {
+	MacResIDArray res;
+	int typeNum = typeNumForID(typeID);
 
 	if (typeNum == -1)
 		return res;
@@ -515,42 +543,26 @@ MacResTagArray MacResManager::getResTagArray() {
 }
 
 String MacResManager::getResName(uint32 typeID, uint16 resID) const {
-	int typeNum = -1;
-
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+	int typeNum = typeNumForID(typeID);
 
 	if (typeNum == -1)
 		return "";
 
-	for (int i = 0; i < _resTypes[typeNum].items; i++)
-		if (_resLists[typeNum][i].id == resID)
-			return _resLists[typeNum][i].name;
+	int resNum = resNumForID(typeNum, resID);
+
+	if (resNum == -1)
+		return "";
 
-	return "";
+	return _resLists[typeNum][resNum].name;
 }
 
 SeekableReadStream *MacResManager::getResource(uint32 typeID, uint16 resID) {
-	int typeNum = -1;
-	int resNum = -1;
-
-	for (int i = 0; i < _resMap.numTypes; i++)
-		if (_resTypes[i].id == typeID) {
-			typeNum = i;
-			break;
-		}
+	int typeNum = typeNumForID(typeID);
 
 	if (typeNum == -1)
 		return NULL;
 
-	for (int i = 0; i < _resTypes[typeNum].items; i++)
-		if (_resLists[typeNum][i].id == resID) {
-			resNum = i;
-			break;
-		}
+	int resNum = resNumForID(typeNum, resID);
 
 	if (resNum == -1)
 		return NULL;
@@ -657,6 +669,22 @@ void MacResManager::readMap() {
 			}
 		}
 	}
+
+	// Hash the map so that lookups don't have to scan it. In case of
+	// duplicate entries the first one wins, matching the linear scan
+	// the lookups used to do.
+	_index = new ResIndex();
+	_index->idMaps.resize(_resMap.numTypes);
+
+	for (int i = 0; i < _resMap.numTypes; i++) {
+		if (!_index->typeMap.contains(_resTypes[i].id))
+			_index->typeMap[_resTypes[i].id] = i;
+
+		for (int j = 0; j < _resTypes[i].items; j++) {
+			if (!_index->idMaps[i].contains(_resLists[i][j].id))
+				_index->idMaps[i][_resLists[i][j].id] = j;
+		}
+	}
 }
 
 String MacResManager::constructAppleDoubleName(String name) {
@@ -238,6 +238,18 @@ private:
 
 	typedef Resource *ResPtr;
 
+	/**
+	 * Hashed lookup tables over the resource map, built in readMap().
+	 * They map a type ID to its slot in _resTypes and a resource ID to its
+	 * slot in the type's _resLists entry, so that getResource() and friends
+	 * don't have to walk the map linearly on every call.
+	 */
+	struct ResIndex;
+	ResIndex *_index;
+
+	int typeNumForID(uint32 typeID) const;
+	int resNumForID(int typeNum, uint16 resID) const;
+
 	int32 _resForkOffset;
 	uint32 _resForkSize;
 
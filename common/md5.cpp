@@ -33,31 +33,24 @@
 
 namespace Common {
 
-struct md5_context {
-	uint32 total[2];
-	uint32 state[4];
-	uint8 buffer[64];
-};
-
-static void md5_starts(md5_context *ctx);
-static void md5_update(md5_context *ctx, const uint8 *input, uint32 length);
-static void md5_finish(md5_context *ctx, uint8 digest[16]);
-
-
 #define GET_UINT32(n, b, i)	(n) = READ_LE_UINT32(b + i)
 #define PUT_UINT32(n, b, i)	WRITE_LE_UINT32(b + i, n)
 
-void md5_starts(md5_context *ctx) {
-	ctx->total[0] = 0;
-	ctx->total[1] = 0;
+MD5::MD5() {
+	reset();
+}
+
+void MD5::reset() {
+	_total[0] = 0;
+	_total[1] = 0;
 
-	ctx->state[0] = 0x67452301;
-	ctx->state[1] = 0xEFCDAB89;
-	ctx->state[2] = 0x98BADCFE;
-	ctx->state[3] = 0x10325476;
+	_state[0] = 0x67452301;
+	_state[1] = 0xEFCDAB89;
+	_state[2] = 0x98BADCFE;
+	_state[3] = 0x10325476;
 }
 
-static void md5_process(md5_context *ctx, const uint8 data[64]) {
+void MD5::process(const byte data[64]) {
 	uint32 X[16], A, B, C, D;
 
 	GET_UINT32(X[0],  data,  0);
@@ -84,10 +77,10 @@ static void md5_process(md5_context *ctx, const uint8 data[64]) {
 	a += F(b,c,d) + X[k] + t; a = S(a,s) + b; \
 }
 
-	A = ctx->state[0];
-	B = ctx->state[1];
-	C = ctx->state[2];
-	D = ctx->state[3];
+	A = _state[0];
+	B = _state[1];
+	C = _state[2];
+	D = _state[3];
 
 #define F(x, y, z) (z ^ (x & (y ^ z)))
 
@@ -173,43 +166,43 @@ static void md5_process(md5_context *ctx, const uint8 data[64]) {
 
 #undef F
 
-	ctx->state[0] += A;
-	ctx->state[1] += B;
-	ctx->state[2] += C;
-	ctx->state[3] += D;
+	_state[0] += A;
+	_state[1] += B;
+	_state[2] += C;
+	_state[3] += D;
 }
 
-void md5_update(md5_context *ctx, const uint8 *input, uint32 length) {
+void MD5::update(const byte *input, uint32 length) {
 	uint32 left, fill;
 
 	if (!length)
 		return;
 
-	left = ctx->total[0] & 0x3F;
+	left = _total[0] & 0x3F;
 	fill = 64 - left;
 
-	ctx->total[0] += length;
-	ctx->total[0] &= 0xFFFFFFFF;
+	_total[0] += length;
+	_total[0] &= 0xFFFFFFFF;
 
-	if (ctx->total[0] < length)
-		ctx->total[1]++;
+	if (_total[0] < length)
+		_total[1]++;
 
 	if (left && length >= fill) {
-		memcpy((void *)(ctx->buffer + left), (const void *)input, fill);
-		md5_process(ctx, ctx->buffer);
+		memcpy((void *)(_buffer + left), (const void *)input, fill);
+		process(_buffer);
 		length -= fill;
 		input  += fill;
 		left = 0;
 	}
 
 	while (length >= 64) {
-		md5_process(ctx, input);
+		process(input);
 		length -= 64;
 		input  += 64;
 	}
 
 	if (length) {
-		memcpy((void *)(ctx->buffer + left), (const void *)input, length);
+		memcpy((void *)(_buffer + left), (const void *)input, length);
 	}
 }
 
@@ -220,38 +213,49 @@ static const uint8 md5_padding[64] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
-void md5_finish(md5_context *ctx, uint8 digest[16]) {
+void MD5::finish(uint8 digest[16]) {
 	uint32 last, padn;
 	uint32 high, low;
 	uint8 msglen[8];
 
-	high = (ctx->total[0] >> 29) | (ctx->total[1] << 3);
-	low  = (ctx->total[0] <<  3);
+	high = (_total[0] >> 29) | (_total[1] << 3);
+	low  = (_total[0] <<  3);
 
 	PUT_UINT32(low,  msglen, 0);
 	PUT_UINT32(high, msglen, 4);
 
-	last = ctx->total[0] & 0x3F;
+	last = _total[0] & 0x3F;
 	padn = (last < 56) ? (56 - last) : (120 - last);
 
-	md5_update(ctx, md5_padding, padn);
-	md5_update(ctx, msglen, 8);
+	update(md5_padding, padn);
+	update(msglen, 8);
 
-	PUT_UINT32(ctx->state[0], digest,  0);
-	PUT_UINT32(ctx->state[1], digest,  4);
-	PUT_UINT32(ctx->state[2], digest,  8);
-	PUT_UINT32(ctx->state[3], digest, 12);
+	PUT_UINT32(_state[0], digest,  0);
+	PUT_UINT32(_state[1], digest,  4);
+	PUT_UINT32(_state[2], digest,  8);
+	PUT_UINT32(_state[3], digest, 12);
 }
 
+String MD5::finishAsString() {
+	uint8 digest[16];
+	String md5;
+
+	finish(digest);
+	for (int i = 0; i < 16; i++) {
+		md5 += String::format("%02x", (int)digest[i]);
+	}
+
+	return md5;
+}
 
 bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length) {
 
 #ifdef DISABLE_MD5
 	memset(digest, 0, 16);
 #else
-	md5_context ctx;
+	MD5 ctx;
 	int i;
-	unsigned char buf[1000];
+	unsigned char buf[8192];
 	bool restricted = (length != 0);
 	uint32 readlen;
 
@@ -260,10 +264,8 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length) {
 	else
 		readlen = length;
 
-	md5_starts(&ctx);
-
 	while ((i = stream.read(buf, readlen)) > 0) {
-		md5_update(&ctx, buf, i);
+		ctx.update(buf, i);
 
 		if (restricted) {
 			length -= i;
@@ -275,7 +277,7 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length) {
 		}
 	}
 
-	md5_finish(&ctx, digest);
+	ctx.finish(digest);
 #endif
 	return true;
 }
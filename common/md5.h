@@ -30,6 +30,45 @@ namespace Common {
 class ReadStream;
 class String;
 
+/**
+ * Incremental computation of an MD5 checksum.
+ *
+ * Data can be fed in arbitrary chunks with update(), which makes this
+ * usable when the data does not live in one stream or buffer, e.g. when
+ * it arrives over the network. For the common case of hashing (a prefix
+ * of) a stream, use computeStreamMD5 below instead.
+ */
+class MD5 {
+public:
+	MD5();
+
+	/** Reset to the initial state, so the object can be reused. */
+	void reset();
+
+	/** Feed the next chunk of data into the checksum. */
+	void update(const byte *input, uint32 length);
+
+	/**
+	 * Finish the computation and return the 128 bit checksum in digest.
+	 * Call reset() before hashing anything else with the same object.
+	 */
+	void finish(uint8 digest[16]);
+
+	/**
+	 * Finish the computation and return the checksum as a human readable
+	 * lowercase hex string of length 32.
+	 * @see finish
+	 */
+	String finishAsString();
+
+private:
+	void process(const byte data[64]);
+
+	uint32 _total[2];
+	uint32 _state[4];
+	byte _buffer[64];
+};
+
 /**
  * Compute the MD5 checksum of the content of the given ReadStream.
  * The 128 bit MD5 checksum is returned directly in the array digest.
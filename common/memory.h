@@ -39,6 +39,21 @@ Type *uninitialized_copy(In first, In last, Type *dst) {
 	return dst;
 }
 
+#if __cplusplus >= 201103L
+/**
+ * Moves data from the range [first, last) to [dst, dst + (last - first)).
+ * It requires the range [dst, dst + (last - first)) to be valid and
+ * uninitialized. The source elements are left in a moved-from state and
+ * still need to be destroyed by the caller.
+ */
+template<class Type>
+Type *uninitialized_move(Type *first, Type *last, Type *dst) {
+	while (first != last)
+		new ((void *)dst++) Type(static_cast<Type &&>(*first++));
+	return dst;
+}
+#endif
+
 /**
  * Initializes the memory [first, first + (last - first)) with the value x.
  * It requires the range [first, first + (last - first)) to be valid and
@@ -21,6 +21,7 @@
  */
 
 #include "common/memorypool.h"
+#include "common/memstats.h"
 #include "common/util.h"
 
 namespace Common {
@@ -70,6 +71,8 @@ void MemoryPool::allocPage() {
 	assert(page.start);
 	_pages.push_back(page);
 
+	MemStats.addAlloc(MemStats.registerPool("memorypool"), page.numChunks * _chunkSize);
+
 
 	// Next time, we'll allocate a page twice as big as this one.
 	_chunksPerPage *= 2;
@@ -153,6 +156,7 @@ void MemoryPool::freeUnusedPages() {
 			}
 
 			::free(_pages[i].start);
+			MemStats.addFree(MemStats.registerPool("memorypool"), _pages[i].numChunks * _chunkSize);
 			++freedPagesCount;
 			_pages[i].start = NULL;
 		}
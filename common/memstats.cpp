@@ -0,0 +1,122 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/memstats.h"
+#include "common/textconsole.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(MemoryStats);
+
+MemoryStats::MemoryStats() : _numPools(0) {
+	memset(_pools, 0, sizeof(_pools));
+}
+
+int MemoryStats::registerPool(const char *name) {
+	for (int i = 0; i < _numPools; i++) {
+		if (!strcmp(_pools[i].name, name))
+			return i;
+	}
+
+	if (_numPools == kMaxPools) {
+		warning("MemoryStats: pool table is full, cannot register '%s'", name);
+		return -1;
+	}
+
+	_pools[_numPools].name = name;
+	return _numPools++;
+}
+
+void MemoryStats::addAlloc(int pool, uint32 bytes) {
+	if (pool < 0 || pool >= _numPools)
+		return;
+
+	Pool &p = _pools[pool];
+	p.current += bytes;
+	p.allocs++;
+	if (p.current > p.peak)
+		p.peak = p.current;
+}
+
+void MemoryStats::addFree(int pool, uint32 bytes) {
+	if (pool < 0 || pool >= _numPools)
+		return;
+
+	Pool &p = _pools[pool];
+	if (bytes > p.current) {
+		// More frees than allocations were reported; clamp rather than wrap
+		warning("MemoryStats: pool '%s' went negative", p.name);
+		p.current = 0;
+	} else {
+		p.current -= bytes;
+	}
+}
+
+void MemoryStats::setShrinkProc(int pool, ShrinkProc proc, void *refCon) {
+	if (pool < 0 || pool >= _numPools)
+		return;
+
+	_pools[pool].shrinkProc = proc;
+	_pools[pool].shrinkRefCon = refCon;
+}
+
+uint32 MemoryStats::getTotalCurrent() const {
+	uint32 total = 0;
+	for (int i = 0; i < _numPools; i++)
+		total += _pools[i].current;
+	return total;
+}
+
+uint32 MemoryStats::shrinkToTarget(uint32 targetTotalBytes) {
+	bool asked[kMaxPools];
+	memset(asked, 0, sizeof(asked));
+
+	uint32 total = getTotalCurrent();
+
+	while (total > targetTotalBytes) {
+		// Pick the largest pool that can shrink and was not asked yet.
+		// Asking each pool only once bounds the loop even when a pool
+		// declines to shrink as far as requested.
+		int best = -1;
+		for (int i = 0; i < _numPools; i++) {
+			if (asked[i] || !_pools[i].shrinkProc)
+				continue;
+			if (best == -1 || _pools[i].current > _pools[best].current)
+				best = i;
+		}
+
+		if (best == -1)
+			break;
+
+		asked[best] = true;
+
+		const uint32 overshoot = total - targetTotalBytes;
+		const uint32 poolTarget = (_pools[best].current > overshoot) ? _pools[best].current - overshoot : 0;
+		(_pools[best].shrinkProc)(_pools[best].shrinkRefCon, poolTarget);
+
+		total = getTotalCurrent();
+	}
+
+	return total;
+}
+
+} // End of namespace Common
@@ -0,0 +1,123 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_MEMSTATS_H
+#define COMMON_MEMSTATS_H
+
+#include "common/scummsys.h"
+#include "common/singleton.h"
+
+namespace Common {
+
+/**
+ * Opt-in memory accounting, tagged by subsystem.
+ *
+ * A subsystem that wants its memory use to be visible registers a named
+ * pool and reports its allocations and frees explicitly. Current and
+ * peak byte counts per pool can then be inspected with the memory_stats
+ * console command, which is a lot more useful than OS-level RSS when a
+ * cache is ballooning.
+ *
+ * There is deliberately no global operator new/delete hook: accounting
+ * is only meaningful at the few places that manage bulk memory (caches,
+ * pools, surfaces), and those know their sizes exactly.
+ *
+ * A cache can additionally attach a shrink callback to its pool. That
+ * turns the accounting into a budget coordinator: shrinkToTarget() asks
+ * the largest shrinkable pools to give memory back until total use is
+ * at or below a target, so several caches share one budget instead of
+ * each growing to its own bound.
+ */
+class MemoryStats : public Singleton<MemoryStats> {
+public:
+	enum {
+		kMaxPools = 16
+	};
+
+	/**
+	 * Callback asking a pool's owner to shrink its memory use down to
+	 * targetBytes. The owner reports what it actually frees through
+	 * addFree() as usual; shrinking less than asked is acceptable.
+	 */
+	typedef void (*ShrinkProc)(void *refCon, uint32 targetBytes);
+
+	MemoryStats();
+
+	/**
+	 * Registers a named accounting pool, or returns the id of the
+	 * existing pool when the name is already known. The name is not
+	 * copied, so it must stay valid for the lifetime of the singleton
+	 * (i.e. pass a string literal). Returns -1 when the table is full.
+	 */
+	int registerPool(const char *name);
+
+	/** Records an allocation of the given size. Ignores invalid pool ids. */
+	void addAlloc(int pool, uint32 bytes);
+
+	/** Records that the given number of bytes was freed again. */
+	void addFree(int pool, uint32 bytes);
+
+	/**
+	 * Attaches a shrink callback to a pool. The owner must detach it
+	 * again (proc = nullptr) before the refCon object is destroyed,
+	 * since pools outlive the caches that report into them.
+	 */
+	void setShrinkProc(int pool, ShrinkProc proc, void *refCon);
+
+	/**
+	 * Asks pools with shrink callbacks to give memory back, largest
+	 * first, until the total tracked use is at or below the target.
+	 * Each pool is asked at most once. Returns the total tracked use
+	 * after shrinking.
+	 */
+	uint32 shrinkToTarget(uint32 targetTotalBytes);
+
+	/** Returns the total current use over all pools. */
+	uint32 getTotalCurrent() const;
+
+	int getPoolCount() const { return _numPools; }
+	const char *getPoolName(int pool) const { return _pools[pool].name; }
+	uint32 getCurrent(int pool) const { return _pools[pool].current; }
+	uint32 getPeak(int pool) const { return _pools[pool].peak; }
+	uint32 getAllocCount(int pool) const { return _pools[pool].allocs; }
+	bool isShrinkable(int pool) const { return _pools[pool].shrinkProc != nullptr; }
+
+private:
+	struct Pool {
+		const char *name;
+		uint32 current;
+		uint32 peak;
+		uint32 allocs;
+		ShrinkProc shrinkProc;
+		void *shrinkRefCon;
+	};
+
+	Pool _pools[kMaxPools];
+	int _numPools;
+};
+
+} // End of namespace Common
+
+/** Shortcut for accessing the memory accounting. */
+#define MemStats	Common::MemoryStats::instance()
+
+#endif
@@ -9,6 +9,7 @@ MODULE_OBJS := \
 	error.o \
 	EventDispatcher.o \
 	EventMapper.o \
+	events.o \
 	file.o \
 	fs.o \
 	gui_options.o \
@@ -22,9 +23,11 @@ MODULE_OBJS := \
 	macresman.o \
 	memorypool.o \
 	md5.o \
+	memstats.o \
 	mutex.o \
 	osd_message_queue.o \
 	platform.o \
+	profiler.o \
 	quicktime.o \
 	random.o \
 	rational.o \
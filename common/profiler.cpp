@@ -0,0 +1,106 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/profiler.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+#include "common/util.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(Profiler);
+
+Profiler::Profiler() : _numZones(0), _frameStart(0), _numFrames(0) {
+	memset(_zones, 0, sizeof(_zones));
+	memset(_history, 0, sizeof(_history));
+}
+
+int Profiler::registerZone(const char *name) {
+	for (int i = 0; i < _numZones; i++) {
+		if (!strcmp(_zones[i].name, name))
+			return i;
+	}
+
+	if (_numZones == kMaxZones) {
+		warning("Profiler: zone table is full, cannot register '%s'", name);
+		return -1;
+	}
+
+	_zones[_numZones].name = name;
+	return _numZones++;
+}
+
+void Profiler::beginZone(int zone) {
+	if (zone < 0 || zone >= _numZones)
+		return;
+
+	_zones[zone].start = g_system->getMillis();
+}
+
+void Profiler::endZone(int zone) {
+	if (zone < 0 || zone >= _numZones)
+		return;
+
+	_zones[zone].total += g_system->getMillis() - _zones[zone].start;
+}
+
+void Profiler::frameTick() {
+	uint32 now = g_system->getMillis();
+
+	if (_frameStart == 0) {
+		// First tick ever: there is no complete frame to store yet
+		for (int i = 0; i < _numZones; i++)
+			_zones[i].total = 0;
+		_frameStart = now;
+		return;
+	}
+
+	uint32 *slot = _history[_numFrames % kFrameHistory];
+	for (int i = 0; i < _numZones; i++) {
+		slot[i] = _zones[i].total;
+		_zones[i].total = 0;
+	}
+	slot[kMaxZones] = now - _frameStart;
+
+	_frameStart = now;
+	_numFrames++;
+}
+
+int Profiler::getHistoryLength() const {
+	return (int)MIN<uint32>(_numFrames, kFrameHistory);
+}
+
+uint32 Profiler::getFrameTime(int frame) const {
+	if (frame < 0 || frame >= getHistoryLength())
+		return 0;
+
+	return _history[(_numFrames - getHistoryLength() + frame) % kFrameHistory][kMaxZones];
+}
+
+uint32 Profiler::getZoneTime(int frame, int zone) const {
+	if (frame < 0 || frame >= getHistoryLength() || zone < 0 || zone >= _numZones)
+		return 0;
+
+	return _history[(_numFrames - getHistoryLength() + frame) % kFrameHistory][zone];
+}
+
+} // End of namespace Common
@@ -0,0 +1,120 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/scummsys.h"
+#include "common/singleton.h"
+
+namespace Common {
+
+/**
+ * A lightweight frame profiler.
+ *
+ * Subsystems register named timing zones and bracket their work with
+ * beginZone()/endZone(), or with a stack based ProfileScope. The backend
+ * calls frameTick() once per updateScreen(), which closes the current
+ * frame and stores the per-zone totals in a ring buffer of the last
+ * kFrameHistory frames. The collected data can be inspected (or dumped
+ * as CSV) with the frame_profile console command.
+ *
+ * Timings use OSystem::getMillis(), so they are only as precise as the
+ * backend timer; zones shorter than a millisecond will usually read 0.
+ */
+class Profiler : public Singleton<Profiler> {
+public:
+	enum {
+		kMaxZones = 16,
+		kFrameHistory = 64
+	};
+
+	Profiler();
+
+	/**
+	 * Registers a named timing zone, or returns the id of the existing
+	 * zone when the name is already known. The name is not copied, so it
+	 * must stay valid for the lifetime of the profiler (i.e. pass a
+	 * string literal). Returns -1 when the zone table is full.
+	 */
+	int registerZone(const char *name);
+
+	/** Starts timing the given zone. Ignores invalid zone ids. */
+	void beginZone(int zone);
+
+	/** Stops timing the given zone and adds the elapsed time to the current frame. */
+	void endZone(int zone);
+
+	/** Closes the current frame, stores it in the history and opens the next one. */
+	void frameTick();
+
+	int getZoneCount() const { return _numZones; }
+	const char *getZoneName(int zone) const { return _zones[zone].name; }
+
+	/** Number of completed frames stored in the history (at most kFrameHistory). */
+	int getHistoryLength() const;
+
+	/** Total duration of a stored frame in milliseconds; frame 0 is the oldest stored one. */
+	uint32 getFrameTime(int frame) const;
+
+	/** Time spent in a zone during a stored frame, in milliseconds. */
+	uint32 getZoneTime(int frame, int zone) const;
+
+private:
+	struct Zone {
+		const char *name;
+		uint32 start;
+		uint32 total;
+	};
+
+	Zone _zones[kMaxZones];
+	int _numZones;
+
+	uint32 _frameStart;
+	uint32 _numFrames;
+
+	// Per-frame zone totals; the extra slot holds the whole frame time
+	uint32 _history[kFrameHistory][kMaxZones + 1];
+};
+
+/**
+ * Measures the time between construction and destruction in the given zone.
+ */
+class ProfileScope {
+public:
+	ProfileScope(int zone) : _zone(zone) {
+		Profiler::instance().beginZone(_zone);
+	}
+	~ProfileScope() {
+		Profiler::instance().endZone(_zone);
+	}
+
+private:
+	int _zone;
+};
+
+} // End of namespace Common
+
+/** Shortcut for accessing the profiler. */
+#define ProfMan		Common::Profiler::instance()
+
+#endif
@@ -47,6 +47,7 @@ PlaybackFile::PlaybackFile() : _tmpRecordFile(_tmpBuffer, kRecordBuffSize), _tmp
 	memset(_tmpBuffer, 1, kRecordBuffSize);
 
 	_playbackParseState = kFileStateCheckFormat;
+	_screenshotIndexValid = false;
 }
 
 PlaybackFile::~PlaybackFile() {
@@ -105,6 +106,8 @@ void PlaybackFile::close() {
 		free(i->_value.buffer);
 	}
 	_header.saveFiles.clear();
+	_screenshotIndexValid = false;
+	_screenshotIndex.clear();
 	_mode = kClosed;
 }
 
@@ -571,14 +574,22 @@ int PlaybackFile::getScreensCount() {
 	if (_mode != kRead) {
 		return 0;
 	}
+	if (!_screenshotIndexValid) {
+		buildScreenshotIndex();
+	}
+	return _screenshotIndex.size();
+}
+
+void PlaybackFile::buildScreenshotIndex() {
+	_screenshotIndex.clear();
 	_readStream->seek(0);
-	int result = 0;
 	while (skipToNextScreenshot()) {
+		// skipToNextScreenshot() consumed the tag, remember where it starts
+		_screenshotIndex.push_back(_readStream->pos() - 4);
 		uint32 size = _readStream->readUint32BE();
 		_readStream->skip(size-8);
-		++result;
 	}
-	return result;
+	_screenshotIndexValid = true;
 }
 
 bool PlaybackFile::skipToNextScreenshot() {
@@ -602,20 +613,14 @@ Graphics::Surface *PlaybackFile::getScreenShot(int number) {
 	if (_mode != kRead) {
 		return NULL;
 	}
-	_readStream->seek(0);
-	int screenCount = 1;
-	while (skipToNextScreenshot()) {
-		if (screenCount == number) {
-			screenCount++;
-			_readStream->seek(-4, SEEK_CUR);
-			return Graphics::loadThumbnail(*_readStream);
-		} else {
-			uint32 size = _readStream->readUint32BE();
-			_readStream->skip(size-8);
-			screenCount++;
-		}
+	if (!_screenshotIndexValid) {
+		buildScreenshotIndex();
+	}
+	if ((number < 1) || ((uint32)number > _screenshotIndex.size())) {
+		return NULL;
 	}
-	return NULL;
+	_readStream->seek(_screenshotIndex[number - 1]);
+	return Graphics::loadThumbnail(*_readStream);
 }
 
 void PlaybackFile::updateHeader() {
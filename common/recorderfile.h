@@ -24,6 +24,7 @@
 #define COMMON_RECORDERFILE_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/events.h"
 #include "common/mutex.h"
 #include "common/memstream.h"
@@ -144,6 +145,12 @@ private:
 	PlaybackFileHeader _header;
 	PlaybackFileState _playbackParseState;
 
+	// File offsets of all screenshot chunks, built lazily by one linear
+	// scan, so that requesting the n-th screenshot is a direct seek
+	// instead of a scan from the beginning of the file.
+	bool _screenshotIndexValid;
+	Array<uint32> _screenshotIndex;
+
 	void skipHeader();
 	bool parseHeader();
 	bool processChunk(ChunkHeader &nextChunk);
@@ -170,6 +177,7 @@ private:
 	void readHashMap(ChunkHeader chunk);
 
 	bool skipToNextScreenshot();
+	void buildScreenshotIndex();
 	void readEvent(RecorderEvent& event);
 	void readEventsToBuffer(uint32 size);
 	bool grabScreenAndComputeMD5(Graphics::Surface &screen, uint8 md5[16]);
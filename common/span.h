@@ -530,11 +530,16 @@ protected:
 	}
 
 	inline void validate(const index_type index, const difference_type deltaInBytes, const SpanValidationMode mode = kValidateRead) const {
+		// In release builds the data is trusted and accesses compile down to
+		// raw pointer arithmetic, like the skipped consistency checks in
+		// zlib.cpp; development builds keep the full bounds validation
+#ifndef RELEASE_BUILD
 		/* LCOV_EXCL_START */
 		if (impl().checkInvalidBounds(index, deltaInBytes)) {
 			error("%s", impl().getValidationMessage(index, deltaInBytes, mode).c_str());
 		}
 		/* LCOV_EXCL_STOP */
+#endif
 	}
 };
 
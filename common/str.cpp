@@ -35,6 +35,36 @@ static uint32 computeCapacity(uint32 len) {
 	return ((len + 32 - 1) & ~0x1F);
 }
 
+// Pools for the smallest heap buffer capacities (32 to 128 bytes). Since
+// capacities are always multiples of 32, these four buckets cover nearly
+// all transient strings that outgrow the builtin storage, and spare the
+// general allocator millions of short-lived new[]/delete[] pairs during
+// detection and script parsing.
+static const uint32 kMaxPooledCapacity = 128;
+static MemoryPool *g_storagePools[4]; // index: capacity / 32 - 1
+
+static char *allocStorage(uint32 capacity) {
+	if (capacity <= kMaxPooledCapacity && (capacity & 0x1F) == 0) {
+		const uint32 idx = capacity / 32 - 1;
+		if (!g_storagePools[idx])
+			g_storagePools[idx] = new MemoryPool(capacity);
+		return (char *)g_storagePools[idx]->allocChunk();
+	}
+	return new char[capacity];
+}
+
+static void freeStorage(char *str, uint32 capacity) {
+	if (capacity <= kMaxPooledCapacity && (capacity & 0x1F) == 0) {
+		const uint32 idx = capacity / 32 - 1;
+		// Every pooled capacity is allocated through allocStorage, so the
+		// pool must exist by the time a buffer of that size is freed
+		assert(g_storagePools[idx]);
+		g_storagePools[idx]->freeChunk(str);
+		return;
+	}
+	delete[] str;
+}
+
 String::String(const char *str) : _size(0), _str(_storage) {
 	if (str == 0) {
 		_storage[0] = 0;
@@ -65,7 +95,7 @@ void String::initWithCStr(const char *str, uint32 len) {
 		// Not enough internal storage, so allocate more
 		_extern._capacity = computeCapacity(len+1);
 		_extern._refCount = 0;
-		_str = new char[_extern._capacity];
+		_str = allocStorage(_extern._capacity);
 		assert(_str != 0);
 	}
 
@@ -142,7 +172,7 @@ void String::ensureCapacity(uint32 new_size, bool keep_old) {
 		newCapacity = MAX(curCapacity * 2, computeCapacity(new_size+1));
 
 	// Allocate new storage
-	newStorage = new char[newCapacity];
+	newStorage = allocStorage(newCapacity);
 	assert(newStorage);
 
 
@@ -199,7 +229,7 @@ void String::decRefCount(int *oldRefCount) {
 			assert(g_refCountPool);
 			g_refCountPool->freeChunk(oldRefCount);
 		}
-		delete[] _str;
+		freeStorage(_str, _extern._capacity);
 
 		// Even though _str points to a freed memory block now,
 		// we do not change its value, because any code that calls
@@ -237,6 +267,50 @@ String &String::operator=(const String &str) {
 	return *this;
 }
 
+#if __cplusplus >= 201103L
+String::String(String &&str) : _size(str._size) {
+	if (str.isStorageIntern()) {
+		memcpy(_storage, str._storage, _size + 1);
+		_str = _storage;
+	} else {
+		// Steal the external storage, including a possibly shared
+		// refcount, and leave the source as an empty string
+		_extern._refCount = str._extern._refCount;
+		_extern._capacity = str._extern._capacity;
+		_str = str._str;
+
+		str._str = str._storage;
+		str._size = 0;
+		str._storage[0] = 0;
+	}
+}
+
+String &String::operator=(String &&str) {
+	if (&str == this)
+		return *this;
+
+	if (str.isStorageIntern()) {
+		decRefCount(_extern._refCount);
+		_size = str._size;
+		_str = _storage;
+		memcpy(_str, str._str, _size + 1);
+	} else {
+		decRefCount(_extern._refCount);
+
+		_extern._refCount = str._extern._refCount;
+		_extern._capacity = str._extern._capacity;
+		_size = str._size;
+		_str = str._str;
+
+		str._str = str._storage;
+		str._size = 0;
+		str._storage[0] = 0;
+	}
+
+	return *this;
+}
+#endif
+
 String &String::operator=(char c) {
 	decRefCount(_extern._refCount);
 	_str = _storage;
@@ -25,6 +25,7 @@
 #include "common/system.h"
 #include "common/events.h"
 #include "common/fs.h"
+#include "common/rect.h"
 #include "common/savefile.h"
 #include "common/str.h"
 #include "common/taskbar.h"
@@ -121,6 +122,19 @@ bool OSystem::setGraphicsMode(const char *name) {
 	return false;
 }
 
+void OSystem::copyRectsToScreen(const void *buf, int pitch, const Common::Rect *rects, uint numRects) {
+	const Graphics::PixelFormat format = getScreenFormat();
+
+	for (uint i = 0; i < numRects; ++i) {
+		const Common::Rect &r = rects[i];
+		if (!r.isValidRect() || r.isEmpty())
+			continue;
+
+		const byte *src = (const byte *)buf + r.top * pitch + r.left * format.bytesPerPixel;
+		copyRectToScreen(src, pitch, r.left, r.top, r.width(), r.height());
+	}
+}
+
 void OSystem::fatalError() {
 	quit();
 	exit(1);
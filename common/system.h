@@ -755,6 +755,26 @@ public:
 	 */
 	virtual void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) = 0;
 
+	/**
+	 * Blit a batch of rectangles from the same source buffer to the virtual
+	 * screen. Coordinates of each rect apply to both the buffer and the
+	 * screen, so callers holding a full back buffer (and a dirty-rect list,
+	 * see Graphics::ManagedSurface::getDirtyRects) can push only the areas
+	 * that changed in one call.
+	 *
+	 * The default implementation simply forwards each rect to
+	 * copyRectToScreen; backends that can batch uploads (e.g. into a single
+	 * texture update) are encouraged to override this.
+	 *
+	 * @param buf		the source buffer, covering the whole screen
+	 * @param pitch		the buffer pitch (number of bytes in a scanline)
+	 * @param rects		list of screen areas to update
+	 * @param numRects	number of rects in the list
+	 *
+	 * @see copyRectToScreen
+	 */
+	virtual void copyRectsToScreen(const void *buf, int pitch, const Common::Rect *rects, uint numRects);
+
 	/**
 	 * Lock the active screen framebuffer and return a Graphics::Surface
 	 * representing it. The caller can then perform arbitrary graphics
@@ -225,6 +225,21 @@ String TranslationManager::getLangById(int id) const {
 }
 
 bool TranslationManager::openTranslationsFile(File &inFile) {
+	// Try the location where we found the file the previous time first.
+	// The search below can be expensive (the Themepath is scanned
+	// recursively), and it is done once on startup and then again for
+	// every language change.
+	if (!_translationsFilePath.empty()) {
+		FSNode fileNode(_translationsFilePath);
+		if (fileNode.exists() && fileNode.isReadable() && !fileNode.isDirectory() && inFile.open(fileNode)) {
+			if (checkHeader(inFile))
+				return true;
+			inFile.close();
+		}
+		// The file moved or changed; fall back to a full search.
+		_translationsFilePath.clear();
+	}
+
 	// First look in the Themepath if we can find the file.
 	if (ConfMan.hasKey("themepath") && openTranslationsFile(FSNode(ConfMan.get("themepath")), inFile))
 		return true;
@@ -255,8 +270,10 @@ bool TranslationManager::openTranslationsFile(const FSNode &node, File &inFile,
 	FSNode fileNode = node.getChild("translations.dat");
 	if (fileNode.exists() && fileNode.isReadable() && !fileNode.isDirectory()) {
 		if (inFile.open(fileNode)) {
-			if (checkHeader(inFile))
+			if (checkHeader(inFile)) {
+				_translationsFilePath = fileNode.getPath();
 				return true;
+			}
 			inFile.close();
 		}
 	}
@@ -279,6 +296,19 @@ bool TranslationManager::openTranslationsFile(const FSNode &node, File &inFile,
 	return false;
 }
 
+static String readMessageString(File &in, Array<char> &buf, int len) {
+	// The stored length includes the terminating 0. Read the whole string
+	// in one go, growing the scratch buffer as needed; the message lists
+	// are by far the largest part of the file, and building the strings
+	// from fixed size chunks caused several allocations per message.
+	if (len <= 0)
+		return String();
+	if ((int)buf.size() < len)
+		buf.resize(len);
+	in.read(buf.begin(), len);
+	return String(buf.begin(), len - 1);
+}
+
 void TranslationManager::loadTranslationsInfoDat() {
 	File in;
 	if (!openTranslationsFile(in)) {
@@ -323,16 +353,11 @@ void TranslationManager::loadTranslationsInfoDat() {
 
 	// Read messages
 	int numMessages = in.readUint16BE();
+	Array<char> msgBuf;
 	_messageIds.resize(numMessages);
 	for (int i = 0; i < numMessages; ++i) {
 		len = in.readUint16BE();
-		String msg;
-		while (len > 0) {
-			in.read(buf, len > 256 ? 256 : len);
-			msg += String(buf, len > 256 ? 256 : len - 1);
-			len -= 256;
-		}
-		_messageIds[i] = msg;
+		_messageIds[i] = readMessageString(in, msgBuf, len);
 	}
 }
 
@@ -387,16 +412,11 @@ void TranslationManager::loadLanguageDat(int index) {
 	_currentCharset = String(buf, len - 1);
 
 	// Read messages
+	Array<char> msgBuf;
 	for (int i = 0; i < nbMessages; ++i) {
 		_currentTranslationMessages[i].msgid = in.readUint16BE();
 		len = in.readUint16BE();
-		String msg;
-		while (len > 0) {
-			in.read(buf, len > 256 ? 256 : len);
-			msg += String(buf, len > 256 ? 256 : len - 1);
-			len -= 256;
-		}
-		_currentTranslationMessages[i].msgstr = msg;
+		_currentTranslationMessages[i].msgstr = readMessageString(in, msgBuf, len);
 		len = in.readUint16BE();
 		if (len > 0) {
 			in.read(buf, len);
@@ -222,6 +222,7 @@ private:
 	Array<PoMessageEntry> _currentTranslationMessages;
 	String _currentCharset;
 	int _currentLang;
+	String _translationsFilePath;
 
 	uint32 _charmapStart;
 	uint32 *_charmap;
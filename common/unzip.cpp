@@ -1419,10 +1419,212 @@ int unzGetGlobalComment(unzFile file, char *szComment, uLong uSizeBuf) {
 
 namespace Common {
 
+/**
+ * Shared backing buffer for a fully decompressed zip member. The buffer
+ * stays alive as long as either the archive's cache or a stream handed
+ * out to a client references it, so cache eviction never invalidates
+ * streams that are still in use.
+ */
+struct CachedMemberData {
+	byte *data;
+	uint32 size;
+	CachedMemberData(byte *d, uint32 s) : data(d), size(s) {}
+	~CachedMemberData() { free(data); }
+};
+
+typedef SharedPtr<CachedMemberData> CachedMemberDataPtr;
+
+namespace {
+
+/**
+ * Read stream over a shared decompressed member buffer.
+ */
+class CachedMemberReadStream : public MemoryReadStream {
+public:
+	CachedMemberReadStream(const CachedMemberDataPtr &data)
+		: MemoryReadStream(data->data, data->size), _data(data) {}
+
+private:
+	CachedMemberDataPtr _data;
+};
+
+/**
+ * Seekable read stream which decompresses a zip member on the fly,
+ * instead of inflating it fully into memory up front. Used for large
+ * members, where clients frequently only look at a header or read the
+ * data sequentially anyway.
+ *
+ * Reads re-seek the archive's underlying stream every time, so several
+ * member streams of the same archive can be used independently.
+ * Seeking backwards restarts decompression from the beginning of the
+ * member, which is the usual price of deflate streams.
+ */
+class ZipMemberReadStream : public SeekableReadStream {
+public:
+	ZipMemberReadStream(SeekableReadStream *zip, uint32 dataOffset, uint32 compSize, uint32 uncompSize, uint16 method)
+		: _zip(zip), _dataOffset(dataOffset), _compSize(compSize), _uncompSize(uncompSize),
+		  _method(method), _pos(0), _compPos(0), _err(false), _eos(false) {
+#ifdef USE_ZLIB
+		memset(&_zstream, 0, sizeof(_zstream));
+		if (_method != 0) {
+			// Negative windowBits: raw deflate data, no zlib header.
+			if (inflateInit2(&_zstream, -MAX_WBITS) != Z_OK)
+				_err = true;
+		}
+#else
+		if (_method != 0)
+			_err = true;
+#endif
+	}
+
+	~ZipMemberReadStream() {
+#ifdef USE_ZLIB
+		if (_method != 0)
+			inflateEnd(&_zstream);
+#endif
+	}
+
+	bool err() const { return _err; }
+	void clearErr() { _err = false; _eos = false; }
+	bool eos() const { return _eos; }
+	int32 pos() const { return _pos; }
+	int32 size() const { return _uncompSize; }
+
+	uint32 read(void *dataPtr, uint32 dataSize) {
+		if (_err)
+			return 0;
+
+		uint32 toRead = MIN(dataSize, _uncompSize - _pos);
+		uint32 got = 0;
+
+		if (_method == 0) {
+			// Stored member: a plain copy out of the archive stream.
+			_zip->seek(_dataOffset + _pos, SEEK_SET);
+			got = _zip->read(dataPtr, toRead);
+			if (got != toRead)
+				_err = true;
+		} else {
+#ifdef USE_ZLIB
+			_zstream.next_out = (Bytef *)dataPtr;
+			_zstream.avail_out = toRead;
+
+			while (_zstream.avail_out > 0) {
+				if (_zstream.avail_in == 0) {
+					uint32 chunk = MIN<uint32>(UNZ_BUFSIZE, _compSize - _compPos);
+					if (chunk == 0)
+						break;
+					_zip->seek(_dataOffset + _compPos, SEEK_SET);
+					if (_zip->read(_inBuf, chunk) != chunk) {
+						_err = true;
+						break;
+					}
+					_compPos += chunk;
+					_zstream.next_in = _inBuf;
+					_zstream.avail_in = chunk;
+				}
+
+				int zerr = inflate(&_zstream, Z_SYNC_FLUSH);
+				if (zerr == Z_STREAM_END)
+					break;
+				if (zerr != Z_OK) {
+					_err = true;
+					break;
+				}
+			}
+
+			got = toRead - _zstream.avail_out;
+#endif
+		}
+
+		_pos += got;
+		if (got < dataSize)
+			_eos = true;
+		return got;
+	}
+
+	bool seek(int32 offset, int whence = SEEK_SET) {
+		int32 target = offset;
+		if (whence == SEEK_CUR)
+			target += _pos;
+		else if (whence == SEEK_END)
+			target += _uncompSize;
+
+		if (target < 0 || (uint32)target > _uncompSize)
+			return false;
+
+		_eos = false;
+
+		if (_method == 0) {
+			_pos = target;
+			return true;
+		}
+
+		if ((uint32)target < _pos) {
+			// Deflate cannot run backwards; restart from the top.
+#ifdef USE_ZLIB
+			if (inflateReset(&_zstream) != Z_OK) {
+				_err = true;
+				return false;
+			}
+			_zstream.avail_in = 0;
+#endif
+			_pos = 0;
+			_compPos = 0;
+		}
+
+		// Inflate forward to the target, discarding the output.
+		byte skipBuf[1024];
+		while (_pos < (uint32)target && !_err) {
+			uint32 chunk = MIN<uint32>(sizeof(skipBuf), target - _pos);
+			if (read(skipBuf, chunk) != chunk)
+				return false;
+		}
+
+		_eos = false;
+		return !_err;
+	}
+
+private:
+	SeekableReadStream *_zip;   // the archive's stream; not owned
+	uint32 _dataOffset;         // start of the compressed data in _zip
+	uint32 _compSize;
+	uint32 _uncompSize;
+	uint16 _method;
+	uint32 _pos;                // position in the uncompressed data
+	uint32 _compPos;            // compressed bytes consumed so far
+	bool _err;
+	bool _eos;
+#ifdef USE_ZLIB
+	z_stream _zstream;
+	byte _inBuf[UNZ_BUFSIZE];
+#endif
+};
+
+} // End of anonymous namespace
 
 class ZipArchive : public Archive {
 	unzFile _zipFile;
 
+	/**
+	 * LRU cache of fully decompressed members, so that repeated opens of
+	 * the same member (themes read their files over and over while a
+	 * dialog is built) do not cost a full inflation each time.
+	 */
+	struct CacheEntry {
+		CachedMemberDataPtr data;
+		uint32 tick;       // last use, for LRU eviction
+		CacheEntry() : tick(0) {}
+	};
+	typedef HashMap<String, CacheEntry, IgnoreCase_Hash, IgnoreCase_EqualTo> MemberCacheMap;
+	mutable MemberCacheMap _cache;
+	mutable uint32 _cacheTick;
+	mutable uint32 _cachedBytes;
+
+	enum {
+		kMemberCacheBudget = 512 * 1024, ///< total decompressed bytes kept cached
+		kStreamThreshold = 128 * 1024    ///< members above this size are streamed instead
+	};
+
 public:
 	ZipArchive(unzFile zipFile);
 
@@ -1453,7 +1655,7 @@ public:
 };
 */
 
-ZipArchive::ZipArchive(unzFile zipFile) : _zipFile(zipFile) {
+ZipArchive::ZipArchive(unzFile zipFile) : _zipFile(zipFile), _cacheTick(0), _cachedBytes(0) {
 	assert(_zipFile);
 }
 
@@ -1486,6 +1688,13 @@ const ArchiveMemberPtr ZipArchive::getMember(const String &name) const {
 }
 
 SeekableReadStream *ZipArchive::createReadStreamForMember(const String &name) const {
+	// Serve repeated opens out of the decompressed member cache.
+	MemberCacheMap::iterator ci = _cache.find(name);
+	if (ci != _cache.end()) {
+		ci->_value.tick = ++_cacheTick;
+		return new CachedMemberReadStream(ci->_value.data);
+	}
+
 	if (unzLocateFile(_zipFile, name.c_str(), 2) != UNZ_OK)
 		return 0;
 
@@ -1496,6 +1705,25 @@ SeekableReadStream *ZipArchive::createReadStreamForMember(const String &name) co
 	if (unzGetCurrentFileInfo(_zipFile, &fileInfo, NULL, 0, NULL, 0, NULL, 0) != UNZ_OK)
 		return 0;
 
+	if (fileInfo.uncompressed_size > kStreamThreshold) {
+		// Large member: hand out a stream which inflates on demand,
+		// instead of paying for a full decompression up front. The
+		// stream keeps its own inflate state, so multiple members of
+		// the same archive can be open independently.
+		unz_s *s = (unz_s *)_zipFile;
+		const file_in_zip_read_info_s *info = s->pfile_in_zip_read;
+		uint32 dataOffset = info->pos_in_zipfile + info->byte_before_the_zipfile;
+		uint16 method = (uint16)info->compression_method;
+		unzCloseCurrentFile(_zipFile);
+
+#ifndef USE_ZLIB
+		if (method != 0)
+			return 0;
+#endif
+		return new ZipMemberReadStream(s->_stream, dataOffset,
+		                               fileInfo.compressed_size, fileInfo.uncompressed_size, method);
+	}
+
 	byte *buffer = (byte *)malloc(fileInfo.uncompressed_size);
 	assert(buffer);
 
@@ -1509,12 +1737,25 @@ SeekableReadStream *ZipArchive::createReadStreamForMember(const String &name) co
 		return 0;
 	}
 
-	return new MemoryReadStream(buffer, fileInfo.uncompressed_size, DisposeAfterUse::YES);
+	CachedMemberDataPtr data(new CachedMemberData(buffer, fileInfo.uncompressed_size));
+
+	// Evict least recently used members until the new one fits the budget.
+	while (_cachedBytes + fileInfo.uncompressed_size > kMemberCacheBudget && !_cache.empty()) {
+		MemberCacheMap::iterator lru = _cache.begin();
+		for (MemberCacheMap::iterator i = _cache.begin(); i != _cache.end(); ++i) {
+			if (i->_value.tick < lru->_value.tick)
+				lru = i;
+		}
+		_cachedBytes -= lru->_value.data->size;
+		_cache.erase(lru->_key);
+	}
+
+	CacheEntry &entry = _cache[name];
+	entry.data = data;
+	entry.tick = ++_cacheTick;
+	_cachedBytes += fileInfo.uncompressed_size;
 
-	// FIXME: instead of reading all into a memory stream, we could
-	// instead create a new ZipStream class. But then we have to be
-	// careful to handle the case where the client code opens multiple
-	// files in the archive and tries to use them independently.
+	return new CachedMemberReadStream(data);
 }
 
 Archive *makeZipArchive(const String &name) {
@@ -23,7 +23,7 @@
 #include "common/xmlparser.h"
 #include "common/archive.h"
 #include "common/fs.h"
-#include "common/memstream.h"
+#include "common/stream.h"
 #include "common/system.h"
 
 namespace Common {
@@ -35,6 +35,9 @@ XMLParser::~XMLParser() {
 	delete _XMLkeys;
 	delete _stream;
 
+	if (_ownBuffer)
+		free(const_cast<byte *>(_buffer));
+
 	for (List<XMLKeyLayout *>::iterator i = _layoutList.begin();
 		i != _layoutList.end(); ++i)
 		delete *i;
@@ -61,7 +64,10 @@ bool XMLParser::loadFile(const FSNode &node) {
 }
 
 bool XMLParser::loadBuffer(const byte *buffer, uint32 size, DisposeAfterUse::Flag disposable) {
-	_stream = new MemoryReadStream(buffer, size, disposable);
+	_buffer = buffer;
+	_bufferSize = size;
+	_bufferPos = 0;
+	_ownBuffer = (disposable == DisposeAfterUse::YES);
 	_fileName = "Memory Stream";
 	return true;
 }
@@ -75,58 +81,43 @@ bool XMLParser::loadStream(SeekableReadStream *stream) {
 void XMLParser::close() {
 	delete _stream;
 	_stream = 0;
+
+	if (_ownBuffer)
+		free(const_cast<byte *>(_buffer));
+	_buffer = 0;
+	_bufferSize = 0;
+	_bufferPos = 0;
+	_ownBuffer = false;
 }
 
 bool XMLParser::parserError(const String &errStr) {
 	_state = kParserError;
 
-	const int startPosition = _stream->pos();
-	int currentPosition = startPosition;
+	const uint32 startPosition = (_bufferPos < _bufferSize) ? _bufferPos : _bufferSize;
 	int lineCount = 1;
-	char c = 0;
-
-	_stream->seek(0, SEEK_SET);
-
-	while (currentPosition--) {
-		c = _stream->readByte();
 
-		if (c == '\n' || c == '\r')
+	for (uint32 i = 0; i < startPosition; ++i) {
+		if (_buffer[i] == '\n' || _buffer[i] == '\r')
 			lineCount++;
 	}
 
-	assert(_stream->pos() == startPosition);
-	currentPosition = startPosition;
-
 	Common::String errorMessage = Common::String::format("\n  File <%s>, line %d:\n", _fileName.c_str(), lineCount);
 
 	if (startPosition > 1) {
-		int keyOpening = 0;
-		int keyClosing = 0;
-
-		while (currentPosition-- && keyOpening == 0) {
-			_stream->seek(-2, SEEK_CUR);
-			c = _stream->readByte();
-
-			if (c == '<')
-				keyOpening = currentPosition - 1;
-			else if (c == '>')
-				keyClosing = currentPosition;
-		}
-
-		_stream->seek(startPosition, SEEK_SET);
-		currentPosition = startPosition;
-		while (keyClosing == 0 && c && currentPosition++) {
-			c = _stream->readByte();
-
-			if (c == '>')
-				keyClosing = currentPosition;
-		}
-
-		currentPosition = (keyClosing - keyOpening);
-		_stream->seek(keyOpening, SEEK_SET);
-
-		while (currentPosition--)
-			errorMessage += (char)_stream->readByte();
+		// Locate the key surrounding the error position and quote it
+		uint32 keyOpening = startPosition;
+		while (keyOpening > 0 && _buffer[keyOpening - 1] != '<')
+			keyOpening--;
+		if (keyOpening > 0)
+			keyOpening--;
+
+		uint32 keyClosing = startPosition;
+		while (keyClosing < _bufferSize && _buffer[keyClosing] != '>')
+			keyClosing++;
+		if (keyClosing < _bufferSize)
+			keyClosing++;
+
+		errorMessage += String((const char *)_buffer + keyOpening, (const char *)_buffer + keyClosing);
 	}
 
 	errorMessage += "\n\nParser error: ";
@@ -220,17 +211,17 @@ bool XMLParser::parseKeyValue(String keyName) {
 
 	if (_char == '"' || _char == '\'') {
 		stringStart = _char;
-		_char = _stream->readByte();
+		_char = readChar();
 
-		while (_char && _char != stringStart) {
-			_token += _char;
-			_char = _stream->readByte();
-		}
+		const uint32 start = _bufferPos - 1;
+		while (_char && _char != stringStart)
+			_char = readChar();
 
 		if (_char == 0)
 			return false;
 
-		_char = _stream->readByte();
+		_token = String((const char *)_buffer + start, (const char *)_buffer + _bufferPos - 1);
+		_char = readChar();
 
 	} else if (!parseToken()) {
 		return false;
@@ -299,11 +290,33 @@ bool XMLParser::closeKey() {
 }
 
 bool XMLParser::parse() {
-	if (_stream == 0)
+	if (_buffer == 0 && _stream == 0)
 		return false;
 
-	// Make sure we are at the start of the stream.
-	_stream->seek(0, SEEK_SET);
+	// When loading from a file or stream, slurp the whole thing into a
+	// single buffer first; the scanner then runs off plain memory
+	// instead of doing a virtual readByte call per character.
+	if (_buffer == 0) {
+		int32 size = _stream->size();
+		if (size <= 0)
+			return false;
+
+		byte *buffer = (byte *)malloc(size);
+		if (!buffer || _stream->read(buffer, size) != (uint32)size) {
+			free(buffer);
+			return false;
+		}
+
+		_buffer = buffer;
+		_bufferSize = size;
+		_ownBuffer = true;
+
+		delete _stream;
+		_stream = 0;
+	}
+
+	// Make sure we are at the start of the buffer.
+	_bufferPos = 0;
 
 	if (_XMLkeys == 0)
 		buildLayout();
@@ -320,7 +333,7 @@ bool XMLParser::parse() {
 	_state = kParserNeedHeader;
 	_activeKey.clear();
 
-	_char = _stream->readByte();
+	_char = readChar();
 
 	while (_char && _state != kParserError) {
 		if (skipSpaces())
@@ -337,7 +350,7 @@ bool XMLParser::parse() {
 				break;
 			}
 
-			if ((_char = _stream->readByte()) == 0) {
+			if ((_char = readChar()) == 0) {
 				parserError("Unexpected end of file.");
 				break;
 			}
@@ -348,10 +361,10 @@ bool XMLParser::parse() {
 					break;
 				}
 
-				_char = _stream->readByte();
+				_char = readChar();
 				activeHeader = true;
 			} else if (_char == '/') {
-				_char = _stream->readByte();
+				_char = readChar();
 				activeClosure = true;
 			} else if (_char == '?') {
 				parserError("Unexpected header. There may only be one XML header per file.");
@@ -399,7 +412,7 @@ bool XMLParser::parse() {
 				else
 					_state = kParserNeedKey;
 
-				_char = _stream->readByte();
+				_char = readChar();
 				break;
 			}
 
@@ -407,14 +420,14 @@ bool XMLParser::parse() {
 
 			if (_char == '/' || (_char == '?' && activeHeader)) {
 				selfClosure = true;
-				_char = _stream->readByte();
+				_char = readChar();
 			}
 
 			if (_char == '>') {
 				if (activeHeader && !selfClosure) {
 					parserError("XML Header must be self-closed.");
 				} else if (parseActiveKey(selfClosure)) {
-					_char = _stream->readByte();
+					_char = readChar();
 					_state = kParserNeedKey;
 				}
 
@@ -437,7 +450,7 @@ bool XMLParser::parse() {
 			else
 				_state = kParserNeedPropertyValue;
 
-			_char = _stream->readByte();
+			_char = readChar();
 			break;
 
 		case kParserNeedPropertyValue:
@@ -467,39 +480,39 @@ bool XMLParser::skipSpaces() {
 		return false;
 
 	while (_char && isSpace(_char))
-		_char = _stream->readByte();
+		_char = readChar();
 
 	return true;
 }
 
 bool XMLParser::skipComments() {
 	if (_char == '<') {
-		_char = _stream->readByte();
+		_char = readChar();
 
 		if (_char != '!') {
-			_stream->seek(-1, SEEK_CUR);
+			_bufferPos--;
 			_char = '<';
 			return false;
 		}
 
-		if (_stream->readByte() != '-' || _stream->readByte() != '-')
+		if (readChar() != '-' || readChar() != '-')
 			return parserError("Malformed comment syntax.");
 
-		_char = _stream->readByte();
+		_char = readChar();
 
 		while (_char) {
 			if (_char == '-') {
-				if (_stream->readByte() == '-') {
+				if (readChar() == '-') {
 
-					if (_stream->readByte() != '>')
+					if (readChar() != '>')
 						return parserError("Malformed comment (double-hyphen inside comment body).");
 
-					_char = _stream->readByte();
+					_char = readChar();
 					return true;
 				}
 			}
 
-			_char = _stream->readByte();
+			_char = readChar();
 		}
 
 		return parserError("Comment has no closure.");
@@ -509,12 +522,15 @@ bool XMLParser::skipComments() {
 }
 
 bool XMLParser::parseToken() {
-	_token.clear();
+	// Cut the token out of the read buffer in one go; _char already
+	// holds its first character, which sits just before _bufferPos
+	const uint32 start = _char ? _bufferPos - 1 : _bufferSize;
 
-	while (isValidNameChar(_char)) {
-		_token += _char;
-		_char = _stream->readByte();
-	}
+	while (isValidNameChar(_char))
+		_char = readChar();
+
+	const uint32 end = _char ? _bufferPos - 1 : _bufferSize;
+	_token = String((const char *)_buffer + start, (const char *)_buffer + end);
 
 	return isSpace(_char) != 0 || _char == '>' || _char == '=' || _char == '/';
 }
@@ -92,7 +92,7 @@ public:
 	/**
 	 * Parser constructor.
 	 */
-	XMLParser() : _XMLkeys(0), _stream(0) {}
+	XMLParser() : _XMLkeys(0), _stream(0), _buffer(0), _bufferSize(0), _bufferPos(0), _ownBuffer(false) {}
 
 	virtual ~XMLParser();
 
@@ -341,6 +341,22 @@ private:
 	SeekableReadStream *_stream;
 	String _fileName;
 
+	/**
+	 * The whole file is parsed from a single read buffer: files and
+	 * streams are slurped into it once when parse() starts, and tokens
+	 * are then cut out of it in one go instead of being grown character
+	 * by character through a virtual readByte() call each.
+	 */
+	const byte *_buffer;
+	uint32 _bufferSize;
+	uint32 _bufferPos;
+	bool _ownBuffer; /** Whether the parser must free _buffer on close */
+
+	/** Reads the next character from the buffer, 0 at the end. */
+	inline char readChar() {
+		return _bufferPos < _bufferSize ? (char)_buffer[_bufferPos++] : 0;
+	}
+
 	ParserState _state; /** Internal state of the parser */
 
 	String _error; /** Current error message */
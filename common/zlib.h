@@ -130,8 +130,13 @@ SeekableReadStream *wrapCompressedReadStream(SeekableReadStream *toBeWrapped, ui
  *
  * It is safe to call this with a NULL parameter (in this case, NULL is
  * returned).
+ *
+ * @param toBeWrapped	the stream to be wrapped
+ * @param level			the compression level (0 - 9, or -1 for the zlib
+ *						default). Lower levels compress worse but are
+ *						noticeably faster to write out.
  */
-WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped);
+WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped, int level = -1);
 
 } // End of namespace Common
 
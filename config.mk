@@ -0,0 +1,176 @@
+# -------- Generated by configure -----------
+
+CXX := g++
+CXXFLAGS :=   -ansi -W -Wno-unused-parameter -Wno-empty-body -pedantic -Wno-long-long 
+LD := g++
+LIBS += -lm  -ljpeg  -lpng -lz -lz -L/root/miniconda/lib -lcurl
+RANLIB := ranlib
+STRIP := strip
+AR := ar cru
+AS := as
+ASFLAGS := 
+WINDRES := windres
+WINDRESFLAGS := 
+STAGINGPATH=staging
+WIN32PATH=c:/scummvm
+AMIGAOSPATH=Games:ScummVM
+STATICLIBPATH=
+XCODETOOLSPATH=
+SPARKLEPATH=
+SDLCONFIG=sdl2-config
+
+ABI := 
+
+BACKEND := null
+MODULES += backends/platform/null
+MODULE_DIRS += 
+EXEPRE := 
+EXEEXT := 
+NASM := 
+NASMFLAGS := 
+ZLIB_LIBS := -lz
+ZLIB_CFLAGS := 
+
+prefix = /usr/local
+exec_prefix = ${prefix}
+bindir = ${exec_prefix}/bin
+libdir = ${exec_prefix}/lib
+datarootdir = ${prefix}/share
+datadir = ${datarootdir}/scummvm
+mandir = ${datarootdir}/man
+docdir = ${datarootdir}/doc/scummvm
+
+
+HAVE_GCC = 1
+HAVE_GCC3 = 1
+CXX_UPDATE_DEP_FLAG = -MMD -MF "$(*D)/$(DEPDIR)/$(*F).d" -MQ "$@" -MP
+POSIX = 1
+# VERBOSE_BUILD = 1
+# USE_ELF_LOADER = 1
+# DYNAMIC_MODULES = 1
+USE_MT32EMU = 1
+# USE_RGB_COLOR = 1
+USE_HIGHRES = 1
+USE_SAVEGAME_TIMESTAMP = 1
+USE_SCALERS = 1
+USE_HQ_SCALERS = 1
+# USE_OGG = 1
+# USE_VORBIS = 1
+# USE_TREMOR = 1
+# USE_FLAC = 1
+# USE_MAD = 1
+# USE_ALSA = 1
+USE_JPEG = 1
+USE_PNG = 1
+# USE_THEORADEC = 1
+# USE_FAAD = 1
+USE_ZLIB = 1
+# USE_MPEG2 = 1
+USE_LIBCURL = 1
+USE_CLOUD = 1
+# USE_FLUIDSYNTH = 1
+# USE_FREETYPE2 = 1
+# USE_OPENGL = 1
+# USE_LINUXCD = 1
+# USE_NASM = 1
+# ENABLE_VKEYBD = 1
+# ENABLE_KEYMAPPER = 1
+# ENABLE_EVENTRECORDER = 1
+USE_TRANSLATION = 1
+# USE_TASKBAR = 1
+USE_BINK = 1
+# USE_UPDATES = 1
+# ENABLE_ACCESS
+# ENABLE_ADL
+# ENABLE_AGI
+# ENABLE_AGOS
+# ENABLE_AGOS2
+# ENABLE_AVALANCHE
+# ENABLE_BBVS
+# ENABLE_BLADERUNNER
+# ENABLE_CGE
+# ENABLE_CGE2
+# ENABLE_CHEWY
+# ENABLE_CINE
+# ENABLE_COMPOSER
+# ENABLE_CRUISE
+# ENABLE_CRYO
+# ENABLE_DIRECTOR
+# ENABLE_DM
+# ENABLE_DRACI
+# ENABLE_DRASCULA
+# ENABLE_DREAMWEB
+# ENABLE_FULLPIPE
+# ENABLE_GNAP
+# ENABLE_GOB
+# ENABLE_GROOVIE
+# ENABLE_GROOVIE2
+# ENABLE_HOPKINS
+# ENABLE_HUGO
+# ENABLE_KYRA
+# ENABLE_LOL
+# ENABLE_EOB
+# ENABLE_LAB
+# ENABLE_LASTEXPRESS
+# ENABLE_LURE
+# ENABLE_MACVENTURE
+# ENABLE_MADE
+# ENABLE_MADS
+# ENABLE_MOHAWK
+# ENABLE_CSTIME
+# ENABLE_RIVEN
+# ENABLE_MYST
+# ENABLE_MORTEVIELLE
+# ENABLE_NEVERHOOD
+# ENABLE_PARALLACTION
+# ENABLE_PEGASUS
+# ENABLE_PLUMBERS
+# ENABLE_PRINCE
+# ENABLE_QUEEN
+# ENABLE_SAGA
+# ENABLE_IHNM
+# ENABLE_SAGA2
+# ENABLE_SCI
+# ENABLE_SCI32
+# ENABLE_SCUMM
+# ENABLE_SCUMM_7_8
+# ENABLE_HE
+# ENABLE_SHERLOCK
+# ENABLE_SKY
+# ENABLE_SLUDGE
+# ENABLE_SWORD1
+# ENABLE_SWORD2
+# ENABLE_SWORD25
+# ENABLE_TEENAGENT
+# ENABLE_TESTBED
+# ENABLE_TINSEL
+# ENABLE_TITANIC
+# ENABLE_TOLTECS
+# ENABLE_TONY
+# ENABLE_TOON
+# ENABLE_TOUCHE
+# ENABLE_TSAGE
+# ENABLE_TUCKER
+# ENABLE_VOYEUR
+# ENABLE_WAGE
+# ENABLE_WINTERMUTE
+# ENABLE_XEEN
+# ENABLE_ZVISION
+
+INCLUDES +=  -I/root/miniconda/include
+OBJS += 
+DEFINES += -DUSE_NULL_DRIVER -DPOSIX -DHAS_POSIX_SPAWN -DDATA_PATH=\"${datarootdir}/scummvm\" -DPLUGIN_DIRECTORY=\"${exec_prefix}/lib/scummvm\"
+LDFLAGS += 
+
+
+
+port_mk = ports.mk
+
+SAVED_CONFIGFLAGS  := --backend=null --disable-all-engines --disable-debug
+SAVED_LDFLAGS      := 
+SAVED_CXX          := 
+SAVED_CXXFLAGS     := 
+SAVED_CPPFLAGS     := 
+SAVED_ASFLAGS      := 
+SAVED_WINDRESFLAGS := 
+SAVED_SDL_CONFIG   := 
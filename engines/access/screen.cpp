@@ -140,6 +140,14 @@ void Screen::updatePalette() {
 	update();
 }
 
+void Screen::updateFadePalette() {
+	// Only the palette changes during a fade step, so push it and flip the
+	// screen directly, without re-copying the unchanged frame contents the
+	// way updatePalette() does
+	g_system->getPaletteManager()->setPalette(&_tempPalette[0], 0, PALETTE_COUNT);
+	g_system->updateScreen();
+}
+
 void Screen::savePalette() {
 	Common::copy(&_rawPalette[0], &_rawPalette[PALETTE_SIZE],
 		&_savedPalettes[_savedPaletteCount][0]);
@@ -162,45 +170,43 @@ void Screen::getPalette(byte *pal) {
 
 void Screen::forceFadeOut() {
 	const int FADE_AMOUNT = 2;
-	bool repeatFlag;
-	byte *srcP;
-	int count;
-
-	do {
-		repeatFlag = false;
-		for (srcP = &_tempPalette[0], count = 0; count < PALETTE_SIZE; ++count, ++srcP) {
-			int v = *srcP;
-			if (v) {
-				repeatFlag = true;
-				*srcP = MAX((int)*srcP - FADE_AMOUNT, 0);
-			}
-		}
 
-		updatePalette();
+	// Work out the number of steps in advance from the largest palette
+	// component, so each step is a single pass over the palette rather than
+	// a scan to decide whether another step is needed. Always run at least
+	// one step, so the final palette gets pushed even if it's already black
+	int maxValue = 0;
+	for (const byte *srcP = &_tempPalette[0]; srcP < &_tempPalette[PALETTE_SIZE]; ++srcP)
+		maxValue = MAX(maxValue, (int)*srcP);
+	int steps = MAX((maxValue + FADE_AMOUNT - 1) / FADE_AMOUNT, 1);
+
+	for (int step = 0; step < steps && !_vm->shouldQuit(); ++step) {
+		for (byte *srcP = &_tempPalette[0]; srcP < &_tempPalette[PALETTE_SIZE]; ++srcP)
+			*srcP = MAX((int)*srcP - FADE_AMOUNT, 0);
+
+		updateFadePalette();
 		_vm->_events->pollEventsAndWait();
-	} while (repeatFlag && !_vm->shouldQuit());
+	}
 }
 
 void Screen::forceFadeIn() {
 	Common::fill(&_tempPalette[0], &_tempPalette[PALETTE_SIZE], 0);
 
 	const int FADE_AMOUNT = 2;
-	bool repeatFlag;
-	do {
-		repeatFlag = false;
+	int maxValue = 0;
+	for (const byte *srcP = &_rawPalette[0]; srcP < &_rawPalette[PALETTE_SIZE]; ++srcP)
+		maxValue = MAX(maxValue, (int)*srcP);
+	int steps = MAX((maxValue + FADE_AMOUNT - 1) / FADE_AMOUNT, 1);
+
+	for (int step = 0; step < steps; ++step) {
 		const byte *srcP = &_rawPalette[0];
 		byte *destP = &_tempPalette[0];
+		for (int idx = 0; idx < PALETTE_SIZE; ++idx, ++srcP, ++destP)
+			*destP = MIN((int)*destP + FADE_AMOUNT, (int)*srcP);
 
-		for (int idx = 0; idx < PALETTE_SIZE; ++idx, ++srcP, ++destP) {
-			if (*destP != *srcP) {
-				repeatFlag = true;
-				*destP = MIN((int)*destP + FADE_AMOUNT, (int)*srcP);
-			}
-		}
-
-		updatePalette();
+		updateFadePalette();
 		_vm->_events->pollEventsAndWait();
-	} while (repeatFlag);
+	}
 }
 
 void Screen::copyBuffer(const byte *data) {
@@ -64,6 +64,11 @@ private:
 	Common::List<Common::Rect> _dirtyRects;
 
 	void updatePalette();
+
+	/**
+	 * Palette-only screen update used by the fade loops
+	 */
+	void updateFadePalette();
 public:
 	int _vesaMode;
 	int _startColor, _numColors;
@@ -26,6 +26,7 @@
 #include "common/macresman.h"
 #include "common/md5.h"
 #include "common/config-manager.h"
+#include "common/singleton.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
@@ -33,6 +34,35 @@
 #include "engines/advancedDetector.h"
 #include "engines/obsolete.h"
 
+/**
+ * A session-wide cache for the file properties computed during detection.
+ *
+ * When the launcher scans a directory, every engine's detection pass probes
+ * the same files, so without a cache each candidate file gets hashed once
+ * per engine. Entries are keyed by the number of bytes hashed and the full
+ * path, and are kept for the lifetime of the session.
+ */
+class ADFilePropertiesCacheManager : public Common::Singleton<ADFilePropertiesCacheManager> {
+public:
+	bool get(const Common::String &key, ADFileProperties &props) const {
+		if (!_cache.contains(key))
+			return false;
+		props = _cache.getVal(key);
+		return true;
+	}
+
+	void set(const Common::String &key, const ADFileProperties &props) {
+		_cache[key] = props;
+	}
+
+private:
+	ADFilePropertiesMap _cache;
+};
+
+namespace Common {
+DECLARE_SINGLETON(ADFilePropertiesCacheManager);
+}
+
 static GameDescriptor toGameDescriptor(const ADGameDescription &g, const PlainGameDescriptor *sg) {
 	const char *title = 0;
 	const char *extra;
@@ -403,6 +433,10 @@ bool AdvancedMetaEngine::getFileProperties(const Common::FSNode &parent, const F
 	// file and as one with resource fork.
 
 	if (game.flags & ADGF_MACRESFORK) {
+		const Common::String cacheKey = Common::String::format("r:%u:%s/%s", _md5Bytes, parent.getPath().c_str(), fname.c_str());
+		if (ADFilePropertiesCacheManager::instance().get(cacheKey, fileProps))
+			return true;
+
 		Common::MacResManager macResMan;
 
 		if (!macResMan.open(parent, fname))
@@ -411,13 +445,19 @@ bool AdvancedMetaEngine::getFileProperties(const Common::FSNode &parent, const F
 		fileProps.md5 = macResMan.computeResForkMD5AsString(_md5Bytes);
 		fileProps.size = macResMan.getResForkDataSize();
 
-		if (fileProps.size != 0)
+		if (fileProps.size != 0) {
+			ADFilePropertiesCacheManager::instance().set(cacheKey, fileProps);
 			return true;
+		}
 	}
 
 	if (!allFiles.contains(fname))
 		return false;
 
+	const Common::String cacheKey = Common::String::format("f:%u:%s", _md5Bytes, allFiles[fname].getPath().c_str());
+	if (ADFilePropertiesCacheManager::instance().get(cacheKey, fileProps))
+		return true;
+
 	Common::File testFile;
 
 	if (!testFile.open(allFiles[fname]))
@@ -425,6 +465,7 @@ bool AdvancedMetaEngine::getFileProperties(const Common::FSNode &parent, const F
 
 	fileProps.size = (int32)testFile.size();
 	fileProps.md5 = Common::computeStreamMD5AsString(testFile, _md5Bytes);
+	ADFilePropertiesCacheManager::instance().set(cacheKey, fileProps);
 	return true;
 }
 
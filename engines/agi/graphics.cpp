@@ -388,6 +388,19 @@ void GfxMgr::clear(byte color, byte priority) {
 	memset(_priorityScreen, priority, _pixels);
 }
 
+// Copy the visual + priority game screens into buffers provided by the caller
+void GfxMgr::copyGameScreens(byte *gameScreenDest, byte *priorityScreenDest) {
+	memcpy(gameScreenDest, _gameScreen, _pixels);
+	memcpy(priorityScreenDest, _priorityScreen, _pixels);
+}
+
+// Replace the visual + priority game screens with buffers previously filled
+// by copyGameScreens()
+void GfxMgr::setGameScreens(const byte *gameScreen, const byte *priorityScreen) {
+	memcpy(_gameScreen, gameScreen, _pixels);
+	memcpy(_priorityScreen, priorityScreen, _pixels);
+}
+
 void GfxMgr::clearDisplay(byte color, bool copyToScreen) {
 	memset(_displayScreen, color, _displayPixels);
 
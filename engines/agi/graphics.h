@@ -162,6 +162,8 @@ public:
 	void debugShowMap(int mapNr);
 
 	void clear(byte color, byte priority);
+	void copyGameScreens(byte *gameScreenDest, byte *priorityScreenDest);
+	void setGameScreens(const byte *gameScreen, const byte *priorityScreen);
 	void clearDisplay(byte color, bool copyToScreen = true);
 	void putPixel(int16 x, int16 y, byte drawMask, byte color, byte priority);
 	void putPixelOnDisplay(int16 x, int16 y, byte color);
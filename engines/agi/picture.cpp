@@ -48,6 +48,49 @@ PictureMgr::PictureMgr(AgiBase *agi, GfxMgr *gfx) {
 	_width = _height = 0;
 }
 
+PictureMgr::~PictureMgr() {
+	for (uint i = 0; i < _pictureCache.size(); i++) {
+		free(_pictureCache[i].gameScreen);
+		free(_pictureCache[i].priorityScreen);
+	}
+}
+
+const PictureMgr::PictureCacheEntry *PictureMgr::findCachedPicture(int16 resourceNr) const {
+	for (uint i = 0; i < _pictureCache.size(); i++)
+		if (_pictureCache[i].resourceNr == resourceNr)
+			return &_pictureCache[i];
+	return NULL;
+}
+
+void PictureMgr::cachePicture(int16 resourceNr) {
+	uncachePicture(resourceNr);
+
+	// Drop the oldest entry when the cache is full
+	if (_pictureCache.size() >= kPictureCacheSize) {
+		free(_pictureCache[0].gameScreen);
+		free(_pictureCache[0].priorityScreen);
+		_pictureCache.remove_at(0);
+	}
+
+	PictureCacheEntry cacheEntry;
+	cacheEntry.resourceNr = resourceNr;
+	cacheEntry.gameScreen = (byte *)malloc(SCRIPT_WIDTH * SCRIPT_HEIGHT);
+	cacheEntry.priorityScreen = (byte *)malloc(SCRIPT_WIDTH * SCRIPT_HEIGHT);
+	_gfx->copyGameScreens(cacheEntry.gameScreen, cacheEntry.priorityScreen);
+	_pictureCache.push_back(cacheEntry);
+}
+
+void PictureMgr::uncachePicture(int16 resourceNr) {
+	for (uint i = 0; i < _pictureCache.size(); i++) {
+		if (_pictureCache[i].resourceNr == resourceNr) {
+			free(_pictureCache[i].gameScreen);
+			free(_pictureCache[i].priorityScreen);
+			_pictureCache.remove_at(i);
+			return;
+		}
+	}
+}
+
 void PictureMgr::putVirtPixel(int x, int y) {
 	byte drawMask = 0;
 
@@ -916,6 +959,31 @@ int PictureMgr::draw_FillCheck(int16 x, int16 y) {
 int PictureMgr::decodePicture(int16 resourceNr, bool clearScreen, bool agi256, int16 pic_width, int16 pic_height) {
 	debugC(8, kDebugLevelResources, "(%d)", resourceNr);
 
+	// A full screen 16 color draw of an unchanged picture on a cleared
+	// screen always produces the same result, so such draws can be
+	// replayed from the rasterized cache
+	const bool cacheable = clearScreen && !agi256 && _flags == 0 &&
+		pic_width == _DEFAULT_WIDTH && pic_height == _DEFAULT_HEIGHT &&
+		_xOffset == 0 && _yOffset == 0;
+
+	if (cacheable) {
+		const PictureCacheEntry *cacheEntry = findCachedPicture(resourceNr);
+		if (cacheEntry) {
+			_resourceNr = resourceNr;
+			_data = _vm->_game.pictures[resourceNr].rdata;
+			_dataSize = _vm->_game.dirPic[resourceNr].len;
+			_width = pic_width;
+			_height = pic_height;
+
+			_gfx->setGameScreens(cacheEntry->gameScreen, cacheEntry->priorityScreen);
+
+			_vm->clearImageStack();
+			_vm->recordImageStackCall(ADD_PIC, resourceNr, clearScreen, agi256, 0, 0, 0, 0);
+
+			return errOK;
+		}
+	}
+
 	_patCode = 0;
 	_patNum = 0;
 	_priOn = _scrOn = false;
@@ -945,6 +1013,9 @@ int PictureMgr::decodePicture(int16 resourceNr, bool clearScreen, bool agi256, i
 		_vm->clearImageStack();
 	_vm->recordImageStackCall(ADD_PIC, resourceNr, clearScreen, agi256, 0, 0, 0, 0);
 
+	if (cacheable)
+		cachePicture(resourceNr);
+
 	return errOK;
 }
 
@@ -993,6 +1064,10 @@ int PictureMgr::unloadPicture(int n) {
 		_vm->_game.dirPic[n].flags &= ~RES_LOADED;
 	}
 
+	// The cached rasterization is no longer valid, since the slot may get
+	// reloaded with different picture data
+	uncachePicture(n);
+
 	return errOK;
 }
 
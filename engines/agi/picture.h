@@ -23,6 +23,8 @@
 #ifndef AGI_PICTURE_H
 #define AGI_PICTURE_H
 
+#include "common/array.h"
+
 namespace Agi {
 
 #define _DEFAULT_WIDTH      160
@@ -63,6 +65,7 @@ class PictureMgr {
 
 public:
 	PictureMgr(AgiBase *agi, GfxMgr *gfx);
+	~PictureMgr();
 
 	int16 getResourceNr() { return _resourceNr; };
 
@@ -151,6 +154,26 @@ private:
 
 	int _flags;
 	int _currentStep;
+
+	/**
+	 * Rasterized picture cache. Remembers the visual + priority screens
+	 * produced by a full screen draw of a picture resource, so that
+	 * redrawing the same picture is two memcpys instead of re-running
+	 * all of its vector opcodes.
+	 */
+	struct PictureCacheEntry {
+		int16 resourceNr;
+		byte *gameScreen;
+		byte *priorityScreen;
+	};
+
+	enum { kPictureCacheSize = 8 };
+
+	Common::Array<PictureCacheEntry> _pictureCache;
+
+	const PictureCacheEntry *findCachedPicture(int16 resourceNr) const;
+	void cachePicture(int16 resourceNr);
+	void uncachePicture(int16 resourceNr);
 };
 
 } // End of namespace Agi
@@ -498,7 +498,7 @@ AGOSEngine::AGOSEngine(OSystem *system, const AGOSGameDescription *gd)
 
 	memset(_lettersToPrintBuf, 0, sizeof(_lettersToPrintBuf));
 
-	_planarBuf = 0;
+	_planarImageCacheCounter = 0;
 
 	_midiEnabled = false;
 
@@ -946,7 +946,7 @@ AGOSEngine::~AGOSEngine() {
 	if (_backBuf)
 		_backBuf->free();
 	delete _backBuf;
-	free(_planarBuf);
+	clearPlanarImageCache();
 	if (_scaleBuf)
 		_scaleBuf->free();
 	delete _scaleBuf;
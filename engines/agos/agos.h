@@ -123,6 +123,16 @@ struct VgaPointersEntry {
 	VgaPointersEntry() { memset(this, 0, sizeof(*this)); }
 };
 
+struct PlanarImageCacheEntry {
+	const byte *srcPtr;
+	byte *data;
+	uint16 palette;
+	uint8 colorDepth;
+	bool compressed;
+	uint32 lastUsed;
+	PlanarImageCacheEntry() { memset(this, 0, sizeof(*this)); }
+};
+
 struct VgaSprite {
 	uint16 id;
 	int16 image;
@@ -549,7 +559,11 @@ protected:
 	uint8 _currentPalette[768];
 	uint8 _displayPalette[768];
 
-	byte *_planarBuf;
+	// Cache of recently converted planar images, so that redrawing the same
+	// image does not convert it again every frame. Flushed by allocBlock(),
+	// since newly loaded zone data may overwrite the source graphics.
+	PlanarImageCacheEntry _planarImageCache[16];
+	uint32 _planarImageCacheCounter;
 	byte _videoBuf1[32000];
 	uint16 _videoWindows[128];
 
@@ -1210,6 +1224,7 @@ protected:
 	byte *getScaleBuf();
 
 	byte *convertImage(VC10_state *state, bool compressed);
+	void clearPlanarImageCache();
 
 	bool decrunchFile(byte *src, byte *dst, uint32 size);
 	void loadVGABeardFile(uint16 id);
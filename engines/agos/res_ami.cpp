@@ -140,6 +140,14 @@ static void convertCompressedImage(const byte *src, byte *dst, uint8 colorDepth,
 	}
 }
 
+void AGOSEngine::clearPlanarImageCache() {
+	for (int i = 0; i < ARRAYSIZE(_planarImageCache); i++) {
+		free(_planarImageCache[i].data);
+		_planarImageCache[i].data = NULL;
+		_planarImageCache[i].srcPtr = NULL;
+	}
+}
+
 byte *AGOSEngine::convertImage(VC10_state *state, bool compressed) {
 	int length, i, j;
 
@@ -155,9 +163,38 @@ byte *AGOSEngine::convertImage(VC10_state *state, bool compressed) {
 	int width = state->width * 16;
 	int height = state->height;
 
-	free(_planarBuf);
-	_planarBuf = (byte *)malloc(width * height);
-	byte *dst = _planarBuf;
+	// Converting planar graphics to chunky is expensive enough to matter
+	// when the same image is redrawn every frame, so the most recently
+	// converted images are kept around. All parameters that influence the
+	// output are part of the lookup.
+	for (i = 0; i < ARRAYSIZE(_planarImageCache); i++) {
+		PlanarImageCacheEntry *e = &_planarImageCache[i];
+		if (e->data != NULL && e->srcPtr == src && e->palette == state->palette &&
+			e->colorDepth == colorDepth && e->compressed == compressed) {
+			e->lastUsed = ++_planarImageCacheCounter;
+			return e->data;
+		}
+	}
+
+	// Replace the least recently used slot
+	PlanarImageCacheEntry *entry = &_planarImageCache[0];
+	for (i = 1; i < ARRAYSIZE(_planarImageCache); i++) {
+		if (entry->data == NULL)
+			break;
+		PlanarImageCacheEntry *e = &_planarImageCache[i];
+		if (e->data == NULL || e->lastUsed < entry->lastUsed)
+			entry = e;
+	}
+
+	free(entry->data);
+	entry->data = (byte *)malloc(width * height);
+	entry->srcPtr = src;
+	entry->palette = state->palette;
+	entry->colorDepth = colorDepth;
+	entry->compressed = compressed;
+	entry->lastUsed = ++_planarImageCacheCounter;
+
+	byte *dst = entry->data;
 
 	if (compressed) {
 		convertCompressedImage(src, dst, colorDepth, height, width, (getGameType() == GType_PN));
@@ -184,7 +221,7 @@ byte *AGOSEngine::convertImage(VC10_state *state, bool compressed) {
 		}
 	}
 
-	return _planarBuf;
+	return entry->data;
 }
 
 } // End of namespace AGOS
@@ -134,6 +134,9 @@ byte *AGOSEngine::allocBlock(uint32 size) {
 			if (_rejectBlock)
 				continue;
 			checkZonePtrs();
+			// The new block may overwrite graphics that converted images in
+			// the planar image cache were created from
+			clearPlanarImageCache();
 			_vgaMemPtr = _blockEnd;
 			return _block;
 		}
@@ -50,6 +50,7 @@ const MouseHotspotType GraphicManager::kMouseHotSpots[9] = {
 
 GraphicManager::GraphicManager(AvalancheEngine *vm) {
 	_vm = vm;
+	_shownSurfaceValid = false;
 	setDialogColor(kColorBlack, kColorWhite);
 }
 
@@ -59,6 +60,7 @@ GraphicManager::~GraphicManager() {
 	_background.free();
 	_screen.free();
 	_scrolls.free();
+	_shownSurface.free();
 	_backup.free();
 
 	for (int i = 0; i < 10; i++)
@@ -87,6 +89,7 @@ void GraphicManager::init() {
 	_magics.create(kScreenWidth, kScreenHeight, Graphics::PixelFormat::createFormatCLUT8());
 	_screen.create(kScreenWidth, kScreenHeight * 2, Graphics::PixelFormat::createFormatCLUT8());
 	_scrolls.create(kScreenWidth, kScreenHeight, Graphics::PixelFormat::createFormatCLUT8());
+	_shownSurface.create(kScreenWidth, kScreenHeight, Graphics::PixelFormat::createFormatCLUT8());
 }
 
 /**
@@ -795,6 +798,9 @@ uint16 GraphicManager::seuGetPicHeight(int which) {
 
 void GraphicManager::menuRefreshScreen() {
 	g_system->copyRectToScreen(_menu.getPixels(), _menu.pitch, 0, 0, kScreenWidth, kMenuScreenHeight);
+	// The menu is drawn over the game screen, so the next refreshScreen()
+	// has to push a full frame to restore it.
+	_shownSurfaceValid = false;
 	g_system->updateScreen();
 }
 
@@ -1181,13 +1187,29 @@ void GraphicManager::drawChar(byte ander, int x, int y, Color color) {
 	}
 }
 void GraphicManager::refreshScreen() {
-	// These cycles are for doubling the screen height.
-	for (uint16 y = 0; y < _screen.h / 2; y++) {
-		memcpy(_screen.getBasePtr(0, y * 2), _surface.getBasePtr(0, y), _screen.w);
-		memcpy(_screen.getBasePtr(0, y * 2 + 1), _surface.getBasePtr(0, y), _screen.w);
+	uint16 firstRow = 0;
+	uint16 lastRow = _surface.h;
+
+	// Only the rows that changed since the last refresh have to be doubled
+	// and copied to the backend again.
+	if (_shownSurfaceValid) {
+		while ((firstRow < lastRow) && (memcmp(_surface.getBasePtr(0, firstRow), _shownSurface.getBasePtr(0, firstRow), _surface.w) == 0))
+			firstRow++;
+		while ((lastRow > firstRow) && (memcmp(_surface.getBasePtr(0, lastRow - 1), _shownSurface.getBasePtr(0, lastRow - 1), _surface.w) == 0))
+			lastRow--;
+	}
+
+	if (firstRow < lastRow) {
+		// These cycles are for doubling the screen height.
+		for (uint16 y = firstRow; y < lastRow; y++) {
+			memcpy(_screen.getBasePtr(0, y * 2), _surface.getBasePtr(0, y), _screen.w);
+			memcpy(_screen.getBasePtr(0, y * 2 + 1), _surface.getBasePtr(0, y), _screen.w);
+			memcpy(_shownSurface.getBasePtr(0, y), _surface.getBasePtr(0, y), _surface.w);
+		}
+		// Now we copy the stretched picture to the screen.
+		g_system->copyRectToScreen(_screen.getBasePtr(0, firstRow * 2), _screen.pitch, 0, firstRow * 2, kScreenWidth, (lastRow - firstRow) * 2);
+		_shownSurfaceValid = true;
 	}
-	// Now we copy the stretched picture to the screen.
-	g_system->copyRectToScreen(_screen.getPixels(), _screen.pitch, 0, 0, kScreenWidth, kScreenHeight * 2);
 	g_system->updateScreen();
 }
 
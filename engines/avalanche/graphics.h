@@ -176,6 +176,8 @@ private:
 	Graphics::Surface _magics; // Lucerna::draw_also_lines() draws the "magical" lines here. Further information: https://github.com/urukgit/avalot/wiki/Also
 	Graphics::Surface _screen; // Only used in refreshScreen() to make it more optimized. (No recreation of it at every call of the function.)
 	Graphics::Surface _scrolls;
+	Graphics::Surface _shownSurface; // Copy of _surface as it was last pushed to the backend by refreshScreen().
+	bool _shownSurfaceValid;
 	Graphics::Surface _surface;
 	Graphics::Surface _menu;
 
@@ -48,6 +48,7 @@
 #include "graphics/fontman.h"
 #include "graphics/palette.h"
 #include "graphics/surface.h"
+#include "video/avi_decoder.h"
 
 namespace Bbvs {
 
@@ -96,6 +97,7 @@ BbvsEngine::BbvsEngine(OSystem *syst, const ADGameDescription *gd) :
 	_hasSnapshot = false;
 	_snapshot = nullptr;
 	_snapshotStream = nullptr;
+	_videoDecoder = nullptr;
 	_isSaveAllowed = false;
 
 	for (int i = 0; i < 80; i++) {
@@ -134,6 +136,7 @@ BbvsEngine::~BbvsEngine() {
 #endif
 
 	delete _random;
+	delete _videoDecoder;
 
 }
 
@@ -38,6 +38,10 @@
 
 struct ADGameDescription;
 
+namespace Video {
+class AVIDecoder;
+}
+
 namespace Bbvs {
 
 class ActionCommands;
@@ -270,6 +274,8 @@ public:
 
 	int _newSceneNum, _prevSceneNum, _currSceneNum;
 	int _playVideoNumber;
+	Video::AVIDecoder *_videoDecoder;
+	Common::String _videoFilename;
 
 	int _dialogSlotCount;
 	byte _dialogItemStatus[kDialogItemStatusCount];
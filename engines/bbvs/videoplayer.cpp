@@ -45,20 +45,30 @@ void BbvsEngine::playVideo(int videoNum) {
 
 	debug(0, "Screen format: %s", _system->getScreenFormat().toString().c_str());
 
-	Video::VideoDecoder *videoDecoder = new Video::AVIDecoder();
-	if (!videoDecoder->loadFile(videoFilename)) {
-		delete videoDecoder;
-		warning("Unable to open video %s", videoFilename.c_str());
-		return;
+	// Reuse the decoder from the previous clip where possible; replaying the
+	// same file only needs a rewind instead of re-probing the container
+	if (_videoDecoder && _videoFilename == videoFilename) {
+		_videoDecoder->rewind();
+	} else {
+		delete _videoDecoder;
+		_videoDecoder = new Video::AVIDecoder();
+		_videoFilename = videoFilename;
+		if (!_videoDecoder->loadFile(videoFilename)) {
+			delete _videoDecoder;
+			_videoDecoder = nullptr;
+			_videoFilename.clear();
+			warning("Unable to open video %s", videoFilename.c_str());
+			return;
+		}
 	}
 
-	videoDecoder->start();
+	_videoDecoder->start();
 
 	bool skipVideo = false;
 
-	while (!shouldQuit() && !videoDecoder->endOfVideo() && !skipVideo) {
-		if (videoDecoder->needsUpdate()) {
-			const Graphics::Surface *frame = videoDecoder->decodeNextFrame();
+	while (!shouldQuit() && !_videoDecoder->endOfVideo() && !skipVideo) {
+		if (_videoDecoder->needsUpdate()) {
+			const Graphics::Surface *frame = _videoDecoder->decodeNextFrame();
 			if (frame) {
 				if (frame->format.bytesPerPixel > 1) {
 					Graphics::Surface *frame1 = frame->convertTo(_system->getScreenFormat());
@@ -82,7 +92,8 @@ void BbvsEngine::playVideo(int videoNum) {
 		_system->delayMillis(10);
 	}
 
-	delete videoDecoder;
+	// Keep the decoder around for the next clip instead of destroying it
+	_videoDecoder->stop();
 
 	initGraphics(320, 240);
 
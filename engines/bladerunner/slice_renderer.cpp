@@ -501,6 +501,16 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 
 	SlicePalette &palette = _vm->_sliceAnimations->getPalette(_framePaletteIndex);
 
+	// Without a screen effect over the frame, the lit color depends only on
+	// the palette index and the per-line lighting constants, so it can be
+	// computed once per scanline per index instead of for every span.
+	uint16 litColor[256];
+	bool litColorValid[256];
+	bool cacheLitColors = advanced && _screenEffects->_entries.empty();
+	if (cacheLitColors) {
+		memset(litColorValid, 0, sizeof(litColorValid));
+	}
+
 	byte *p = (byte*)_sliceFramePtr + 0x20 + 4 * slice;
 
 	uint32 polyOffset = READ_LE_UINT32(p);
@@ -528,18 +538,30 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 				int vertexZ = (_m21lookup[p[0]] + _m22lookup[p[1]] + _m23) >> 6;
 
 				if (vertexZ >= 0 && vertexZ < 65536) {
-					int color555 = palette.color555[p[2]];
+					byte paletteIndex = p[2];
+					int color555 = palette.color555[paletteIndex];
 					if (advanced) {
-						Color256 aescColor = { 0, 0, 0 };
-						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
-
-						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) >> 16) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) >> 16) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) >> 16) + aescColor.b;
-
-						int bladeToScummVmConstant = 256 / 32;
-						color555 = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+						if (cacheLitColors && litColorValid[paletteIndex]) {
+							color555 = litColor[paletteIndex];
+						} else {
+							Color256 aescColor = { 0, 0, 0 };
+							if (!cacheLitColors) {
+								_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
+							}
+
+							Color256 color = palette.color[paletteIndex];
+							color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) >> 16) + aescColor.r;
+							color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) >> 16) + aescColor.g;
+							color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) >> 16) + aescColor.b;
+
+							int bladeToScummVmConstant = 256 / 32;
+							color555 = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+
+							if (cacheLitColors) {
+								litColor[paletteIndex] = color555;
+								litColorValid[paletteIndex] = true;
+							}
+						}
 					}
 					for (int x = previousVertexX; x != vertexX; ++x) {
 						if (vertexZ < zbufLinePtr[x]) {
@@ -34,7 +34,11 @@
 
 namespace CGE {
 
-Bitmap::Bitmap(CGEEngine *vm, const char *fname) : _m(NULL), _v(NULL), _map(0), _vm(vm) {
+enum {
+	kMaxSpanLen = 0xF000                            // longest single span; keeps the length in 16 bits
+};
+
+Bitmap::Bitmap(CGEEngine *vm, const char *fname) : _m(NULL), _v(NULL), _s(NULL), _map(0), _vm(vm) {
 	debugC(1, kCGEDebugBitmap, "Bitmap::Bitmap(%s)", fname);
 
 	char pat[kMaxPath];
@@ -51,7 +55,7 @@ Bitmap::Bitmap(CGEEngine *vm, const char *fname) : _m(NULL), _v(NULL), _map(0),
 	}
 }
 
-Bitmap::Bitmap(CGEEngine *vm, uint16 w, uint16 h, uint8 *map) : _w(w), _h(h), _m(map), _v(NULL), _map(0), _b(NULL), _vm(vm) {
+Bitmap::Bitmap(CGEEngine *vm, uint16 w, uint16 h, uint8 *map) : _w(w), _h(h), _m(map), _v(NULL), _s(NULL), _map(0), _b(NULL), _vm(vm) {
 	debugC(1, kCGEDebugBitmap, "Bitmap::Bitmap(%d, %d, map)", w, h);
 	if (map)
 		code();
@@ -62,7 +66,7 @@ Bitmap::Bitmap(CGEEngine *vm, uint16 w, uint16 h, uint8 *map) : _w(w), _h(h), _m
 // especially for text line real time display
 Bitmap::Bitmap(CGEEngine *vm, uint16 w, uint16 h, uint8 fill)
 	: _w((w + 3) & ~3),                              // only full uint32 allowed!
-	  _h(h), _m(NULL), _map(0), _b(NULL), _vm(vm) {
+	  _h(h), _m(NULL), _s(NULL), _map(0), _b(NULL), _vm(vm) {
 	debugC(1, kCGEDebugBitmap, "Bitmap::Bitmap(%d, %d, %d)", w, h, fill);
 
 	uint16 dsiz = _w >> 2;                           // data size (1 plane line size)
@@ -98,9 +102,10 @@ Bitmap::Bitmap(CGEEngine *vm, uint16 w, uint16 h, uint8 fill)
 	b->_skip = 0;                                    // fix the first entry
 	_v = v;
 	_b = b;
+	makeSpanList();
 }
 
-Bitmap::Bitmap(CGEEngine *vm, const Bitmap &bmp) : _w(bmp._w), _h(bmp._h), _m(NULL), _v(NULL), _map(0), _b(NULL), _vm(vm) {
+Bitmap::Bitmap(CGEEngine *vm, const Bitmap &bmp) : _w(bmp._w), _h(bmp._h), _m(NULL), _v(NULL), _s(NULL), _map(0), _b(NULL), _vm(vm) {
 	debugC(1, kCGEDebugBitmap, "Bitmap::Bitmap(bmp)");
 	uint8 *v0 = bmp._v;
 	if (!v0)
@@ -112,6 +117,7 @@ Bitmap::Bitmap(CGEEngine *vm, const Bitmap &bmp) : _w(bmp._w), _h(bmp._h), _m(NU
 	assert(v1 != NULL);
 	memcpy(v1, v0, siz);
 	_b = (HideDesc *)((_v = v1) + vsiz);
+	makeSpanList();
 }
 
 Bitmap::~Bitmap() {
@@ -119,6 +125,7 @@ Bitmap::~Bitmap() {
 
 	free(_m);
 	delete[] _v;
+	delete[] _s;
 }
 
 Bitmap &Bitmap::operator=(const Bitmap &bmp) {
@@ -133,6 +140,8 @@ Bitmap &Bitmap::operator=(const Bitmap &bmp) {
 	_map = 0;
 	_vm = bmp._vm;
 	delete[] _v;
+	delete[] _s;
+	_s = NULL;
 
 	if (v0 == NULL) {
 		_v = NULL;
@@ -143,6 +152,7 @@ Bitmap &Bitmap::operator=(const Bitmap &bmp) {
 		assert(v1 != NULL);
 		memcpy(v1, v0, siz);
 		_b = (HideDesc *)((_v = v1) + vsiz);
+		makeSpanList();
 	}
 	return *this;
 }
@@ -267,10 +277,120 @@ BitmapPtr Bitmap::code() {
 			cnt = kScrWidth - h;
 		}
 	}
+	makeSpanList();
 
 	return this;
 }
 
+// Compile the plane-interleaved video chunks into a list of spans of
+// consecutive screen bytes, so that show() can blit each span with a
+// single memcpy instead of interpreting the chunk stream pixel by pixel.
+//
+// The span list starts with a uint16 span count, followed by one record
+// per span: uint32 offset from the blit origin, uint16 length, then the
+// span's pixel data.
+void Bitmap::makeSpanList() {
+	debugC(1, kCGEDebugBitmap, "Bitmap::makeSpanList()");
+
+	delete[] _s;
+	_s = NULL;
+	if (!_v || !_h)
+		return;
+
+	// Play the four plane streams into a linear coverage map
+	uint32 cap = (uint32)_h * kScrWidth + 4;
+	uint8 *pix = new uint8[cap];
+	uint8 *use = new uint8[cap];
+	memset(use, 0, cap);
+
+	const byte *srcP = (const byte *)_v;
+	bool ok = true;
+	for (int planeCtr = 0; planeCtr < 4 && ok; planeCtr++) {
+		uint32 pos = planeCtr;
+		for (;;) {
+			uint16 v = READ_LE_UINT16(srcP);
+			srcP += 2;
+			int cmd = v >> 14;
+			int count = v & 0x3FFF;
+
+			if (cmd == 0) {
+				// End of image
+				break;
+			}
+			if (cmd == 1) {
+				// SKIP
+				pos += 4 * count;
+				continue;
+			}
+			if (count && pos + 4 * (count - 1) >= cap) {
+				// Malformed data; show() falls back to the chunk stream
+				ok = false;
+				break;
+			}
+
+			// REPEAT or COPY
+			while (count-- > 0) {
+				pix[pos] = *srcP;
+				use[pos] = 1;
+				pos += 4;
+				if (cmd == 3)
+					srcP++;
+			}
+			if (cmd == 2)
+				srcP++;
+		}
+	}
+
+	uint32 spanCount = 0, pixCount = 0;
+	if (ok) {
+		uint32 i = 0;
+		while (i < cap) {
+			if (!use[i]) {
+				i++;
+				continue;
+			}
+			uint32 j = i;
+			while (j < cap && use[j])
+				j++;
+			spanCount += (j - i + kMaxSpanLen - 1) / kMaxSpanLen;
+			pixCount += j - i;
+			i = j;
+		}
+	}
+
+	if (ok && spanCount && spanCount <= 0xFFFF) {
+		uint8 *s = new uint8[2 + spanCount * 6 + pixCount];
+		assert(s != NULL);
+		uint8 *p = s;
+		WRITE_LE_UINT16(p, spanCount);
+		p += 2;
+		uint32 i = 0;
+		while (i < cap) {
+			if (!use[i]) {
+				i++;
+				continue;
+			}
+			uint32 j = i;
+			while (j < cap && use[j])
+				j++;
+			while (i < j) {
+				uint32 len = MIN<uint32>(j - i, kMaxSpanLen);
+				WRITE_LE_UINT32(p, i);
+				p += 4;
+				WRITE_LE_UINT16(p, len);
+				p += 2;
+				memcpy(p, pix + i, len);
+				p += len;
+				i += len;
+			}
+		}
+		_s = s;
+	}
+
+	delete[] pix;
+	delete[] use;
+}
+
 bool Bitmap::solidAt(int16 x, int16 y) {
 	debugC(6, kCGEDebugBitmap, "Bitmap::solidAt(%d, %d)", x, y);
 
@@ -376,6 +496,8 @@ bool Bitmap::loadVBM(EncryptedStream *f) {
 		f->read(_v, n);
 
 	_b = (HideDesc *)(_v + n - _h * sizeof(HideDesc));
+	if (!f->err())
+		makeSpanList();
 	return (!f->err());
 }
 
@@ -62,6 +62,7 @@ public:
 	uint16 _h;
 	uint8 *_m;
 	uint8 *_v;
+	uint8 *_s;
 	int32 _map;
 	HideDesc *_b;
 
@@ -72,6 +73,7 @@ public:
 	~Bitmap();
 
 	Bitmap *code();
+	void makeSpanList();
 	Bitmap &operator=(const Bitmap &bmp);
 	void hide(int16 x, int16 y);
 	void show(int16 x, int16 y);
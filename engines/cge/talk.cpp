@@ -252,6 +252,7 @@ void InfoLine::update(const char *text) {
 			text++;
 		}
 	}
+	_ts[0]->makeSpanList();
 
 	_oldText = text;
 }
@@ -848,10 +848,30 @@ void Vga::copyPage(uint16 d, uint16 s) {
 void Bitmap::xShow(int16 x, int16 y) {
 	debugC(4, kCGEDebugBitmap, "Bitmap::xShow(%d, %d)", x, y);
 
-	const byte *srcP = (const byte *)_v;
 	byte *destEndP = (byte *)_vm->_vga->_page[1]->getBasePtr(0, kScrHeight);
 	byte *lookupTable = _m;
 
+	if (_s) {
+		// The covered positions are known from the span list, so the chunk
+		// stream doesn't need to be interpreted to find them
+		const byte *p = _s;
+		byte *destP = (byte *)_vm->_vga->_page[1]->getBasePtr(x, y);
+		uint16 n = READ_LE_UINT16(p);
+		p += 2;
+		while (n--) {
+			uint32 off = READ_LE_UINT32(p);
+			uint16 len = READ_LE_UINT16(p + 4);
+			p += 6 + len;
+			byte *d = destP + off;
+			assert(d + len <= destEndP);
+			for (uint16 i = 0; i < len; i++)
+				d[i] = lookupTable[d[i]];
+		}
+		return;
+	}
+
+	const byte *srcP = (const byte *)_v;
+
 	// Loop through processing data for each plane. The game originally ran in plane mapped mode, where a
 	// given plane holds each fourth pixel sequentially. So to handle an entire picture, each plane's data
 	// must be decompressed and inserted into the surface
@@ -901,9 +921,27 @@ void Bitmap::xShow(int16 x, int16 y) {
 void Bitmap::show(int16 x, int16 y) {
 	debugC(5, kCGEDebugBitmap, "Bitmap::show(%d, %d)", x, y);
 
-	const byte *srcP = (const byte *)_v;
 	byte *destEndP = (byte *)_vm->_vga->_page[1]->getBasePtr(0, kScrHeight);
 
+	if (_s) {
+		// Blit the precompiled spans with straight memory copies
+		const byte *p = _s;
+		byte *destP = (byte *)_vm->_vga->_page[1]->getBasePtr(x, y);
+		uint16 n = READ_LE_UINT16(p);
+		p += 2;
+		while (n--) {
+			uint32 off = READ_LE_UINT32(p);
+			uint16 len = READ_LE_UINT16(p + 4);
+			p += 6;
+			assert(destP + off + len <= destEndP);
+			memcpy(destP + off, p, len);
+			p += len;
+		}
+		return;
+	}
+
+	const byte *srcP = (const byte *)_v;
+
 	// Loop through processing data for each plane. The game originally ran in plane mapped mode, where a
 	// given plane holds each fourth pixel sequentially. So to handle an entire picture, each plane's data
 	// must be decompressed and inserted into the surface
@@ -35,14 +35,18 @@
 
 namespace CGE2 {
 
-Bitmap::Bitmap() : _w(0), _h(0), _v(nullptr), _b(nullptr), _map(0), _vm(nullptr) {
+enum {
+	kMaxSpanLen = 0xF000                            // longest single span; keeps the length in 16 bits
+};
+
+Bitmap::Bitmap() : _w(0), _h(0), _v(nullptr), _s(nullptr), _b(nullptr), _map(0), _vm(nullptr) {
 }
 
 void Bitmap::setVM(CGE2Engine *vm) {
 	_vm = vm;
 }
 
-Bitmap::Bitmap(CGE2Engine *vm, const char *fname) : _w(0), _h(0), _v(nullptr), _b(nullptr), _map(0), _vm(vm) {
+Bitmap::Bitmap(CGE2Engine *vm, const char *fname) : _w(0), _h(0), _v(nullptr), _s(nullptr), _b(nullptr), _map(0), _vm(vm) {
 	Common::String path;
 
 	if (!strcmp(fname, "04tal201")) {
@@ -67,7 +71,7 @@ Bitmap::Bitmap(CGE2Engine *vm, const char *fname) : _w(0), _h(0), _v(nullptr), _
 	}
 }
 
-Bitmap::Bitmap(CGE2Engine *vm, uint16 w, uint16 h, uint8 *map) : _w(w), _h(h), _v(nullptr), _map(0), _b(nullptr), _vm(vm) {
+Bitmap::Bitmap(CGE2Engine *vm, uint16 w, uint16 h, uint8 *map) : _w(w), _h(h), _v(nullptr), _s(nullptr), _map(0), _b(nullptr), _vm(vm) {
 	if (map)
 		code(map);
 }
@@ -77,7 +81,7 @@ Bitmap::Bitmap(CGE2Engine *vm, uint16 w, uint16 h, uint8 *map) : _w(w), _h(h), _
 // especially for text line real time display
 Bitmap::Bitmap(CGE2Engine *vm, uint16 w, uint16 h, uint8 fill)
 	: _w((w + 3) & ~3),                              // only full uint32 allowed!
-	  _h(h), _map(0), _b(nullptr), _vm(vm) {
+	  _h(h), _s(nullptr), _map(0), _b(nullptr), _vm(vm) {
 
 	uint16 dsiz = _w >> 2;                           // data size (1 plane line size)
 	uint16 lsiz = 2 + dsiz + 2;                     // uint16 for line header, uint16 for gap
@@ -111,9 +115,10 @@ Bitmap::Bitmap(CGE2Engine *vm, uint16 w, uint16 h, uint8 fill)
 	b->_skip = 0;                                    // fix the first entry
 	_v = v;
 	_b = b;
+	makeSpanList();
 }
 
-Bitmap::Bitmap(CGE2Engine *vm, const Bitmap &bmp) : _w(bmp._w), _h(bmp._h), _v(nullptr), _map(0), _b(nullptr), _vm(vm) {
+Bitmap::Bitmap(CGE2Engine *vm, const Bitmap &bmp) : _w(bmp._w), _h(bmp._h), _v(nullptr), _s(nullptr), _map(0), _b(nullptr), _vm(vm) {
 	uint8 *v0 = bmp._v;
 	if (!v0)
 		return;
@@ -123,6 +128,7 @@ Bitmap::Bitmap(CGE2Engine *vm, const Bitmap &bmp) : _w(bmp._w), _h(bmp._h), _v(n
 	uint8 *v1 = new uint8[siz];
 	memcpy(v1, v0, siz);
 	_b = (HideDesc *)((_v = v1) + vsiz);
+	makeSpanList();
 }
 
 Bitmap::~Bitmap() {
@@ -133,6 +139,8 @@ void Bitmap::release() {
 	if (_v != nullptr)
 		delete[] _v;
 	_v = nullptr;
+	delete[] _s;
+	_s = nullptr;
 }
 
 Bitmap &Bitmap::operator=(const Bitmap &bmp) {
@@ -146,6 +154,8 @@ Bitmap &Bitmap::operator=(const Bitmap &bmp) {
 	_vm = bmp._vm;
 	delete[] _v;
 	_v = nullptr;
+	delete[] _s;
+	_s = nullptr;
 
 	if (v0) {
 		uint16 vsiz = (uint8 *)bmp._b - (uint8 *)v0;
@@ -153,6 +163,7 @@ Bitmap &Bitmap::operator=(const Bitmap &bmp) {
 		uint8 *v1 = new uint8[siz];
 		memcpy(v1, v0, siz);
 		_b = (HideDesc *)((_v = v1) + vsiz);
+		makeSpanList();
 	}
 	return *this;
 }
@@ -274,10 +285,117 @@ BitmapPtr Bitmap::code(uint8 *map) {
 			cnt = kScrWidth - h;
 		}
 	}
+	makeSpanList();
 
 	return this;
 }
 
+// Compile the plane-interleaved video chunks into a list of spans of
+// consecutive screen bytes, so that show() can blit each span with a
+// single memcpy instead of interpreting the chunk stream pixel by pixel.
+//
+// The span list starts with a uint16 span count, followed by one record
+// per span: uint32 offset from the blit origin, uint16 length, then the
+// span's pixel data.
+void Bitmap::makeSpanList() {
+	delete[] _s;
+	_s = nullptr;
+	if (!_v || !_h)
+		return;
+
+	// Play the four plane streams into a linear coverage map
+	uint32 cap = (uint32)_h * kScrWidth + 4;
+	uint8 *pix = new uint8[cap];
+	uint8 *use = new uint8[cap];
+	memset(use, 0, cap);
+
+	const byte *srcP = (const byte *)_v;
+	bool ok = true;
+	for (int planeCtr = 0; planeCtr < 4 && ok; planeCtr++) {
+		uint32 pos = planeCtr;
+		for (;;) {
+			uint16 v = READ_LE_UINT16(srcP);
+			srcP += 2;
+			int cmd = v >> 14;
+			int count = v & 0x3FFF;
+
+			if (cmd == 0) {
+				// End of image
+				break;
+			}
+			if (cmd == 1) {
+				// SKIP
+				pos += 4 * count;
+				continue;
+			}
+			if (count && pos + 4 * (count - 1) >= cap) {
+				// Malformed data; show() falls back to the chunk stream
+				ok = false;
+				break;
+			}
+
+			// REPEAT or COPY
+			while (count-- > 0) {
+				pix[pos] = *srcP;
+				use[pos] = 1;
+				pos += 4;
+				if (cmd == 3)
+					srcP++;
+			}
+			if (cmd == 2)
+				srcP++;
+		}
+	}
+
+	uint32 spanCount = 0, pixCount = 0;
+	if (ok) {
+		uint32 i = 0;
+		while (i < cap) {
+			if (!use[i]) {
+				i++;
+				continue;
+			}
+			uint32 j = i;
+			while (j < cap && use[j])
+				j++;
+			spanCount += (j - i + kMaxSpanLen - 1) / kMaxSpanLen;
+			pixCount += j - i;
+			i = j;
+		}
+	}
+
+	if (ok && spanCount && spanCount <= 0xFFFF) {
+		uint8 *s = new uint8[2 + spanCount * 6 + pixCount];
+		uint8 *p = s;
+		WRITE_LE_UINT16(p, spanCount);
+		p += 2;
+		uint32 i = 0;
+		while (i < cap) {
+			if (!use[i]) {
+				i++;
+				continue;
+			}
+			uint32 j = i;
+			while (j < cap && use[j])
+				j++;
+			while (i < j) {
+				uint32 len = MIN<uint32>(j - i, kMaxSpanLen);
+				WRITE_LE_UINT32(p, i);
+				p += 4;
+				WRITE_LE_UINT16(p, len);
+				p += 2;
+				memcpy(p, pix + i, len);
+				p += len;
+				i += len;
+			}
+		}
+		_s = s;
+	}
+
+	delete[] pix;
+	delete[] use;
+}
+
 bool Bitmap::solidAt(V2D pos) {
 	pos.x += _w >> 1;
 	pos.y = _h - pos.y;
@@ -381,6 +499,8 @@ bool Bitmap::loadVBM(EncryptedStream *f) {
 		f->read(_v, n);
 
 	_b = (HideDesc *)(_v + n - _h * sizeof(HideDesc));
+	if (!f->err())
+		makeSpanList();
 	return (!f->err());
 }
 
@@ -64,6 +64,7 @@ public:
 	uint16 _w;
 	uint16 _h;
 	uint8 *_v;
+	uint8 *_s;
 	int32 _map;
 	HideDesc *_b;
 
@@ -76,6 +77,7 @@ public:
 
 	void setVM(CGE2Engine *vm);
 	Bitmap *code(uint8 *map);
+	void makeSpanList();
 	Bitmap &operator=(const Bitmap &bmp);
 	void release();
 	void hide(V2D pos);
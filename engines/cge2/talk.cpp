@@ -307,6 +307,7 @@ void InfoLine::update(const char *text) {
 			text++;
 		}
 	}
+	_ext->_shpList->makeSpanList();
 }
 
 } // End of namespace CGE2
@@ -1124,10 +1124,38 @@ void Vga::copyPage(uint16 d, uint16 s) {
 void Bitmap::show(V2D pos) {
 	xLatPos(pos);
 
-	const byte *srcP = (const byte *)_v;
 	byte *screenStartP = (byte *)_vm->_vga->_page[1]->getPixels();
 	byte *screenEndP = (byte *)_vm->_vga->_page[1]->getBasePtr(0, kScrHeight);
 
+	if (_s) {
+		// Blit the precompiled spans with straight memory copies, clipped
+		// against the screen buffer like the pixel loop below
+		const byte *p = _s;
+		byte *destP = (byte *)_vm->_vga->_page[1]->getBasePtr(pos.x, pos.y);
+		uint16 n = READ_LE_UINT16(p);
+		p += 2;
+		while (n--) {
+			uint32 off = READ_LE_UINT32(p);
+			int len = READ_LE_UINT16(p + 4);
+			p += 6;
+			byte *d = destP + off;
+			const byte *sp = p;
+			p += len;
+			if (d < screenStartP) {
+				sp += screenStartP - d;
+				len -= screenStartP - d;
+				d = screenStartP;
+			}
+			if (d + len > screenEndP)
+				len = screenEndP - d;
+			if (len > 0)
+				memcpy(d, sp, len);
+		}
+		return;
+	}
+
+	const byte *srcP = (const byte *)_v;
+
 	// Loop through processing data for each plane. The game originally ran in plane mapped mode, where a
 	// given plane holds each fourth pixel sequentially. So to handle an entire picture, each plane's data
 	// must be decompressed and inserted into the surface
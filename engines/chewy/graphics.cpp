@@ -134,7 +134,11 @@ void Graphics::playVideo(uint num) {
 		if (cfoDecoder->needsUpdate()) {
 			const ::Graphics::Surface *frame = cfoDecoder->decodeNextFrame();
 			if (frame) {
-				g_system->copyRectToScreen(frame->getPixels(), frame->pitch, x, y, frame->w, frame->h);
+				// Only copy the areas the delta frame actually changed
+				const Common::List<Common::Rect> *dirtyRects = cfoDecoder->getDirtyRects();
+				for (Common::List<Common::Rect>::const_iterator it = dirtyRects->begin(); it != dirtyRects->end(); ++it)
+					g_system->copyRectToScreen(frame->getBasePtr(it->left, it->top), frame->pitch, x + it->left, y + it->top, it->width(), it->height());
+				cfoDecoder->clearDirtyRects();
 
 				if (cfoDecoder->hasDirtyPalette())
 					g_system->getPaletteManager()->setPalette(cfoDecoder->getPalette(), 0, 256);
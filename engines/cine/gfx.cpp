@@ -108,11 +108,14 @@ static const byte cursorPalette[] = {
  */
 FWRenderer::FWRenderer() : _background(NULL), _backupPal(), _cmd(""),
 	_cmdY(0), _messageBg(0), _backBuffer(new byte[_screenSize]),
+	_shownBuffer(new byte[_screenSize]), _shownBufferValid(false),
 	_activePal(), _changePal(0), _showCollisionPage(false) {
 
 	assert(_backBuffer);
+	assert(_shownBuffer);
 
 	memset(_backBuffer, 0, _screenSize);
+	memset(_shownBuffer, 0, _screenSize);
 	memset(_bgName, 0, sizeof(_bgName));
 }
 
@@ -123,6 +126,7 @@ FWRenderer::FWRenderer() : _background(NULL), _backupPal(), _cmd(""),
 FWRenderer::~FWRenderer() {
 	delete[] _background;
 	delete[] _backBuffer;
+	delete[] _shownBuffer;
 
 	clearMenuStack();
 }
@@ -144,6 +148,7 @@ void FWRenderer::clear() {
 	_activePal.clear();
 
 	memset(_backBuffer, 0, _screenSize);
+	_shownBufferValid = false;
 
 	_cmd = "";
 	_cmdY = 0;
@@ -677,7 +682,11 @@ void FWRenderer::drawFrame() {
  * @note Useful for debugging collision page related problems.
  */
 void FWRenderer::showCollisionPage(bool state) {
-	_showCollisionPage = state;
+	if (_showCollisionPage != state) {
+		_showCollisionPage = state;
+		// The blit source changed, so the next blit must push a full frame
+		_shownBufferValid = false;
+	}
 }
 
 /**
@@ -687,7 +696,47 @@ void FWRenderer::blit() {
 	// Show the back buffer or the collision page. Normally the back
 	// buffer but showing the collision page is useful for debugging.
 	byte *source = (_showCollisionPage ? collisionPage : _backBuffer);
-	g_system->copyRectToScreen(source, 320, 0, 0, 320, 200);
+
+	if (!_shownBufferValid) {
+		memcpy(_shownBuffer, source, _screenSize);
+		_shownBufferValid = true;
+		g_system->copyRectToScreen(source, _screenWidth, 0, 0, _screenWidth, _screenHeight);
+		return;
+	}
+
+	// Compare against the previously pushed frame and only copy the region
+	// that changed; a typical frame only touches a few moving overlays
+	int top = -1, bottom = -1, left = _screenWidth, right = -1;
+	for (int y = 0; y < _screenHeight; y++) {
+		const byte *newLine = source + y * _screenWidth;
+		const byte *oldLine = _shownBuffer + y * _screenWidth;
+
+		if (memcmp(newLine, oldLine, _screenWidth) == 0)
+			continue;
+
+		if (top == -1)
+			top = y;
+		bottom = y;
+
+		int x = 0;
+		while (newLine[x] == oldLine[x])
+			x++;
+		left = MIN(left, x);
+
+		x = _screenWidth - 1;
+		while (newLine[x] == oldLine[x])
+			x--;
+		right = MAX(right, x);
+	}
+
+	if (top == -1)
+		return;
+
+	int width = right - left + 1;
+	for (int y = top; y <= bottom; y++)
+		memcpy(_shownBuffer + y * _screenWidth + left, source + y * _screenWidth + left, width);
+
+	g_system->copyRectToScreen(source + top * _screenWidth + left, _screenWidth, left, top, width, bottom - top + 1);
 }
 
 /**
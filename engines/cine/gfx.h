@@ -135,6 +135,8 @@ protected:
 	static const int _screenHeight = 200; ///< Screen height
 
 	byte *_backBuffer; ///< Screen backbuffer
+	byte *_shownBuffer; ///< Copy of the last frame pushed to the video backend
+	bool _shownBufferValid; ///< Whether _shownBuffer matches what is on screen
 	Cine::Palette _backupPal; ///< The backup color palette
 	Cine::Palette _activePal; ///< The active color palette
 	Common::Stack<Menu *> _menuStack; ///< All displayed menus
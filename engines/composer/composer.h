@@ -270,7 +270,7 @@ private:
 	void decompressBitmap(uint16 type, Common::SeekableReadStream *stream, byte *buffer, uint32 size, uint width, uint height);
 	bool initSprite(Sprite &sprite);
 	Common::SeekableReadStream *getStreamForSprite(uint16 id);
-	void drawSprite(const Sprite &sprite);
+	void drawSprite(const Sprite &sprite, const Common::Rect &clip);
 };
 
 } // End of namespace Composer
@@ -538,16 +538,14 @@ void ComposerEngine::redraw() {
 
 	for (Common::List<Sprite>::iterator i = _sprites.begin(); i != _sprites.end(); i++) {
 		Common::Rect rect(i->_pos.x, i->_pos.y, i->_pos.x + i->_surface.w, i->_pos.y + i->_surface.h);
-		bool intersects = false;
 		for (uint j = 0; j < _dirtyRects.size(); j++) {
 			if (!_dirtyRects[j].intersects(rect))
 				continue;
-			intersects = true;
-			break;
+			// Only repaint the part of the sprite which is actually dirty;
+			// a small animation in front of a large background sprite would
+			// otherwise repaint the whole background every frame.
+			drawSprite(*i, _dirtyRects[j]);
 		}
-		if (!intersects)
-			continue;
-		drawSprite(*i);
 	}
 
 	for (uint i = 0; i < _dirtyRects.size(); i++) {
@@ -820,21 +818,22 @@ bool ComposerEngine::initSprite(Sprite &sprite) {
 	return true;
 }
 
-void ComposerEngine::drawSprite(const Sprite &sprite) {
+void ComposerEngine::drawSprite(const Sprite &sprite, const Common::Rect &clip) {
 	int x = sprite._pos.x;
 	int y = sprite._pos.y;
 
+	int startLine = MAX<int>(MAX<int>(clip.top, 0) - y, 0);
+	int endLine = MIN<int>(MIN<int>(clip.bottom, _screen.h) - y, sprite._surface.h);
+	int startCol = MAX<int>(MAX<int>(clip.left, 0) - x, 0);
+	int endCol = MIN<int>(MIN<int>(clip.right, _screen.w) - x, sprite._surface.w);
+
 	// incoming data is BMP-style (bottom-up), so flip it
 	byte *pixels = (byte *)_screen.getPixels();
-	for (int j = 0; j < sprite._surface.h; j++) {
-		if (j + y < 0)
-			continue;
-		if (j + y >= _screen.h)
-			break;
+	for (int j = startLine; j < endLine; j++) {
 		const byte *in = (const byte *)sprite._surface.getBasePtr(0, sprite._surface.h - j - 1);
 		byte *out = pixels + ((j + y) * _screen.w) + x;
-		for (int i = 0; i < sprite._surface.w; i++)
-			if ((x + i >= 0) && (x + i < _screen.w) && in[i])
+		for (int i = startCol; i < endCol; i++)
+			if (in[i])
 				out[i] = in[i];
 	}
 }
@@ -64,6 +64,12 @@ public:
 class BitmapCast : public Cast {
 public:
 	BitmapCast(Common::ReadStreamEndian &stream, uint32 castTag, uint16 version = 2);
+	~BitmapCast();
+
+	/** Matte ink mask derived from the surface, shared by all channels showing this cast member */
+	Graphics::Surface *matte;
+	/** White color the cached matte mask was computed with */
+	int matteWhiteColor;
 
 	uint16 regX;
 	uint16 regY;
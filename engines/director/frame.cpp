@@ -724,7 +724,7 @@ void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics
 		drawBackgndTransSprite(targetSurface, spriteSurface, drawRect);
 		break;
 	case kInkTypeMatte:
-		drawMatteSprite(targetSurface, spriteSurface, drawRect);
+		drawMatteSprite(targetSurface, spriteSurface, spriteId, drawRect);
 		break;
 	case kInkTypeGhost:
 		drawGhostSprite(targetSurface, spriteSurface, drawRect);
@@ -914,19 +914,17 @@ void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::
 	}
 }
 
-void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
+void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, uint16 spriteId, Common::Rect &drawRect) {
 	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
-	Graphics::Surface tmp;
-	tmp.copyFrom(sprite);
 
 	// Searching white color in the corners
 	int whiteColor = -1;
 
 	for (int corner = 0; corner < 4; corner++) {
-		int x = (corner & 0x1) ? tmp.w - 1 : 0;
-		int y = (corner & 0x2) ? tmp.h - 1 : 0;
+		int x = (corner & 0x1) ? sprite.w - 1 : 0;
+		int y = (corner & 0x2) ? sprite.h - 1 : 0;
 
-		byte color = *(byte *)tmp.getBasePtr(x, y);
+		byte color = *(const byte *)sprite.getBasePtr(x, y);
 
 		if (_vm->getPalette()[color * 3 + 0] == 0xff &&
 			_vm->getPalette()[color * 3 + 1] == 0xff &&
@@ -939,14 +937,32 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 	if (whiteColor == -1) {
 		debugC(1, kDebugImages, "No white color for Matte image");
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
+		for (int yy = 0; yy < sprite.h; yy++) {
+			const byte *src = (const byte *)sprite.getBasePtr(0, yy);
 			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
 
 			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++)
 				*dst = *src;
 		}
+
+		return;
+	}
+
+	// The mask only depends on the cast member's pixels and the white color,
+	// so for bitmap casts it is computed once and then shared by every
+	// channel that shows this cast member, instead of being flood filled
+	// again on every blit
+	BitmapCast *bitmapCast = _sprites[spriteId]->_bitmapCast;
+	bool cacheable = (bitmapCast != nullptr && bitmapCast->surface == &sprite);
+	Graphics::Surface *ownedMask = nullptr;
+	const Graphics::Surface *mask;
+
+	if (cacheable && bitmapCast->matte && bitmapCast->matteWhiteColor == whiteColor) {
+		mask = bitmapCast->matte;
 	} else {
+		Graphics::Surface tmp;
+		tmp.copyFrom(sprite);
+
 		Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
 
 		for (int yy = 0; yy < tmp.h; yy++) {
@@ -960,18 +976,38 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 		}
 		ff.fillMask();
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			const byte *mask = (const byte *)ff.getMask()->getBasePtr(0, yy);
-			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+		ownedMask = new Graphics::Surface();
+		ownedMask->copyFrom(*ff.getMask());
+		tmp.free();
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, mask++)
-				if (*mask == 0)
-					*dst = *src;
+		if (cacheable) {
+			if (bitmapCast->matte) {
+				bitmapCast->matte->free();
+				delete bitmapCast->matte;
+			}
+			bitmapCast->matte = ownedMask;
+			bitmapCast->matteWhiteColor = whiteColor;
+			ownedMask = nullptr;
+			mask = bitmapCast->matte;
+		} else {
+			mask = ownedMask;
 		}
 	}
 
-	tmp.free();
+	for (int yy = 0; yy < sprite.h; yy++) {
+		const byte *src = (const byte *)sprite.getBasePtr(0, yy);
+		const byte *maskPix = (const byte *)mask->getBasePtr(0, yy);
+		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+
+		for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, maskPix++)
+			if (*maskPix == 0)
+				*dst = *src;
+	}
+
+	if (ownedMask) {
+		ownedMask->free();
+		delete ownedMask;
+	}
 }
 
 uint16 Frame::getSpriteIDFromPos(Common::Point pos) {
@@ -79,6 +79,10 @@ DisplayMan::DisplayMan(DMEngine *dmEngine) : _vm(dmEngine) {
 	_currMapAllowedCreatureTypes = nullptr;
 	_derivedBitmapByteCount = nullptr;
 	_derivedBitmaps = nullptr;
+	_derivedBitmapSizes = nullptr;
+	_derivedBitmapLastUse = nullptr;
+	_derivedBitmapCacheSize = 0;
+	_derivedBitmapUseCounter = 0;
 
 	_screenWidth = _screenHeight = 0;
 	_championPortraitOrdinal = 0;
@@ -637,6 +641,8 @@ DisplayMan::~DisplayMan() {
 			delete[] _derivedBitmaps[i];
 		delete[] _derivedBitmaps;
 	}
+	delete[] _derivedBitmapSizes;
+	delete[] _derivedBitmapLastUse;
 
 	delete[] _bitmapCeiling;
 	delete[] _bitmapFloor;
@@ -707,8 +713,13 @@ void DisplayMan::initializeGraphicData() {
     }
 	if (!_derivedBitmaps) {
 		_derivedBitmaps = new byte *[k730_DerivedBitmapMaximumCount];
-		for (uint16 i = 0; i < k730_DerivedBitmapMaximumCount; ++i)
+		_derivedBitmapSizes = new uint32[k730_DerivedBitmapMaximumCount];
+		_derivedBitmapLastUse = new uint32[k730_DerivedBitmapMaximumCount];
+		for (uint16 i = 0; i < k730_DerivedBitmapMaximumCount; ++i) {
 			_derivedBitmaps[i] = nullptr;
+			_derivedBitmapSizes[i] = 0;
+			_derivedBitmapLastUse[i] = 0;
+		}
 	}
 
 	_derivedBitmapByteCount[kDMDerivedBitmapViewport] = 112 * 136;
@@ -2266,6 +2277,10 @@ void DisplayMan::drawDungeon(Direction dir, int16 posX, int16 posY) {
 
 	DungeonMan &dungeon = *_vm->_dungeonMan;
 
+	// Marks the start of a new frame for the derived bitmap cache; bitmaps
+	// used during this call are protected from eviction until the next one
+	_derivedBitmapUseCounter++;
+
 	if (_drawFloorAndCeilingRequested)
 		drawFloorAndCeiling();
 
@@ -2919,7 +2934,9 @@ void DisplayMan::drawField(FieldAspect *fieldAspect, Box& box) {
 									   _vm->getRandomNumber(2) + fieldAspect->_baseStartUnitIndex, _vm->getRandomNumber(32), k112_byteWidthViewport,
 									   (Color)fieldAspect->_transparentColor, fieldAspect->_xPos, 0, 136, fieldAspect->_bitplaneWordCount);
 	addDerivedBitmap(kDMDerivedBitmapViewport);
-	releaseBlock(kDMDerivedBitmapViewport | 0x8000);
+	// The viewport scratch block has a fixed size and is needed again by the
+	// next field or explosion draw, so it is kept in the cache rather than
+	// being freed and reallocated on every call
 }
 
 int16 DisplayMan::getScaledBitmapByteCount(int16 byteWidth, int16 height, int16 scale) {
@@ -3894,23 +3911,58 @@ uint16 DisplayMan::getHorizontalOffsetM22(uint16 val) {
 bool DisplayMan::isDerivedBitmapInCache(int16 derivedBitmapIndex) {
 	if (_derivedBitmaps[derivedBitmapIndex] == nullptr) {
 		// * 2, because the original uses 4 bits instead of 8 bits to store a pixel
-		_derivedBitmaps[derivedBitmapIndex] = new byte[_derivedBitmapByteCount[derivedBitmapIndex] * 2 + 16];
+		uint32 allocatedSize = _derivedBitmapByteCount[derivedBitmapIndex] * 2 + 16;
+		if (_derivedBitmapCacheSize + allocatedSize > k262144_DerivedBitmapMaximumCacheSize)
+			evictDerivedBitmaps();
+
+		_derivedBitmaps[derivedBitmapIndex] = new byte[allocatedSize];
+		_derivedBitmapSizes[derivedBitmapIndex] = allocatedSize;
+		_derivedBitmapCacheSize += allocatedSize;
+		_derivedBitmapLastUse[derivedBitmapIndex] = _derivedBitmapUseCounter;
 		return false;
 	}
 
+	_derivedBitmapLastUse[derivedBitmapIndex] = _derivedBitmapUseCounter;
 	return true;
 }
 
 byte *DisplayMan::getDerivedBitmap(int16 derivedBitmapIndex) {
+	_derivedBitmapLastUse[derivedBitmapIndex] = _derivedBitmapUseCounter;
 	return _derivedBitmaps[derivedBitmapIndex];
 }
 
-void DisplayMan::addDerivedBitmap(int16 derivedBitmapIndex) {}
+void DisplayMan::addDerivedBitmap(int16 derivedBitmapIndex) {
+	_derivedBitmapLastUse[derivedBitmapIndex] = _derivedBitmapUseCounter;
+}
+
+void DisplayMan::evictDerivedBitmaps() {
+	// Free the least recently used bitmaps until the cache fits its budget
+	// again. Bitmaps already used during the current drawDungeon() call are
+	// never evicted, so pointers obtained earlier in the frame stay valid
+	while (_derivedBitmapCacheSize > k262144_DerivedBitmapMaximumCacheSize) {
+		int16 evictionCandidate = -1;
+
+		for (int16 i = 0; i < k730_DerivedBitmapMaximumCount; ++i) {
+			if ((_derivedBitmaps[i] == nullptr) || (_derivedBitmapLastUse[i] == _derivedBitmapUseCounter))
+				continue;
+
+			if ((evictionCandidate == -1) || (_derivedBitmapLastUse[i] < _derivedBitmapLastUse[evictionCandidate]))
+				evictionCandidate = i;
+		}
+
+		if (evictionCandidate == -1)
+			break;
+
+		releaseBlock(evictionCandidate);
+	}
+}
 
 void DisplayMan::releaseBlock(uint16 index) {
 	index &= ~0x8000;
 	delete[] _derivedBitmaps[index];
 	_derivedBitmaps[index] = nullptr;
+	_derivedBitmapCacheSize -= _derivedBitmapSizes[index];
+	_derivedBitmapSizes[index] = 0;
 }
 
 uint16 DisplayMan::getDarkenedColor(uint16 RGBcolor) {
@@ -331,6 +331,7 @@ enum GraphicIndice {
 #define k247_FirstFloorOrn 247 // @ C247_GRAPHIC_FIRST_FLOOR_ORNAMENT
 #define k303_FirstDoorOrn 303 // @ C303_GRAPHIC_FIRST_DOOR_ORNAMENT
 #define k730_DerivedBitmapMaximumCount 730 // @ C730_DERIVED_BITMAP_MAXIMUM_COUNT
+#define k262144_DerivedBitmapMaximumCacheSize 262144 // Total byte budget for cached derived bitmaps
 
 #define k16_Scale_D3 16 // @ C16_SCALE_D3
 #define k20_Scale_D2 20 // @ C20_SCALE_D2
@@ -611,6 +612,10 @@ class DisplayMan {
 
 	uint16 *_derivedBitmapByteCount; // @ G0639_pui_DerivedBitmapByteCount
 	byte **_derivedBitmaps; // @ G0638_pui_DerivedBitmapBlockIndices
+	uint32 *_derivedBitmapSizes; // Allocated byte size of each derived bitmap, 0 when not in cache
+	uint32 *_derivedBitmapLastUse; // Value of _derivedBitmapUseCounter when the bitmap was last used
+	uint32 _derivedBitmapCacheSize; // Total byte size of the currently allocated derived bitmaps
+	uint32 _derivedBitmapUseCounter; // Incremented once per drawDungeon() call
 
 	int16 _stairsNativeBitmapIndexUpFrontD3L; // @ G0675_i_StairsNativeBitmapIndex_Up_Front_D3L
 	int16 _stairsNativeBitmapIndexUpFrontD3C; // @ G0676_i_StairsNativeBitmapIndex_Up_Front_D3C
@@ -818,6 +823,7 @@ public:
 	bool isDerivedBitmapInCache(int16 derivedBitmapIndex); // @  F0491_CACHE_IsDerivedBitmapInCache
 	byte *getDerivedBitmap(int16 derivedBitmapIndex); // @ F0492_CACHE_GetDerivedBitmap
 	void addDerivedBitmap(int16 derivedBitmapIndex); // @ F0493_CACHE_AddDerivedBitmap
+	void evictDerivedBitmaps(); // Frees the least recently used derived bitmaps while over the cache budget
 	void releaseBlock(uint16 index); // @ F0480_CACHE_ReleaseBlock
 	uint16 getDarkenedColor(uint16 RGBcolor);
 	void startEndFadeToPalette(uint16 *P0849_pui_Palette); // @ F0436_STARTEND_FadeToPalette
@@ -274,6 +274,13 @@ Text::Text(const Common::String &str, const Font *font, byte fontColor,
 
 	_scaledWidth = _width;
 	_scaledHeight = _height;
+
+	_cache = NULL;
+	_cacheDirty = true;
+}
+
+Text::~Text() {
+	delete _cache;
 }
 
 void Text::setText(const Common::String &str) {
@@ -281,6 +288,7 @@ void Text::setText(const Common::String &str) {
 	_height = _font->getStringHeight(str);
 
 	 _text = str;
+	_cacheDirty = true;
 
 	_length = 0;
 	for (uint i = 0; i < _text.size(); ++i) {
@@ -290,8 +298,62 @@ void Text::setText(const Common::String &str) {
 	}
 }
 
+/**
+ *  @brief Re-renders the text into the cache surface
+ *
+ *  The text is drawn at the top-left corner of the cache, which has exactly
+ *  the size of the rendered text, so the line centering inside drawString()
+ *  produces the same layout as drawing to the screen directly would.
+ */
+void Text::updateCache() const {
+	if (_cache && (_cache->w != (int)_width || _cache->h != (int)_height)) {
+		delete _cache;
+		_cache = NULL;
+	}
+	if (!_cache)
+		_cache = new Surface(_width, _height);
+
+	_cache->fill(_cache->getTransparentColor());
+	_font->drawString(_cache, _text, 0, 0, _color, _spacing, false);
+	_cacheDirty = false;
+}
+
 void Text::draw(Surface *surface, bool markDirty, int relX, int relY) const {
-	_font->drawString(surface, _text, _x + relX, _y + relY, _color, _spacing, true);
+	const bool contentChanged = _cacheDirty;
+	if (_cacheDirty)
+		updateCache();
+
+	const Common::Rect destRect(_x + relX, _y + relY, _x + relX + _cache->w, _y + relY + _cache->h);
+	Common::Rect clippedDestRect(0, 0, surface->w, surface->h);
+	clippedDestRect.clip(destRect);
+
+	const Common::Point croppedBy(clippedDestRect.left - destRect.left, clippedDestRect.top - destRect.top);
+
+	byte *dst = (byte *)surface->getBasePtr(clippedDestRect.left, clippedDestRect.top);
+	const byte *src = (const byte *)_cache->getBasePtr(croppedBy.x, croppedBy.y);
+
+	const int transparent = _cache->getTransparentColor();
+	const int rows = clippedDestRect.height();
+	const int columns = clippedDestRect.width();
+
+	for (int i = 0; i < rows; ++i) {
+		for (int j = 0; j < columns; ++j) {
+			if (src[j] != transparent) {
+				dst[j] = src[j];
+			}
+		}
+		dst += surface->pitch;
+		src += _cache->pitch;
+	}
+
+	// Unlike sprites, the animation code doesn't know when a text changes
+	// its contents, so the dirty marking is tracked here: the rectangle is
+	// only marked when the text was re-rendered or has moved, not on the
+	// unchanged redraws done every frame
+	if (markDirty || contentChanged || destRect != _lastMarkedRect) {
+		surface->markDirtyRect(clippedDestRect);
+		_lastMarkedRect = destRect;
+	}
 }
 
 Common::Rect Text::getRect(const Displacement &displacement) const {
@@ -304,6 +366,7 @@ void Text::setFont(const Font *font) {
 		return;
 	}
 	_font = font;
+	_cacheDirty = true;
 
 	_width = _font->getStringWidth(_text, _spacing);
 	_height = _font->getStringHeight(_text);
@@ -314,6 +377,7 @@ void Text::repeatedlySplitLongLines(uint maxWidth) {
 		splitLinesLongerThan(maxWidth);
 		_width = _font->getStringWidth(_text, _spacing);
 		_height = _font->getStringHeight(_text);
+		_cacheDirty = true;
 	}
 }
 
@@ -138,11 +138,11 @@ class Text : public Drawable {
 public:
 	Text(const Common::String &str, const Font *font, byte fontColor,
 	    int x, int y, uint spacing);
-	~Text() {}
+	~Text();
 
 	void setText(const Common::String &str);
-	void setColor(byte fontColor) { _color = fontColor; }
-	void setSpacing(uint spacing) { _spacing = spacing; }
+	void setColor(byte fontColor) { _color = fontColor; _cacheDirty = true; }
+	void setSpacing(uint spacing) { _spacing = spacing; _cacheDirty = true; }
 	void setFont(const Font *font);
 
 	void repeatedlySplitLongLines(uint maxWidth);
@@ -159,12 +159,21 @@ public:
 	DrawableType getType() const { return kDrawableText; }
 private:
 	void splitLinesLongerThan(uint maxWidth);
+	void updateCache() const;
 
 	Common::String _text;
 	uint _length;
 	uint8 _color;
 	uint _spacing;
 	const Font *_font;
+
+	/** Rendering glyphs is relatively expensive and texts are redrawn
+	 *  every frame, so the text is rasterized into this surface once per
+	 *  content change and then only blitted.
+	 */
+	mutable Surface *_cache;
+	mutable bool _cacheDirty;
+	mutable Common::Rect _lastMarkedRect; ///< where the text was last marked dirty
 };
 
 } // End of namespace Draci
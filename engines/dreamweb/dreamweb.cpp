@@ -51,6 +51,9 @@ DreamWebEngine::DreamWebEngine(OSystem *syst, const DreamWebGameDescription *gam
 
 	_vSyncInterrupt = false;
 
+	memset(_screenShadow, 0, sizeof(_screenShadow));
+	_screenShadowValid = false;
+
 	_console = 0;
 	_sound = 0;
 	_speed = 1;
@@ -466,13 +469,62 @@ void DreamWebEngine::setPalette(const uint8 *data, uint start, uint count) {
 }
 
 void DreamWebEngine::blit(const uint8 *src, int pitch, int x, int y, int w, int h) {
+	const int kTileSize = 16;
+
 	if (y + h > (int)kScreenheight)
 		h = kScreenheight - y;
 	if (x + w > (int)kScreenwidth)
 		w = kScreenwidth - x;
 	if (h <= 0 || w <= 0)
 		return;
-	_system->copyRectToScreen(src, pitch, x, y, w, h);
+
+	if (!_screenShadowValid) {
+		// No valid shadow yet (first blit, or the screen was written to
+		// directly), so push everything and take a snapshot
+		_system->copyRectToScreen(src, pitch, x, y, w, h);
+		for (int row = 0; row < h; ++row)
+			memcpy(_screenShadow + (y + row) * kScreenwidth + x, src + row * pitch, w);
+		// Only a full screen blit makes the whole shadow trustworthy
+		_screenShadowValid = (x == 0 && y == 0 && w == (int)kScreenwidth && h == (int)kScreenheight);
+		return;
+	}
+
+	// Compare the region against the shadow in 16x16 tiles and only push
+	// spans of changed tiles to the backend. The game continuously redraws
+	// regions that mostly have not changed, and the backend multiplies
+	// every copied pixel by its scaler.
+	for (int ty = 0; ty < h; ty += kTileSize) {
+		const int th = MIN(kTileSize, h - ty);
+		int spanStart = -1;
+
+		// The extra iteration past the right edge flushes a pending span
+		for (int tx = 0; tx < w + kTileSize; tx += kTileSize) {
+			bool dirty = false;
+
+			if (tx < w) {
+				const int tw = MIN(kTileSize, w - tx);
+				for (int row = 0; row < th && !dirty; ++row)
+					dirty = memcmp(src + (ty + row) * pitch + tx,
+						_screenShadow + (y + ty + row) * kScreenwidth + x + tx, tw) != 0;
+			}
+
+			if (dirty) {
+				if (spanStart < 0)
+					spanStart = tx;
+				continue;
+			}
+
+			if (spanStart >= 0) {
+				const int spanW = MIN(tx, w) - spanStart;
+				const uint8 *spanSrc = src + ty * pitch + spanStart;
+				_system->copyRectToScreen(spanSrc, pitch, x + spanStart, y + ty, spanW, th);
+				for (int row = 0; row < th; ++row)
+					memcpy(_screenShadow + (y + ty + row) * kScreenwidth + x + spanStart,
+						spanSrc + row * pitch, spanW);
+				spanStart = -1;
+			}
+		}
+	}
 }
 
 void DreamWebEngine::printUnderMonitor() {
@@ -498,6 +550,8 @@ void DreamWebEngine::printUnderMonitor() {
 
 void DreamWebEngine::cls() {
 	_system->fillScreen(0);
+	// The screen was cleared behind blit()'s back
+	_screenShadowValid = false;
 }
 
 uint8 DreamWebEngine::modifyChar(uint8 c) const {
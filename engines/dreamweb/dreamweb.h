@@ -104,6 +104,11 @@ private:
 	DreamWebSound *_sound;
 	bool					_vSyncInterrupt;
 
+	// Shadow copy of the game screen contents, used by blit() to skip
+	// pushing unchanged tiles to the backend
+	uint8					_screenShadow[kScreenwidth * kScreenheight];
+	bool					_screenShadowValid;
+
 protected:
 	// Engine APIs
 	virtual Common::Error run();
@@ -152,6 +152,8 @@ void DreamWebEngine::doShake() {
 void DreamWebEngine::setMode() {
 	waitForVSync();
 	initGraphics(kScreenwidth, kScreenheight);
+	// The mode switch gives us a freshly cleared screen
+	_screenShadowValid = false;
 }
 
 void DreamWebEngine::showPCX(const Common::String &suffix) {
@@ -184,6 +186,9 @@ void DreamWebEngine::showPCX(const Common::String &suffix) {
 	for (uint16 y = 0; y < pcxSurface->h; y++)
 		memcpy((byte *)s->getBasePtr(0, y), pcxSurface->getBasePtr(0, y), pcxSurface->w);
 	g_system->unlockScreen();
+
+	// The screen was written to directly, bypassing blit()'s shadow copy
+	_screenShadowValid = false;
 }
 
 void DreamWebEngine::frameOutV(uint8 *dst, const uint8 *src, uint16 pitch, uint16 width, uint16 height, int16 x, int16 y) {
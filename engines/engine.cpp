@@ -264,8 +264,7 @@ void splashScreen() {
 	Common::Event event;
 	while (time0 + 600 > g_system->getMillis()) {
 		g_system->updateScreen();
-		(void)g_system->getEventManager()->pollEvent(event);
-		g_system->delayMillis(10);
+		(void)g_system->getEventManager()->waitEventWithTimeout(event, 10);
 	}
 	g_system->hideOverlay();
 
@@ -423,6 +423,9 @@ void Picture::freePicture() {
 		_data = nullptr;
 	}
 
+	for (int i = 0; i < ARRAYSIZE(_transformedBitmaps); i++)
+		_transformedBitmaps[i].reset();
+
 	_convertedBitmap.reset();
 }
 
@@ -495,6 +498,10 @@ void Picture::init() {
 
 	_bitmap.reset(new Bitmap());
 
+	// Drop any transformed copies of the previous bitmap
+	for (int i = 0; i < ARRAYSIZE(_transformedBitmaps); i++)
+		_transformedBitmaps[i].reset();
+
 	getDibInfo();
 
 	_bitmap->_flags |= 0x1000000;
@@ -537,6 +544,27 @@ const Bitmap *Picture::getPixelData() {
 	return _bitmap.get();
 }
 
+Bitmap *Picture::getTransformedBitmap(bool flipH, bool flipV) {
+	if (!_bitmap)
+		init();
+
+	if (!_bitmap)
+		return nullptr;
+
+	int idx = (flipV ? 2 : 0) | (flipH ? 1 : 0);
+
+	if (!_transformedBitmaps[idx]) {
+		Bitmap *b = new Bitmap(*_bitmap);
+		if (flipH)
+			b->_flipping ^= Graphics::FLIP_H;
+		if (flipV)
+			b->_flipping ^= Graphics::FLIP_V;
+		_transformedBitmaps[idx].reset(b);
+	}
+
+	return _transformedBitmaps[idx].get();
+}
+
 void Picture::draw(int x, int y, int style, int angle) {
 	int x1 = x;
 	int y1 = y;
@@ -571,7 +599,7 @@ void Picture::draw(int x, int y, int style, int angle) {
 	case 1: {
 		//flip
 		const Dims dims = getDimensions();
-		_bitmap->flipVertical()->drawShaded(1, x1, y1 + 30 + dims.y, *pal, _alpha);
+		getTransformedBitmap(false, true)->drawShaded(1, x1, y1 + 30 + dims.y, *pal, _alpha);
 		break;
 	}
 	case 2:
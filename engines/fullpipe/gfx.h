@@ -106,6 +106,14 @@ public:
 	int getPixelAtPos(int x, int y);
 	int getPixelAtPosEx(int x, int y);
 
+	/**
+	 * Returns a cached copy of the picture's bitmap with the given extra
+	 * flipping applied, creating it on first use. The copy shares the
+	 * pixel data with the original bitmap and stays owned by the picture,
+	 * so the draw code no longer allocates a transformed bitmap per frame
+	 */
+	Bitmap *getTransformedBitmap(bool flipH, bool flipV);
+
 	const Bitmap *getConvertedBitmap() const { return _convertedBitmap.get(); }
 	const Palette &getPaletteData() const { return _paletteData; }
 	void setPaletteData(const Palette &pal);
@@ -121,6 +129,8 @@ protected:
 	int _width;
 	int _height;
 	Common::ScopedPtr<Bitmap> _bitmap;
+	/** flipped copies of _bitmap, created on demand by getTransformedBitmap() */
+	Common::ScopedPtr<Bitmap> _transformedBitmaps[4];
 	int _field_54;
 	Common::ScopedPtr<MemoryObject2> _memoryObject2;
 	int _alpha;
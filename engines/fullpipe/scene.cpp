@@ -510,6 +510,10 @@ void Scene::draw() {
 	// Clean previous stuff
 	g_fp->_backgroundSurface.fillRect(Common::Rect(0, 0, 800, 600), 0);
 
+	// Z-sort the scene items once per frame. drawContent() then only
+	// walks the already sorted list for each priority band
+	objectList_sortByPriority(_picObjList, 1);
+
 	drawContent(60000, 0, true);
 
 	objectList_sortByPriority(_staticANIObjectList2);
@@ -666,13 +670,7 @@ void Scene::drawContent(int minPri, int maxPri, bool drawBg) {
 
 	debugC(1, kDebugDrawing, "Scene::drawContent(>%d, <%d, %d)", minPri, maxPri, drawBg);
 
-#if 0
-	if (_picObjList.size() > 2) { // We need to z-sort them
-		objectList_sortByPriority(_picObjList, true);
-	}
-#else
-	objectList_sortByPriority(_picObjList, 1);
-#endif
+	// _picObjList was z-sorted by draw() before the first call for this frame
 
 	if (minPri == -1 && _picObjList.size())
 		minPri = _picObjList.back()->_priority - 1;
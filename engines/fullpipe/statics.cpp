@@ -489,15 +489,10 @@ void Movement::draw(bool flipFlag, int angle) {
 	if (_currDynamicPhase->getPaletteData().size())
 		g_fp->_globalPalette = &_currDynamicPhase->getPaletteData();
 
-	Common::ScopedPtr<Bitmap> bmp;
-	if (_currMovement) {
-		bmp.reset(_currDynamicPhase->getPixelData()->reverseImage());
-	} else {
-		bmp.reset(_currDynamicPhase->getPixelData()->reverseImage(false));
-	}
+	Bitmap *bmp = _currDynamicPhase->getTransformedBitmap(_currMovement != nullptr, false);
 
 	if (flipFlag) {
-		bmp->flipVertical()->drawShaded(1, x, y + 30 + _currDynamicPhase->_rect.bottom, _currDynamicPhase->getPaletteData(), _currDynamicPhase->getAlpha());
+		_currDynamicPhase->getTransformedBitmap(_currMovement != nullptr, true)->drawShaded(1, x, y + 30 + _currDynamicPhase->_rect.bottom, _currDynamicPhase->getPaletteData(), _currDynamicPhase->getAlpha());
 	} else if (angle) {
 		bmp->drawRotated(x, y, angle, _currDynamicPhase->getPaletteData(), _currDynamicPhase->getAlpha());
 	} else {
@@ -512,15 +507,16 @@ void Movement::draw(bool flipFlag, int angle) {
 		}
 
 		if (_currDynamicPhase->getConvertedBitmap()) {
+			Common::ScopedPtr<Bitmap> conv;
 			if (_currMovement) {
 				//vrtSetAlphaBlendMode(g_vrtDrawHandle, 1, LOBYTE(_currDynamicPhase->rect.top));
-				bmp.reset(_currDynamicPhase->getConvertedBitmap()->reverseImage());
-				bmp->putDib(x, y, _currDynamicPhase->getPaletteData(), _currDynamicPhase->getAlpha());
+				conv.reset(_currDynamicPhase->getConvertedBitmap()->reverseImage());
+				conv->putDib(x, y, _currDynamicPhase->getPaletteData(), _currDynamicPhase->getAlpha());
 				//vrtSetAlphaBlendMode(g_vrtDrawHandle, 0, 255);
 			} else {
 				//vrtSetAlphaBlendMode(g_vrtDrawHandle, 1, LOBYTE(_currDynamicPhase->rect.top));
-				bmp.reset(_currDynamicPhase->getConvertedBitmap()->reverseImage(false));
-				bmp->putDib(x, y, _currDynamicPhase->getPaletteData(), _currDynamicPhase->getAlpha());
+				conv.reset(_currDynamicPhase->getConvertedBitmap()->reverseImage(false));
+				conv->putDib(x, y, _currDynamicPhase->getPaletteData(), _currDynamicPhase->getAlpha());
 				//vrtSetAlphaBlendMode(g_vrtDrawHandle, 0, 255);
 			}
 		}
@@ -928,12 +928,13 @@ void GameSys::updateScreen() {
 			intersectRect(rcSrc2, _screenRect, gfxItem->_currFrame._rect)) {
 			updateRect(srcRect);
 			updateRect(rcSrc2);
+		} else {
+			// The sprite was removed, so push the restored background area
+			updateRect(srcRect);
 		}
 		gfxItem->_prevFrame = gfxItem->_currFrame;
 	}
 
-	updateRect(Common::Rect(0, 0, 800, 600));
-
 	debugC(kDebugBasic, "GameSys::updateScreen() OK");
 }
 
@@ -49,36 +49,54 @@ uint32 LzssReadStream::decodeLZSS(Common::ReadStream *in, uint8 lengthmask, uint
 	uint32 outstreampos = 0;
 	uint32 bufpos = 0;
 
-	while (!in->eos()) {
-		byte flagbyte = in->readByte();
+	// Slurp the compressed data into a flat buffer first, so the decode
+	// loop below works with plain pointer arithmetic instead of making a
+	// virtual stream call per input byte.
+	uint32 incap = 65536;
+	uint32 insize = 0;
+	byte *inbuf = (byte *)malloc(incap);
+	for (;;) {
+		insize += in->read(inbuf + insize, incap - insize);
+		if (insize < incap)
+			break;
+		incap *= 2;
+		inbuf = (byte *)realloc(inbuf, incap);
+	}
+
+	uint32 inpos = 0;
+	while (inpos < insize) {
+		byte flagbyte = inbuf[inpos++];
 		for (uint32 i = 1; i <= 8; i++) {
-			if (!in->eos()) {
-				if ((flagbyte & 1) == 0) {
-					uint32 offsetlen = in->readUint16LE();
-					if (offsetlen == 0) {
-						break;
-					}
-					uint32 length = (offsetlen & lengthmask) + COMP_THRESH;
-					uint32 offset = (bufpos - (offsetlen >> lengthbits)) & (N - 1);
-					for (uint32 j = 0; j < length; j++) {
-						byte tempa = histbuff[(offset + j) & (N - 1)];
-						_outLzssBufData[outstreampos++] = tempa;
-						histbuff[bufpos] = tempa;
-						bufpos = (bufpos + 1) & (N - 1);
-					}
-				} else {
-					byte tempa = in->readByte();
-					if (in->eos()) {
-						break;
-					}
+			if (inpos >= insize)
+				break;
+
+			if ((flagbyte & 1) == 0) {
+				if (inpos + 2 > insize)
+					break;
+				uint32 offsetlen = READ_LE_UINT16(inbuf + inpos);
+				inpos += 2;
+				if (offsetlen == 0) {
+					break;
+				}
+				uint32 length = (offsetlen & lengthmask) + COMP_THRESH;
+				uint32 offset = (bufpos - (offsetlen >> lengthbits)) & (N - 1);
+				for (uint32 j = 0; j < length; j++) {
+					byte tempa = histbuff[(offset + j) & (N - 1)];
 					_outLzssBufData[outstreampos++] = tempa;
 					histbuff[bufpos] = tempa;
 					bufpos = (bufpos + 1) & (N - 1);
 				}
-				flagbyte = flagbyte >> 1;
+			} else {
+				byte tempa = inbuf[inpos++];
+				_outLzssBufData[outstreampos++] = tempa;
+				histbuff[bufpos] = tempa;
+				bufpos = (bufpos + 1) & (N - 1);
 			}
+			flagbyte = flagbyte >> 1;
 		}
 	}
+
+	free(inbuf);
 	delete[] histbuff;
 	return outstreampos;
 }
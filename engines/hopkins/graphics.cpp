@@ -1342,6 +1342,38 @@ int GraphicsManager::zoomOut(int val, int percentage) {
 }
 
 // Display 'Perfect?'
+// Draw a single sprite row, copying runs of non-transparent pixels in one
+// go and skipping transparent (zero) runs word-wise instead of testing
+// every pixel individually
+static void drawSpriteRow(byte *destP, const byte *srcP, int width) {
+	const byte *srcEndP = srcP + width;
+
+	while (srcP < srcEndP) {
+		const byte *runStartP = srcP;
+		while (srcP < srcEndP && *srcP)
+			++srcP;
+		if (srcP != runStartP) {
+			memcpy(destP, runStartP, srcP - runStartP);
+			destP += srcP - runStartP;
+		}
+
+		while (srcP < srcEndP && *srcP == 0 && ((uintptr)srcP & 3) != 0) {
+			++srcP;
+			++destP;
+		}
+		if (((uintptr)srcP & 3) == 0) {
+			while (srcP + 4 <= srcEndP && *(const uint32 *)srcP == 0) {
+				srcP += 4;
+				destP += 4;
+			}
+		}
+		while (srcP < srcEndP && *srcP == 0) {
+			++srcP;
+			++destP;
+		}
+	}
+}
+
 void GraphicsManager::drawCompressedSprite(byte *surface, const byte *srcData, int xp300, int yp300, int frameIndex, int zoom1, int zoom2, bool flipFl) {
 	const byte *spriteStartP = srcData + 3;
 	for (int i = frameIndex; i; --i)
@@ -1651,16 +1683,9 @@ void GraphicsManager::drawCompressedSprite(byte *surface, const byte *srcData, i
 			int yCtr1;
 			do {
 				yCtr1 = spriteHeight1;
-				byte *dest1CopyP = dest1P;
-				const byte *spritePixelsCopyP = spritePixelsP;
-				for (int xCtr1 = spriteWidth; xCtr1; xCtr1--) {
-					if (*spritePixelsP)
-						*dest1P = *spritePixelsP;
-					++dest1P;
-					++spritePixelsP;
-				}
-				spritePixelsP = _specialWidth + spritePixelsCopyP;
-				dest1P = _lineNbr2 + dest1CopyP;
+				drawSpriteRow(dest1P, spritePixelsP, spriteWidth);
+				spritePixelsP += _specialWidth;
+				dest1P += _lineNbr2;
 				spriteHeight1 = yCtr1 - 1;
 			} while (yCtr1 != 1);
 		}
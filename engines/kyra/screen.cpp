@@ -2271,6 +2271,49 @@ uint Screen::decodeFrame4(const uint8 *src, uint8 *dst, uint32 dstSize) {
 	return dst - dstOrig;
 }
 
+// Helpers for the WSA frame delta decoders below: apply a whole fill or
+// copy run to the destination in word-sized blocks instead of byte by byte.
+
+template<bool noXor>
+static uint8 *applyFrameDeltaFill(uint8 *dst, uint8 code, uint32 len) {
+	if (noXor) {
+		memset(dst, code, len);
+		return dst + len;
+	}
+
+	for (; len && ((uintptr)dst & 3); --len)
+		*dst++ ^= code;
+
+	const uint32 pattern = code * 0x01010101u;
+	for (; len >= 4; len -= 4, dst += 4)
+		*(uint32 *)dst ^= pattern;
+
+	for (; len; --len)
+		*dst++ ^= code;
+
+	return dst;
+}
+
+template<bool noXor>
+static uint8 *applyFrameDeltaCopy(uint8 *dst, const uint8 *&src, uint32 len) {
+	if (noXor) {
+		memcpy(dst, src, len);
+		src += len;
+		return dst + len;
+	}
+
+	for (; len && ((uintptr)dst & 3); --len)
+		*dst++ ^= *src++;
+
+	for (; len >= 4; len -= 4, dst += 4, src += 4)
+		*(uint32 *)dst ^= READ_UINT32(src);
+
+	for (; len; --len)
+		*dst++ ^= *src++;
+
+	return dst;
+}
+
 void Screen::decodeFrameDelta(uint8 *dst, const uint8 *src, bool noXor) {
 	if (noXor)
 		wrapped_decodeFrameDelta<true>(dst, src);
@@ -2285,12 +2328,7 @@ void Screen::wrapped_decodeFrameDelta(uint8 *dst, const uint8 *src) {
 		if (code == 0) {
 			uint8 len = *src++;
 			code = *src++;
-			while (len--) {
-				if (noXor)
-					*dst++ = code;
-				else
-					*dst++ ^= code;
-			}
+			dst = applyFrameDeltaFill<noXor>(dst, code, len);
 		} else if (code & 0x80) {
 			code -= 0x80;
 			if (code != 0) {
@@ -2304,31 +2342,16 @@ void Screen::wrapped_decodeFrameDelta(uint8 *dst, const uint8 *src) {
 					if (subcode & 0x4000) {
 						uint16 len = subcode - 0x4000;
 						code = *src++;
-						while (len--) {
-							if (noXor)
-								*dst++ = code;
-							else
-								*dst++ ^= code;
-						}
+						dst = applyFrameDeltaFill<noXor>(dst, code, len);
 					} else {
-						while (subcode--) {
-							if (noXor)
-								*dst++ = *src++;
-							else
-								*dst++ ^= *src++;
-						}
+						dst = applyFrameDeltaCopy<noXor>(dst, src, subcode);
 					}
 				} else {
 					dst += subcode;
 				}
 			}
 		} else {
-			while (code--) {
-				if (noXor)
-					*dst++ = *src++;
-				else
-					*dst++ ^= *src++;
-			}
+			dst = applyFrameDeltaCopy<noXor>(dst, src, code);
 		}
 	}
 }
@@ -2430,6 +2453,41 @@ void Screen::convertAmigaMsc(uint8 *data) {
 	}
 }
 
+// Page variants of the run helpers above, splitting each run at the line
+// boundaries so it can still be applied in blocks.
+
+template<bool noXor>
+static void applyFrameDeltaPageFill(uint8 *&dst, uint8 *&dstNext, int &count, const int pitch, uint8 code, uint32 len) {
+	while (len) {
+		uint32 chunk = MIN<uint32>(len, (uint32)(pitch - count));
+		dst = applyFrameDeltaFill<noXor>(dst, code, chunk);
+		len -= chunk;
+		count += chunk;
+
+		if (count == pitch) {
+			count = 0;
+			dstNext += Screen::SCREEN_W;
+			dst = dstNext;
+		}
+	}
+}
+
+template<bool noXor>
+static void applyFrameDeltaPageCopy(uint8 *&dst, uint8 *&dstNext, int &count, const int pitch, const uint8 *&src, uint32 len) {
+	while (len) {
+		uint32 chunk = MIN<uint32>(len, (uint32)(pitch - count));
+		dst = applyFrameDeltaCopy<noXor>(dst, src, chunk);
+		len -= chunk;
+		count += chunk;
+
+		if (count == pitch) {
+			count = 0;
+			dstNext += Screen::SCREEN_W;
+			dst = dstNext;
+		}
+	}
+}
+
 template<bool noXor>
 void Screen::wrapped_decodeFrameDeltaPage(uint8 *dst, const uint8 *src, int pitch) {
 	int count = 0;
@@ -2439,18 +2497,7 @@ void Screen::wrapped_decodeFrameDeltaPage(uint8 *dst, const uint8 *src, int pitc
 		if (code == 0) {
 			uint8 len = *src++;
 			code = *src++;
-			while (len--) {
-				if (noXor)
-					*dst++ = code;
-				else
-					*dst++ ^= code;
-
-				if (++count == pitch) {
-					count = 0;
-					dstNext += SCREEN_W;
-					dst = dstNext;
-				}
-			}
+			applyFrameDeltaPageFill<noXor>(dst, dstNext, count, pitch, code, len);
 		} else if (code & 0x80) {
 			code -= 0x80;
 			if (code != 0) {
@@ -2471,31 +2518,9 @@ void Screen::wrapped_decodeFrameDeltaPage(uint8 *dst, const uint8 *src, int pitc
 					if (subcode & 0x4000) {
 						uint16 len = subcode - 0x4000;
 						code = *src++;
-						while (len--) {
-							if (noXor)
-								*dst++ = code;
-							else
-								*dst++ ^= code;
-
-							if (++count == pitch) {
-								count = 0;
-								dstNext += SCREEN_W;
-								dst = dstNext;
-							}
-						}
+						applyFrameDeltaPageFill<noXor>(dst, dstNext, count, pitch, code, len);
 					} else {
-						while (subcode--) {
-							if (noXor)
-								*dst++ = *src++;
-							else
-								*dst++ ^= *src++;
-
-							if (++count == pitch) {
-								count = 0;
-								dstNext += SCREEN_W;
-								dst = dstNext;
-							}
-						}
+						applyFrameDeltaPageCopy<noXor>(dst, dstNext, count, pitch, src, subcode);
 					}
 				} else {
 					dst += subcode;
@@ -2510,18 +2535,7 @@ void Screen::wrapped_decodeFrameDeltaPage(uint8 *dst, const uint8 *src, int pitc
 				}
 			}
 		} else {
-			while (code--) {
-				if (noXor)
-					*dst++ = *src++;
-				else
-					*dst++ ^= *src++;
-
-				if (++count == pitch) {
-					count = 0;
-					dstNext += SCREEN_W;
-					dst = dstNext;
-				}
-			}
+			applyFrameDeltaPageCopy<noXor>(dst, dstNext, count, pitch, src, code);
 		}
 	}
 }
@@ -277,7 +277,7 @@ void Anim::stopDiffEnd() {
 	}
 }
 
-void Anim::readDiff(Common::File *diffFile, bool playOnce, bool onlyDiffData) {
+void Anim::readDiff(Common::SeekableReadStream *diffFile, bool playOnce, bool onlyDiffData) {
 	_playOnce = playOnce;
 	_delayMicros = 0;
 	_frameNum = 0;
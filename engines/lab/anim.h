@@ -57,7 +57,7 @@ private:
 	bool _donePal;
 	uint16 _frameNum;
 	bool _playOnce;
-	Common::File *_diffFile;
+	Common::SeekableReadStream *_diffFile;
 	uint32 _diffFileStart;
 	uint32 _size;
 	bool _stopPlayingEnd;
@@ -80,7 +80,7 @@ public:
 	 * Reads in a DIFF file.
 	 */
 	void setOutputBuffer(byte *memoryBuffer); // nullptr for output to screen
-	void readDiff(Common::File *diffFile, bool playOnce, bool onlyDiffData);
+	void readDiff(Common::SeekableReadStream *diffFile, bool playOnce, bool onlyDiffData);
 	void diffNextFrame(bool onlyDiffData = false);
 
 	/**
@@ -29,6 +29,7 @@
  */
 
 #include "common/file.h"
+#include "common/memstream.h"
 #include "graphics/palette.h"
 
 #include "lab/lab.h"
@@ -51,6 +52,7 @@ DisplayMan::DisplayMan(LabEngine *vm) : _vm(vm) {
 
 	_screenBytesPerPage = 0;
 	_curBitmap = nullptr;
+	_preloadedPictsSize = 0;
 	_displayBuffer = nullptr;
 	_currentDisplayBuffer = nullptr;
 	_fadePalette = nullptr;
@@ -64,12 +66,81 @@ DisplayMan::DisplayMan(LabEngine *vm) : _vm(vm) {
 
 DisplayMan::~DisplayMan() {
 	freePict();
+	freePreloadedPicts();
 	delete[] _displayBuffer;
 }
 
 void DisplayMan::loadPict(const Common::String filename) {
 	freePict();
-	_curBitmap = _vm->_resource->openDataFile(filename, MKTAG('D', 'I', 'F', 'F'));
+
+	_curBitmap = takePreloadedPict(filename);
+	if (!_curBitmap)
+		_curBitmap = _vm->_resource->openDataFile(filename, MKTAG('D', 'I', 'F', 'F'));
+}
+
+void DisplayMan::preloadPict(const Common::String filename) {
+	// Skip files that have already been preloaded
+	for (Common::List<PreloadedPict>::iterator it = _preloadedPicts.begin(); it != _preloadedPicts.end(); ++it) {
+		if (it->_filename == filename)
+			return;
+	}
+
+	Common::File *dataFile = _vm->_resource->openDataFile(filename, MKTAG('D', 'I', 'F', 'F'));
+	if (!dataFile)
+		return;
+
+	PreloadedPict pict;
+	pict._filename = filename;
+	// The header tag has already been consumed, just like after loadPict()
+	pict._size = (uint32)(dataFile->size() - dataFile->pos());
+
+	if (pict._size > _maxPreloadedPictsSize) {
+		delete dataFile;
+		return;
+	}
+
+	// NOTE: The data needs to be allocated with malloc(), as it ends up
+	// being freed with free() by the memory stream handed out
+	pict._data = (byte *)malloc(pict._size);
+	if (!pict._data || (dataFile->read(pict._data, pict._size) != pict._size)) {
+		free(pict._data);
+		delete dataFile;
+		return;
+	}
+
+	delete dataFile;
+
+	// Make room within the byte budget, dropping the oldest entries first
+	while (!_preloadedPicts.empty() && (_preloadedPictsSize + pict._size > _maxPreloadedPictsSize)) {
+		free(_preloadedPicts.front()._data);
+		_preloadedPictsSize -= _preloadedPicts.front()._size;
+		_preloadedPicts.pop_front();
+	}
+
+	_preloadedPicts.push_back(pict);
+	_preloadedPictsSize += pict._size;
+}
+
+Common::SeekableReadStream *DisplayMan::takePreloadedPict(const Common::String &filename) {
+	for (Common::List<PreloadedPict>::iterator it = _preloadedPicts.begin(); it != _preloadedPicts.end(); ++it) {
+		if (it->_filename == filename) {
+			Common::SeekableReadStream *stream = new Common::MemoryReadStream(it->_data, it->_size, DisposeAfterUse::YES);
+			_preloadedPictsSize -= it->_size;
+			_preloadedPicts.erase(it);
+
+			return stream;
+		}
+	}
+
+	return nullptr;
+}
+
+void DisplayMan::freePreloadedPicts() {
+	for (Common::List<PreloadedPict>::iterator it = _preloadedPicts.begin(); it != _preloadedPicts.end(); ++it)
+		free(it->_data);
+
+	_preloadedPicts.clear();
+	_preloadedPictsSize = 0;
 }
 
 void DisplayMan::loadBackPict(const Common::String fileName, uint16 *highPal) {
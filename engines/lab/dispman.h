@@ -31,6 +31,12 @@
 #ifndef LAB_DISPMAN_H
 #define LAB_DISPMAN_H
 
+#include "common/list.h"
+
+namespace Common {
+class SeekableReadStream;
+}
+
 namespace Lab {
 
 class LabEngine;
@@ -125,10 +131,33 @@ private:
 	uint16 textLength(TextFont *font, const Common::String text);
 
 	bool _actionMessageShown;
-	Common::File *_curBitmap;
+	Common::SeekableReadStream *_curBitmap;
 	byte _curVgaPal[256 * 3];
 	byte *_currentDisplayBuffer;
 
+	/**
+	 * Picture files read ahead for the views next to the one on screen.
+	 * Entries are handed out (and removed) by loadPict() when their view
+	 * is actually shown, so a preloaded turn skips the disk entirely.
+	 */
+	struct PreloadedPict {
+		Common::String _filename;
+		byte *_data;
+		uint32 _size;
+	};
+
+	/** Byte budget for the preloaded picture files */
+	static const uint32 _maxPreloadedPictsSize = 1024 * 1024;
+
+	Common::List<PreloadedPict> _preloadedPicts;
+	uint32 _preloadedPictsSize;
+
+	/**
+	 * Hands over the preloaded data of a picture file as a stream, or
+	 * nullptr if the file has not been preloaded.
+	 */
+	Common::SeekableReadStream *takePreloadedPict(const Common::String &filename);
+
 public:
 	DisplayMan(LabEngine *lab);
 	virtual ~DisplayMan();
@@ -142,6 +171,14 @@ public:
 	void readPict(const Common::String filename, bool playOnce = true, bool onlyDiffData = false, byte *memoryBuffer = nullptr);
 	void freePict();
 
+	/**
+	 * Reads a picture file into the preload cache, so that a later
+	 * loadPict() of the same file does not have to go to disk. The cache
+	 * is kept within a small byte budget by dropping the oldest entries.
+	 */
+	void preloadPict(const Common::String filename);
+	void freePreloadedPicts();
+
 	/**
 	 * Does a certain number of pre-programmed wipes.
 	 */
@@ -511,6 +511,12 @@ void LabEngine::mainGameLoop() {
 			updateEvents();
 			_anim->diffNextFrame();
 
+			// Use the idle time to read ahead the pictures of the views
+			// the player can turn to, so the turn itself doesn't have to
+			// wait for the disk
+			if (!_anim->isPlaying())
+				preloadAdjacentViews();
+
 			if (_followingCrumbs) {
 				MainButton code = followCrumbs();
 
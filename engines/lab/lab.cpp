@@ -74,6 +74,8 @@ LabEngine::LabEngine(OSystem *syst, const ADGameDescription *gameDesc)
 	_numInv = 0;
 	_manyRooms = 0;
 	_direction = 0;
+	_preloadRoomNum = -1;
+	_preloadDirection = 0;
 	_highestCondition = 0;
 	_crumbTimestamp = 0;
 	_maxRooms = 0;
@@ -138,6 +138,10 @@ private:
 
 	uint16 _direction;
 	uint16 _highPalette[20];
+
+	// View the adjacent pictures were last preloaded for
+	int _preloadRoomNum;
+	uint16 _preloadDirection;
 	uint16 _journalPage;
 	uint16 _maxRooms;
 	uint16 _monitorPage;
@@ -443,6 +447,12 @@ private:
 	 */
 	void perFlipButton(uint16 buttonId);
 
+	/**
+	 * Preloads the pictures of the views the player can turn to, so that
+	 * the turn itself does not have to read them from disk.
+	 */
+	void preloadAdjacentViews();
+
 	/**
 	 * process a arrow button movement.
 	 */
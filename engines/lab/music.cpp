@@ -111,7 +111,7 @@ void Music::loadSoundEffect(const Common::String filename, bool loop, bool waitT
 	}
 }
 
-void Music::playSoundEffect(uint16 sampleSpeed, uint32 length, bool loop, Common::File *dataFile) {
+void Music::playSoundEffect(uint16 sampleSpeed, uint32 length, bool loop, Common::SeekableReadStream *dataFile) {
 	stopSoundEffect();
 
 	// NOTE: We need to use malloc(), cause this will be freed with free()
@@ -35,6 +35,7 @@
 
 namespace Common {
 class File;
+class SeekableReadStream;
 }
 
 namespace Lab {
@@ -81,7 +82,7 @@ public:
 	void freeMusic();
 
 	bool isSoundEffectActive() const;
-	void playSoundEffect(uint16 sampleSpeed, uint32 length, bool loop, Common::File *dataFile);
+	void playSoundEffect(uint16 sampleSpeed, uint32 length, bool loop, Common::SeekableReadStream *dataFile);
 
 	/**
 	 * Reads in a sound effect file.  Ignores any graphics.
@@ -117,6 +117,35 @@ Common::String LabEngine::getPictName(bool useClose) {
 	return viewPtr->_graphicName;
 }
 
+void LabEngine::preloadAdjacentViews() {
+	if (!_mainDisplay || _closeDataPtr || (_roomNum < 0))
+		return;
+
+	// Only do the work once per view; this is called from the idle loop
+	if ((_roomNum == _preloadRoomNum) && (_direction == _preloadDirection))
+		return;
+
+	_preloadRoomNum = _roomNum;
+	_preloadDirection = _direction;
+
+	for (uint16 direction = kDirectionNorth; direction <= kDirectionWest; direction++) {
+		if (direction == _direction)
+			continue;
+
+		// Unlike getViewData, don't error out if no view matches: not
+		// being able to preload a view is not fatal
+		ViewDataList &views = _rooms[_roomNum]._view[direction];
+
+		for (ViewDataList::iterator view = views.begin(); view != views.end(); ++view) {
+			if (checkConditions(view->_condition)) {
+				if (!view->_graphicName.empty())
+					_graphics->preloadPict(view->_graphicName);
+				break;
+			}
+		}
+	}
+}
+
 void LabEngine::drawDirection(const CloseData *closePtr) {
 	if (closePtr && !closePtr->_message.empty()) {
 		_graphics->drawMessage(closePtr->_message, false);
@@ -111,7 +111,7 @@ Common::Point Utils::vgaUnscale(Common::Point pos) {
 }
 
 template<typename T>
-void Utils::unDiff(T *dest, Common::File *sourceFile) {
+void Utils::unDiff(T *dest, Common::SeekableReadStream *sourceFile) {
 	byte bytesPerWord = sizeof(T);
 
 	while (1) {
@@ -142,7 +142,7 @@ void Utils::unDiff(T *dest, Common::File *sourceFile) {
 }
 
 template<typename T>
-void Utils::verticalUnDiff(T *dest, Common::File *sourceFile, uint16 bytesPerRow) {
+void Utils::verticalUnDiff(T *dest, Common::SeekableReadStream *sourceFile, uint16 bytesPerRow) {
 	uint16 counter = 0;
 	byte bytesPerWord = sizeof(T);
 	uint16 wordsPerRow = bytesPerRow / bytesPerWord;
@@ -177,7 +177,7 @@ void Utils::verticalUnDiff(T *dest, Common::File *sourceFile, uint16 bytesPerRow
 	}
 }
 
-void Utils::runLengthDecode(byte *dest, Common::File *sourceFile) {
+void Utils::runLengthDecode(byte *dest, Common::SeekableReadStream *sourceFile) {
 	int8 num;
 	int16 count;
 
@@ -202,7 +202,7 @@ void Utils::runLengthDecode(byte *dest, Common::File *sourceFile) {
 	}
 }
 
-void Utils::verticalRunLengthDecode(byte *dest, Common::File *sourceFile, uint16 bytesPerRow) {
+void Utils::verticalRunLengthDecode(byte *dest, Common::SeekableReadStream *sourceFile, uint16 bytesPerRow) {
 	int16 count;
 	byte *top = dest;
 
@@ -235,7 +235,7 @@ void Utils::verticalRunLengthDecode(byte *dest, Common::File *sourceFile, uint16
 	}
 }
 
-void Utils::unDiff(byte *newBuf, byte *oldBuf, Common::File *sourceFile, uint16 bytesPerRow, bool isVertical) {
+void Utils::unDiff(byte *newBuf, byte *oldBuf, Common::SeekableReadStream *sourceFile, uint16 bytesPerRow, bool isVertical) {
 	sourceFile->skip(1);
 	byte bufType = sourceFile->readByte();
 
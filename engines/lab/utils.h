@@ -42,14 +42,14 @@ private:
 	 * Undiffs a piece of memory based on the header size.
 	 */
 	template<typename T>
-	void unDiff(T *dest, Common::File *sourceFile);
+	void unDiff(T *dest, Common::SeekableReadStream *sourceFile);
 
 	/**
 	 * Undiffs a piece of memory when header size is a byte, and copy/skip size
 	 * is a byte or a word or a double word.
 	 */
 	template<typename T>
-	void verticalUnDiff(T *dest, Common::File *sourceFile, uint16 bytesPerRow);
+	void verticalUnDiff(T *dest, Common::SeekableReadStream *sourceFile, uint16 bytesPerRow);
 
 public:
 	Utils(LabEngine *vm);
@@ -92,9 +92,9 @@ public:
 	/**
 	 * Does the undiffing between the bitmaps.
 	 */
-	void unDiff(byte *newBuf, byte *oldBuf, Common::File *sourceFile, uint16 bytesPerRow, bool isVertical);
-	void runLengthDecode(byte *dest, Common::File *sourceFile);
-	void verticalRunLengthDecode(byte *dest, Common::File *sourceFile, uint16 bytesPerRow);
+	void unDiff(byte *newBuf, byte *oldBuf, Common::SeekableReadStream *sourceFile, uint16 bytesPerRow, bool isVertical);
+	void runLengthDecode(byte *dest, Common::SeekableReadStream *sourceFile);
+	void verticalRunLengthDecode(byte *dest, Common::SeekableReadStream *sourceFile, uint16 bytesPerRow);
 	void setBytesPerRow(int num);
 	uint16 getRandom(uint16 max);
 };
@@ -31,6 +31,7 @@
 
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/memstream.h"
 
 namespace LastExpress {
 
@@ -40,7 +41,7 @@ const char *archiveCD1Path = "cd1.hpf";
 const char *archiveCD2Path = "cd2.hpf";
 const char *archiveCD3Path = "cd3.hpf";
 
-ResourceManager::ResourceManager(bool isDemo) : _isDemo(isDemo) {
+ResourceManager::ResourceManager(bool isDemo) : _isDemo(isDemo), _fileCacheSize(0) {
 }
 
 ResourceManager::~ResourceManager() {
@@ -108,6 +109,13 @@ void ResourceManager::reset() {
 		SAFE_DELETE(*it);
 
 	_archives.clear();
+
+	// Drop the cached file data, as it may belong to the unloaded archives
+	for (Common::List<FileCacheEntry>::iterator it = _fileCache.begin(); it != _fileCache.end(); ++it)
+		free(it->data);
+
+	_fileCache.clear();
+	_fileCacheSize = 0;
 }
 
 bool ResourceManager::loadArchive(const Common::String &name) {
@@ -128,7 +136,7 @@ bool ResourceManager::loadArchive(const Common::String &name) {
 
 // Get a stream to file in the archive
 //  - same as createReadStreamForMember except it checks if the file exists and will assert / output a debug message if not
-Common::SeekableReadStream *ResourceManager::getFileStream(const Common::String &name) const {
+Common::SeekableReadStream *ResourceManager::getFileStream(const Common::String &name) {
 
 	// Check if the file exits in the archive
 	if (!hasFile(name)) {
@@ -138,9 +146,82 @@ Common::SeekableReadStream *ResourceManager::getFileStream(const Common::String
 
 	debugC(2, kLastExpressDebugResource, "Opening file: %s", name.c_str());
 
+	if (isCacheable(name))
+		return getCachedFileStream(name);
+
 	return createReadStreamForMember(name);
 }
 
+bool ResourceManager::isCacheable(const Common::String &name) {
+	Common::String filename(name);
+	filename.toLowercase();
+
+	// Entity draw sequences are small and re-requested over and over while
+	// the real-time logic runs; everything else (sounds, backgrounds,
+	// animations) is either streamed during playback or loaded once per scene
+	return filename.hasSuffix(".seq");
+}
+
+Common::SeekableReadStream *ResourceManager::getCachedFileStream(const Common::String &name) {
+	// Look for an already cached copy, moving it to the front of the list.
+	// Callers take ownership of the streams we hand out (and may keep them
+	// for as long as the sequence is on screen), so they get their own copy
+	// of the data and eviction can never pull it out from under them
+	for (Common::List<FileCacheEntry>::iterator it = _fileCache.begin(); it != _fileCache.end(); ++it) {
+		if (it->name.equalsIgnoreCase(name)) {
+			FileCacheEntry entry = *it;
+			_fileCache.erase(it);
+			_fileCache.push_front(entry);
+
+			byte *data = (byte *)malloc(entry.size);
+			assert(data);
+			memcpy(data, entry.data, entry.size);
+
+			return new Common::MemoryReadStream(data, entry.size, DisposeAfterUse::YES);
+		}
+	}
+
+	Common::SeekableReadStream *stream = createReadStreamForMember(name);
+	if (!stream)
+		return NULL;
+
+	// Don't let a single large file flush the whole cache
+	uint32 size = (uint32)stream->size();
+	if (size > _fileCacheMaxSize / 4)
+		return stream;
+
+	FileCacheEntry entry;
+	entry.name = name;
+	entry.size = size;
+	entry.data = (byte *)malloc(size);
+
+	if (!entry.data || stream->read(entry.data, size) != size) {
+		// Could not cache the file; fall back to reading from the archive
+		free(entry.data);
+		delete stream;
+
+		return createReadStreamForMember(name);
+	}
+
+	delete stream;
+
+	_fileCache.push_front(entry);
+	_fileCacheSize += size;
+
+	// Evict the least recently used files
+	while (_fileCacheSize > _fileCacheMaxSize && _fileCache.size() > 1) {
+		free(_fileCache.back().data);
+		_fileCacheSize -= _fileCache.back().size;
+		_fileCache.pop_back();
+	}
+
+	byte *data = (byte *)malloc(size);
+	assert(data);
+	memcpy(data, entry.data, size);
+
+	return new Common::MemoryReadStream(data, size, DisposeAfterUse::YES);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Archive functions
 //////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 #include "lastexpress/shared.h"
 
 #include "common/array.h"
+#include "common/list.h"
 
 namespace LastExpress {
 
@@ -42,7 +43,7 @@ public:
 	// Loading
 	bool loadArchive(ArchiveIndex type);
 	static bool isArchivePresent(ArchiveIndex type);
-	Common::SeekableReadStream *getFileStream(const Common::String &name) const;
+	Common::SeekableReadStream *getFileStream(const Common::String &name);
 
 	// Archive functions
 	bool hasFile(const Common::String &name) const;
@@ -56,13 +57,30 @@ public:
 	Font *loadFont() const;
 
 private:
+	// Raw file data kept in memory for files that gameplay re-requests
+	// constantly (entity draw sequences), so that loading them during the
+	// real-time game ticks does not hit the archive on disk every time
+	struct FileCacheEntry {
+		Common::String name;
+		byte *data;
+		uint32 size;
+	};
+
+	static const uint32 _fileCacheMaxSize = 2 * 1024 * 1024;
+
 	bool _isDemo;
 
 	bool loadArchive(const Common::String &name);
 	void reset();
 
+	static bool isCacheable(const Common::String &name);
+	Common::SeekableReadStream *getCachedFileStream(const Common::String &name);
+
 	Common::Array<HPFArchive *> _archives;
 
+	Common::List<FileCacheEntry> _fileCache;    ///< most recently used file first
+	uint32 _fileCacheSize;
+
 	friend class Debugger;
 };
 
@@ -71,6 +71,7 @@ Hotspot::Hotspot(HotspotData *res): _pathFinder(this) {
 	_frameCtr = res->tickTimeout;
 	_tempDest.counter = 0;
 	_colorOffset = isEGA ? 0 : res->colorOffset;
+	_frameColorOffset = _colorOffset;
 
 	_override = resources.getHotspotOverride(res->hotspotId);
 	setAnimation(_data->animRecordId);
@@ -101,6 +102,7 @@ Hotspot::Hotspot(Hotspot *character, uint16 objType): _pathFinder(this) {
 	_hotspotId = 0xffff;
 	_override = NULL;
 	_colorOffset = 0;
+	_frameColorOffset = 0;
 	_destHotspotId = character->hotspotId();
 	_blockedOffset = 0;
 	_exitCtr = 0;
@@ -172,6 +174,7 @@ Hotspot::Hotspot(): _pathFinder(NULL) {
 	_hotspotId = 0xffff;
 	_override = NULL;
 	_colorOffset = 0;
+	_frameColorOffset = 0;
 	_destHotspotId = 0;
 	_blockedOffset = 0;
 	_exitCtr = 0;
@@ -253,6 +256,18 @@ void Hotspot::setAnimation(HotspotAnimData *newRecord) {
 	int16 xStart;
 	int animIndex = res.getAnimationIndex(newRecord);
 
+	// If the already decoded frame set matches the new animation record, then
+	// reuse it rather than fetching and decoding the animation all over again
+	if ((_frames != NULL) && (_anim != NULL) && (newRecord != NULL) &&
+			!_frameStartsUsed && (_anim->animId == newRecord->animId) &&
+			(_frameColorOffset == _colorOffset) &&
+			(_frames->width() == _width * _numFrames) &&
+			(_frames->height() == _height)) {
+		_anim = newRecord;
+		_frameNumber = 0;
+		return;
+	}
+
 	if (_frames) {
 		delete _frames;
 		_frames = NULL;
@@ -313,6 +328,16 @@ void Hotspot::setAnimation(HotspotAnimData *newRecord) {
 	tempWidth = _width;
 	tempHeight = _height;
 
+	// Build a lookup table mapping each source byte (two 4-bit pixels) to its
+	// pair of remapped output bytes, so the color offset is applied once per
+	// possible value here rather than once per pixel of every frame
+	byte pairLut[256][2];
+	for (int lutCtr = 0; lutCtr < 256; ++lutCtr) {
+		pairLut[lutCtr][0] = _colorOffset + (lutCtr >> 4);
+		pairLut[lutCtr][1] = _colorOffset + (lutCtr & 0xf);
+	}
+	_frameColorOffset = _colorOffset;
+
 	for (uint16 frameNumCtr = 0; frameNumCtr < _numFrames; ++frameNumCtr, ++headerEntry) {
 
 		if ((newRecord->flags & PIXELFLAG_HAS_TABLE) != 0) {
@@ -356,9 +381,9 @@ void Hotspot::setAnimation(HotspotAnimData *newRecord) {
 			pDest = mDest.data() + yPos * _frames->width() + xStart;
 
 			for (uint16 xPos = 0; xPos < tempWidth / 2; ++xPos) {
-				*pDest++ = _colorOffset + (*pSrc >> 4);
-				*pDest++ = _colorOffset + (*pSrc & 0xf);
-				++pSrc;
+				const byte *pair = pairLut[*pSrc++];
+				*pDest++ = pair[0];
+				*pDest++ = pair[1];
 			}
 		}
 
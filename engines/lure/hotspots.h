@@ -201,6 +201,7 @@ private:
 	uint8 _layer;
 	uint16 _hotspotScriptOffset;
 	uint8 _colorOffset;
+	uint8 _frameColorOffset;
 	bool _persistant;
 	HotspotOverrideData *_override;
 	bool _skipFlag;
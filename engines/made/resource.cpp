@@ -382,6 +382,8 @@ void GenericResource::load(byte *source, int size) {
 ResourceReader::ResourceReader() {
 	_isV1 = false;
 	_cacheDataSize = 0;
+	_soundCacheDataSize = 0;
+	_useCounter = 0;
 
 	_fd = _fdMusic = _fdPics = _fdSounds = nullptr;
 	_cacheCount = 0;
@@ -551,20 +553,29 @@ ResourceSlot *ResourceReader::getResourceSlot(uint32 resType, uint index) {
 }
 
 Resource *ResourceReader::getResourceFromCache(ResourceSlot *slot) {
-	if (slot->res)
+	if (slot->res) {
 		slot->refCount++;
+		slot->lastUse = ++_useCounter;
+	}
 	return slot->res;
 }
 
-void ResourceReader::addResourceToCache(ResourceSlot *slot, Resource *res) {
-	_cacheDataSize += slot->size;
+void ResourceReader::addResourceToCache(ResourceSlot *slot, Resource *res, uint32 resType) {
+	bool soundTier = (resType == kResSNDS);
 
-	if (_cacheDataSize >= kMaxResourceCacheSize) {
-		purgeCache();
+	if (soundTier) {
+		_soundCacheDataSize += slot->size;
+		if (_soundCacheDataSize >= kMaxSoundCacheSize)
+			purgeCache(true);
+	} else {
+		_cacheDataSize += slot->size;
+		if (_cacheDataSize >= kMaxResourceCacheSize)
+			purgeCache(false);
 	}
 
 	slot->res = res;
 	slot->refCount = 1;
+	slot->lastUse = ++_useCounter;
 	_cacheCount++;
 }
 
@@ -573,20 +584,37 @@ void ResourceReader::tossResourceFromCache(ResourceSlot *slot) {
 		slot->refCount--;
 }
 
-void ResourceReader::purgeCache() {
+void ResourceReader::purgeCache(bool soundTier) {
 	debug(2, "ResourceReader::purgeCache()");
-	for (ResMap::const_iterator resTypeIter = _resSlots.begin(); resTypeIter != _resSlots.end(); ++resTypeIter) {
-		ResourceSlots *slots = (*resTypeIter)._value;
-		for (ResourceSlots::iterator slotIter = slots->begin(); slotIter != slots->end(); ++slotIter) {
-			ResourceSlot *slot = &(*slotIter);
-			if (slot->refCount <= 0 && slot->res) {
-				_cacheDataSize -= slot->size;
-				delete slot->res;
-				slot->res = NULL;
-				slot->refCount = 0;
-				_cacheCount--;
+
+	// Evict the least recently used unreferenced resources of the given
+	// tier until it fits its budget again, instead of flushing everything
+	int &tierDataSize = soundTier ? _soundCacheDataSize : _cacheDataSize;
+	const int tierMaxSize = soundTier ? kMaxSoundCacheSize : kMaxResourceCacheSize;
+
+	while (tierDataSize >= tierMaxSize) {
+		ResourceSlot *evictionCandidate = NULL;
+
+		for (ResMap::const_iterator resTypeIter = _resSlots.begin(); resTypeIter != _resSlots.end(); ++resTypeIter) {
+			if (((*resTypeIter)._key == kResSNDS) != soundTier)
+				continue;
+			ResourceSlots *slots = (*resTypeIter)._value;
+			for (ResourceSlots::iterator slotIter = slots->begin(); slotIter != slots->end(); ++slotIter) {
+				ResourceSlot *slot = &(*slotIter);
+				if (slot->refCount <= 0 && slot->res &&
+					(!evictionCandidate || slot->lastUse < evictionCandidate->lastUse))
+					evictionCandidate = slot;
 			}
 		}
+
+		if (!evictionCandidate)
+			break;
+
+		tierDataSize -= evictionCandidate->size;
+		delete evictionCandidate->res;
+		evictionCandidate->res = NULL;
+		evictionCandidate->refCount = 0;
+		_cacheCount--;
 	}
 }
 
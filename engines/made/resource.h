@@ -53,6 +53,15 @@ const int kMaxResourceCacheSize = 1000 * 1024;
 const int kMaxResourceCacheSize = 400 * 1024;
 #endif
 
+/// Decoded sounds have their own cache budget so that loading a
+/// picture-heavy screen cannot evict speech samples that are about
+/// to be replayed.
+#ifndef __DS__
+const int kMaxSoundCacheSize = 500 * 1024;
+#else
+const int kMaxSoundCacheSize = 200 * 1024;
+#endif
+
 
 enum ResourceType {
 	kResARCH = MKTAG('A','R','C','H'),
@@ -179,9 +188,10 @@ struct ResourceSlot {
 	uint32 size;
 	Resource *res;
 	int refCount;
-	ResourceSlot() : offs(0), size(0), res(NULL), refCount(0) {
+	uint32 lastUse;
+	ResourceSlot() : offs(0), size(0), res(NULL), refCount(0), lastUse(0) {
 	}
-	ResourceSlot(uint32 roffs, uint32 rsize) : offs(roffs), size(rsize), res(NULL), refCount(0) {
+	ResourceSlot(uint32 roffs, uint32 rsize) : offs(roffs), size(rsize), res(NULL), refCount(0), lastUse(0) {
 	}
 };
 
@@ -216,6 +226,8 @@ protected:
 	ResMap _resSlots;
 	int _cacheCount;
 	int _cacheDataSize;
+	int _soundCacheDataSize;
+	uint32 _useCounter;
 
 	void loadIndex(ResourceSlots *slots);
 
@@ -248,7 +260,7 @@ protected:
 				res = new T();
 				res->_slot = slot;
 				res->load(buffer, size);
-				addResourceToCache(slot, res);
+				addResourceToCache(slot, res, resType);
 				delete[] buffer;
 			}
 		}
@@ -258,9 +270,9 @@ protected:
 	bool loadResource(ResourceSlot *slot, byte *&buffer, uint32 &size);
 	ResourceSlot *getResourceSlot(uint32 resType, uint index);
 	Resource *getResourceFromCache(ResourceSlot *slot);
-	void addResourceToCache(ResourceSlot *slot, Resource *res);
+	void addResourceToCache(ResourceSlot *slot, Resource *res, uint32 resType);
 	void tossResourceFromCache(ResourceSlot *slot);
-	void purgeCache();
+	void purgeCache(bool soundTier);
 
 };
 
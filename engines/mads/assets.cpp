@@ -25,26 +25,76 @@
 #include "mads/assets.h"
 #include "mads/compression.h"
 #include "mads/events.h"
+#include "mads/game.h"
 #include "mads/palette.h"
+#include "mads/scene.h"
 
 namespace MADS {
 
+SpriteAssetCache::Entry *SpriteAssetCache::find(const Common::String &resName) {
+	EntryMap::iterator it = _entries.find(resName);
+	return (it != _entries.end()) ? it->_value : nullptr;
+}
+
+SpriteAssetCache::Entry *SpriteAssetCache::add(const Common::String &resName) {
+	Entry *entry = new Entry();
+	_entries[resName] = entry;
+	return entry;
+}
+
+void SpriteAssetCache::clear() {
+	for (EntryMap::iterator it = _entries.begin(); it != _entries.end(); ++it) {
+		Entry *entry = it->_value;
+
+		for (uint i = 0; i < entry->_frameData.size(); ++i)
+			delete[] entry->_frameData[i];
+		delete entry->_pack;
+		delete entry;
+	}
+
+	_entries.clear();
+}
+
+/*------------------------------------------------------------------------*/
+
 SpriteAsset::SpriteAsset(MADSEngine *vm, const Common::String &resourceName, int flags) : _vm(vm) {
 	Common::String resName = resourceName;
 	if (!resName.hasSuffix(".SS") && !resName.hasSuffix(".ss"))
 		resName += ".SS";
 	_srcSize = 0;
 
-	File file(resName);
-	load(&file, flags);
+	// Sprite sets loaded by resource name go through the scene's cache, so
+	// that reloading one within a scene skips the decompression
+	SpriteAssetCache::Entry *cacheEntry = nullptr;
+	if (_vm->_game) {
+		SpriteAssetCache &cache = _vm->_game->_scene._spriteCache;
+		cacheEntry = cache.find(resName);
+		if (!cacheEntry)
+			cacheEntry = cache.add(resName);
+	}
 
-	file.close();
+	if (cacheEntry && cacheEntry->_pack) {
+		load(cacheEntry->_pack, cacheEntry, flags);
+	} else {
+		File file(resName);
+		MadsPack *sprite = new MadsPack(&file);
+		file.close();
+
+		if (cacheEntry) {
+			cacheEntry->_pack = sprite;
+			load(sprite, cacheEntry, flags);
+		} else {
+			load(sprite, nullptr, flags);
+			delete sprite;
+		}
+	}
 }
 
 SpriteAsset::SpriteAsset(MADSEngine *vm, Common::SeekableReadStream *stream, int flags) : _vm(vm) {
 	_srcSize = 0;
 
-	load(stream, flags);
+	MadsPack sprite(stream);
+	load(&sprite, nullptr, flags);
 }
 
 SpriteAsset::~SpriteAsset() {
@@ -57,17 +107,16 @@ SpriteAsset::~SpriteAsset() {
 	delete _charInfo;
 }
 
-void SpriteAsset::load(Common::SeekableReadStream *stream, int flags) {
+void SpriteAsset::load(MadsPack *sprite, SpriteAssetCache::Entry *cacheEntry, int flags) {
 	int curFrame = 0;
 	uint32 frameOffset = 0;
-	MadsPack sprite(stream);
 	_frameRate = 0;
 	_pixelSpeed = 0;
 	_maxWidth = 0;
 	_maxHeight = 0;
 	_usageIndex = -1;
 
-	Common::SeekableReadStream *spriteStream = sprite.getItemStream(0);
+	Common::SeekableReadStream *spriteStream = sprite->getItemStream(0);
 	_mode = spriteStream->readByte();
 	spriteStream->skip(1);
 	int type1 = spriteStream->readUint16LE();
@@ -84,7 +133,7 @@ void SpriteAsset::load(Common::SeekableReadStream *stream, int flags) {
 	delete spriteStream;
 
 	// Get the palette data
-	Common::SeekableReadStream *palStream = sprite.getItemStream(2);
+	Common::SeekableReadStream *palStream = sprite->getItemStream(2);
 	Common::Array<RGB6> palette;
 
 	int numColors = palStream->readUint16LE();
@@ -135,8 +184,8 @@ void SpriteAsset::load(Common::SeekableReadStream *stream, int flags) {
 		assert(_usageIndex >= 0);
 	}
 
-	spriteStream = sprite.getItemStream(1);
-	Common::SeekableReadStream *spriteDataStream = sprite.getItemStream(3);
+	spriteStream = sprite->getItemStream(1);
+	Common::SeekableReadStream *spriteDataStream = sprite->getItemStream(3);
 	SpriteAssetFrame frame;
 	Common::Array<int> frameSizes;
 	for (curFrame = 0; curFrame < _frameCount; curFrame++) {
@@ -170,26 +219,41 @@ void SpriteAsset::load(Common::SeekableReadStream *stream, int flags) {
 	if (_mode != 0) {
 		// Handle decompressing Fab encoded data
 		for (curFrame = 0; curFrame < _frameCount; curFrame++) {
-			FabDecompressor fab;
-
 			int srcSize = (curFrame == (_frameCount - 1)) ? spriteDataStream->size() - _frameOffsets[curFrame] :
 				_frameOffsets[curFrame + 1] - _frameOffsets[curFrame];
-			byte *srcData = new byte[srcSize];
-			assert(srcData);
-			spriteDataStream->read(srcData, srcSize);
 
-			byte *destData = new byte[frameSizes[curFrame]];
-			assert(destData);
+			byte *destData;
+			if (cacheEntry && curFrame < (int)cacheEntry->_frameData.size()) {
+				// Reuse the decompressed frame data of an earlier load
+				destData = cacheEntry->_frameData[curFrame];
+				assert(cacheEntry->_frameSizes[curFrame] == (uint32)frameSizes[curFrame]);
+				spriteDataStream->skip(srcSize);
+			} else {
+				FabDecompressor fab;
 
-			fab.decompress(srcData, srcSize, destData, frameSizes[curFrame]);
+				byte *srcData = new byte[srcSize];
+				assert(srcData);
+				spriteDataStream->read(srcData, srcSize);
+
+				destData = new byte[frameSizes[curFrame]];
+				assert(destData);
+
+				fab.decompress(srcData, srcSize, destData, frameSizes[curFrame]);
+				delete[] srcData;
+
+				if (cacheEntry) {
+					cacheEntry->_frameData.push_back(destData);
+					cacheEntry->_frameSizes.push_back(frameSizes[curFrame]);
+				}
+			}
 
 			// Load the frames
 			Common::MemoryReadStream *rs = new Common::MemoryReadStream(destData, frameSizes[curFrame]);
 			_frames[curFrame]._frame = new MSprite(rs, palette, _frames[curFrame]._bounds);
 			delete rs;
 
-			delete[] srcData;
-			delete[] destData;
+			if (!cacheEntry)
+				delete[] destData;
 		}
 	}
 
@@ -25,6 +25,8 @@
 
 #include "common/scummsys.h"
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "mads/palette.h"
 
 namespace MADS {
@@ -35,6 +37,7 @@ enum AssetFlags {
 };
 
 class MADSEngine;
+class MadsPack;
 class MSprite;
 class MSurface;
 
@@ -59,6 +62,46 @@ public:
 	int _centerOfGravity;
 };
 
+/**
+ * Cache of unpacked sprite set data, with scene-scoped lifetime.
+ *
+ * Scene animations reload their sprite sets every time they are started,
+ * so restarting an animation within a scene used to re-run the FAB
+ * decompression of every frame. The cache keeps the unpacked resource and
+ * the decompressed frame data around until the scene is left, leaving only
+ * the palette mapping to be redone on a reload.
+ */
+class SpriteAssetCache {
+public:
+	struct Entry {
+		MadsPack *_pack;
+		Common::Array<byte *> _frameData;
+		Common::Array<uint32> _frameSizes;
+
+		Entry() : _pack(nullptr) {}
+	};
+private:
+	typedef Common::HashMap<Common::String, Entry *> EntryMap;
+	EntryMap _entries;
+public:
+	~SpriteAssetCache() { clear(); }
+
+	/**
+	 * Return the cached entry for the given resource, if any
+	 */
+	Entry *find(const Common::String &resName);
+
+	/**
+	 * Add a new, empty entry for the given resource
+	 */
+	Entry *add(const Common::String &resName);
+
+	/**
+	 * Free all the cached data
+	 */
+	void clear();
+};
+
 class SpriteAsset {
 private:
 	MADSEngine *_vm;
@@ -76,7 +119,7 @@ private:
 	/**
 	 * Load the data for the asset
 	 */
-	void load(Common::SeekableReadStream *stream, int flags);
+	void load(MadsPack *sprite, SpriteAssetCache::Entry *cacheEntry, int flags);
 public:
 	SpriteSetCharInfo *_charInfo;
 	int _usageIndex;
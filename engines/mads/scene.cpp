@@ -709,6 +709,7 @@ void Scene::freeCurrentScene() {
 	_vm->_palette->_paletteUsage.load(nullptr);
 	_cyclingActive = false;
 	_hotspots.clear();
+	_spriteCache.clear();
 	_backgroundSurface.free();
 	_depthSurface.free();
 
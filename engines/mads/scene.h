@@ -89,6 +89,7 @@ public:
 	TextDisplayList _textDisplay;
 	SpriteSlots _spriteSlots;
 	SpriteSets _sprites;
+	SpriteAssetCache _spriteCache;
 	DynamicHotspots _dynamicHotspots;
 	Common::Array<int> _activeVocabs;
 	SequenceList _sequences;
@@ -68,7 +68,12 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
+// Byte budget for the decoded image cache; beyond this trimCache()
+// starts evicting the least recently used images.
+static const uint32 kImageCacheLimit = 16 * 1024 * 1024;
+
 GraphicsManager::GraphicsManager() {
+	_cacheTick = 0;
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -86,16 +91,42 @@ void GraphicsManager::clearCache() {
 
 	_cache.clear();
 	_subImageCache.clear();
+	_cacheLastUsed.clear();
+}
+
+void GraphicsManager::trimCache() {
+	uint32 cacheSize = 0;
+	for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+		const Graphics::Surface *surface = it->_value->getSurface();
+		cacheSize += surface->pitch * surface->h;
+	}
+
+	while (cacheSize > kImageCacheLimit && !_cache.empty()) {
+		// Find the least recently used image
+		uint16 oldestId = _cache.begin()->_key;
+		uint32 oldestTick = _cacheLastUsed[oldestId];
+
+		for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+			if (_cacheLastUsed[it->_key] < oldestTick) {
+				oldestId = it->_key;
+				oldestTick = _cacheLastUsed[it->_key];
+			}
+		}
+
+		const Graphics::Surface *surface = _cache[oldestId]->getSurface();
+		cacheSize -= surface->pitch * surface->h;
+
+		delete _cache[oldestId];
+		_cache.erase(oldestId);
+		_cacheLastUsed.erase(oldestId);
+	}
 }
 
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
 	if (!_cache.contains(id))
 		_cache[id] = decodeImage(id);
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	_cacheLastUsed[id] = ++_cacheTick;
 
 	return _cache[id];
 }
@@ -228,6 +259,7 @@ void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
 		error("Image %d already in cache", id);
 
 	_cache[id] = surface;
+	_cacheLastUsed[id] = ++_cacheTick;
 }
 
 } // End of namespace Mohawk
@@ -74,6 +74,11 @@ public:
 	// Free all surfaces in the cache
 	void clearCache();
 
+	// Evict the least recently used images until the cache fits its byte
+	// budget again. Called on card changes, so images shared between
+	// neighboring cards survive the flip instead of being re-decoded.
+	void trimCache();
+
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
 	MohawkSurface *findImage(uint16 id);
@@ -100,6 +105,10 @@ private:
 	// An image cache that stores images until clearCache() is called
 	Common::HashMap<uint16, MohawkSurface *> _cache;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
+
+	// LRU bookkeeping for trimCache()
+	Common::HashMap<uint16, uint32> _cacheLastUsed;
+	uint32 _cacheTick;
 };
 
 } // End of namespace Mohawk
@@ -643,9 +643,9 @@ void MohawkEngine_Myst::changeToCard(uint16 card, TransitionType transition) {
 
 	unloadCard();
 
-	// Clear the resource cache and image cache
+	// Clear the resource cache and trim the image cache
 	_cache.clear();
-	_gfx->clearCache();
+	_gfx->trimCache();
 
 	_mouseClicked = false;
 	_mouseMoved = false;
@@ -487,9 +487,9 @@ static const RivenSpecialChange rivenSpecialChange[] = {
 void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	debug (1, "Changing to card %d", dest);
 
-	// Clear the graphics cache (images typically aren't used
-	// on different cards).
-	_gfx->clearCache();
+	// Trim the graphics cache. Images shared with the cards around this
+	// one stay decoded, so flipping back and forth doesn't re-decode them.
+	_gfx->trimCache();
 
 	if (!(getFeatures() & GF_DEMO)) {
 		for (byte i = 0; i < ARRAYSIZE(rivenSpecialChange); i++)
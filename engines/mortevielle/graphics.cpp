@@ -995,13 +995,21 @@ void ScreenSurface::writeCharacter(const Common::Point &pt, unsigned char ch, in
 	Graphics::Surface destSurface = lockArea(Common::Rect(pt.x, pt.y * 2,
 		pt.x + FONT_WIDTH, (pt.y + FONT_HEIGHT) * 2));
 
+	drawCharacterGlyph(destSurface, ch, palIndex);
+}
+
+/**
+ * Draws the glyph for a character to the top left of a surface, without any
+ * dirty rect handling
+ */
+void ScreenSurface::drawCharacterGlyph(Graphics::Surface &dest, unsigned char ch, int palIndex) {
 	// Get the start of the character to use
 	assert((ch >= ' ') && (ch <= (unsigned char)(32 + FONT_NUM_CHARS)));
 	const byte *charData = &_fontData[((int)ch - 32) * FONT_HEIGHT];
 
 	// Loop through decoding each character's data
 	for (int yp = 0; yp < FONT_HEIGHT; ++yp) {
-		byte *lineP = (byte *)destSurface.getBasePtr(0, yp * 2);
+		byte *lineP = (byte *)dest.getBasePtr(0, yp * 2);
 		byte byteVal = *charData++;
 
 		for (int xp = 0; xp < FONT_WIDTH; ++xp, ++lineP, byteVal <<= 1) {
@@ -1104,9 +1112,19 @@ void ScreenSurface::drawString(const Common::String &l, int command) {
 
 	pt.x += 1;
 	pt.y += 1;
+
+	// Lock the whole text run at once, so the string produces a single
+	// dirty rect instead of one per character
+	Graphics::Surface destSurface = lockArea(Common::Rect(pt.x, pt.y * 2,
+		pt.x + charWidth * (int)l.size() + (FONT_WIDTH - charWidth), (pt.y + FONT_HEIGHT) * 2));
+
+	int xp = 0;
 	for (x = 1; (x <= (int)l.size()) && (l[x - 1] != 0); ++x) {
-		_vm->_screenSurface->writeCharacter(Common::Point(pt.x, pt.y), l[x - 1], color);
-		pt.x += charWidth;
+		Graphics::Surface charSurface;
+		charSurface.init(FONT_WIDTH, FONT_HEIGHT * 2, destSurface.pitch,
+			destSurface.getBasePtr(xp, 0), destSurface.format);
+		drawCharacterGlyph(charSurface, l[x - 1], color);
+		xp += charWidth;
 	}
 	_vm->_mouse->showMouse();
 }
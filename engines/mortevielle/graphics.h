@@ -90,6 +90,8 @@ private:
 	Common::List<Common::Rect> _dirtyRects;
 	byte _fontData[FONT_NUM_CHARS * FONT_HEIGHT];
 
+	void drawCharacterGlyph(Graphics::Surface &dest, unsigned char ch, int palIndex);
+
 public:
 	ScreenSurface(MortevielleEngine *vm);
 
@@ -45,9 +45,41 @@
 #include "neverhood/modules/module2800.h"
 #include "neverhood/modules/module2900.h"
 #include "neverhood/modules/module3000.h"
+#include "neverhood/resourceman.h"
 
 namespace Neverhood {
 
+// Modules reachable from each module, derived from the transitions in
+// GameModule::updateModule; used to prefetch the resources of likely
+// successor modules during idle time. Zero-terminated.
+static const struct ModuleNeighbors {
+	int moduleNum;
+	int neighbors[7];
+} kModuleNeighbors[] = {
+	{ 1000, { 2300, 0 } },
+	{ 1100, { 1300, 2900, 0 } },
+	{ 1200, { 2300, 2600, 0 } },
+	{ 1300, { 2900, 0 } },
+	{ 1400, { 1600, 0 } },
+	{ 1500, { 1000, 0 } },
+	{ 1600, { 1400, 1700, 2100, 0 } },
+	{ 1700, { 1600, 2900, 0 } },
+	{ 1800, { 2700, 2800, 3000, 0 } },
+	{ 1900, { 3000, 0 } },
+	{ 2000, { 2900, 0 } },
+	{ 2100, { 1600, 2900, 0 } },
+	{ 2200, { 2300, 0 } },
+	{ 2300, { 1000, 1200, 2200, 2400, 3000, 0 } },
+	{ 2400, { 2300, 0 } },
+	{ 2500, { 2600, 0 } },
+	{ 2600, { 1200, 2500, 0 } },
+	{ 2700, { 1800, 0 } },
+	{ 2800, { 1800, 2900, 0 } },
+	{ 2900, { 1100, 1300, 1700, 2000, 2100, 2800, 0 } },
+	{ 3000, { 1800, 1900, 2300, 0 } },
+	{ 0, { 0 } }
+};
+
 static const uint32 kRadioMusicFileHashes[] = {
 	0x82B22000,
 	0x02B22004,
@@ -444,6 +476,8 @@ void GameModule::createModule(int moduleNum, int which) {
 	debug(1, "GameModule::createModule(%d, %d)", moduleNum, which);
 	_moduleNum = moduleNum;
 
+	_vm->_res->setCurrentModule(moduleNum);
+
 	delete _childObject;
 
 	switch (_moduleNum) {
@@ -542,6 +576,13 @@ void GameModule::createModule(int moduleNum, int which) {
 	}
 	SetUpdateHandler(&GameModule::updateModule);
 	_childObject->handleUpdate();
+
+	// Queue the resources of the modules reachable from this one for
+	// prefetching during idle time
+	for (const ModuleNeighbors *mn = kModuleNeighbors; mn->moduleNum != 0; ++mn)
+		if (mn->moduleNum == moduleNum)
+			for (int i = 0; mn->neighbors[i] != 0; i++)
+				_vm->_res->prefetchModule(mn->neighbors[i]);
 }
 
 void GameModule::createModuleByHash(uint32 nameHash) {
@@ -195,7 +195,11 @@ void NeverhoodEngine::mainLoop() {
 			if (_updateSound)
 				_soundMan->update();
 			nextFrameTime = _screen->getNextFrameTime();
-		};
+		} else {
+			// Use the idle time until the next frame to decompress
+			// resources of modules the player may enter next
+			_res->pumpPrefetch(applyResourceFixes());
+		}
 
 		_audioResourceMan->updateMusic();
 
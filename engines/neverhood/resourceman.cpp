@@ -31,10 +31,13 @@ ResourceHandle::ResourceHandle()
 ResourceHandle::~ResourceHandle() {
 }
 
-ResourceMan::ResourceMan() {
+ResourceMan::ResourceMan()
+	: _currentModuleNum(0), _prefetchedBytes(0) {
 }
 
 ResourceMan::~ResourceMan() {
+	for (Common::HashMap<int, ModuleHashSet*>::iterator it = _moduleHashes.begin(); it != _moduleHashes.end(); ++it)
+		delete (*it)._value;
 }
 
 void ResourceMan::addArchive(const Common::String &filename) {
@@ -126,6 +129,15 @@ static const EntrySizeFix entrySizeFixes[] = {
 	{          0,        0,         0,     0,         0 }
 };
 
+// Apply fixes for broken resources in Russian versions
+static void applyEntrySizeFixes(BlbArchiveEntry *entry) {
+	for (const EntrySizeFix *cur = entrySizeFixes; cur->fileHash > 0; ++cur) {
+		if (entry->fileHash == cur->fileHash && entry->offset == cur->offset &&
+			entry->diskSize == cur->diskSize && entry->size == cur->size)
+			entry->size = cur->fixedSize;
+	}
+}
+
 void ResourceMan::loadResource(ResourceHandle &resourceHandle, bool applyResourceFixes) {
 	resourceHandle._data = NULL;
 	if (resourceHandle.isValid()) {
@@ -137,23 +149,29 @@ void ResourceMan::loadResource(ResourceHandle &resourceHandle, bool applyResourc
 		}
 		if (resourceData->data != NULL) {
 			resourceData->dataRefCount++;
+			// The prefetcher got here first; the data is now in active use
+			resourceData->prefetched = false;
 		} else {
 			BlbArchiveEntry *entry = resourceHandle._resourceFileEntry->archiveEntry;
 
-			// Apply fixes for broken resources in Russian versions
-			if (applyResourceFixes) {
-				for (const EntrySizeFix *cur = entrySizeFixes; cur->fileHash > 0; ++cur) {
-					if (entry->fileHash == cur->fileHash && entry->offset == cur->offset &&
-						entry->diskSize == cur->diskSize && entry->size == cur->size)
-						entry->size = cur->fixedSize;
-				}
-			}
+			if (applyResourceFixes)
+				applyEntrySizeFixes(entry);
 
 			resourceData->data = new byte[entry->size];
 			resourceHandle._resourceFileEntry->archive->load(entry, resourceData->data, 0);
 			resourceData->dataRefCount = 1;
 		}
 		resourceHandle._data = resourceData->data;
+		// Remember that the current module uses this resource so it can be
+		// prefetched the next time a neighboring module transitions here
+		if (_currentModuleNum != 0) {
+			ModuleHashSet *moduleHashes = _moduleHashes[_currentModuleNum];
+			if (!moduleHashes) {
+				moduleHashes = new ModuleHashSet();
+				_moduleHashes[_currentModuleNum] = moduleHashes;
+			}
+			(*moduleHashes)[fileHash] = true;
+		}
 	}
 }
 
@@ -170,11 +188,61 @@ void ResourceMan::unloadResource(ResourceHandle &resourceHandle) {
 void ResourceMan::purgeResources() {
 	for (Common::HashMap<uint32, ResourceData*>::iterator it = _data.begin(); it != _data.end(); ++it) {
 		ResourceData *resourceData = (*it)._value;
-		if (resourceData->dataRefCount == 0) {
+		if (resourceData->dataRefCount == 0 && !resourceData->prefetched) {
 			delete[] resourceData->data;
 			resourceData->data = NULL;
 		}
 	}
 }
 
+void ResourceMan::setCurrentModule(int moduleNum) {
+	if (moduleNum == _currentModuleNum)
+		return;
+	_currentModuleNum = moduleNum;
+	_prefetchQueue.clear();
+	_prefetchedBytes = 0;
+	// Unpin data prefetched for the previous transition; whatever was not
+	// claimed by loadResource is freed by the next purgeResources
+	for (Common::HashMap<uint32, ResourceData*>::iterator it = _data.begin(); it != _data.end(); ++it)
+		(*it)._value->prefetched = false;
+}
+
+void ResourceMan::prefetchModule(int moduleNum) {
+	ModuleHashSet *moduleHashes = _moduleHashes.contains(moduleNum) ? _moduleHashes[moduleNum] : NULL;
+	if (!moduleHashes)
+		return;
+	for (ModuleHashSet::iterator it = moduleHashes->begin(); it != moduleHashes->end(); ++it) {
+		const uint32 fileHash = (*it)._key;
+		if (!_data.contains(fileHash) || _data[fileHash]->data == NULL)
+			_prefetchQueue.push_back(fileHash);
+	}
+}
+
+void ResourceMan::pumpPrefetch(bool applyResourceFixes) {
+	while (!_prefetchQueue.empty()) {
+		const uint32 fileHash = _prefetchQueue.back();
+		_prefetchQueue.pop_back();
+		ResourceFileEntry *entry = findEntry(fileHash);
+		if (!entry)
+			continue;
+		ResourceData *resourceData = _data[fileHash];
+		if (!resourceData) {
+			resourceData = new ResourceData();
+			_data[fileHash] = resourceData;
+		}
+		if (resourceData->data != NULL)
+			continue;
+		if (applyResourceFixes)
+			applyEntrySizeFixes(entry->archiveEntry);
+		if (_prefetchedBytes + entry->archiveEntry->size > kPrefetchByteBudget)
+			continue;
+		resourceData->data = new byte[entry->archiveEntry->size];
+		entry->archive->load(entry->archiveEntry, resourceData->data, 0);
+		resourceData->prefetched = true;
+		_prefetchedBytes += entry->archiveEntry->size;
+		// Decompress at most one resource per frame to stay invisible
+		break;
+	}
+}
+
 } // End of namespace Neverhood
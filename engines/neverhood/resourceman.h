@@ -45,7 +45,8 @@ struct Resource {
 struct ResourceData {
 	byte *data;
 	int dataRefCount;
-	ResourceData() : data(NULL), dataRefCount() {}
+	bool prefetched;
+	ResourceData() : data(NULL), dataRefCount(), prefetched(false) {}
 };
 
 class ResourceMan;
@@ -81,12 +82,30 @@ public:
 	void loadResource(ResourceHandle &resourceHandle, bool applyResourceFixes);
 	void unloadResource(ResourceHandle &resourceHandle);
 	void purgeResources();
+	// Tell the resource manager which module is running so it can remember
+	// which resources the module uses; unpins data prefetched for the
+	// previous transition
+	void setCurrentModule(int moduleNum);
+	// Queue the resources known to be used by the given module for
+	// prefetching during idle time
+	void prefetchModule(int moduleNum);
+	// Decompress at most one queued resource; called once per frame while
+	// the engine is waiting for the next frame time
+	void pumpPrefetch(bool applyResourceFixes);
 protected:
 	typedef Common::HashMap<uint32, ResourceFileEntry> EntriesMap;
+	typedef Common::HashMap<uint32, bool> ModuleHashSet;
+	// Total bytes of decompressed resource data the prefetcher may keep
+	// pinned for one module transition
+	static const uint32 kPrefetchByteBudget = 4 * 1024 * 1024;
 	Common::Array<BlbArchive*> _archives;
 	EntriesMap _entries;
 	Common::HashMap<uint32, ResourceData*> _data;
 	Common::Array<Resource*> _resources;
+	Common::HashMap<int, ModuleHashSet*> _moduleHashes;
+	Common::Array<uint32> _prefetchQueue;
+	int _currentModuleNum;
+	uint32 _prefetchedBytes;
 };
 
 } // End of namespace Neverhood
@@ -105,6 +105,11 @@ void PtcArchive::close() {
 	delete _stream;
 	_stream = nullptr;
 	_items.clear();
+
+	for (CacheMap::iterator it = _cache.begin(); it != _cache.end(); ++it) {
+		free(it->_value._data);
+	}
+	_cache.clear();
 }
 
 bool PtcArchive::hasFile(const Common::String &name) const {
@@ -135,6 +140,11 @@ Common::SeekableReadStream *PtcArchive::createReadStreamForMember(const Common::
 		return 0;
 	}
 
+	if (_cache.contains(name)) {
+		const FileData &cached = _cache[name];
+		return new Common::MemoryReadStream(cached._data, cached._size, DisposeAfterUse::NO);
+	}
+
 	const FileEntry &entryHeader = _items[name];
 
 	if (entryHeader._size < 4)
@@ -156,6 +166,14 @@ Common::SeekableReadStream *PtcArchive::createReadStreamForMember(const Common::
 		free(buffer);
 		size = decompLen;
 		buffer = decompData;
+
+		// Cache the decompressed file; the archive owns the buffer now
+		FileData cached;
+		cached._data = buffer;
+		cached._size = size;
+		_cache[name] = cached;
+
+		return new Common::MemoryReadStream(buffer, size, DisposeAfterUse::NO);
 	}
 
 	//debug("PtcArchive::createReadStreamForMember name %s", name.c_str());
@@ -51,10 +51,21 @@ private:
 		uint32 _size;
 	};
 
+	struct FileData {
+		byte *_data;
+		uint32 _size;
+	};
+
 	Common::SeekableReadStream *_stream;
 
 	typedef Common::HashMap<Common::String, FileEntry, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> FileMap;
 	FileMap _items;
+
+	// Decompressing a file is by far the most expensive part of reading it,
+	// so decompressed files are kept here for as long as the archive stays
+	// open and are served again without touching the disk.
+	typedef Common::HashMap<Common::String, FileData, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CacheMap;
+	mutable CacheMap _cache;
 };
 
 } // End of namespace Prince
@@ -78,6 +78,7 @@ void PrinceEngine::debugEngine(const char *s, ...) {
 PrinceEngine::PrinceEngine(OSystem *syst, const PrinceGameDescription *gameDesc) :
 	Engine(syst), _gameDescription(gameDesc), _graph(nullptr), _script(nullptr), _interpreter(nullptr), _flags(nullptr),
 	_locationNr(0), _debugger(nullptr), _midiPlayer(nullptr), _room(nullptr),
+	_locationArchive(nullptr), _prevLocationArchive(nullptr), _prevLocationNr(0),
 	_cursor1(nullptr), _cursor2(nullptr), _cursor3(nullptr), _font(nullptr),
 	_suitcaseBmp(nullptr), _roomBmp(nullptr), _cursorNr(0), _picWindowX(0), _picWindowY(0), _randomSource("prince"),
 	_invLineX(134), _invLineY(176), _invLine(5), _invLines(3), _invLineW(70), _invLineH(76), _maxInvW(72), _maxInvH(76),
@@ -128,6 +129,12 @@ PrinceEngine::~PrinceEngine() {
 	delete _graph;
 	delete _room;
 
+	if (_locationArchive != nullptr) {
+		SearchMan.remove(Common::String::format("%02d", _locationNr));
+		delete _locationArchive;
+	}
+	delete _prevLocationArchive;
+
 	if (_cursor2 != nullptr) {
 		_cursor2->free();
 		delete _cursor2;
@@ -510,6 +517,17 @@ bool PrinceEngine::loadLocation(uint16 locationNr) {
 	const Common::FSNode gameDataDir(ConfMan.get("path"));
 	SearchMan.remove(Common::String::format("%02d", _locationNr));
 
+	// Keep the archive of the location we are leaving open. Its files stay
+	// decompressed in its cache, so returning there right away - which the
+	// hub structure of the game makes very common - skips both the disk
+	// reads and the MASM decompression.
+	if (_locationArchive != nullptr) {
+		delete _prevLocationArchive;
+		_prevLocationArchive = _locationArchive;
+		_prevLocationNr = _locationNr;
+		_locationArchive = nullptr;
+	}
+
 	_locationNr = locationNr;
 	_debugger->_locationNr = locationNr;
 
@@ -521,11 +539,16 @@ bool PrinceEngine::loadLocation(uint16 locationNr) {
 	const Common::String locationNrStr = Common::String::format("%02d", _locationNr);
 	debugEngine("loadLocation %s", locationNrStr.c_str());
 
-	PtcArchive *locationArchive = new PtcArchive();
-	if (!locationArchive->open(locationNrStr + "/databank.ptc"))
-		error("Can't open location %s", locationNrStr.c_str());
+	if (_prevLocationArchive != nullptr && _prevLocationNr == locationNr) {
+		_locationArchive = _prevLocationArchive;
+		_prevLocationArchive = nullptr;
+	} else {
+		_locationArchive = new PtcArchive();
+		if (!_locationArchive->open(locationNrStr + "/databank.ptc"))
+			error("Can't open location %s", locationNrStr.c_str());
+	}
 
-	SearchMan.add(locationNrStr, locationArchive);
+	SearchMan.add(locationNrStr, _locationArchive, 0, false);
 
 	loadMusic(_locationNr);
 
@@ -80,6 +80,7 @@ class Hero;
 class Animation;
 class Room;
 class Pscr;
+class PtcArchive;
 
 enum {
 	GF_TRANSLATED = 1 << 0
@@ -363,6 +364,13 @@ public:
 	uint32 _currentTime;
 	uint16 _locationNr;
 	uint16 _sceneWidth;
+
+	PtcArchive *_locationArchive;
+
+	// Archive of the previously visited location, kept open so that its
+	// already decompressed files can be reused when the player backtracks
+	PtcArchive *_prevLocationArchive;
+	uint16 _prevLocationNr;
 	int32 _picWindowX;
 	int32 _picWindowY;
 
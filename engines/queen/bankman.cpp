@@ -29,8 +29,9 @@
 namespace Queen {
 
 BankManager::BankManager(Resource *res)
-	: _res(res) {
+	: _planarScratch(NULL), _planarScratchSize(0), _res(res) {
 	memset(_frames, 0, sizeof(_frames));
+	memset(_frameCapacity, 0, sizeof(_frameCapacity));
 	memset(_banks, 0, sizeof(_banks));
 }
 
@@ -39,6 +40,34 @@ BankManager::~BankManager() {
 		close(i);
 	}
 	eraseFrames(true);
+	delete[] _planarScratch;
+}
+
+void BankManager::reserveFrameData(uint32 dstframe, uint32 size) {
+	BobFrame *bf = &_frames[dstframe];
+	if (bf->data && _frameCapacity[dstframe] >= size) {
+		// recycle the previous unpack's buffer
+		return;
+	}
+	delete[] bf->data;
+	bf->data = new uint8[ size ];
+	_frameCapacity[dstframe] = size;
+}
+
+void BankManager::eraseFrameData(uint32 dstframe) {
+	BobFrame *bf = &_frames[dstframe];
+	delete[] bf->data;
+	bf->data = NULL;
+	_frameCapacity[dstframe] = 0;
+}
+
+uint8 *BankManager::getPlanarScratch(uint32 size) {
+	if (_planarScratchSize < size) {
+		delete[] _planarScratch;
+		_planarScratch = new uint8[ size ];
+		_planarScratchSize = size;
+	}
+	return _planarScratch;
 }
 
 void BankManager::load(const char *bankname, uint32 bankslot) {
@@ -90,10 +119,9 @@ void BankManager::load(const char *bankname, uint32 bankslot) {
 	strcpy(bank->name, bankname);
 }
 
-static void convertPlanarBitmap(uint8 *dst, int dstPitch, const uint8 *src, int w, int h, int plane) {
+static void convertPlanarBitmap(uint8 *dst, int dstPitch, const uint8 *src, int w, int h, int plane, uint8 *planarBuf) {
 	assert(w != 0 && h != 0);
 	int planarSize = plane * h * w * 2;
-	uint8 *planarBuf = new uint8[ planarSize ];
 	uint8 *dstPlanar = planarBuf;
 	while (planarSize > 0) {
 		if (src[0] == 0) {
@@ -127,8 +155,6 @@ static void convertPlanarBitmap(uint8 *dst, int dstPitch, const uint8 *src, int
 		}
 		dst += dstPitch;
 	}
-
-	delete[] planarBuf;
 }
 
 void BankManager::unpack(uint32 srcframe, uint32 dstframe, uint32 bankslot) {
@@ -140,8 +166,6 @@ void BankManager::unpack(uint32 srcframe, uint32 dstframe, uint32 bankslot) {
 
 	assert(dstframe < MAX_FRAMES_NUMBER);
 	BobFrame *bf = &_frames[dstframe];
-	delete[] bf->data;
-	bf->data = NULL;
 
 	const uint8 *p = bank->data + bank->indexes[srcframe];
 
@@ -156,8 +180,10 @@ void BankManager::unpack(uint32 srcframe, uint32 dstframe, uint32 bankslot) {
 
 		uint32 size = bf->width * bf->height;
 		if (size != 0) {
-			bf->data = new uint8[ size ];
-			convertPlanarBitmap(bf->data, bf->width, p + 12, w, h, plane);
+			reserveFrameData(dstframe, size);
+			convertPlanarBitmap(bf->data, bf->width, p + 12, w, h, plane, getPlanarScratch(plane * h * w * 2));
+		} else {
+			eraseFrameData(dstframe);
 		}
 	} else {
 		bf->width    = READ_LE_UINT16(p + 0);
@@ -167,8 +193,10 @@ void BankManager::unpack(uint32 srcframe, uint32 dstframe, uint32 bankslot) {
 
 		uint32 size = bf->width * bf->height;
 		if (size != 0) {
-			bf->data = new uint8[ size ];
+			reserveFrameData(dstframe, size);
 			memcpy(bf->data, p + 8, size);
+		} else {
+			eraseFrameData(dstframe);
 		}
 	}
 }
@@ -195,7 +223,7 @@ void BankManager::overpack(uint32 srcframe, uint32 dstframe, uint32 bankslot) {
 		if (bf->width < src_w || bf->height < src_h) {
 			unpack(srcframe, dstframe, bankslot);
 		} else {
-			convertPlanarBitmap(bf->data, bf->width, p + 12, w, h, plane);
+			convertPlanarBitmap(bf->data, bf->width, p + 12, w, h, plane, getPlanarScratch(plane * h * w * 2));
 		}
 	} else {
 		uint16 src_w = READ_LE_UINT16(p + 0);
@@ -233,6 +261,7 @@ void BankManager::eraseFrame(uint32 index) {
 	BobFrame *bf = &_frames[index];
 	delete[] bf->data;
 	memset(bf, 0, sizeof(BobFrame));
+	_frameCapacity[index] = 0;
 }
 
 void BankManager::eraseFrames(bool joe) {
@@ -71,12 +71,27 @@ private:
 		char name[20];
 	};
 
+	//! ensure a frame's pixel buffer can hold size bytes, recycling the current buffer when possible
+	void reserveFrameData(uint32 dstframe, uint32 size);
+
+	//! free a frame's pixel buffer
+	void eraseFrameData(uint32 dstframe);
+
+	//! get the scratch buffer for Amiga planar frame decoding, growing it on demand
+	uint8 *getPlanarScratch(uint32 size);
+
 	//! unpacked bob frames
 	BobFrame _frames[MAX_FRAMES_NUMBER];
 
+	//! allocated size of each unpacked frame's pixel buffer
+	uint32 _frameCapacity[MAX_FRAMES_NUMBER];
+
 	 //! banked bob frames
 	PackedBank _banks[MAX_BANKS_NUMBER];
 
+	uint8 *_planarScratch;
+	uint32 _planarScratchSize;
+
 	Resource *_res;
 };
 
@@ -97,6 +97,7 @@ IsoMap::IsoMap(SagaEngine *vm) : _vm(vm) {
 	_viewScroll.x = (128 - 8) * 16;
 	_viewScroll.y = (128 - 8) * 16 - 64;
 	_viewDiff = 1;
+	_sceneCacheValid = false;
 	_platformHeight = 0;
 	_queueCount = _readCount = 0;
 
@@ -274,6 +275,7 @@ void IsoMap::clear() {
 	_multiTable.clear();
 	_tileData.clear();
 	_multiTableData.clear();
+	_sceneCacheValid = false;
 }
 
 void IsoMap::adjustScroll(bool jump) {
@@ -378,8 +380,31 @@ int16 IsoMap::findMulti(int16 tileIndex, int16 absU, int16 absV, int16 absH) {
 
 void IsoMap::draw() {
 	_tileClip = _vm->_scene->getSceneClip();
+
+	// The tile layers only change when the view scrolls or a tile state
+	// changes, so composite them once and just blit the snapshot again on
+	// the frames in between. Sprites are drawn over the result afterwards.
+	if (_sceneCacheValid && _sceneCacheScroll == _viewScroll && _sceneCacheClip == _tileClip) {
+		_vm->_gfx->drawRegion(_tileClip, _sceneCache.getBuffer());
+		return;
+	}
+
 	_vm->_gfx->drawRect(_tileClip, 0);
 	drawTiles(NULL);
+
+	// Snapshot the composited tile layers for reuse
+	_sceneCache.resize(_tileClip.width() * _tileClip.height());
+	const byte *readPointer = _vm->_gfx->getBackBufferPixels()
+		+ _tileClip.top * _vm->_gfx->getBackBufferPitch() + _tileClip.left;
+	byte *writePointer = _sceneCache.getBuffer();
+	for (int row = 0; row < _tileClip.height(); row++) {
+		memcpy(writePointer, readPointer, _tileClip.width());
+		readPointer += _vm->_gfx->getBackBufferPitch();
+		writePointer += _tileClip.width();
+	}
+	_sceneCacheScroll = _viewScroll;
+	_sceneCacheClip = _tileClip;
+	_sceneCacheValid = true;
 }
 
 void IsoMap::setMapPosition(int x, int y) {
@@ -1620,6 +1645,7 @@ void IsoMap::setTileDoorState(int doorNumber, int doorState) {
 
 	multiTileEntryData = &_multiTable[doorNumber];
 	multiTileEntryData->currentState = doorState;
+	_sceneCacheValid = false;
 }
 
 bool IsoMap::nextTileTarget(ActorData* actor) {
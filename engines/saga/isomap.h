@@ -279,6 +279,13 @@ private:
 	Point _viewScroll;
 	Rect _tileClip;
 
+	// Cached composite of the static tile layers for the current view,
+	// reused until the view scrolls or a tile state changes
+	ByteArray _sceneCache;
+	Point _sceneCacheScroll;
+	Rect _sceneCacheClip;
+	bool _sceneCacheValid;
+
 	SagaEngine *_vm;
 };
 
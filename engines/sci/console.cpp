@@ -2322,7 +2322,7 @@ bool Console::cmdPrintSegmentTable(int argc, const char **argv) {
 				break;
 
 			case SEG_TYPE_CLONES:
-				debugPrintf("C  clones (%d allocd)", (*(CloneTable *)mobj).entries_used);
+				debugPrintf("C  clones (%d allocd, %u pool bytes)", (*(CloneTable *)mobj).entries_used, (*(CloneTable *)mobj).poolSize());
 				break;
 
 			case SEG_TYPE_LOCALS:
@@ -2334,15 +2334,15 @@ bool Console::cmdPrintSegmentTable(int argc, const char **argv) {
 				break;
 
 			case SEG_TYPE_LISTS:
-				debugPrintf("L  lists (%d)", (*(ListTable *)mobj).entries_used);
+				debugPrintf("L  lists (%d, %u pool bytes)", (*(ListTable *)mobj).entries_used, (*(ListTable *)mobj).poolSize());
 				break;
 
 			case SEG_TYPE_NODES:
-				debugPrintf("N  nodes (%d)", (*(NodeTable *)mobj).entries_used);
+				debugPrintf("N  nodes (%d, %u pool bytes)", (*(NodeTable *)mobj).entries_used, (*(NodeTable *)mobj).poolSize());
 				break;
 
 			case SEG_TYPE_HUNK:
-				debugPrintf("H  hunk (%d)", (*(HunkTable *)mobj).entries_used);
+				debugPrintf("H  hunk (%d, %u pool bytes)", (*(HunkTable *)mobj).entries_used, (*(HunkTable *)mobj).poolSize());
 				break;
 
 			case SEG_TYPE_DYNMEM:
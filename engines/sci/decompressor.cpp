@@ -25,6 +25,7 @@
 #include "common/dcl.h"
 #include "common/util.h"
 #include "common/endian.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/textconsole.h"
 
@@ -53,11 +54,37 @@ void Decompressor::init(Common::ReadStream *src, byte *dest, uint32 nPacked,
 	_nBits = 0;
 	_dwRead = _dwWrote = 0;
 	_dwBits = 0;
+
+	// Prefetch the whole packed block, so that the bit readers below work
+	// out of memory instead of making one virtual stream call per byte.
+	// If the allocation fails we keep reading from the stream directly.
+	free(_srcBuf);
+	_srcBuf = (byte *)malloc(nPacked);
+	_srcBufSize = _srcBuf ? src->read(_srcBuf, nPacked) : 0;
+	_srcBufPos = 0;
+}
+
+byte Decompressor::readPackedByte() {
+	if (_srcBuf)
+		return (_srcBufPos < _srcBufSize) ? _srcBuf[_srcBufPos++] : 0;
+	return _src->readByte();
+}
+
+void Decompressor::readPackedBlock(byte *dst, uint32 size) {
+	if (_srcBuf) {
+		uint32 avail = _srcBufSize - _srcBufPos;
+		if (size > avail)
+			size = avail;
+		memcpy(dst, _srcBuf + _srcBufPos, size);
+		_srcBufPos += size;
+	} else {
+		_src->read(dst, size);
+	}
 }
 
 void Decompressor::fetchBitsMSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << (24 - _nBits);
+		_dwBits |= ((uint32)readPackedByte()) << (24 - _nBits);
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -79,7 +106,7 @@ byte Decompressor::getByteMSB() {
 
 void Decompressor::fetchBitsLSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << _nBits;
+		_dwBits |= ((uint32)readPackedByte()) << _nBits;
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -112,10 +139,10 @@ int DecompressorHuffman::unpack(Common::ReadStream *src, byte *dest, uint32 nPac
 	int16 c;
 	uint16 terminator;
 
-	numnodes = _src->readByte();
-	terminator = _src->readByte() | 0x100;
+	numnodes = readPackedByte();
+	terminator = readPackedByte() | 0x100;
 	_nodes = new byte [numnodes << 1];
-	_src->read(_nodes, numnodes << 1);
+	readPackedBlock(_nodes, numnodes << 1);
 
 	while ((c = getc2()) != terminator && (c >= 0) && !isFinished())
 		putByte(c);
@@ -625,6 +652,15 @@ void DecompressorLZW::reorderView(byte *src, byte *dest) {
 
 int DecompressorDCL::unpack(Common::ReadStream *src, byte *dest, uint32 nPacked,
                             uint32 nUnpacked) {
+	// Feed the DCL decoder from memory as well, see Decompressor::init().
+	byte *buf = (byte *)malloc(nPacked);
+	if (buf) {
+		uint32 bufSize = src->read(buf, nPacked);
+		Common::MemoryReadStream memStream(buf, bufSize);
+		bool success = Common::decompressDCL(&memStream, dest, bufSize, nUnpacked);
+		free(buf);
+		return success ? 0 : SCI_ERROR_DECOMPRESSION_ERROR;
+	}
 	return Common::decompressDCL(src, dest, nPacked, nUnpacked) ? 0 : SCI_ERROR_DECOMPRESSION_ERROR;
 }
 
@@ -702,8 +738,18 @@ uint32 DecompressorLZS::getCompLen() {
 void DecompressorLZS::copyComp(int offs, uint32 clen) {
 	int hpos = _dwWrote - offs;
 
-	while (clen--)
-		putByte(_dest[hpos++]);
+	if ((uint32)offs >= clen) {
+		// Non-overlapping history copy, which is by far the most common case
+		// for image data (e.g. Robot cels); let memcpy move the block instead
+		// of copying one byte per iteration.
+		memcpy(_dest + _dwWrote, _dest + hpos, clen);
+		_dwWrote += clen;
+	} else {
+		// The copy overlaps its own output and replicates a pattern, so it
+		// must be done bytewise.
+		while (clen--)
+			putByte(_dest[hpos++]);
+	}
 }
 
 #endif	// #ifdef ENABLE_SCI32
@@ -51,8 +51,10 @@ enum ResourceCompression {
  */
 class Decompressor {
 public:
-	Decompressor() {}
-	virtual ~Decompressor() {}
+	Decompressor() : _srcBuf(0) {}
+	virtual ~Decompressor() {
+		free(_srcBuf);
+	}
 
 
 	virtual int unpack(Common::ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked);
@@ -94,6 +96,17 @@ protected:
 	void fetchBitsMSB();
 	void fetchBitsLSB();
 
+	/**
+	 * Get one byte of packed data, from the prefetched block if there is
+	 * one and directly from _src otherwise.
+	 */
+	byte readPackedByte();
+
+	/**
+	 * Get a block of packed data, see readPackedByte().
+	 */
+	void readPackedBlock(byte *dst, uint32 size);
+
 	/**
 	 * Write one byte into _dest stream
 	 * @param b byte to put
@@ -117,6 +130,9 @@ protected:
 	uint32 _dwWrote;	///< number of bytes written to _dest
 	Common::ReadStream *_src;
 	byte *_dest;
+	byte *_srcBuf;		///< whole packed block prefetched from _src, NULL if allocation failed
+	uint32 _srcBufSize;	///< number of valid bytes in _srcBuf
+	uint32 _srcBufPos;	///< current read position in _srcBuf
 };
 
 /**
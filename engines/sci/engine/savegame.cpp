@@ -116,9 +116,14 @@ struct DefaultSyncer : Common::BinaryFunction<Common::Serializer, T, void> {
 	}
 };
 
-// Syncer for entries in a segment obj table
+// Syncer for entries in a segment obj table. Entry objects are restored
+// through the owning table's pool, matching how freeEntry() releases them.
 template<typename T>
 struct SegmentObjTableEntrySyncer : Common::BinaryFunction<Common::Serializer, typename T::Entry &, void> {
+	T &_table;
+
+	SegmentObjTableEntrySyncer(T &table) : _table(table) {}
+
 	void operator()(Common::Serializer &s, typename T::Entry &entry, int index) const {
 		s.syncAsSint32LE(entry.next_free);
 
@@ -134,7 +139,7 @@ struct SegmentObjTableEntrySyncer : Common::BinaryFunction<Common::Serializer, t
 
 		if (hasData) {
 			if (s.isLoading()) {
-				entry.data = new typename T::value_type;
+				entry.data = _table.allocData();
 			}
 			syncWithSerializer(s, *entry.data);
 		} else if (s.isLoading()) {
@@ -162,17 +167,21 @@ struct SegmentObjTableEntrySyncer : Common::BinaryFunction<Common::Serializer, t
  */
 template<typename T, class Syncer = DefaultSyncer<T> >
 struct ArraySyncer : Common::BinaryFunction<Common::Serializer, T, void> {
+	Syncer _sync;
+
+	ArraySyncer() : _sync() {}
+	ArraySyncer(const Syncer &sync) : _sync(sync) {}
+
 	void operator()(Common::Serializer &s, Common::Array<T> &arr) const {
 		uint len = arr.size();
 		s.syncAsUint32LE(len);
-		Syncer sync;
 
 		// Resize the array if loading.
 		if (s.isLoading())
 			arr.resize(len);
 
 		for (uint i = 0; i < len; ++i) {
-			sync(s, arr[i], i);
+			_sync(s, arr[i], i);
 		}
 	}
 };
@@ -185,8 +194,8 @@ void syncArray(Common::Serializer &s, Common::Array<T> &arr) {
 }
 
 template<typename T, class Syncer>
-void syncArray(Common::Serializer &s, Common::Array<T> &arr) {
-	ArraySyncer<T, Syncer> sync;
+void syncArray(Common::Serializer &s, Common::Array<T> &arr, const Syncer &syncer) {
+	ArraySyncer<T, Syncer> sync(syncer);
 	sync(s, arr);
 }
 
@@ -482,7 +491,7 @@ void sync_Table(Common::Serializer &s, T &obj) {
 	s.syncAsSint32LE(obj.first_free);
 	s.syncAsSint32LE(obj.entries_used);
 
-	syncArray<typename T::Entry, SegmentObjTableEntrySyncer<T> >(s, obj._table);
+	syncArray<typename T::Entry, SegmentObjTableEntrySyncer<T> >(s, obj._table, SegmentObjTableEntrySyncer<T>(obj));
 }
 
 void CloneTable::saveLoadWithSerializer(Common::Serializer &s) {
@@ -242,7 +242,7 @@ struct SegmentObjTable : public SegmentObj {
 	ArrayType _table;
 
 public:
-	SegmentObjTable(SegmentType type) : SegmentObj(type) {
+	SegmentObjTable(SegmentType type) : SegmentObj(type), _poolFree(nullptr), _slabFill(0) {
 		initTable();
 	}
 
@@ -252,6 +252,9 @@ public:
 				freeEntry(i);
 			}
 		}
+		for (uint i = 0; i < _slabs.size(); i++) {
+			free(_slabs[i]);
+		}
 	}
 
 	void initTable() {
@@ -268,12 +271,12 @@ public:
 
 			_table[oldff].next_free = oldff;
 			assert(_table[oldff].data == nullptr);
-			_table[oldff].data = new T;
+			_table[oldff].data = allocData();
 			return oldff;
 		} else {
 			uint newIdx = _table.size();
 			_table.push_back(Entry());
-			_table.back().data = new T;
+			_table.back().data = allocData();
 			_table[newIdx].next_free = newIdx;	// Tag as 'valid'
 			return newIdx;
 		}
@@ -292,7 +295,7 @@ public:
 			::error("Table::freeEntry: Attempt to release invalid table index %d", idx);
 
 		_table[idx].next_free = first_free;
-		delete _table[idx].data;
+		freeData(_table[idx].data);
 		_table[idx].data = nullptr;
 		first_free = idx;
 		entries_used--;
@@ -313,6 +316,46 @@ public:
 
 	T &operator[](uint index) { return at(index); }
 	const T &operator[](uint index) const { return at(index); }
+
+	/**
+	 * Number of bytes held by the entry pool, for the segment info console
+	 * command.
+	 */
+	uint poolSize() const { return _slabs.size() * POOL_SLAB_ENTRIES * sizeof(T); }
+
+	// Entry objects are carved out of slabs and recycled through a free
+	// list, so that the alloc/free churn of short-lived clones, lists and
+	// nodes does not go through the heap once the pool has warmed up. The
+	// first bytes of a free block store the link to the next one; every
+	// entry type is larger than a pointer. allocData() is public because
+	// the save state syncer restores entry objects directly.
+
+	T *allocData() {
+		if (_poolFree) {
+			void *mem = _poolFree;
+			_poolFree = *(void **)mem;
+			return new (mem) T();
+		}
+		if (_slabs.empty() || _slabFill == POOL_SLAB_ENTRIES) {
+			_slabs.push_back((byte *)malloc(POOL_SLAB_ENTRIES * sizeof(T)));
+			assert(_slabs.back());
+			_slabFill = 0;
+		}
+		return new (_slabs.back() + _slabFill++ * sizeof(T)) T();
+	}
+
+	void freeData(T *data) {
+		data->~T();
+		*(void **)data = _poolFree;
+		_poolFree = data;
+	}
+
+private:
+	enum { POOL_SLAB_ENTRIES = 64 };
+
+	Common::Array<byte *> _slabs;
+	void *_poolFree;	///< Head of the free block list
+	uint _slabFill;		///< Number of blocks used in the newest slab
 };
 
 
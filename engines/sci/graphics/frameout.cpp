@@ -401,14 +401,21 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 		robotPlayer.doRobot();
 	}
 
-	// SSCI allocated these as static arrays of 100 pointers to
-	// ScreenItemList / RectList
-	ScreenItemListList screenItemLists;
-	EraseListList eraseLists;
+	// These lists are members so the arrays are not rebuilt on every
+	// frame; the per-plane lists are emptied before use instead
+	ScreenItemListList &screenItemLists = _screenItemLists;
+	EraseListList &eraseLists = _eraseLists;
 
 	screenItemLists.resize(_planes.size());
 	eraseLists.resize(_planes.size());
 
+	for (ScreenItemListList::iterator list = screenItemLists.begin(); list != screenItemLists.end(); ++list) {
+		list->clear();
+	}
+	for (EraseListList::iterator list = eraseLists.begin(); list != eraseLists.end(); ++list) {
+		list->clear();
+	}
+
 	if (g_sci->_gfxRemap32->getRemapCount() > 0 && _remapOccurred) {
 		remapMarkRedraw();
 	}
@@ -322,6 +322,17 @@ private:
 	 */
 	RectList _showList;
 
+	/**
+	 * Per-plane draw and erase lists, used by `frameOut` and reused across
+	 * frames to avoid rebuilding the arrays of fixed-size lists once per
+	 * frame.
+	 *
+	 * @note SSCI allocated these as static arrays of 100 pointers to
+	 * ScreenItemList / RectList.
+	 */
+	ScreenItemListList _screenItemLists;
+	EraseListList _eraseLists;
+
 	/**
 	 * The amount of extra overdraw that is acceptable when merging two show
 	 * list rectangles together into a single larger rectangle.
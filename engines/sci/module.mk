@@ -66,6 +66,7 @@ MODULE_OBJS := \
 	parser/said.o \
 	parser/vocabulary.o \
 	sound/audio.o \
+	sound/decoders/sol.o \
 	sound/midiparser_sci.o \
 	sound/music.o \
 	sound/soundcmd.o \
@@ -96,7 +97,6 @@ MODULE_OBJS += \
 	graphics/video32.o \
 	graphics/cursor32.o \
 	sound/audio32.o \
-	sound/decoders/sol.o \
 	video/robot_decoder.o
 endif
 
@@ -24,6 +24,7 @@
 #include "sci/engine/kernel.h"
 #include "sci/engine/seg_manager.h"
 #include "sci/sound/audio.h"
+#include "sci/sound/decoders/sol.h"
 
 #include "backends/audiocd/audiocd.h"
 
@@ -395,11 +396,37 @@ Audio::RewindableAudioStream *AudioPlayer::getAudioStream(uint32 number, uint32
 		if ((audioRes->getUint8At(0) & 0x7f) == kResourceTypeAudio && audioRes->getUint32BEAt(2) == MKTAG('S','O','L',0)) {
 			// SCI1.1
 			const uint8 headerSize = audioRes->getUint8At(1);
-			Common::MemoryReadStream headerStream = audioRes->subspan(kResourceHeaderSize, headerSize).toStream();
 
-			if (readSOLHeader(&headerStream, headerSize, size, _audioRate, audioFlags, audioRes->size())) {
-				Common::MemoryReadStream dataStream(audioRes->subspan(kResourceHeaderSize + headerSize).toStream());
-				data = readSOLAudio(&dataStream, size, audioFlags, flags);
+			if ((headerSize == 11 || headerSize == 12) && (audioRes->getUint8At(8) & kSolFlagCompressed)) {
+				// Compressed SOL audio is decoded in fixed blocks from the
+				// mixer thread, instead of being decompressed completely up
+				// front. Speech resources in talkie games are several
+				// megabytes in size, and the upfront decode delayed the
+				// start of playback noticeably. The compressed data has to
+				// be copied into our own buffer, because the resource is not
+				// locked and ResourceManager may free it at any time. The
+				// QFG3 demo format (header size 7) has no data size field,
+				// which makeSOLStream() requires, so it keeps using the old
+				// path below.
+				_audioRate = audioRes->getUint16LEAt(6);
+
+				byte *solBuffer = (byte *)malloc(audioRes->size());
+				assert(solBuffer);
+				audioRes->unsafeCopyDataTo(solBuffer);
+				Common::SeekableReadStream *solStream = new Common::MemoryReadStream(solBuffer, audioRes->size(), DisposeAfterUse::YES);
+
+				audioSeekStream = makeSOLStream(solStream, DisposeAfterUse::YES);
+				if (!audioSeekStream) {
+					warning("Failed to create SOL audio stream for audio entry %i", number);
+					delete solStream;
+				}
+			} else {
+				Common::MemoryReadStream headerStream = audioRes->subspan(kResourceHeaderSize, headerSize).toStream();
+
+				if (readSOLHeader(&headerStream, headerSize, size, _audioRate, audioFlags, audioRes->size())) {
+					Common::MemoryReadStream dataStream(audioRes->subspan(kResourceHeaderSize + headerSize).toStream());
+					data = readSOLAudio(&dataStream, size, audioFlags, flags);
+				}
 			}
 		} else if (audioRes->size() > 4 && audioRes->getUint32BEAt(0) == MKTAG('R','I','F','F')) {
 			// WAVE detected
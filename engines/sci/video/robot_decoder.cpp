@@ -463,7 +463,6 @@ void RobotDecoder::initVideo(const int16 x, const int16 y, const int16 scale, co
 	// Fixed cel buffers are for version 5 and newer
 	_fixedCels.reserve(MIN(_maxCelsPerFrame, (int16)kFixedCelListSize));
 	_celDecompressionBuffer.reserve(_maxCelArea[0] + SciBitmap::getBitmapHeaderSize() + kRawPaletteSize);
-	_celDecompressionArea = _maxCelArea[0];
 }
 
 void RobotDecoder::initRecordAndCuePositions() {
@@ -1506,8 +1505,11 @@ uint32 RobotDecoder::createCel5(const byte *rawVideoData, const int16 screenItem
 		// direct copy to bitmap
 		targetBuffer = bitmap.getPixels();
 	} else {
-		// go through squashed cel decompressor
-		_celDecompressionBuffer.resize(_celDecompressionArea >= celWidth * (celHeight * _verticalScaleFactor / 100));
+		// go through squashed cel decompressor. The buffer was already grown
+		// to the largest cel area of the frame in preallocateCelMemory();
+		// resizing it here again would reinitialize the scratch memory on
+		// every squashed cel.
+		assert(_celDecompressionBuffer.size() >= (uint)(celWidth * (celHeight * _verticalScaleFactor / 100)));
 		targetBuffer = _celDecompressionBuffer.begin();
 	}
 
@@ -1303,11 +1303,6 @@ private:
 	 */
 	ScratchMemory _celDecompressionBuffer;
 
-	/**
-	 * The size, in bytes, of the squashed cel decompression buffer.
-	 */
-	int _celDecompressionArea;
-
 	/**
 	 * If true, the robot just started playing and is awaiting output for the
 	 * first frame.
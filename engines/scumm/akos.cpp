@@ -348,6 +348,7 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	_codec = READ_LE_UINT16(&akhd->codec);
 	akct = _vm->findResourceData(MKTAG('A','K','C','T'), akos);
 	rgbs = _vm->findResourceData(MKTAG('R','G','B','S'), akos);
+	_costumeID = costume;
 
 	xmap = 0;
 	if (shadow) {
@@ -1145,6 +1146,69 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
+// Byte budget for the decoded cel cache. Enough for the cels of a handful
+// of on-screen actors, without letting the cache grow without bound.
+#define AKOS16_CEL_CACHE_BUDGET (512 * 1024)
+
+void AkosRenderer::clearCelCache() {
+	for (CelCacheMap::iterator it = _celCache.begin(); it != _celCache.end(); ++it)
+		free(it->_value.data);
+	_celCache.clear();
+	_celCacheSize = 0;
+}
+
+const byte *AkosRenderer::akos16CacheCel(const byte *src) {
+	const uint32 size = _width * _height;
+	if (size == 0 || size > AKOS16_CEL_CACHE_BUDGET / 4)
+		return 0;
+
+	const uint32 key = src - akcd;
+
+	CelCacheMap::iterator it = _celCache.find(key);
+	if (it != _celCache.end()) {
+		if (it->_value.costume == _costumeID && it->_value.size == size) {
+			it->_value.stamp = ++_celCacheStamp;
+			return it->_value.data;
+		}
+		// Same offset, different costume; drop the stale entry.
+		_celCacheSize -= it->_value.size;
+		free(it->_value.data);
+		_celCache.erase(key);
+	}
+
+	// Make room for the new cel by evicting the oldest entries first.
+	while (_celCacheSize + size > AKOS16_CEL_CACHE_BUDGET && !_celCache.empty()) {
+		CelCacheMap::iterator oldest = _celCache.begin();
+		for (CelCacheMap::iterator i = _celCache.begin(); i != _celCache.end(); ++i) {
+			if (i->_value.stamp < oldest->_value.stamp)
+				oldest = i;
+		}
+		_celCacheSize -= oldest->_value.size;
+		free(oldest->_value.data);
+		_celCache.erase(oldest->_key);
+	}
+
+	byte *data = (byte *)malloc(size);
+	if (!data)
+		return 0;
+
+	// Decoding the whole cel row by row consumes the bit stream exactly
+	// like the skip/decode/skip sequence in akos16Decompress does, so the
+	// cached bytes match what a clipped decode would have produced.
+	akos16SetupBitReader(src);
+	for (int i = 0; i < _height; i++)
+		akos16DecodeLine(data + i * _width, _width, 1);
+
+	CelCacheEntry entry;
+	entry.costume = _costumeID;
+	entry.size = size;
+	entry.stamp = ++_celCacheStamp;
+	entry.data = data;
+	_celCache[key] = entry;
+	_celCacheSize += size;
+	return data;
+}
+
 void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
 	byte *tmp_buf = _akos16.buffer;
@@ -1157,10 +1221,20 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 		tmp_buf += (t_width - 1);
 	}
 
-	akos16SetupBitReader(src);
+	// The skip counts address the cel as one serial pixel stream:
+	// numskip_before is the top clip plus the left clip of the first row,
+	// and numskip_after covers the right clip of one row plus the left
+	// clip of the next. With a cached cel that simply means starting at
+	// the clipped column and stepping one full cel width per output row.
+	const byte *celPtr = akos16CacheCel(src);
+	if (celPtr) {
+		celPtr += numskip_before;
+	} else {
+		akos16SetupBitReader(src);
 
-	if (numskip_before != 0) {
-		akos16SkipData(numskip_before);
+		if (numskip_before != 0) {
+			akos16SkipData(numskip_before);
+		}
 	}
 
 	maskpitch = _numStrips;
@@ -1170,12 +1244,21 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
-		akos16DecodeLine(tmp_buf, t_width, dir);
+		if (celPtr) {
+			byte *buf = tmp_buf;
+			for (int32 i = 0; i < t_width; i++) {
+				*buf = celPtr[i];
+				buf += dir;
+			}
+			celPtr += _width;
+		} else {
+			akos16DecodeLine(tmp_buf, t_width, dir);
+		}
 		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
 
-		if (numskip_after != 0)	{
+		if (!celPtr && numskip_after != 0) {
 			akos16SkipData(numskip_after);
 		}
 		dest += pitch;
@@ -23,6 +23,7 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/hashmap.h"
 #include "scumm/base-costume.h"
 
 namespace Scumm {
@@ -85,6 +86,23 @@ protected:
 		byte buffer[336];
 	} _akos16;
 
+	// Cache of decoded codec 16 cels, so that an actor which keeps
+	// showing the same cel costs a row copy per line instead of a full
+	// bit stream decode. The cached bytes are palette indices before any
+	// masking or shadow processing, hence entries do not depend on the
+	// current actor palette or on the mirror flag.
+	struct CelCacheEntry {
+		uint16 costume;
+		uint32 size;
+		uint32 stamp;
+		byte *data;
+	};
+	typedef Common::HashMap<uint32, CelCacheEntry> CelCacheMap;
+	CelCacheMap _celCache;
+	uint32 _celCacheSize;
+	uint32 _celCacheStamp;
+	uint16 _costumeID;
+
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
 		_useBompPalette = false;
@@ -98,6 +116,12 @@ public:
 		rgbs = 0;
 		xmap = 0;
 		_actorHitMode = false;
+		_celCacheSize = 0;
+		_celCacheStamp = 0;
+		_costumeID = 0;
+	}
+	virtual ~AkosRenderer() {
+		clearCelCache();
 	}
 
 	bool _actorHitMode;
@@ -119,6 +143,8 @@ protected:
 	void akos16SetupBitReader(const byte *src);
 	void akos16SkipData(int32 numskip);
 	void akos16DecodeLine(byte *buf, int32 numbytes, int32 dir);
+	const byte *akos16CacheCel(const byte *src);
+	void clearCelCache();
 	void akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
 
 	void markRectAsDirty(Common::Rect rect);
@@ -716,7 +716,6 @@ byte *ScummEngine::getBoxConnectionBase(int box) {
  */
 int ScummEngine::getNextBox(byte from, byte to) {
 	const byte *boxm;
-	byte i;
 	const int numOfBoxes = getNumBoxes();
 	int dest = -1;
 
@@ -773,13 +772,30 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	if ((_game.id == GID_INDY3) && _roomResource == 46 && from == 1 && to == 0)
 		return 0;
 
-	// Skip up to the matrix data for box 'from'
-	for (i = 0; i < from && boxm < end; i++) {
-		while (boxm < end && *boxm != 0xFF)
-			boxm += 3;
-		boxm++;
+	// Seek to the matrix data for box 'from'. The row offsets are cached,
+	// as this lookup runs for every walking actor on every step and the
+	// matrix only changes when the room (or its box matrix) is replaced.
+	if (!_boxMatrixRowIndexValid) {
+		const byte *p = boxm;
+		uint row = 0;
+
+		for (; row < ARRAYSIZE(_boxMatrixRowIndex) && p < end; row++) {
+			_boxMatrixRowIndex[row] = p - boxm;
+			while (p < end && *p != 0xFF)
+				p += 3;
+			p++;
+		}
+
+		// Rows beyond the end of a (possibly truncated, see above) matrix
+		// point at its end, so searching them fails like it used to.
+		for (; row < ARRAYSIZE(_boxMatrixRowIndex); row++)
+			_boxMatrixRowIndex[row] = end - boxm;
+
+		_boxMatrixRowIndexValid = true;
 	}
 
+	boxm += _boxMatrixRowIndex[from];
+
 	// Now search for the entry for box 'to'
 	while (boxm < end && boxm[0] != 0xFF) {
 		if (boxm[0] <= to && to <= boxm[1])
@@ -1071,6 +1087,8 @@ void ScummEngine::createBoxMatrix() {
 	printMatrix(getBoxMatrixBaseAddr(), num);
 #endif
 
+	_boxMatrixRowIndexValid = false;
+
 	free(itineraryMatrix);
 }
 
@@ -654,6 +654,7 @@ void CharsetRendererV3::printChar(int chr, bool ignoreCharsetMask) {
 	if (!ignoreCharsetMask) {
 		_hasMask = true;
 		_textScreenID = vs->number;
+		extendTextArea(Common::Rect(_left, _top, _left + width, _top + height));
 	}
 
 	if ((ignoreCharsetMask || !vs->hasTwoBuffers)
@@ -784,6 +785,7 @@ void CharsetRendererClassic::printChar(int chr, bool ignoreCharsetMask) {
 	if (!ignoreCharsetMask || (_vm->_game.platform == Common::kPlatformFMTowns && vs->number == kMainVirtScreen)) {
 		_hasMask = true;
 		_textScreenID = vs->number;
+		extendTextArea(Common::Rect(_left, _top, _left + _width, _top + _height));
 	}
 
 	// We need to know the virtual screen we draw on for Indy 4 Amiga, since
@@ -1288,6 +1290,7 @@ void CharsetRendererNut::printChar(int chr, bool ignoreCharsetMask) {
 	if (!ignoreCharsetMask) {
 		_hasMask = true;
 		_textScreenID = kMainVirtScreen;
+		extendTextArea(shadow);
 	}
 
 	int drawTop = _top;
@@ -1364,6 +1367,7 @@ void CharsetRendererNES::printChar(int chr, bool ignoreCharsetMask) {
 	if (!ignoreCharsetMask) {
 		_hasMask = true;
 		_textScreenID = vs->number;
+		extendTextArea(Common::Rect(_left, _top, _left + width, _top + height));
 	}
 
 	if (ignoreCharsetMask || !vs->hasTwoBuffers)
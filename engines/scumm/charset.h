@@ -61,6 +61,13 @@ public:
 	bool _hasMask;	// True if "removable" text is visible somewhere (should be called _hasText or so)
 	VirtScreenNumber _textScreenID;	// ID of the virtual screen on which the text is visible.
 
+	// Union of the screen areas covered by "removable" text since the last
+	// restoreCharsetBg() call. Unlike _str, which only spans the string
+	// currently being drawn, this accumulates until the text is removed
+	// again, so the restore code only has to touch this area instead of
+	// invalidating the whole virtual screen.
+	Common::Rect _textArea;
+
 	bool _blitAlso;
 	bool _firstChar;
 	bool _disableOffsX;
@@ -89,6 +96,13 @@ public:
 
 	virtual void setColor(byte color) { _color = color; translateColor(); }
 
+	void extendTextArea(const Common::Rect &r) {
+		if (_textArea.isEmpty())
+			_textArea = r;
+		else
+			_textArea.extend(r);
+	}
+
 	void saveLoadWithSerializer(Serializer *ser);
 };
 
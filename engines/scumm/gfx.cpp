@@ -1101,27 +1101,61 @@ void ScummEngine::restoreCharsetBg() {
 		// currently covered by the charset mask.
 
 		VirtScreen *vs = &_virtscr[_charset->_textScreenID];
-		if (!vs->h)
+
+		// Only the area which actually had text drawn onto it needs to be
+		// restored; invalidating the whole virtual screen here forced a
+		// complete screen update for every line of dialogue.
+		Common::Rect rect = _charset->_textArea;
+		_charset->_textArea = Common::Rect();
+
+		if (!vs->h || rect.isEmpty())
+			return;
+
+		// Convert 'rect' to local (virtual screen) coordinates
+		rect.top -= vs->topline;
+		rect.bottom -= vs->topline;
+
+		rect.clip(vs->w, vs->h);
+
+		const int height = rect.height();
+		const int width = rect.width();
+
+		if (!height || !width)
 			return;
 
-		markRectAsDirty(vs->number, Common::Rect(vs->w, vs->h), USAGE_BIT_RESTORED);
+		markRectAsDirty(vs->number, rect, USAGE_BIT_RESTORED);
 
-		byte *screenBuf = vs->getPixels(0, 0);
+		byte *screenBuf = vs->getPixels(rect.left, rect.top);
 
 		if (vs->hasTwoBuffers && _currentRoom != 0 && isLightOn()) {
 			if (vs->number != kMainVirtScreen) {
 				// Restore from back buffer
-				const byte *backBuf = vs->getBackPixels(0, 0);
-				blit(screenBuf, vs->pitch, backBuf, vs->pitch, vs->w, vs->h, vs->format.bytesPerPixel);
+				const byte *backBuf = vs->getBackPixels(rect.left, rect.top);
+				blit(screenBuf, vs->pitch, backBuf, vs->pitch, width, height, vs->format.bytesPerPixel);
 			}
 		} else {
 			// Clear area
-			memset(screenBuf, 0, vs->h * vs->pitch);
+			fill(screenBuf, vs->pitch, 0, width, height, vs->format.bytesPerPixel);
 		}
 
 		if (vs->hasTwoBuffers) {
 			// Clean out the charset mask
-			clearTextSurface();
+#ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
+			if (_game.platform == Common::kPlatformFMTowns) {
+				if (_townsScreen)
+					_townsScreen->fillLayerRect(1, rect.left * _textSurfaceMultiplier, (rect.top + vs->topline) * _textSurfaceMultiplier, width * _textSurfaceMultiplier, height * _textSurfaceMultiplier, 0);
+				byte *mask = (byte *)_textSurface.getBasePtr(rect.left * _textSurfaceMultiplier, (rect.top + vs->topline) * _textSurfaceMultiplier);
+				fill(mask, _textSurface.pitch, 0, width * _textSurfaceMultiplier, height * _textSurfaceMultiplier, _textSurface.format.bytesPerPixel);
+			} else
+#endif
+			{
+				Common::Rect maskRect(rect.left, rect.top - _screenTop, rect.right, rect.bottom - _screenTop);
+				maskRect.clip(_textSurface.w / _textSurfaceMultiplier, _textSurface.h / _textSurfaceMultiplier);
+				if (maskRect.height() > 0 && maskRect.width() > 0) {
+					byte *mask = (byte *)_textSurface.getBasePtr(maskRect.left, maskRect.top);
+					fill(mask, _textSurface.pitch, CHARSET_MASK_TRANSPARENCY, maskRect.width() * _textSurfaceMultiplier, maskRect.height() * _textSurfaceMultiplier, _textSurface.format.bytesPerPixel);
+				}
+			}
 		}
 	}
 }
@@ -2114,14 +2148,14 @@ void Gdi::drawBMAPBg(const byte *ptr, VirtScreen *vs) {
 	case 136:
 	case 137:
 	case 138:
-		drawStripHE(dst, vs->pitch, bmap_ptr, vs->w, vs->h, false);
+		drawStripHE<false>(dst, vs->pitch, bmap_ptr, vs->w, vs->h);
 		break;
 	case 144:
 	case 145:
 	case 146:
 	case 147:
 	case 148:
-		drawStripHE(dst, vs->pitch, bmap_ptr, vs->w, vs->h, true);
+		drawStripHE<true>(dst, vs->pitch, bmap_ptr, vs->w, vs->h);
 		break;
 	case 150:
 		fill(dst, vs->pitch, *bmap_ptr, vs->w, vs->h, vs->format.bytesPerPixel);
@@ -2298,7 +2332,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 
 	switch (code) {
 	case 1:
-		drawStripRaw(dst, dstPitch, src, numLinesToProcess, false);
+		drawStripRaw<false>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 2:
@@ -2320,11 +2354,11 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 8:
 		// Used in 3DO versions of HE games
 		transpStrip = true;
-		drawStrip3DO(dst, dstPitch, src, numLinesToProcess, true);
+		drawStrip3DO<true>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 9:
-		drawStrip3DO(dst, dstPitch, src, numLinesToProcess, false);
+		drawStrip3DO<false>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 10:
@@ -2337,7 +2371,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 16:
 	case 17:
 	case 18:
-		drawStripBasicV(dst, dstPitch, src, numLinesToProcess, false);
+		drawStripBasicV<false>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 24:
@@ -2345,7 +2379,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 26:
 	case 27:
 	case 28:
-		drawStripBasicH(dst, dstPitch, src, numLinesToProcess, false);
+		drawStripBasicH<false>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 34:
@@ -2354,7 +2388,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 37:
 	case 38:
 		transpStrip = true;
-		drawStripBasicV(dst, dstPitch, src, numLinesToProcess, true);
+		drawStripBasicV<true>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 44:
@@ -2363,7 +2397,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 47:
 	case 48:
 		transpStrip = true;
-		drawStripBasicH(dst, dstPitch, src, numLinesToProcess, true);
+		drawStripBasicH<true>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 64:
@@ -2376,7 +2410,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 106:
 	case 107:
 	case 108:
-		drawStripComplex(dst, dstPitch, src, numLinesToProcess, false);
+		drawStripComplex<false>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 84:
@@ -2390,7 +2424,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 127:
 	case 128:
 		transpStrip = true;
-		drawStripComplex(dst, dstPitch, src, numLinesToProcess, true);
+		drawStripComplex<true>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	case 134:
@@ -2398,7 +2432,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 136:
 	case 137:
 	case 138:
-		drawStripHE(dst, dstPitch, src, 8, numLinesToProcess, false);
+		drawStripHE<false>(dst, dstPitch, src, 8, numLinesToProcess);
 		break;
 
 	case 143: // Triggered by Russian water
@@ -2408,11 +2442,11 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 	case 147:
 	case 148:
 		transpStrip = true;
-		drawStripHE(dst, dstPitch, src, 8, numLinesToProcess, true);
+		drawStripHE<true>(dst, dstPitch, src, 8, numLinesToProcess);
 		break;
 
 	case 149:
-		drawStripRaw(dst, dstPitch, src, numLinesToProcess, true);
+		drawStripRaw<true>(dst, dstPitch, src, numLinesToProcess);
 		break;
 
 	default:
@@ -3330,7 +3364,8 @@ void Gdi::drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) con
 	} while (0)
 
 // NOTE: drawStripHE is actually very similar to drawStripComplex
-void Gdi::drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height, const bool transpCheck) const {
+template<bool transpCheck>
+void Gdi::drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height) const {
 	static const int delta_color[] = { -4, -3, -2, -1, 1, 2, 3, 4 };
 	uint32 dataBit, data;
 	byte color;
@@ -3376,7 +3411,8 @@ void Gdi::drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int h
 #undef FILL_BITS
 
 
-void Gdi::drawStrip3DO(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const {
+template<bool transpCheck>
+void Gdi::drawStrip3DO(byte *dst, int dstPitch, const byte *src, int height) const {
 	if (height == 0)
 		return;
 
@@ -3421,7 +3457,8 @@ void Gdi::drawStrip3DO(byte *dst, int dstPitch, const byte *src, int height, con
 		}                           \
 	} while (0)
 
-void Gdi::drawStripComplex(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const {
+template<bool transpCheck>
+void Gdi::drawStripComplex(byte *dst, int dstPitch, const byte *src, int height) const {
 	byte color = *src++;
 	uint bits = *src++;
 	byte cl = 8;
@@ -3473,7 +3510,8 @@ void Gdi::drawStripComplex(byte *dst, int dstPitch, const byte *src, int height,
 	} while (--height);
 }
 
-void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const {
+template<bool transpCheck>
+void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height) const {
 	byte color = *src++;
 	uint bits = *src++;
 	byte cl = 8;
@@ -3505,7 +3543,8 @@ void Gdi::drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height,
 	} while (--height);
 }
 
-void Gdi::drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const {
+template<bool transpCheck>
+void Gdi::drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height) const {
 	byte color = *src++;
 	uint bits = *src++;
 	byte cl = 8;
@@ -3571,7 +3610,8 @@ void Gdi::drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height,
 			}                              \
 		} while (0)
 
-void Gdi::drawStripRaw(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const {
+template<bool transpCheck>
+void Gdi::drawStripRaw(byte *dst, int dstPitch, const byte *src, int height) const {
 	int x;
 
 	if (_vm->_game.features & GF_OLD256) {
@@ -211,18 +211,27 @@ protected:
 
 	void drawStripEGA(byte *dst, int dstPitch, const byte *src, int height) const;
 
-	void drawStripComplex(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const;
-	void drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const;
-	void drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const;
-
-	void drawStripRaw(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const;
+	// The decoders below are templated on the transparency check so the
+	// compiler emits a specialized copy of each inner loop per variant,
+	// instead of testing the flag again for every single pixel.
+	template<bool transpCheck>
+	void drawStripComplex(byte *dst, int dstPitch, const byte *src, int height) const;
+	template<bool transpCheck>
+	void drawStripBasicH(byte *dst, int dstPitch, const byte *src, int height) const;
+	template<bool transpCheck>
+	void drawStripBasicV(byte *dst, int dstPitch, const byte *src, int height) const;
+
+	template<bool transpCheck>
+	void drawStripRaw(byte *dst, int dstPitch, const byte *src, int height) const;
 	void unkDecode8(byte *dst, int dstPitch, const byte *src, int height) const;
 	void unkDecode9(byte *dst, int dstPitch, const byte *src, int height) const;
 	void unkDecode10(byte *dst, int dstPitch, const byte *src, int height) const;
 	void unkDecode11(byte *dst, int dstPitch, const byte *src, int height) const;
-	void drawStrip3DO(byte *dst, int dstPitch, const byte *src, int height, const bool transpCheck) const;
+	template<bool transpCheck>
+	void drawStrip3DO(byte *dst, int dstPitch, const byte *src, int height) const;
 
-	void drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height, const bool transpCheck) const;
+	template<bool transpCheck>
+	void drawStripHE(byte *dst, int dstPitch, const byte *src, int width, int height) const;
 	virtual void writeRoomColor(byte *dst, byte color) const;
 
 	/* Mask decompressors */
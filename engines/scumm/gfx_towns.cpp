@@ -117,6 +117,7 @@ void ScummEngine::towns_restoreCharsetBg() {
 		restoreBackground(_curStringRect, 0);
 		_curStringRect.left = -1;
 		_charset->_hasMask = false;
+		_charset->_textArea = Common::Rect();
 		_nextLeft = _string[0].xpos;
 	}
 
@@ -39,6 +39,7 @@ Sprite::Sprite(ScummEngine_v90he *vm)
 	_spriteGroups(0),
 	_spriteTable(0),
 	_activeSpritesTable(0),
+	_sortSpritesTable(0),
 	_numSpritesToProcess(0),
 	_varNumSpriteGroups(0),
 	_varNumSprites(0),
@@ -49,6 +50,7 @@ Sprite::~Sprite() {
 	free(_spriteGroups);
 	free(_spriteTable);
 	free(_activeSpritesTable);
+	free(_sortSpritesTable);
 }
 
 void ScummEngine_v90he::allocateArrays() {
@@ -1066,6 +1068,7 @@ void Sprite::allocTables(int numSprites, int numGroups, int numMaxSprites) {
 	_spriteGroups = (SpriteGroup *)malloc((_varNumSpriteGroups + 1) * sizeof(SpriteGroup));
 	_spriteTable = (SpriteInfo *)malloc((_varNumSprites + 1) * sizeof(SpriteInfo));
 	_activeSpritesTable = (SpriteInfo **)malloc((_varNumSprites + 1) * sizeof(SpriteInfo *));
+	_sortSpritesTable = (SpriteInfo **)malloc((_varNumSprites + 1) * sizeof(SpriteInfo *));
 }
 
 void Sprite::resetGroup(int spriteGroupId) {
@@ -1199,6 +1202,10 @@ void Sprite::updateImages() {
 	}
 }
 
+// Maximum zorder spread handled by the bucket sort in sortActiveSprites().
+// Wider (degenerate) spreads fall back to qsort.
+static const int32 kSpriteZorderBuckets = 2048;
+
 static int compareSprTable(const void *a, const void *b) {
 	const SpriteInfo *spr1 = *(const SpriteInfo *const*)a;
 	const SpriteInfo *spr2 = *(const SpriteInfo *const*)b;
@@ -1209,11 +1216,20 @@ static int compareSprTable(const void *a, const void *b) {
 	if (spr1->zorder < spr2->zorder)
 		return -1;
 
+	// Break ties by sprite id, so that the qsort fallback yields the same
+	// (stable) order as the bucket sort path.
+	if (spr1->id > spr2->id)
+		return 1;
+
+	if (spr1->id < spr2->id)
+		return -1;
+
 	return 0;
 }
 
 void Sprite::sortActiveSprites() {
 	int groupZorder;
+	int32 minZorder = 0, maxZorder = 0;
 
 	_numSpritesToProcess = 0;
 
@@ -1237,6 +1253,15 @@ void Sprite::sortActiveSprites() {
 			spi->id = i;
 			spi->zorder = spi->priority + groupZorder;
 
+			if (_numSpritesToProcess == 0) {
+				minZorder = maxZorder = spi->zorder;
+			} else {
+				if (spi->zorder < minZorder)
+					minZorder = spi->zorder;
+				if (spi->zorder > maxZorder)
+					maxZorder = spi->zorder;
+			}
+
 			_activeSpritesTable[_numSpritesToProcess++] = spi;
 		}
 	}
@@ -1244,7 +1269,33 @@ void Sprite::sortActiveSprites() {
 	if (_numSpritesToProcess < 2)
 		return;
 
-	qsort(_activeSpritesTable, _numSpritesToProcess, sizeof(SpriteInfo *), compareSprTable);
+	// Sprite priorities cover a small range in practice, so a stable two
+	// pass bucket sort is cheaper than qsort in sprite heavy scenes and
+	// keeps equal priority sprites in table order between frames.
+	const int32 range = maxZorder - minZorder + 1;
+	if (range <= kSpriteZorderBuckets) {
+		int32 buckets[kSpriteZorderBuckets];
+		memset(buckets, 0, range * sizeof(buckets[0]));
+
+		for (int i = 0; i < _numSpritesToProcess; i++)
+			buckets[_activeSpritesTable[i]->zorder - minZorder]++;
+
+		int32 pos = 0;
+		for (int32 i = 0; i < range; i++) {
+			int32 count = buckets[i];
+			buckets[i] = pos;
+			pos += count;
+		}
+
+		for (int i = 0; i < _numSpritesToProcess; i++) {
+			SpriteInfo *spi = _activeSpritesTable[i];
+			_sortSpritesTable[buckets[spi->zorder - minZorder]++] = spi;
+		}
+
+		memcpy(_activeSpritesTable, _sortSpritesTable, _numSpritesToProcess * sizeof(SpriteInfo *));
+	} else {
+		qsort(_activeSpritesTable, _numSpritesToProcess, sizeof(SpriteInfo *), compareSprTable);
+	}
 }
 
 void Sprite::processImages(bool arg) {
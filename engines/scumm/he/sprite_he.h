@@ -106,6 +106,7 @@ public:
 	SpriteInfo *_spriteTable;
 	SpriteGroup *_spriteGroups;
 	SpriteInfo **_activeSpritesTable;
+	SpriteInfo **_sortSpritesTable;
 
 	int32 _numSpritesToProcess;
 	int32 _varNumSpriteGroups;
@@ -64,6 +64,7 @@ IMuseInternal::IMuseInternal() :
 	_music_volume(0),
 	_trigger_count(0),
 	_snm_trigger_index(0),
+	_deferredCommandsPending(0),
 	_pcSpeaker(false) {
 	memset(_channel_volume, 0, sizeof(_channel_volume));
 	memset(_channel_volume_eff, 0, sizeof(_channel_volume_eff));
@@ -1636,6 +1637,11 @@ void IMuseInternal::init_queue() {
 }
 
 void IMuseInternal::handleDeferredCommands(MidiDriver *midi) {
+	// Deferred commands are rare; don't bother scanning the table on
+	// every timer tick when none are pending.
+	if (!_deferredCommandsPending)
+		return;
+
 	uint32 advance = midi->getBaseTempo();
 
 	DeferredCommand *ptr = &_deferredCommands[0];
@@ -1648,6 +1654,8 @@ void IMuseInternal::handleDeferredCommands(MidiDriver *midi) {
 			ptr->time_left = advance;
 		}
 		ptr->time_left -= advance;
+		if (!ptr->time_left)
+			_deferredCommandsPending--;
 	}
 }
 
@@ -1670,6 +1678,7 @@ void IMuseInternal::addDeferredCommand(int time, int a, int b, int c, int d, int
 		ptr->d = d;
 		ptr->e = e;
 		ptr->f = f;
+		_deferredCommandsPending++;
 	}
 }
 
@@ -439,6 +439,7 @@ protected:
 	Instrument _global_instruments[32];
 	CommandQueue _cmd_queue[64];
 	DeferredCommand _deferredCommands[4];
+	uint8 _deferredCommandsPending; // Number of _deferredCommands slots in use
 
 protected:
 	IMuseInternal();
@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/config-manager.h"
 #include "common/system.h"
 #include "common/timer.h"
 
@@ -52,6 +53,21 @@ IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, Audio::Mixer *mixer, int fps)
 	_sound = new ImuseDigiSndMgr(_vm);
 	assert(_sound);
 	_callbackFps = fps;
+
+	// Amount of audio to keep queued ahead of the mixer, so that a slow
+	// disk read or bundle decompression does not run a channel dry in the
+	// middle of a music transition. Expressed in callback ticks; the
+	// optional config key gives the prebuffer length in milliseconds.
+	int prebufferMs = 200;
+	if (ConfMan.hasKey("dimuse_prebuffer")) {
+		prebufferMs = ConfMan.getInt("dimuse_prebuffer");
+		if (prebufferMs < 0 || prebufferMs > 2000) {
+			warning("IMuseDigital: invalid dimuse_prebuffer %d ms, using 200 ms", prebufferMs);
+			prebufferMs = 200;
+		}
+	}
+	_prebufferTicks = prebufferMs * _callbackFps / 1000;
+
 	resetState();
 	for (int l = 0; l < MAX_DIGITAL_TRACKS + MAX_DIGITAL_FADETRACKS; l++) {
 		_track[l] = new Track;
@@ -266,7 +282,13 @@ void IMuseDigital::callback() {
 
 				int32 feedSize = track->feedSize / _callbackFps;
 
-				if (track->stream->endOfData()) {
+				// Top up the prebuffer. Each queued buffer holds roughly one
+				// callback tick of data, so feed enough ticks in one go to
+				// restore the configured lead over the mixer.
+				int32 queuedTicks = track->stream->numQueuedStreams();
+				if (queuedTicks < _prebufferTicks) {
+					feedSize *= (_prebufferTicks - queuedTicks + 1);
+				} else if (track->stream->endOfData()) {
 					feedSize *= 2;
 				}
 
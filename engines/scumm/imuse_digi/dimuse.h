@@ -56,6 +56,7 @@ class IMuseDigital : public MusicEngine {
 private:
 
 	int _callbackFps;		// value how many times callback needs to be called per second
+	int _prebufferTicks;	// how many callback ticks of audio to keep queued ahead of the mixer
 
 	struct TriggerParams {
 		char marker[10];
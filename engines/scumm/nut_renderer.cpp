@@ -31,15 +31,15 @@ namespace Scumm {
 NutRenderer::NutRenderer(ScummEngine *vm, const char *filename) :
 	_vm(vm),
 	_numChars(0),
-	_maxCharSize(0),
-	_charBuffer(0),
 	_decodedData(0) {
 	memset(_chars, 0, sizeof(_chars));
+	memset(_unpackedChars, 0, sizeof(_unpackedChars));
 	loadFont(filename);
 }
 
 NutRenderer::~NutRenderer() {
-	delete[] _charBuffer;
+	for (int i = 0; i < ARRAYSIZE(_unpackedChars); i++)
+		delete[] _unpackedChars[i];
 	delete[] _decodedData;
 }
 
@@ -126,10 +126,7 @@ void NutRenderer::loadFont(const char *filename) {
 		offset += READ_BE_UINT32(dataSrc + offset + 4) + 16;
 		int width = READ_LE_UINT16(dataSrc + offset + 14);
 		int height = READ_LE_UINT16(dataSrc + offset + 16);
-		int size = width * height;
-		decodedLength += size;
-		if (size > _maxCharSize)
-			_maxCharSize = size;
+		decodedLength += width * height;
 	}
 
 	debug(1, "NutRenderer::loadFont('%s') - decodedLength = %d", filename, decodedLength);
@@ -254,8 +251,6 @@ void NutRenderer::loadFont(const char *filename) {
 
 		delete[] _decodedData;
 		_decodedData = compressedData;
-
-		_charBuffer = new byte[_maxCharSize];
 	}
 
 	delete[] dataSrc;
@@ -286,6 +281,14 @@ byte *NutRenderer::unpackChar(byte c) {
 	if (_bpp == 8)
 		return _chars[c].src;
 
+	// Unpack the glyph lazily and keep it around afterwards, so that e.g.
+	// SMUSH subtitles do not pay for unpacking the same glyphs on every
+	// frame they are visible. Only glyphs which are actually drawn take up
+	// the extra memory.
+	if (_unpackedChars[c])
+		return _unpackedChars[c];
+
+	byte *buffer = new byte[_chars[c].width * _chars[c].height];
 	byte *src = _chars[c].src;
 	int pitch = (_bpp * _chars[c].width + 7) / 8;
 
@@ -317,12 +320,13 @@ byte *NutRenderer::unpackChar(byte c) {
 					val |= (1 << i);
 			}
 
-			_charBuffer[ty * _chars[c].width + tx] = _palette[val];
+			buffer[ty * _chars[c].width + tx] = _palette[val];
 		}
 		src += pitch;
 	}
 
-	return _charBuffer;
+	_unpackedChars[c] = buffer;
+	return buffer;
 }
 
 void NutRenderer::drawFrame(byte *dst, int c, int x, int y) {
@@ -40,8 +40,6 @@ protected:
 
 	ScummEngine *_vm;
 	int _numChars;
-	int _maxCharSize;
-	byte *_charBuffer;
 	byte *_decodedData;
 	byte *_paletteMap;
 	byte _bpp;
@@ -52,6 +50,7 @@ protected:
 		byte *src;
 		byte transparency;
 	} _chars[256];
+	byte *_unpackedChars[256];
 
 	void codec1(byte *dst, const byte *src, int width, int height, int pitch);
 	void codec21(byte *dst, const byte *src, int width, int height, int pitch);
@@ -1034,6 +1034,7 @@ void ResourceManager::Resource::setOnHeap() {
 
 void ResourceManager::expireResources(uint32 size) {
 	byte best_counter;
+	uint32 best_size;
 	ResType best_type;
 	int best_res = 0;
 	uint32 oldAllocatedSize;
@@ -1051,6 +1052,7 @@ void ResourceManager::expireResources(uint32 size) {
 	do {
 		best_type = rtInvalid;
 		best_counter = 2;
+		best_size = 0;
 
 		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 			if (_types[type]._mode != kDynamicResTypeMode) {
@@ -1060,10 +1062,18 @@ void ResourceManager::expireResources(uint32 size) {
 				while (idx-- > 0) {
 					Resource &tmp = _types[type][idx];
 					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
+					if (!tmp.isLocked() && counter >= 2 && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+						// Pick the least recently used resource; among equally
+						// old ones prefer the largest, so that freeing the
+						// requested amount of memory expires as few resources
+						// as possible and cheap-to-reload small ones survive.
+						if (best_type == rtInvalid || counter > best_counter ||
+								(counter == best_counter && tmp._size > best_size)) {
+							best_counter = counter;
+							best_size = tmp._size;
+							best_type = type;
+							best_res = idx;
+						}
 					}
 				}
 			}
@@ -1472,6 +1482,13 @@ const byte *ScummEngine::findResource(uint32 tag, const byte *searchin) {
 	}
 
 	while (curpos < totalsize) {
+		// A block header must fit into what is left of the resource,
+		// otherwise the tag/size reads below would run past its end
+		if (curpos + 8 > totalsize) {
+			error("(%s) Not found in %d... truncated block at %d", tag2str(tag), 0, curpos);
+			return NULL;
+		}
+
 		if (READ_BE_UINT32(searchin) == tag) {
 			_resourceLastSearchBuf = searchin;
 			return searchin;
@@ -1505,6 +1522,13 @@ const byte *findResourceSmall(uint32 tag, const byte *searchin) {
 	curpos = 6;
 
 	while (curpos < totalsize) {
+		// A block header must fit into what is left of the resource,
+		// otherwise the size/tag reads below would run past its end
+		if (curpos + 6 > totalsize) {
+			error("(%s) Not found in %d... truncated block at %d", tag2str(tag), 0, curpos);
+			return NULL;
+		}
+
 		size = READ_LE_UINT32(searchin);
 
 		if (READ_LE_UINT16(searchin + 4) == smallTag)
@@ -208,10 +208,13 @@ bool ScummEngine::saveState(int slot, bool compat, Common::String &filename) {
 		delete out;
 	}
 
-	if (saveFailed)
+	if (saveFailed) {
 		debug(1, "State save as '%s' FAILED", filename.c_str());
-	else
+	} else {
 		debug(1, "State saved as '%s'", filename.c_str());
+		if (!compat)
+			_savegameNameCache[slot] = _saveLoadDescription;
+	}
 
 	pauseEngine(false);
 
@@ -299,6 +302,7 @@ bool ScummEngine_v4::savePreparedSavegame(int slot, char *desc) {
 		return false;
 	} else {
 		debug(1, "State saved as '%s'", filename.c_str());
+		_savegameNameCache[slot] = desc;
 		return true;
 	}
 }
@@ -354,6 +358,13 @@ bool ScummEngine::loadState(int slot, bool compat, Common::String &filename) {
 		return false;
 	}
 
+	// We have read the header anyway, so remember the name for the
+	// save/load dialogs.
+	if (!compat) {
+		hdr.name[sizeof(hdr.name) - 1] = 0;
+		_savegameNameCache[slot] = hdr.name;
+	}
+
 	// Since version 52 a thumbnail is saved directly after the header.
 	if (hdr.ver >= VER(52)) {
 		// Prior to version 75 we always required an thumbnail to be present
@@ -554,6 +565,7 @@ bool ScummEngine::loadState(int slot, bool compat, Common::String &filename) {
 
 	// Reset charset mask
 	_charset->_hasMask = false;
+	_charset->_textArea = Common::Rect();
 	clearTextSurface();
 
 	_lastCodePtr = NULL;
@@ -630,11 +642,26 @@ bool ScummEngine::getSavegameName(int slot, Common::String &desc) {
 
 	desc.clear();
 	Common::String filename = makeSavegameName(slot, false);
+
+	// A cached name is only trusted if the savefile still shows up in the
+	// savefile list (which requires no file opens), so a save removed
+	// behind our back, e.g. from the launcher, does not linger here.
+	if (_savegameNameCache.contains(slot)) {
+		if (!_saveFileMan->listSavefiles(filename).empty()) {
+			desc = _savegameNameCache[slot];
+			return true;
+		}
+		_savegameNameCache.erase(slot);
+		return false;
+	}
+
 	in = _saveFileMan->openForLoading(filename);
 	if (in) {
 		result = Scumm::getSavegameName(in, desc, _game.heversion);
 		delete in;
 	}
+	if (result)
+		_savegameNameCache[slot] = desc;
 	return result;
 }
 
@@ -1767,6 +1794,9 @@ void ScummEngine::loadResource(Serializer *ser, ResType type, ResId idx) {
 		byte *ptr = _res->createResource(type, idx, size);
 		ser->loadBytes(ptr, size);
 
+		if (type == rtMatrix && idx == 1) {
+			_boxMatrixRowIndexValid = false;
+		}
 		if (type == rtInventory) {
 			_inventory[idx] = ser->loadUint16();
 		}
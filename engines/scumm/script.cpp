@@ -448,14 +448,6 @@ void ScummEngine::resetScriptPointer() {
  * The script resource may have moved because it might have been garbage
  * collected by ResourceManager::expireResources.
  */
-void ScummEngine::refreshScriptPointer() {
-	if (*_lastCodePtr != _scriptOrgPointer) {
-		long oldoffs = _scriptPointer - _scriptOrgPointer;
-		getScriptBaseAddress();
-		_scriptPointer = _scriptOrgPointer + oldoffs;
-	}
-}
-
 /** Execute a script - Read opcode, and execute it from the table */
 void ScummEngine::executeScript() {
 	int c;
@@ -488,14 +480,6 @@ void ScummEngine::executeScript() {
 	}
 }
 
-void ScummEngine::executeOpcode(byte i) {
-	if (_opcodes[i].proc && _opcodes[i].proc->isValid())
-		(*_opcodes[i].proc)();
-	else {
-		error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
-	}
-}
-
 const char *ScummEngine::getOpcodeDesc(byte i) {
 #ifndef REDUCE_MEMORY_USAGE
 	return _opcodes[i].desc;
@@ -504,11 +488,6 @@ const char *ScummEngine::getOpcodeDesc(byte i) {
 #endif
 }
 
-byte ScummEngine::fetchScriptByte() {
-	refreshScriptPointer();
-	return *_scriptPointer++;
-}
-
 uint ScummEngine::fetchScriptWord() {
 	refreshScriptPointer();
 	uint a = READ_LE_UINT16(_scriptPointer);
@@ -520,17 +499,6 @@ int ScummEngine::fetchScriptWordSigned() {
 	return (int16)fetchScriptWord();
 }
 
-uint ScummEngine::fetchScriptDWord() {
-	refreshScriptPointer();
-	uint a = READ_LE_UINT32(_scriptPointer);
-	_scriptPointer += 4;
-	return a;
-}
-
-int ScummEngine::fetchScriptDWordSigned() {
-	return (int32)fetchScriptDWord();
-}
-
 int ScummEngine::readVar(uint var) {
 	int a;
 
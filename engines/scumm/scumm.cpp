@@ -167,6 +167,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_pauseDialog = NULL;
 	_versionDialog = NULL;
 	_fastMode = 0;
+	_timerOvershoot = 0;
 	_actors = _sortedActors = NULL;
 	_arraySlot = NULL;
 	_inventory = NULL;
@@ -304,6 +305,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_defaultTalkDelay = 0;
 	_saveSound = 0;
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
+	_boxMatrixRowIndexValid = false;
+	memset(_boxMatrixRowIndex, 0, sizeof(_boxMatrixRowIndex));
 	memset(_scaleSlots, 0, sizeof(_scaleSlots));
 	_charset = NULL;
 	_charsetColor = 0;
@@ -2158,6 +2161,18 @@ void ScummEngine::waitForTimer(int msec_delay) {
 	else if (_fastMode & 1)
 		msec_delay = 10;
 
+	// delayMillis() has a coarse granularity, so the previous wait usually
+	// overshot its deadline by a few milliseconds. Shorten this wait by that
+	// amount so the error doesn't accumulate and the frame intervals stay
+	// stable instead of oscillating around the target, which shows up as
+	// judder in scrolling scenes.
+	if (_timerOvershoot > 0) {
+		msec_delay -= MIN(_timerOvershoot, msec_delay);
+		_timerOvershoot = 0;
+	}
+	if (msec_delay < 0)
+		msec_delay = 0;
+
 	start_time = _system->getMillis();
 
 	while (!shouldQuit()) {
@@ -2170,10 +2185,19 @@ void ScummEngine::waitForTimer(int msec_delay) {
 #endif
 
 		_system->updateScreen();
-		if (_system->getMillis() >= start_time + msec_delay)
+		uint32 cur_time = _system->getMillis();
+		if (cur_time >= start_time + msec_delay)
 			break;
-		_system->delayMillis(10);
+		// Sleep no longer than the time left until the deadline, so we wake
+		// up close to it instead of up to a full quantum late.
+		_system->delayMillis(MIN<uint32>(start_time + msec_delay - cur_time, 10));
 	}
+
+	_timerOvershoot = (int)(_system->getMillis() - start_time) - msec_delay;
+	// Don't carry a huge debt over from an unusually long iteration
+	// (e.g. a blocking load), that would starve the next few frames.
+	if (_timerOvershoot > 50)
+		_timerOvershoot = 50;
 }
 
 void ScummEngine_v0::scummLoop(int delta) {
@@ -2246,6 +2270,7 @@ load_game:
 	if (_completeScreenRedraw) {
 		clearCharsetMask();
 		_charset->_hasMask = false;
+		_charset->_textArea = Common::Rect();
 
 		// HACK as in game save stuff isn't supported currently
 		if (_game.id == GID_LOOM) {
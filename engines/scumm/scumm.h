@@ -28,6 +28,7 @@
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 #include "common/savefile.h"
 #include "common/keyboard.h"
 #include "common/random.h"
@@ -504,6 +505,7 @@ protected:
 	char displayMessage(const char *altButton, const char *message, ...) GCC_PRINTF(3, 4);
 
 	byte _fastMode;
+	int _timerOvershoot;	// By how much the last waitForTimer() missed its deadline
 
 	byte _numActors;
 	Actor **_actors;	// Has _numActors elements
@@ -604,6 +606,11 @@ protected:
 	Common::String _saveLoadFileName;
 	Common::String _saveLoadDescription;
 
+	// Savegame names by slot, filled in as saves are written or their
+	// headers read. Spares the save/load dialogs from re-opening every
+	// savefile each time they are brought up.
+	Common::HashMap<int, Common::String> _savegameNameCache;
+
 	bool saveState(Common::WriteStream *out, bool writeHeader = true);
 	bool saveState(int slot, bool compat, Common::String &fileName);
 	bool loadState(int slot, bool compat);
@@ -655,7 +662,17 @@ protected:
 	OpcodeEntry _opcodes[256];
 
 	virtual void setupOpcodes() = 0;
-	void executeOpcode(byte i);
+
+	// Executed once per opcode; defined inline (as are the script fetch
+	// helpers below) since the dispatch loop in executeScript() is the
+	// hottest path of the interpreter.
+	void executeOpcode(byte i) {
+		if (_opcodes[i].proc && _opcodes[i].proc->isValid())
+			(*_opcodes[i].proc)();
+		else
+			error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
+	}
+
 	const char *getOpcodeDesc(byte i);
 
 	void initializeLocals(int slot, int *vars);
@@ -699,12 +716,28 @@ protected:
 	void resetScriptPointer();
 	int getVerbEntrypoint(int obj, int entry);
 
-	void refreshScriptPointer();
-	byte fetchScriptByte();
+	void refreshScriptPointer() {
+		// If the script resource was moved while expiring resources,
+		// re-derive the pointer; every operand fetch goes through here.
+		if (*_lastCodePtr != _scriptOrgPointer) {
+			long oldoffs = _scriptPointer - _scriptOrgPointer;
+			getScriptBaseAddress();
+			_scriptPointer = _scriptOrgPointer + oldoffs;
+		}
+	}
+	byte fetchScriptByte() {
+		refreshScriptPointer();
+		return *_scriptPointer++;
+	}
 	virtual uint fetchScriptWord();
 	virtual int fetchScriptWordSigned();
-	uint fetchScriptDWord();
-	int fetchScriptDWordSigned();
+	uint fetchScriptDWord() {
+		refreshScriptPointer();
+		uint a = READ_LE_UINT32(_scriptPointer);
+		_scriptPointer += 4;
+		return a;
+	}
+	int fetchScriptDWordSigned() { return (int32)fetchScriptDWord(); }
 	void ignoreScriptWord() { fetchScriptWord(); }
 	void ignoreScriptByte() { fetchScriptByte(); }
 	void push(int a);
@@ -1175,6 +1208,13 @@ protected:
 	void createBoxMatrix();
 	virtual bool areBoxesNeighbors(int i, int j);
 
+	// Row offsets into the compressed box matrix, so that getNextBox()
+	// can seek straight to the row of the source box instead of scanning
+	// the matrix from the start on every call. Built lazily; invalidated
+	// whenever the matrix resource is replaced.
+	bool _boxMatrixRowIndexValid;
+	uint32 _boxMatrixRowIndex[256];
+
 	/* String class */
 public:
 	CharsetRenderer *_charset;
@@ -217,6 +217,7 @@ Scene::Scene(SherlockEngine *vm): _vm(vm) {
 
 	_currentScene = -1;
 	_goToScene = -1;
+	_zoneIndexCols = _zoneIndexRows = 0;
 	_walkedInScene = false;
 	_version = 0;
 	_compressed = false;
@@ -295,6 +296,7 @@ void Scene::freeScene() {
 	_cAnim.clear();
 	_bgShapes.clear();
 	_zones.clear();
+	buildZoneIndex();
 	_canimShapes.clear();
 
 	for (uint idx = 0; idx < _images.size(); ++idx)
@@ -319,6 +321,7 @@ bool Scene::loadScene(const Common::String &filename) {
 	// Reset the list of walkable areas
 	_zones.clear();
 	_zones.push_back(Common::Rect(0, 0, SHERLOCK_SCREEN_WIDTH, SHERLOCK_SCREEN_HEIGHT));
+	buildZoneIndex();
 
 	_descText.clear();
 	_comments = "";
@@ -543,6 +546,7 @@ bool Scene::loadScene(const Common::String &filename) {
 				_zones[idx].setHeight(boundsStream->readSint16LE() + 1);
 				boundsStream->skip(2);	// Skip unused scene number field
 			}
+			buildZoneIndex();
 
 			if (_compressed)
 				delete boundsStream;
@@ -880,6 +884,7 @@ bool Scene::loadScene(const Common::String &filename) {
 			_zones[idx].setHeight(roomStream->readSint16BE() + 1);
 			roomStream->skip(4); // skip UINT32
 		}
+		buildZoneIndex();
 
 		// === WALK DIRECTORY === Load the walk directory
 		uint32 expected3DO_walkDirectory_size = _zones.size() * _zones.size() * 2;
@@ -1373,7 +1378,61 @@ int Scene::checkForZones(const Common::Point &pt, int zoneType) {
 	return matches;
 }
 
+void Scene::buildZoneIndex() {
+	_zoneIndex.clear();
+	_zoneIndexBounds = Common::Rect();
+	_zoneIndexCols = _zoneIndexRows = 0;
+
+	if (_zones.empty())
+		return;
+
+	// Work out the area the zones cover
+	Common::Rect bounds = _zones[0];
+	for (uint idx = 1; idx < _zones.size(); ++idx)
+		bounds.extend(_zones[idx]);
+
+	_zoneIndexBounds = bounds;
+	_zoneIndexCols = (bounds.width() + ZONE_CELL_SIZE - 1) / ZONE_CELL_SIZE;
+	_zoneIndexRows = (bounds.height() + ZONE_CELL_SIZE - 1) / ZONE_CELL_SIZE;
+	_zoneIndex.resize(_zoneIndexCols * _zoneIndexRows);
+
+	// Register each zone with every cell it overlaps. Iterating the zones
+	// in order keeps each cell's list in ascending order, so cell lookups
+	// return the same zone a full scan of the list would
+	for (uint idx = 0; idx < _zones.size(); ++idx) {
+		const Common::Rect &z = _zones[idx];
+		if (z.isEmpty())
+			continue;
+
+		int c1 = (z.left - bounds.left) / ZONE_CELL_SIZE;
+		int c2 = (z.right - 1 - bounds.left) / ZONE_CELL_SIZE;
+		int r1 = (z.top - bounds.top) / ZONE_CELL_SIZE;
+		int r2 = (z.bottom - 1 - bounds.top) / ZONE_CELL_SIZE;
+
+		for (int row = r1; row <= r2; ++row) {
+			for (int col = c1; col <= c2; ++col)
+				_zoneIndex[row * _zoneIndexCols + col].push_back(idx);
+		}
+	}
+}
+
 int Scene::whichZone(const Common::Point &pt) {
+	if (!_zoneIndex.empty()) {
+		if (!_zoneIndexBounds.contains(pt))
+			// Outside the area covered by any zone
+			return -1;
+
+		int cell = (pt.y - _zoneIndexBounds.top) / ZONE_CELL_SIZE * _zoneIndexCols
+			+ (pt.x - _zoneIndexBounds.left) / ZONE_CELL_SIZE;
+		const Common::Array<int16> &zones = _zoneIndex[cell];
+		for (uint idx = 0; idx < zones.size(); ++idx) {
+			if (_zones[zones[idx]].contains(pt))
+				return zones[idx];
+		}
+
+		return -1;
+	}
+
 	for (uint idx = 0; idx < _zones.size(); ++idx) {
 		if (_zones[idx].contains(pt))
 			return idx;
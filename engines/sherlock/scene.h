@@ -34,6 +34,7 @@
 namespace Sherlock {
 
 #define MAX_ZONES	40
+#define ZONE_CELL_SIZE	64
 #define INFO_LINE	140
 
 class SherlockEngine;
@@ -207,6 +208,20 @@ protected:
 	virtual void paletteLoaded() {}
 
 	Scene(SherlockEngine *vm);
+private:
+	/**
+	 * Grid-based spatial index over _zones. Each cell lists the indexes of
+	 * the zones overlapping it, in ascending order, so whichZone only has
+	 * to test the zones sharing a cell with the queried point.
+	 */
+	Common::Rect _zoneIndexBounds;
+	int _zoneIndexCols, _zoneIndexRows;
+	Common::Array< Common::Array<int16> > _zoneIndex;
+
+	/**
+	 * Rebuild the spatial index after the zone list has changed
+	 */
+	void buildZoneIndex();
 public:
 	int _currentScene;
 	int _goToScene;
@@ -66,6 +66,7 @@ Screen::Screen(OSystem *pSystem, Disk *pDisk, SkyCompact *skyCompact) {
 	uint8 tmpPal[VGA_COLORS * 3];
 
 	_gameGrid = (uint8 *)malloc(GRID_X * GRID_Y * 2);
+	_flipShadow = (uint8 *)malloc(GAME_SCREEN_WIDTH * GAME_SCREEN_HEIGHT);
 	forceRefresh();
 
 	_currentScreen = NULL;
@@ -92,12 +93,14 @@ Screen::Screen(OSystem *pSystem, Disk *pDisk, SkyCompact *skyCompact) {
 
 Screen::~Screen() {
 	free(_gameGrid);
+	free(_flipShadow);
 	free(_currentScreen);
 	free(_scrollScreen);
 }
 
 void Screen::clearScreen() {
 	memset(_currentScreen, 0, FULL_SCREEN_WIDTH * FULL_SCREEN_HEIGHT);
+	memset(_flipShadowGrid, 0, GRID_X * GRID_Y);
 	_system->copyRectToScreen(_currentScreen, GAME_SCREEN_WIDTH, 0, 0, GAME_SCREEN_WIDTH, GAME_SCREEN_HEIGHT);
 	_system->updateScreen();
 }
@@ -160,6 +163,8 @@ void Screen::showScreen(uint16 fileNum) {
 }
 
 void Screen::showScreen(uint8 *pScreen) {
+	// the backend content no longer matches what flip() last copied
+	memset(_flipShadowGrid, 0, GRID_X * GRID_Y);
 	_system->copyRectToScreen(pScreen, 320, 0, 0, GAME_SCREEN_WIDTH, GAME_SCREEN_HEIGHT);
 	_system->updateScreen();
 }
@@ -213,8 +218,28 @@ void Screen::flip(bool doUpdate) {
 	copyX = copyWidth = 0;
 	for (uint8 cnty = 0; cnty < GRID_Y; cnty++) {
 		for (uint8 cntx = 0; cntx < GRID_X; cntx++) {
+			bool blockChanged = false;
 			if (_gameGrid[cnty * GRID_X + cntx] & 1) {
 				_gameGrid[cnty * GRID_X + cntx] &= ~1;
+				uint8 *scrPos = _currentScreen + cnty * GRID_H * GAME_SCREEN_WIDTH + cntx * GRID_W;
+				uint8 *shadowPos = _flipShadow + cnty * GRID_H * GAME_SCREEN_WIDTH + cntx * GRID_W;
+				if (_flipShadowGrid[cnty * GRID_X + cntx]) {
+					// only copy the block if its pixels actually changed
+					// since it was last passed to the backend
+					for (uint8 lineCnt = 0; lineCnt < GRID_H; lineCnt++)
+						if (memcmp(shadowPos + lineCnt * GAME_SCREEN_WIDTH, scrPos + lineCnt * GAME_SCREEN_WIDTH, GRID_W)) {
+							blockChanged = true;
+							break;
+						}
+				} else
+					blockChanged = true;
+				if (blockChanged) {
+					for (uint8 lineCnt = 0; lineCnt < GRID_H; lineCnt++)
+						memcpy(shadowPos + lineCnt * GAME_SCREEN_WIDTH, scrPos + lineCnt * GAME_SCREEN_WIDTH, GRID_W);
+					_flipShadowGrid[cnty * GRID_X + cntx] = 1;
+				}
+			}
+			if (blockChanged) {
 				if (!copyWidth)
 					copyX = cntx * GRID_W;
 				copyWidth += GRID_W;
@@ -454,6 +479,9 @@ void Screen::processSequence() {
 	_seqInfo.nextFrame += 60;
 
 	memset(_seqGrid, 0, 12 * 20);
+	// the sequence frame is copied to the backend directly below, so the
+	// flip() shadow no longer matches the backend contents
+	memset(_flipShadowGrid, 0, GRID_X * GRID_Y);
 
 	uint32 screenPos = 0;
 
@@ -816,6 +844,7 @@ void Screen::showGrid(uint8 *gridBuf) {
 			gridData <<= 1;
 		}
 	}
+	memset(_flipShadowGrid, 0, GRID_X * GRID_Y);
 	_system->copyRectToScreen(_currentScreen, GAME_SCREEN_WIDTH, 0, 0, GAME_SCREEN_WIDTH, GAME_SCREEN_HEIGHT);
 
 }
@@ -79,7 +79,10 @@ public:
 	void halvePalette();
 
 	//- regular screen.asm routines
-	void forceRefresh() { memset(_gameGrid, 0x80, GRID_X * GRID_Y); }
+	void forceRefresh() {
+		memset(_gameGrid, 0x80, GRID_X * GRID_Y);
+		memset(_flipShadowGrid, 0, GRID_X * GRID_Y);
+	}
 	void fnFadeUp(uint32 palNum, uint32 scroll);
 	void fnFadeDown(uint32 scroll);
 	void fnDrawScreen(uint32 palette, uint32 scroll);
@@ -108,6 +111,12 @@ private:
 	uint8 *_gameGrid;
 	uint8 *_currentScreen;
 	uint8 *_scrollScreen;
+	// copy of the screen data last passed to the backend by flip(), with a
+	// per-block validity grid. Marked blocks whose pixels didn't actually
+	// change since the last flip are not copied to the backend again, which
+	// matters a lot when the backend scales the screen up.
+	uint8 *_flipShadow;
+	uint8 _flipShadowGrid[GRID_X * GRID_Y];
 	struct {
 		uint32 nextFrame;
 		uint32 framesLeft;
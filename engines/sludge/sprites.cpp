@@ -336,11 +336,37 @@ Graphics::Surface *GraphicsManager::duplicateSurface(Graphics::Surface *surface)
 }
 
 void GraphicsManager::blendColor(Graphics::Surface *blitted, uint32 color, Graphics::TSpriteBlendMode mode) {
-	Graphics::TransparentSurface tmp;
-	tmp.create(blitted->w, blitted->h, blitted->format);
-	tmp.fillRect(Common::Rect(0, 0, tmp.w, tmp.h), color);
-	tmp.blit(*blitted, 0, 0, Graphics::FLIP_NONE, nullptr, TS_ARGB(255, 255, 255, 255), blitted->w, blitted->h, mode);
-	tmp.free();
+	uint8 ca, cr, cg, cb;
+	blitted->format.colorToARGB(color, ca, cr, cg, cb);
+
+	// A fully transparent blend colour leaves the sprite untouched
+	if (ca == 0)
+		return;
+
+	// The per-channel blend terms are the same for every pixel, so the
+	// blend runs in place instead of filling a temporary surface with the
+	// colour and pushing it through the generic blit machinery
+	const uint32 tr = cr * ca >> 8;
+	const uint32 tg = cg * ca >> 8;
+	const uint32 tb = cb * ca >> 8;
+
+	for (int y = 0; y < blitted->h; ++y) {
+		uint32 *pixel = (uint32 *)blitted->getBasePtr(0, y);
+		for (int x = 0; x < blitted->w; ++x, ++pixel) {
+			uint8 a, r, g, b;
+			blitted->format.colorToARGB(*pixel, a, r, g, b);
+			if (mode == Graphics::BLEND_MULTIPLY) {
+				r = tr * r >> 8;
+				g = tg * g >> 8;
+				b = tb * b >> 8;
+			} else {
+				r = MIN<uint32>(tr + r, 255u);
+				g = MIN<uint32>(tg + g, 255u);
+				b = MIN<uint32>(tb + b, 255u);
+			}
+			*pixel = blitted->format.ARGBToColor(a, r, g, b);
+		}
+	}
 }
 
 Graphics::Surface *GraphicsManager::applyLightmapToSprite(Graphics::Surface *&blitted, OnScreenPerson *thisPerson, bool mirror, int x, int y, int x1, int y1, int diffX, int diffY) {
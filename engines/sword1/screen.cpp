@@ -55,6 +55,7 @@ Screen::Screen(OSystem *system, ResMan *pResMan, ObjectMan *pObjMan) {
 	_updatePalette = false;
 	_psxCache.decodedBackground = NULL;
 	_psxCache.extPlxCache = NULL;
+	_parallaxCache[0].data = _parallaxCache[1].data = NULL;
 	_oldScrollX = 0;
 	_oldScrollY = 0;
 
@@ -357,6 +358,7 @@ void Screen::newScreen(uint32 screen) {
 		_layerGrid[cnt] += 14;
 	}
 	_parallax[0] = _parallax[1] = NULL;
+	_parallaxCache[0].data = _parallaxCache[1].data = NULL;
 	if (_roomDefTable[_currentScreen].parallax[0])
 		_parallax[0] = (uint8 *)_resMan->openFetchRes(_roomDefTable[_currentScreen].parallax[0]);
 	if (_roomDefTable[_currentScreen].parallax[1])
@@ -378,6 +380,7 @@ void Screen::quitScreen() {
 		_resMan->resClose(_roomDefTable[_currentScreen].parallax[0]);
 	if (_roomDefTable[_currentScreen].parallax[1])
 		_resMan->resClose(_roomDefTable[_currentScreen].parallax[1]);
+	_parallaxCache[0].data = _parallaxCache[1].data = NULL;
 	_currentScreen = 0xFFFF;
 }
 
@@ -432,11 +435,18 @@ void Screen::draw() {
 	for (cnt = 0; cnt < _backLength; cnt++)
 		processImage(_backList[cnt]);
 
-	for (cnt = 0; cnt < _sortLength - 1; cnt++)
-		for (uint8 sCnt = 0; sCnt < _sortLength - 1; sCnt++)
-			if (_sortList[sCnt].y > _sortList[sCnt + 1].y) {
-				SWAP(_sortList[sCnt], _sortList[sCnt + 1]);
-			}
+	// The list is in roughly the right order already, as sprites rarely
+	// change their relative depth between frames, so insertion sort is a
+	// good fit (and stable, which the bubble sort it replaces also was)
+	for (cnt = 1; cnt < _sortLength; cnt++) {
+		SortSpr tmpSpr = _sortList[cnt];
+		int8 sCnt = cnt - 1;
+		while ((sCnt >= 0) && (_sortList[sCnt].y > tmpSpr.y)) {
+			_sortList[sCnt + 1] = _sortList[sCnt];
+			sCnt--;
+		}
+		_sortList[sCnt + 1] = tmpSpr;
+	}
 	for (cnt = 0; cnt < _sortLength; cnt++)
 		processImage(_sortList[cnt].id);
 
@@ -683,53 +693,92 @@ void Screen::renderParallax(uint8 *data) {
 	} else
 		paraScrlY = 0;
 
-	if (SwordEngine::isPsx())
+	if (SwordEngine::isPsx()) {
 		drawPsxParallax(data, paraScrlX, scrnScrlX, scrnWidth);
+		return;
+	}
+
+	// Pick the span cache slot belonging to this layer. As long as the
+	// scroll position is unchanged, the spans recorded on a previous frame
+	// can simply be copied over the screen buffer again, without walking
+	// the layer's RLE data at all.
+	ParallaxSpanCache *cache;
+	if (_parallaxCache[0].data == data)
+		cache = &_parallaxCache[0];
+	else if (_parallaxCache[1].data == data)
+		cache = &_parallaxCache[1];
 	else
-		for (uint16 cnty = 0; cnty < scrnHeight; cnty++) {
-			uint8 *src = data + _resMan->readUint32(lineIndexes + cnty + paraScrlY);
-			uint8 *dest = _screenBuf + scrnScrlX + (cnty + scrnScrlY) * _scrnSizeX;
-			uint16 remain = paraScrlX;
-			uint16 xPos = 0;
-			while (remain) { // skip past the first part of the parallax to get to the right scrolling position
-				uint8 doSkip = *src++;
-				if (doSkip <= remain)
-					remain -= doSkip;
-				else {
-					xPos = doSkip - remain;
-					dest += xPos;
-					remain = 0;
-				}
-				uint8 doCopy = *src++;
-				if (doCopy <= remain) {
-					remain -= doCopy;
-					src += doCopy;
-				} else {
-					uint16 remCopy = doCopy - remain;
-					memcpy(dest, src + remain, remCopy);
-					dest += remCopy;
-					src += doCopy;
-					xPos = remCopy;
-					remain = 0;
-				}
+		cache = (_parallaxCache[0].data == NULL) ? &_parallaxCache[0] : &_parallaxCache[1];
+
+	if ((cache->data == data) && (cache->scrlX == scrnScrlX) && (cache->scrlY == scrnScrlY) &&
+			(cache->width == scrnWidth) && (cache->height == scrnHeight)) {
+		for (uint32 spanCnt = 0; spanCnt < cache->spans.size(); spanCnt++) {
+			const ParallaxSpan &span = cache->spans[spanCnt];
+			memcpy(_screenBuf + span.destOff, data + span.srcOff, span.len);
+		}
+		return;
+	}
+
+	cache->data = data;
+	cache->scrlX = scrnScrlX;
+	cache->scrlY = scrnScrlY;
+	cache->width = scrnWidth;
+	cache->height = scrnHeight;
+	cache->spans.clear();
+
+	for (uint16 cnty = 0; cnty < scrnHeight; cnty++) {
+		uint8 *src = data + _resMan->readUint32(lineIndexes + cnty + paraScrlY);
+		uint8 *dest = _screenBuf + scrnScrlX + (cnty + scrnScrlY) * _scrnSizeX;
+		uint16 remain = paraScrlX;
+		uint16 xPos = 0;
+		ParallaxSpan span;
+		while (remain) { // skip past the first part of the parallax to get to the right scrolling position
+			uint8 doSkip = *src++;
+			if (doSkip <= remain)
+				remain -= doSkip;
+			else {
+				xPos = doSkip - remain;
+				dest += xPos;
+				remain = 0;
 			}
-			while (xPos < scrnWidth) {
-				if (uint8 skip = *src++) {
-					dest += skip;
-					xPos += skip;
-				}
-				if (xPos < scrnWidth) {
-					if (uint8 doCopy = *src++) {
-						if (xPos + doCopy > scrnWidth)
-							doCopy = scrnWidth - xPos;
-						memcpy(dest, src, doCopy);
-						dest += doCopy;
-						xPos += doCopy;
-						src += doCopy;
-					}
+			uint8 doCopy = *src++;
+			if (doCopy <= remain) {
+				remain -= doCopy;
+				src += doCopy;
+			} else {
+				uint16 remCopy = doCopy - remain;
+				memcpy(dest, src + remain, remCopy);
+				span.destOff = dest - _screenBuf;
+				span.srcOff = (src + remain) - data;
+				span.len = remCopy;
+				cache->spans.push_back(span);
+				dest += remCopy;
+				src += doCopy;
+				xPos = remCopy;
+				remain = 0;
+			}
+		}
+		while (xPos < scrnWidth) {
+			if (uint8 skip = *src++) {
+				dest += skip;
+				xPos += skip;
+			}
+			if (xPos < scrnWidth) {
+				if (uint8 doCopy = *src++) {
+					if (xPos + doCopy > scrnWidth)
+						doCopy = scrnWidth - xPos;
+					memcpy(dest, src, doCopy);
+					span.destOff = dest - _screenBuf;
+					span.srcOff = src - data;
+					span.len = doCopy;
+					cache->spans.push_back(span);
+					dest += doCopy;
+					xPos += doCopy;
+					src += doCopy;
 				}
 			}
 		}
+	}
 }
 
 void Screen::drawSprite(uint8 *sprData, uint16 sprX, uint16 sprY, uint16 sprWidth, uint16 sprHeight, uint16 sprPitch) {
@@ -1162,6 +1211,7 @@ void Screen::fadePalette() {
 
 void Screen::fnSetParallax(uint32 screen, uint32 resId) {
 	_roomDefTable[screen].parallax[0] = resId;
+	_parallaxCache[0].data = _parallaxCache[1].data = NULL;
 }
 
 void Screen::spriteClipAndSet(uint16 *pSprX, uint16 *pSprY, uint16 *pSprWidth, uint16 *pSprHeight, uint16 *incr) {
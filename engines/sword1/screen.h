@@ -23,6 +23,8 @@
 #ifndef SWORD1_SCREEN_H
 #define SWORD1_SCREEN_H
 
+#include "common/array.h"
+
 #include "sword1/sworddefs.h"
 
 class OSystem;
@@ -53,6 +55,20 @@ struct PSXDataCache { // Cache for PSX screen, to avoid decompressing background
 	uint8 *extPlxCache; // If this screen requires an external parallax, save it here
 };
 
+struct ParallaxSpan { // one opaque pixel run of a parallax layer
+	uint32 destOff; // offset into the screen buffer
+	uint32 srcOff;  // offset into the parallax resource data
+	uint16 len;
+};
+
+struct ParallaxSpanCache { // spans a parallax layer produced for one scroll position,
+                           // so its RLE data is only walked again when scrolling
+	const uint8 *data;
+	uint16 scrlX, scrlY;
+	uint16 width, height;
+	Common::Array<ParallaxSpan> spans;
+};
+
 #define SCRNGRID_X 16
 #define SCRNGRID_Y 8
 #define SHRINK_BUFFER_SIZE 50000
@@ -148,6 +164,7 @@ private:
 	uint16 _oldScrollX, _oldScrollY; // for drawing additional frames
 
 	PSXDataCache _psxCache; // Cache used for PSX backgrounds
+	ParallaxSpanCache _parallaxCache[2]; // one per possible parallax layer
 
 	uint32  _foreList[MAX_FORE];
 	uint32  _backList[MAX_BACK];
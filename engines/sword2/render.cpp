@@ -322,8 +322,16 @@ void Screen::renderParallax(byte *ptr, int16 l) {
 	clipRect.top = MENUDEEP;
 	clipRect.bottom = _screenDeep - MENUDEEP;
 
-	for (int j = 0; j < _yBlocks[l]; j++) {
-		for (int i = 0; i < _xBlocks[l]; i++) {
+	// Restrict the loop to the blocks that can actually intersect the clip
+	// rectangle - in wide locations most blocks are scrolled off screen
+
+	int iFirst = x / BLOCKWIDTH;
+	int iLast = MIN<int>(_xBlocks[l], (x + _screenWide + BLOCKWIDTH - 1) / BLOCKWIDTH);
+	int jFirst = y / BLOCKHEIGHT;
+	int jLast = MIN<int>(_yBlocks[l], (y + (_screenDeep - MENUDEEP * 2) + BLOCKHEIGHT - 1) / BLOCKHEIGHT);
+
+	for (int j = jFirst; j < jLast; j++) {
+		for (int i = iFirst; i < iLast; i++) {
 			if (_blockSurfaces[l][i + j * _xBlocks[l]]) {
 				r.left = i * BLOCKWIDTH - x;
 				r.right = r.left + BLOCKWIDTH;
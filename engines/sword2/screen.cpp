@@ -457,14 +457,14 @@ void Screen::drawSortFrames(byte *file) {
 	// Sort the sort list. Used to be a separate function, but it was only
 	// called once, right before calling drawSortFrames().
 
-	if (_curSort > 1) {
-		for (i = 0; i < _curSort - 1; i++) {
-			for (j = 0; j < _curSort - 1; j++) {
-				if (_sortList[_sortOrder[j]].sort_y > _sortList[_sortOrder[j + 1]].sort_y) {
-					SWAP(_sortOrder[j], _sortOrder[j + 1]);
-				}
-			}
-		}
+	// Insertion sort, since the order rarely changes much between frames
+	// and the list is therefore almost sorted already.
+
+	for (i = 1; i < _curSort; i++) {
+		uint16 tmpOrder = _sortOrder[i];
+		for (j = i; j > 0 && _sortList[_sortOrder[j - 1]].sort_y > _sortList[tmpOrder].sort_y; j--)
+			_sortOrder[j] = _sortOrder[j - 1];
+		_sortOrder[j] = tmpOrder;
 	}
 
 	// Draw the sorted frames - layers, shrinkers & normal flat sprites
@@ -141,6 +141,10 @@ void MoviePlayer::update() {
 				g_system->updateScreen();
 #endif
 			}
+		} else {
+			// The next frame is not due yet; use the idle time to decode
+			// ahead so the frame is ready once its display time arrives.
+			_decoder.decodeAheadFrame();
 		}
 	}
 }
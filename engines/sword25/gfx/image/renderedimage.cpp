@@ -208,6 +208,10 @@ bool RenderedImage::setContent(const byte *pixeldata, uint size, uint offset, ui
 		in += stride;
 	}
 
+	// The new content has not been classified, so do not keep a stale
+	// fast-path alpha mode around.
+	_surface.setAlphaMode(Graphics::ALPHA_FULL);
+
 	return true;
 }
 
@@ -216,6 +220,7 @@ void RenderedImage::replaceContent(byte *pixeldata, int width, int height) {
 	_surface.h = height;
 	_surface.pitch = width * 4;
 	_surface.setPixels(pixeldata);
+	_surface.setAlphaMode(Graphics::ALPHA_FULL);
 }
 // -----------------------------------------------------------------------------
 
@@ -257,17 +262,28 @@ void RenderedImage::copyDirectly(int posX, int posY) {
 }
 
 void RenderedImage::checkForTransparency() {
-	// Check if the source bitmap has any transparent pixels at all
+	// Classify the alpha channel of the source bitmap. Fully opaque images
+	// and images whose pixels are either fully opaque or fully transparent
+	// are flagged on the surface, so that blitting them takes the fast
+	// copy paths instead of alpha blending every single pixel.
 	_isTransparent = false;
 	byte *data = (byte *)_surface.getPixels();
 	for (int i = 0; i < _surface.h; i++) {
 		for (int j = 0; j < _surface.w; j++) {
-			_isTransparent = data[3] != 0xff;
-			if (_isTransparent)
-				return;
+			const byte alpha = data[3];
+			if (alpha != 0xff) {
+				_isTransparent = true;
+				if (alpha != 0) {
+					// Neither opaque nor binary; no need to look further.
+					_surface.setAlphaMode(Graphics::ALPHA_FULL);
+					return;
+				}
+			}
 			data += 4;
 		}
 	}
+
+	_surface.setAlphaMode(_isTransparent ? Graphics::ALPHA_BINARY : Graphics::ALPHA_OPAQUE);
 }
 
 } // End of namespace Sword25
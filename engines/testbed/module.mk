@@ -9,6 +9,7 @@ MODULE_OBJS := \
 	graphics.o \
 	midi.o \
 	misc.o \
+	performance.o \
 	savegame.o \
 	sound.o \
 	testbed.o \
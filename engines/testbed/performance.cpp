@@ -0,0 +1,254 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/mixer.h"
+#include "audio/softsynth/pcspk.h"
+
+#include "common/savefile.h"
+
+#include "engines/engine.h"
+
+#include "testbed/performance.h"
+
+namespace Testbed {
+
+/**
+ * Pushes the given buffer to the screen repeatedly for durationMs
+ * milliseconds and returns the number of full copyRectToScreen() +
+ * updateScreen() iterations that fit in that time.
+ */
+uint PerfTests::timedBlitLoop(const byte *buffer, int width, int height, uint32 durationMs) {
+	const uint32 pitch = width * g_system->getScreenFormat().bytesPerPixel;
+	const uint32 startTime = g_system->getMillis();
+	uint iterations = 0;
+
+	while (g_system->getMillis() - startTime < durationMs) {
+		g_system->copyRectToScreen(buffer, pitch, 0, 0, width, height);
+		g_system->updateScreen();
+		iterations++;
+	}
+
+	return iterations;
+}
+
+void PerfTests::logResult(const char *metric, double value, const char *unit, uint iterations) {
+	Testsuite::logPrintf("PERF! %s : %.2f %s (%u iterations)\n", metric, value, unit, iterations);
+}
+
+TestExitStatus PerfTests::testBlitThroughput() {
+	const uint32 durationMs = 500;
+	const struct {
+		int width;
+		int height;
+	} rectSizes[] = {{16, 16}, {64, 64}, {160, 100}, {320, 200}};
+
+	const uint32 bpp = g_system->getScreenFormat().bytesPerPixel;
+	byte *buffer = new byte[320 * 200 * bpp];
+	for (uint32 i = 0; i < 320 * 200 * bpp; i++) {
+		buffer[i] = i % 256;
+	}
+
+	for (uint i = 0; i < ARRAYSIZE(rectSizes); i++) {
+		const int width = rectSizes[i].width;
+		const int height = rectSizes[i].height;
+		uint iterations = timedBlitLoop(buffer, width, height, durationMs);
+
+		if (!iterations) {
+			Testsuite::logDetailedPrintf("Not even one %dx%d blit finished in %u ms\n", width, height, durationMs);
+			delete[] buffer;
+			return kTestFailed;
+		}
+
+		// Bytes pushed per second, scaled to megabytes.
+		double mbPerSec = (double)iterations * width * height * bpp / durationMs / 1000.0;
+		Common::String metric = Common::String::format("copyRectToScreen %dx%d", width, height);
+		logResult(metric.c_str(), mbPerSec, "MB/s", iterations);
+	}
+
+	delete[] buffer;
+	return kTestPassed;
+}
+
+TestExitStatus PerfTests::testGfxModeBlitCost() {
+	const uint32 durationMs = 500;
+	const int currGFXMode = g_system->getGraphicsMode();
+	const OSystem::GraphicsMode *gfxMode = g_system->getSupportedGraphicsModes();
+
+	while (gfxMode->name) {
+		if (Engine::shouldQuit()) {
+			Testsuite::logPrintf("Info! Explicit exit requested during blit cost test, this test may be incomplete\n");
+			break;
+		}
+
+		g_system->beginGFXTransaction();
+		bool isGFXModeSet = g_system->setGraphicsMode(gfxMode->id);
+		g_system->initSize(320, 200);
+		OSystem::TransactionError gfxError = g_system->endGFXTransaction();
+
+		if (gfxError != OSystem::kTransactionSuccess || !isGFXModeSet) {
+			Testsuite::logDetailedPrintf("Switching to graphics mode %s failed, skipping it\n", gfxMode->name);
+			gfxMode++;
+			continue;
+		}
+
+		// The buffer is allocated per mode as a mode switch may change the pixel format.
+		const uint32 bpp = g_system->getScreenFormat().bytesPerPixel;
+		byte *buffer = new byte[320 * 200 * bpp];
+		for (uint32 i = 0; i < 320 * 200 * bpp; i++) {
+			buffer[i] = i % 256;
+		}
+
+		uint iterations = timedBlitLoop(buffer, 320, 200, durationMs);
+		delete[] buffer;
+
+		if (!iterations) {
+			Testsuite::logDetailedPrintf("Not even one full-screen blit finished in %u ms with GFX mode %s\n", durationMs, gfxMode->name);
+			break;
+		}
+
+		Common::String metric = Common::String::format("fullscreen blit [%s]", gfxMode->name);
+		logResult(metric.c_str(), (double)durationMs / iterations, "ms/frame", iterations);
+		gfxMode++;
+	}
+
+	// Restore Original State
+	g_system->beginGFXTransaction();
+	bool isGFXModeSet = g_system->setGraphicsMode(currGFXMode);
+	g_system->initSize(320, 200);
+	OSystem::TransactionError gfxError = g_system->endGFXTransaction();
+
+	if (gfxError != OSystem::kTransactionSuccess || !isGFXModeSet) {
+		Testsuite::logDetailedPrintf("Switching back to initial graphics mode failed\n");
+		return kTestFailed;
+	}
+
+	return kTestPassed;
+}
+
+TestExitStatus PerfTests::testMixerChannelScaling() {
+	const int maxChannels = 8;
+	const int probeIterations = 50;
+	const uint32 probeDelayMs = 10;
+
+	Audio::Mixer *mixer = g_system->getMixer();
+	Audio::SoundHandle handles[maxChannels];
+	int activeChannels = 0;
+
+	// The mixer runs on the backend side, so its cost can't be timed
+	// directly from here. Instead measure how much a nominal delayMillis()
+	// overshoots while an increasing number of channels is being mixed:
+	// on weak devices the mixing callback eats into the main thread.
+	for (int channels = 0; channels <= maxChannels; channels = channels ? channels * 2 : 1) {
+		while (activeChannels < channels) {
+			Audio::PCSpeaker *speaker = new Audio::PCSpeaker();
+			speaker->play(Audio::PCSpeaker::kWaveFormSine, 1000 + activeChannels * 100, -1);
+			mixer->playStream(Audio::Mixer::kSFXSoundType, &handles[activeChannels], speaker);
+			activeChannels++;
+		}
+
+		uint32 overshoot = 0;
+		for (int i = 0; i < probeIterations; i++) {
+			uint32 startTime = g_system->getMillis();
+			g_system->delayMillis(probeDelayMs);
+			overshoot += g_system->getMillis() - startTime - probeDelayMs;
+		}
+
+		Common::String metric = Common::String::format("delay overshoot with %d mixer channels", channels);
+		logResult(metric.c_str(), (double)overshoot / probeIterations, "ms", probeIterations);
+	}
+
+	for (int i = 0; i < activeChannels; i++) {
+		mixer->stopHandle(handles[i]);
+	}
+
+	return kTestPassed;
+}
+
+TestExitStatus PerfTests::testSavefileThroughput() {
+	const char *fileName = "tBedPerfSavefile.0";
+	const uint32 chunkSize = 4096;
+	const uint32 numChunks = 64; // 256 KB in total
+
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+
+	byte *chunk = new byte[chunkSize];
+	for (uint32 i = 0; i < chunkSize; i++) {
+		chunk[i] = i % 256;
+	}
+
+	Common::OutSaveFile *saveFile = saveFileMan->openForSaving(fileName);
+	if (!saveFile) {
+		Testsuite::logDetailedPrintf("Can't open saveFile %s\n", fileName);
+		delete[] chunk;
+		return kTestFailed;
+	}
+
+	uint32 startTime = g_system->getMillis();
+	for (uint32 i = 0; i < numChunks; i++) {
+		saveFile->write(chunk, chunkSize);
+	}
+	saveFile->finalize();
+	uint32 writeTime = g_system->getMillis() - startTime;
+	delete saveFile;
+
+	Common::InSaveFile *loadFile = saveFileMan->openForLoading(fileName);
+	if (!loadFile) {
+		Testsuite::logDetailedPrintf("Can't open save File to load\n");
+		delete[] chunk;
+		return kTestFailed;
+	}
+
+	startTime = g_system->getMillis();
+	uint32 bytesRead = 0;
+	while (bytesRead < chunkSize * numChunks) {
+		uint32 r = loadFile->read(chunk, chunkSize);
+		if (!r)
+			break;
+		bytesRead += r;
+	}
+	uint32 readTime = g_system->getMillis() - startTime;
+	delete loadFile;
+	delete[] chunk;
+
+	saveFileMan->removeSavefile(fileName);
+
+	if (bytesRead != chunkSize * numChunks) {
+		Testsuite::logDetailedPrintf("Read back %u bytes instead of %u\n", bytesRead, chunkSize * numChunks);
+		return kTestFailed;
+	}
+
+	// A fast backend may finish inside one timer tick, clamp to 1 ms.
+	double totalKB = (double)chunkSize * numChunks / 1024.0;
+	logResult("savefile write", totalKB * 1000.0 / MAX<uint32>(writeTime, 1), "KB/s", numChunks);
+	logResult("savefile read", totalKB * 1000.0 / MAX<uint32>(readTime, 1), "KB/s", numChunks);
+
+	return kTestPassed;
+}
+
+PerformanceTestSuite::PerformanceTestSuite() {
+	addTest("BlitThroughput", &PerfTests::testBlitThroughput, false);
+	addTest("GfxModeBlitCost", &PerfTests::testGfxModeBlitCost, false);
+	addTest("MixerChannelScaling", &PerfTests::testMixerChannelScaling, false);
+	addTest("SavefileThroughput", &PerfTests::testSavefileThroughput, false);
+}
+
+} // End of namespace Testbed
@@ -0,0 +1,71 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef TESTBED_PERFORMANCE_H
+#define TESTBED_PERFORMANCE_H
+
+#include "testbed/testsuite.h"
+
+namespace Testbed {
+
+namespace PerfTests {
+
+// Timed scenarios measuring backend throughput rather than correctness.
+// Every result is logged as a "PERF!" line so the log file can be parsed
+// mechanically when comparing devices.
+
+// Helper functions for Performance tests
+uint timedBlitLoop(const byte *buffer, int width, int height, uint32 durationMs);
+void logResult(const char *metric, double value, const char *unit, uint iterations);
+
+// will contain function declarations for Performance tests
+TestExitStatus testBlitThroughput();
+TestExitStatus testGfxModeBlitCost();
+TestExitStatus testMixerChannelScaling();
+TestExitStatus testSavefileThroughput();
+// add more here
+
+} // End of namespace PerfTests
+
+class PerformanceTestSuite : public Testsuite {
+public:
+	/**
+	 * The constructor for the PerformanceTestSuite
+	 * For every test to be executed one must:
+	 * 1) Create a function that would invoke the test
+	 * 2) Add that test to list by executing addTest()
+	 *
+	 * @see addTest()
+	 */
+	PerformanceTestSuite();
+	~PerformanceTestSuite() {}
+	const char *getName() const {
+		return "Performance";
+	}
+	const char *getDescription() const {
+		return "Performance: Blit/GfxModes/Mixer/Savefile throughput";
+	}
+};
+
+} // End of namespace Testbed
+
+#endif // TESTBED_PERFORMANCE_H
@@ -36,6 +36,7 @@
 #include "testbed/graphics.h"
 #include "testbed/midi.h"
 #include "testbed/misc.h"
+#include "testbed/performance.h"
 #include "testbed/savegame.h"
 #include "testbed/sound.h"
 #include "testbed/testbed.h"
@@ -140,6 +141,9 @@ TestbedEngine::TestbedEngine(OSystem *syst)
 	// Midi
 	ts = new MidiTestSuite();
 	_testsuiteList.push_back(ts);
+	// Performance
+	ts = new PerformanceTestSuite();
+	_testsuiteList.push_back(ts);
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	// Cloud
 	ts = new CloudTestSuite();
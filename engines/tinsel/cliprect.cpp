@@ -165,6 +165,28 @@ void FindMovingObjects(OBJECT **pObjList, Common::Point *pWin, Common::Rect *pCl
 	}
 }
 
+/**
+ * Check whether merging the two rectangles is worthwhile, i.e. their
+ * union does not cover much more area than the rectangles themselves.
+ * Merging heavily overlapping rectangles avoids redrawing the overlap
+ * twice; merging rectangles that merely touch at a corner would redraw
+ * large areas nobody has changed.
+ * @param pSrc1			a source rectangle
+ * @param pSrc2			a source rectangle
+ */
+static bool IsMergeWorthwhile(const Common::Rect &pSrc1, const Common::Rect &pSrc2) {
+	Common::Rect rcUnion;
+
+	UnionRectangle(rcUnion, pSrc1, pSrc2);
+
+	int unionArea = rcUnion.width() * rcUnion.height();
+	int srcArea = pSrc1.width() * pSrc1.height() + pSrc2.width() * pSrc2.height();
+
+	// note: when the rectangles overlap, the overlap is counted twice in
+	// srcArea, which biases the test towards merging - exactly what we want
+	return unionArea - srcArea <= unionArea / 4;
+}
+
 /**
  * Merges any clipping rectangles that overlap to try and reduce
  * the total number of clip rectangles.
@@ -181,7 +203,7 @@ void MergeClipRect() {
 		rInner = rOuter;
 		while (++rInner != s_rectList.end()) {
 
-			if (LooseIntersectRectangle(*rOuter, *rInner)) {
+			if (LooseIntersectRectangle(*rOuter, *rInner) && IsMergeWorthwhile(*rOuter, *rInner)) {
 				// these two rectangles overlap or
 				// are next to each other - merge them
 
@@ -21,6 +21,7 @@
  */
 
 #include "titanic/star_control/base_stars.h"
+#include "titanic/star_control/fpose.h"
 #include "titanic/star_control/star_camera.h"
 #include "titanic/star_control/star_closeup.h"
 #include "titanic/star_control/star_ref.h"
@@ -102,6 +103,129 @@ void CBaseStars::loadData(Common::SeekableReadStream &s) {
 	// Iterate through reading the data for each entry
 	for (uint idx = 0; idx < count; ++idx)
 		_data[idx].load(s);
+
+	buildCells();
+}
+
+void CBaseStars::buildCells() {
+	// Number of cells along each axis of the grid
+	const uint GRID_SIZE = 8;
+
+	_cells.clear();
+	_cellIndexes.clear();
+
+	if (_data.empty())
+		return;
+
+	// Get the bounding box of the entire field
+	FVector minB = _data[0]._position, maxB = _data[0]._position;
+	for (uint idx = 1; idx < _data.size(); ++idx) {
+		const FVector &pos = _data[idx]._position;
+		minB._x = MIN(minB._x, pos._x);
+		minB._y = MIN(minB._y, pos._y);
+		minB._z = MIN(minB._z, pos._z);
+		maxB._x = MAX(maxB._x, pos._x);
+		maxB._y = MAX(maxB._y, pos._y);
+		maxB._z = MAX(maxB._z, pos._z);
+	}
+
+	FVector cellSize(
+		(maxB._x - minB._x) / GRID_SIZE,
+		(maxB._y - minB._y) / GRID_SIZE,
+		(maxB._z - minB._z) / GRID_SIZE
+	);
+	if (cellSize._x <= 0.0)
+		cellSize._x = 1.0;
+	if (cellSize._y <= 0.0)
+		cellSize._y = 1.0;
+	if (cellSize._z <= 0.0)
+		cellSize._z = 1.0;
+
+	// Count the stars falling in each grid cell
+	Common::Array<uint> starCells;
+	Common::Array<uint> cellCounts;
+	starCells.resize(_data.size());
+	cellCounts.resize(GRID_SIZE * GRID_SIZE * GRID_SIZE);
+
+	for (uint idx = 0; idx < _data.size(); ++idx) {
+		const FVector &pos = _data[idx]._position;
+		uint gx = MIN((uint)((pos._x - minB._x) / cellSize._x), GRID_SIZE - 1);
+		uint gy = MIN((uint)((pos._y - minB._y) / cellSize._y), GRID_SIZE - 1);
+		uint gz = MIN((uint)((pos._z - minB._z) / cellSize._z), GRID_SIZE - 1);
+		starCells[idx] = (gz * GRID_SIZE + gy) * GRID_SIZE + gx;
+		cellCounts[starCells[idx]]++;
+	}
+
+	// Lay out the star indexes grouped by cell, skipping empty cells
+	_cellIndexes.resize(_data.size());
+	Common::Array<int> cellSlots;
+	cellSlots.resize(cellCounts.size());
+
+	uint startIndex = 0;
+	for (uint cellNum = 0; cellNum < cellCounts.size(); ++cellNum) {
+		if (cellCounts[cellNum] == 0) {
+			cellSlots[cellNum] = -1;
+			continue;
+		}
+
+		StarCell cell;
+		cell._startIndex = startIndex;
+		startIndex += cellCounts[cellNum];
+		cellSlots[cellNum] = (int)_cells.size();
+		_cells.push_back(cell);
+	}
+
+	for (uint idx = 0; idx < _data.size(); ++idx) {
+		StarCell &cell = _cells[cellSlots[starCells[idx]]];
+		_cellIndexes[cell._startIndex + cell._count] = idx;
+		cell._count++;
+	}
+
+	// Work out a bounding sphere for each cell from the stars it holds
+	for (uint cellNum = 0; cellNum < _cells.size(); ++cellNum) {
+		StarCell &cell = _cells[cellNum];
+
+		FVector sum;
+		for (uint i = 0; i < cell._count; ++i)
+			sum += _data[_cellIndexes[cell._startIndex + i]]._position;
+		cell._center = FVector(sum._x / cell._count, sum._y / cell._count,
+			sum._z / cell._count);
+
+		double maxDist2 = 0.0;
+		for (uint i = 0; i < cell._count; ++i) {
+			FVector delta = _data[_cellIndexes[cell._startIndex + i]]._position - cell._center;
+			double dist2 = delta._x * delta._x + delta._y * delta._y + delta._z * delta._z;
+			if (dist2 > maxDist2)
+				maxDist2 = dist2;
+		}
+		cell._radius = sqrt(maxDist2);
+	}
+}
+
+void CBaseStars::cullStars(const FPose &pose, double minVal) {
+	_visibleIndexes.clear();
+
+	if (_cellIndexes.size() != _data.size()) {
+		// No partition available (none was built, or stars have been added
+		// or removed since), so every star is potentially visible
+		for (uint idx = 0; idx < _data.size(); ++idx)
+			_visibleIndexes.push_back(idx);
+		return;
+	}
+
+	for (uint cellNum = 0; cellNum < _cells.size(); ++cellNum) {
+		const StarCell &cell = _cells[cellNum];
+		const FVector &c = cell._center;
+		double tempZ = c._x * pose._row1._z + c._y * pose._row2._z
+			+ c._z * pose._row3._z + pose._vector._z;
+
+		// Skip the whole cell if even its nearest point fails the depth test
+		if (tempZ + cell._radius <= minVal)
+			continue;
+
+		for (uint i = 0; i < cell._count; ++i)
+			_visibleIndexes.push_back(_cellIndexes[cell._startIndex + i]);
+	}
 }
 
 void CBaseStars::loadData(const CString &resName) {
@@ -174,8 +298,10 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
+	cullStars(pose, minVal);
+
+	for (uint visIdx = 0; visIdx < _visibleIndexes.size(); ++visIdx) {
+		CBaseStarEntry &entry = _data[_visibleIndexes[visIdx]];
 		const FVector &vector = entry._position;
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
 			+ vector._z * pose._row3._z + pose._vector._z;
@@ -259,8 +385,10 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
+	cullStars(pose, minVal);
+
+	for (uint visIdx = 0; visIdx < _visibleIndexes.size(); ++visIdx) {
+		CBaseStarEntry &entry = _data[_visibleIndexes[visIdx]];
 		const FVector &vector = entry._position;
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
 			+ vector._z * pose._row3._z + pose._vector._z;
@@ -348,8 +476,10 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	int xStart, yStart, rgb;
 	uint16 *pixelP;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
+	cullStars(pose, minVal);
+
+	for (uint visIdx = 0; visIdx < _visibleIndexes.size(); ++visIdx) {
+		CBaseStarEntry &entry = _data[_visibleIndexes[visIdx]];
 		const FVector &vector = entry._position;
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
 			+ vector._z * pose._row3._z + pose._vector._z;
@@ -454,8 +584,10 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarClos
 	int xStart, yStart, rgb;
 	uint16 *pixelP;
 
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		const CBaseStarEntry &entry = _data[idx];
+	cullStars(pose, minVal);
+
+	for (uint visIdx = 0; visIdx < _visibleIndexes.size(); ++visIdx) {
+		const CBaseStarEntry &entry = _data[_visibleIndexes[visIdx]];
 		const FVector &vector = entry._position;
 
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
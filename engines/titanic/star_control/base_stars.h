@@ -38,6 +38,7 @@ class CStarCamera;
 class CStarCloseup;
 class CString;
 class CSurfaceArea;
+class FPose;
 class SimpleFile;
 
 struct CBaseStarEntry {
@@ -74,10 +75,38 @@ struct CStarPosition : public Common::Point {
  */
 class CBaseStars {
 private:
+	/**
+	 * A group of stars sharing a region of space, used to cull whole
+	 * groups against the camera with a single bounding sphere test
+	 */
+	struct StarCell {
+		FVector _center;
+		double _radius;
+		uint _startIndex;
+		uint _count;
+		StarCell() : _radius(0.0), _startIndex(0), _count(0) {}
+	};
+
+	Common::Array<StarCell> _cells;
+	Common::Array<uint> _cellIndexes;
+	Common::Array<uint> _visibleIndexes;
+
 	void draw1(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw2(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
 	void draw4(CSurfaceArea *surfaceArea, CStarCamera *camera, CStarCloseup *closeup);
+
+	/**
+	 * Partition the loaded stars into a fixed grid of bounding sphere
+	 * cells for culling
+	 */
+	void buildCells();
+
+	/**
+	 * Fill _visibleIndexes with the stars whose cells can pass the
+	 * given depth test for the passed camera pose
+	 */
+	void cullStars(const FPose &pose, double minVal);
 protected:
 	FRange _minMax;
 	double _minVal;
@@ -107,6 +107,8 @@ bool Animation::loadAnimation(const Common::String &file) {
 				}
 			}
 
+			computeOpaqueRect(_frames[e]);
+
 			data += headerSize + compressedSize;
 		}
 	}
@@ -139,6 +141,47 @@ Common::Rect Animation::getRect() {
 	return Common::Rect(_x1, _y1, _x2, _y2);
 }
 
+void Animation::computeOpaqueRect(AnimationFrame &frame) {
+	int16 width = frame._x2 - frame._x1;
+	int16 height = frame._y2 - frame._y1;
+
+	// Frames without own data fall back to their reference frame's box
+	frame._opaqueX1 = 0;
+	frame._opaqueY1 = 0;
+	frame._opaqueX2 = width;
+	frame._opaqueY2 = height;
+
+	if (!frame._data || width <= 0 || height <= 0)
+		return;
+
+	frame._opaqueX1 = width;
+	frame._opaqueY1 = height;
+	frame._opaqueX2 = 0;
+	frame._opaqueY2 = 0;
+
+	const uint8 *c = frame._data;
+	for (int16 y = 0; y < height; y++) {
+		int16 first = -1;
+		int16 last = -1;
+		for (int16 x = 0; x < width; x++, c++) {
+			if (*c) {
+				if (first < 0)
+					first = x;
+				last = x;
+			}
+		}
+
+		if (first >= 0) {
+			if (first < frame._opaqueX1)
+				frame._opaqueX1 = first;
+			if (last + 1 > frame._opaqueX2)
+				frame._opaqueX2 = last + 1;
+			frame._opaqueY1 = MIN<int16>(frame._opaqueY1, y);
+			frame._opaqueY2 = y + 1;
+		}
+	}
+}
+
 void Animation::drawFrame(Graphics::Surface &surface, int32 frame, int16 xx, int16 yy) {
 	debugC(3, kDebugAnim, "drawFrame(surface, %d, %d, %d)", frame, xx, yy);
 	if (frame < 0)
@@ -195,18 +238,53 @@ void Animation::drawFrame(Graphics::Surface &surface, int32 frame, int16 xx, int
 	if (rectY < 0)
 		return;
 
+	// Restrict the blit to the cached opaque bounding box of the frame
+	// data; everything outside of it is fully transparent
+	const AnimationFrame &dataF = _frames[dataFrame];
+	int16 skipX = MAX<int16>(dataF._opaqueX1 - offsX, 0);
+	int16 skipY = MAX<int16>(dataF._opaqueY1 - offsY, 0);
+	rectX = MIN<int16>(rectX, dataF._opaqueX2 - offsX) - skipX;
+	rectY = MIN<int16>(rectY, dataF._opaqueY2 - offsY) - skipY;
+
+	if (rectX <= 0 || rectY <= 0)
+		return;
+
+	offsX += skipX;
+	offsY += skipY;
+
 	int32 destPitch = surface.pitch;
 	uint8 *srcRow = _frames[dataFrame]._data + offsX + (_frames[frame]._x2 - _frames[frame]._x1) * offsY;
 	uint8 *curRow = (uint8 *)surface.getBasePtr(xx + _x1 + _frames[frame]._x1 + offsX, yy + _frames[frame]._y1 + _y1 + offsY);
 	for (int16 y = 0; y < rectY; y++) {
 		uint8 *cur = curRow;
-		uint8 *c = srcRow + y * (_frames[frame]._x2 - _frames[frame]._x1);
-		for (int16 x = 0; x < rectX; x++) {
-			if (*c)
-				*cur = *c;
-			c++;
-			cur++;
+		const uint8 *c = srcRow + y * (_frames[frame]._x2 - _frames[frame]._x1);
+		const uint8 *end = c + rectX;
+
+		// Copy opaque runs whole and skip transparent runs a word at a
+		// time, instead of testing every pixel individually
+		while (c < end) {
+			if (*c) {
+				const uint8 *runStart = c;
+				while (c < end && *c)
+					c++;
+
+				memcpy(cur, runStart, c - runStart);
+				cur += c - runStart;
+			} else {
+				const uint8 *runStart = c;
+				while (c < end && *c == 0 && ((uintptr)c & 3) != 0)
+					c++;
+				if (((uintptr)c & 3) == 0) {
+					while (c + 4 <= end && *(const uint32 *)c == 0)
+						c += 4;
+				}
+				while (c < end && *c == 0)
+					c++;
+
+				cur += c - runStart;
+			}
 		}
+
 		curRow += destPitch;
 	}
 }
@@ -42,6 +42,13 @@ struct AnimationFrame {
 	int16 _y2;
 	int32 _ref;
 	uint8 *_data;
+
+	// Bounding box of the non-transparent pixels within the frame rect,
+	// computed once at load time (half-open, relative to _x1/_y1)
+	int16 _opaqueX1;
+	int16 _opaqueY1;
+	int16 _opaqueX2;
+	int16 _opaqueY2;
 };
 
 class Animation {
@@ -76,6 +83,11 @@ public:
 	Common::Rect getRect();
 protected:
 	ToonEngine *_vm;
+
+	/**
+	 * Compute the opaque-extent bounding box of a frame's pixel data
+	 */
+	void computeOpaqueRect(AnimationFrame &frame);
 };
 
 enum AnimationInstanceType {
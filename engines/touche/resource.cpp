@@ -21,6 +21,7 @@
  */
 
 
+#include "common/bufferedstream.h"
 #include "common/textconsole.h"
 
 #include "audio/decoders/flac.h"
@@ -39,7 +40,8 @@ namespace Touche {
 
 enum {
 	kCurrentSpeechDataVersion = 1,
-	kSpeechDataFileHeaderSize = 4
+	kSpeechDataFileHeaderSize = 4,
+	kDataReadAheadBufferSize = 256 * 1024
 };
 
 struct CompressedSpeechFile {
@@ -63,9 +65,15 @@ static const CompressedSpeechFile compressedSpeechFilesTable[] = {
 };
 
 void ToucheEngine::res_openDataFile() {
-	if (!_fData.open("TOUCHE.DAT")) {
+	Common::File *f = new Common::File;
+	if (!f->open("TOUCHE.DAT")) {
+		delete f;
 		error("Unable to open 'TOUCHE.DAT' for reading");
 	}
+	// Room graphics and sequence data are consumed mostly sequentially after
+	// a seek; reading them through a large buffer avoids stalling the game
+	// loop with many small file reads on slow media.
+	_fData = Common::wrapBufferedSeekableReadStream(f, kDataReadAheadBufferSize, DisposeAfterUse::YES);
 	for (int i = 0; compressedSpeechFilesTable[i].filename; ++i) {
 		if (_fSpeech[0].open(compressedSpeechFilesTable[i].filename)) {
 			int version = _fSpeech[0].readUint16LE();
@@ -83,25 +91,26 @@ void ToucheEngine::res_openDataFile() {
 }
 
 void ToucheEngine::res_closeDataFile() {
-	_fData.close();
+	delete _fData;
+	_fData = nullptr;
 	_fSpeech[0].close();
 	_fSpeech[1].close();
 }
 
 void ToucheEngine::res_allocateTables() {
-	_fData.seek(64);
-	uint32 textDataOffs = _fData.readUint32LE();
-	uint32 textDataSize = _fData.readUint32LE();
+	_fData->seek(64);
+	uint32 textDataOffs = _fData->readUint32LE();
+	uint32 textDataSize = _fData->readUint32LE();
 	_textData = (uint8 *)malloc(textDataSize);
 	if (!_textData) {
 		error("Unable to allocate memory for text data");
 	}
-	_fData.seek(textDataOffs);
-	_fData.read(_textData, textDataSize);
+	_fData->seek(textDataOffs);
+	_fData->read(_textData, textDataSize);
 
-	_fData.seek(2);
-	const int bw = _fData.readUint16LE();
-	const int bh = _fData.readUint16LE();
+	_fData->seek(2);
+	const int bw = _fData->readUint16LE();
+	const int bh = _fData->readUint16LE();
 	uint32 size = bw * bh;
 	_backdropBuffer = (uint8 *)malloc(size);
 	if (!_backdropBuffer) {
@@ -214,11 +223,11 @@ uint32 ToucheEngine::res_getDataOffset(ResourceType type, int num, uint32 *size)
 	if (num < 0 || num > rd->count) {
 		error("Invalid resource number %d (type %d)", num, type);
 	}
-	_fData.seek(rd->offs + num * 4);
-	uint32 offs = _fData.readUint32LE();
+	_fData->seek(rd->offs + num * 4);
+	uint32 offs = _fData->readUint32LE();
 	assert(offs != 0);
 	if (size) {
-		uint32 nextOffs = _fData.readUint32LE();
+		uint32 nextOffs = _fData->readUint32LE();
 		*size = nextOffs - offs;
 	}
 	return offs;
@@ -227,9 +236,9 @@ uint32 ToucheEngine::res_getDataOffset(ResourceType type, int num, uint32 *size)
 void ToucheEngine::res_loadSpriteImage(int num, uint8 *dst) {
 	debugC(9, kDebugResource, "ToucheEngine::res_loadSpriteImage() num=%d", num);
 	const uint32 offs = res_getDataOffset(kResourceTypeSpriteImage, num);
-	_fData.seek(offs);
-	_currentImageWidth = _fData.readUint16LE();
-	_currentImageHeight = _fData.readUint16LE();
+	_fData->seek(offs);
+	_currentImageWidth = _fData->readUint16LE();
+	_currentImageHeight = _fData->readUint16LE();
 	for (int i = 0; i < _currentImageHeight; ++i) {
 		res_decodeScanLineImageRLE(dst + _currentImageWidth * i, _currentImageWidth);
 	}
@@ -238,9 +247,9 @@ void ToucheEngine::res_loadSpriteImage(int num, uint8 *dst) {
 void ToucheEngine::res_loadProgram(int num) {
 	debugC(9, kDebugResource, "ToucheEngine::res_loadProgram() num=%d", num);
 	const uint32 offs = res_getDataOffset(kResourceTypeProgram, num, &_programDataSize);
-	_fData.seek(offs);
+	_fData->seek(offs);
 	assert(_programDataSize <= kMaxProgramDataSize);
-	_fData.read(_programData, _programDataSize);
+	_fData->read(_programData, _programDataSize);
 }
 
 void ToucheEngine::res_decodeProgramData() {
@@ -417,14 +426,14 @@ void ToucheEngine::res_loadRoom(int num) {
 	debug(0, "Setting up room %d", num);
 
 	const uint32 offsInfo = res_getDataOffset(kResourceTypeRoomInfo, num);
-	_fData.seek(offsInfo);
-	_fData.skip(2);
-	const int roomImageNum = _fData.readUint16LE();
-	_fData.skip(2);
-	_fData.read(_paletteBuffer, 3 * 256);
+	_fData->seek(offsInfo);
+	_fData->skip(2);
+	const int roomImageNum = _fData->readUint16LE();
+	_fData->skip(2);
+	_fData->read(_paletteBuffer, 3 * 256);
 
 	const uint32 offsImage = res_getDataOffset(kResourceTypeRoomImage, roomImageNum);
-	_fData.seek(offsImage);
+	_fData->seek(offsImage);
 	res_loadBackdrop();
 
 	bool updateScreenPalette = _flagsTable[115] == 0;
@@ -461,9 +470,9 @@ void ToucheEngine::res_loadSprite(int num, int index) {
 	_sequenceEntryTable[index].sprNum = num;
 	SpriteData *spr = &_spritesTable[index];
 	const uint32 offs = res_getDataOffset(kResourceTypeSpriteImage, num);
-	_fData.seek(offs);
-	_currentImageWidth = _fData.readUint16LE();
-	_currentImageHeight = _fData.readUint16LE();
+	_fData->seek(offs);
+	_currentImageWidth = _fData->readUint16LE();
+	_currentImageHeight = _fData->readUint16LE();
 	const uint32 size = _currentImageWidth * _currentImageHeight;
 	if (size > spr->size) {
 		debug(8, "Reallocating memory for sprite %d (index %d), %d bytes needed", num, index, size - spr->size);
@@ -502,17 +511,17 @@ void ToucheEngine::res_loadSequence(int num, int index) {
 	assert(index < NUM_SEQUENCES);
 	_sequenceEntryTable[index].seqNum = num;
 	const uint32 offs = res_getDataOffset(kResourceTypeSequence, num);
-	_fData.seek(offs);
-	_fData.read(_sequenceDataTable[index], 16000);
+	_fData->seek(offs);
+	_fData->read(_sequenceDataTable[index], 16000);
 }
 
 void ToucheEngine::res_decodeScanLineImageRLE(uint8 *dst, int lineWidth) {
 	int w = 0;
 	while (w < lineWidth) {
-		uint8 code = _fData.readByte();
+		uint8 code = _fData->readByte();
 		if ((code & 0xC0) == 0xC0) {
 			int len = code & 0x3F;
-			uint8 color = _fData.readByte();
+			uint8 color = _fData->readByte();
 			memset(dst, color, len);
 			dst += len;
 			w += len;
@@ -526,8 +535,8 @@ void ToucheEngine::res_decodeScanLineImageRLE(uint8 *dst, int lineWidth) {
 
 void ToucheEngine::res_loadBackdrop() {
 	debugC(9, kDebugResource, "ToucheEngine::res_loadBackdrop()");
-	_currentBitmapWidth = _fData.readUint16LE();
-	_currentBitmapHeight = _fData.readUint16LE();
+	_currentBitmapWidth = _fData->readUint16LE();
+	_currentBitmapHeight = _fData->readUint16LE();
 	for (int i = 0; i < _currentBitmapHeight; ++i) {
 		res_decodeScanLineImageRLE(_backdropBuffer + _currentBitmapWidth * i, _currentBitmapWidth);
 	}
@@ -548,9 +557,9 @@ void ToucheEngine::res_loadBackdrop() {
 void ToucheEngine::res_loadImage(int num, uint8 *dst) {
 	debugC(9, kDebugResource, "ToucheEngine::res_loadImage() num=%d", num);
 	const uint32 offsInfo = res_getDataOffset(kResourceTypeIconImage, num);
-	_fData.seek(offsInfo);
-	_currentImageWidth = _fData.readUint16LE();
-	_currentImageHeight = _fData.readUint16LE();
+	_fData->seek(offsInfo);
+	_currentImageWidth = _fData->readUint16LE();
+	_currentImageHeight = _fData->readUint16LE();
 	for (int i = 0; i < _currentImageHeight; ++i) {
 		res_decodeScanLineImageRLE(dst + _currentImageWidth * i, _currentImageWidth);
 	}
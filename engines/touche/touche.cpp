@@ -53,6 +53,7 @@ ToucheEngine::ToucheEngine(OSystem *system, Common::Language language)
 	_hideInventoryTexts = false;
 
 	_numOpcodes = 0;
+	_fData = nullptr;
 	_compressedSpeechData = 0;
 	_textData = nullptr;
 	_backdropBuffer = nullptr;
@@ -3438,8 +3439,8 @@ void ToucheEngine::startMusic(int num) {
 
 	if (_midiPlayer) {
 		const uint32 offs = res_getDataOffset(kResourceTypeMusic, num, &size);
-		_fData.seek(offs);
-		_midiPlayer->play(_fData, size, true);
+		_fData->seek(offs);
+		_midiPlayer->play(*_fData, size, true);
 	} else {
 		Common::String extMusicFilename = Common::String::format("track%02d", num);
 		Audio::SeekableAudioStream *extMusicFileStream = Audio::SeekableAudioStream::openStreamFile(extMusicFilename);
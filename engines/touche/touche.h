@@ -840,7 +840,7 @@ protected:
 	const OpcodeProc *_opcodesTable;
 	int _numOpcodes;
 
-	Common::File _fData;
+	Common::SeekableReadStream *_fData;
 	Common::File _fSpeech[2];
 	int _compressedSpeechData;
 
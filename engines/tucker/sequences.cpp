@@ -20,6 +20,8 @@
  *
  */
 
+#include "common/bufferedstream.h"
+#include "common/file.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -35,6 +37,10 @@
 
 namespace Tucker {
 
+enum {
+	kAnimationReadAheadBufferSize = 256 * 1024
+};
+
 void TuckerEngine::handleIntroSequence() {
 	const int firstSequence = (_gameFlags & kGameFlagDemo) != 0 ? kFirstAnimationSequenceDemo : kFirstAnimationSequenceGame;
 	_player = new AnimationSequencePlayer(_system, _mixer, _eventMan, &_compressedSound, firstSequence);
@@ -769,7 +775,19 @@ void AnimationSequencePlayer::getRGBPalette(int index) {
 }
 
 void AnimationSequencePlayer::openAnimation(int index, const char *fileName) {
-	if (!_flicPlayer[index].loadFile(fileName)) {
+	Common::File *f = new Common::File;
+	if (!f->open(fileName)) {
+		delete f;
+		warning("Unable to open flc animation file '%s'", fileName);
+		_seqNum = 1;
+		return;
+	}
+	// The animation frames are decoded from the file as they are played;
+	// stream them through a large read-ahead buffer so the sequence does not
+	// hitch on small reads from slow media.
+	Common::SeekableReadStream *stream = Common::wrapBufferedSeekableReadStream(f, kAnimationReadAheadBufferSize, DisposeAfterUse::YES);
+	if (!_flicPlayer[index].loadStream(stream)) {
+		delete stream;
 		warning("Unable to open flc animation file '%s'", fileName);
 		_seqNum = 1;
 		return;
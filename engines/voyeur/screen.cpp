@@ -110,6 +110,39 @@ void Screen::addRectNoSaveBack(ViewPortResource *viewPort, int idx, const Common
 	// Stubbed/dummy method in the original.
 }
 
+/**
+ * Blit one row of a colorkeyed image, copying opaque runs with memcpy and
+ * stepping over runs of transparent (zero) pixels a word at a time
+ */
+static void copyRowTransparent(byte *destP, const byte *srcP, int width) {
+	const byte *endP = srcP + width;
+
+	while (srcP < endP) {
+		const byte *runP = srcP;
+		while (srcP < endP && *srcP)
+			++srcP;
+		if (srcP != runP) {
+			memcpy(destP, runP, srcP - runP);
+			destP += srcP - runP;
+		}
+
+		while (srcP < endP && *srcP == 0 && ((uintptr)srcP & 3) != 0) {
+			++srcP;
+			++destP;
+		}
+		if (((uintptr)srcP & 3) == 0) {
+			while (srcP + 4 <= endP && *(const uint32 *)srcP == 0) {
+				srcP += 4;
+				destP += 4;
+			}
+		}
+		while (srcP < endP && *srcP == 0) {
+			++srcP;
+			++destP;
+		}
+	}
+}
+
 void Screen::sDrawPic(DisplayResource *srcDisplay, DisplayResource *destDisplay,
 		const Common::Point &initialOffset) {
 	int width1, width2;
@@ -296,14 +329,9 @@ void Screen::sDrawPic(DisplayResource *srcDisplay, DisplayResource *destDisplay,
 							srcP = (const byte *)getPixels() + srcOffset;
 
 							for (int yp = 0; yp < height1; ++yp) {
-								for (int xp = 0; xp < width2; ++xp, ++srcP, ++destP) {
-									pixel = *srcP;
-									if (pixel)
-										*destP = pixel;
-								}
-
-								srcP += widthDiff;
-								destP += widthDiff2;
+								copyRowTransparent(destP, srcP, width2);
+								srcP += width2 + widthDiff;
+								destP += width2 + widthDiff2;
 							}
 						} else {
 							// loc_25706
@@ -430,13 +458,9 @@ void Screen::sDrawPic(DisplayResource *srcDisplay, DisplayResource *destDisplay,
 						// loc_2637F
 						// Copy with transparency
 						for (int yp = 0; yp < height1; ++yp) {
-							for (int xp = 0; xp < width2; ++xp, ++srcP, ++destP) {
-								if (*srcP != 0)
-									*destP = *srcP;
-							}
-
-							destP += widthDiff2;
-							srcP += widthDiff;
+							copyRowTransparent(destP, srcP, width2);
+							destP += width2 + widthDiff2;
+							srcP += width2 + widthDiff;
 						}
 					}
 				} else {
@@ -64,6 +64,7 @@
 #include "engines/wintermute/platform_osystem.h"
 #include "base/version.h"
 #include "common/config-manager.h"
+#include "common/memstats.h"
 #include "common/savefile.h"
 #include "common/textconsole.h"
 #include "common/util.h"
@@ -3899,6 +3900,14 @@ void BaseGame::autoSaveOnExit() {
 //////////////////////////////////////////////////////////////////////////
 void BaseGame::addMem(int32 bytes) {
 	_usedMem += bytes;
+
+	// Mirror the engine-local counter into the global accounting so the
+	// memory_stats console command can break it out per subsystem
+	if (bytes >= 0) {
+		MemStats.addAlloc(MemStats.registerPool("wintermute gfx"), bytes);
+	} else {
+		MemStats.addFree(MemStats.registerPool("wintermute gfx"), -bytes);
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
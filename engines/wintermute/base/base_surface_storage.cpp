@@ -33,6 +33,8 @@
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
+#include "common/config-manager.h"
+#include "common/memstats.h"
 #include "common/str.h"
 
 namespace Wintermute {
@@ -42,11 +44,27 @@ namespace Wintermute {
 //////////////////////////////////////////////////////////////////////
 BaseSurfaceStorage::BaseSurfaceStorage(BaseGame *inGame) : BaseClass(inGame) {
 	_lastCleanupTime = 0;
+
+	// Byte budget for cached surface pixel data; the least recently used
+	// surfaces are unloaded once it is exceeded. 0 disables the budget.
+	_maxMemUsage = 256 * 1024 * 1024;
+	if (ConfMan.hasKey("gfx_mem_limit")) {
+		int limitMB = ConfMan.getInt("gfx_mem_limit");
+		if (limitMB < 0 || limitMB > 2047) {
+			BaseEngine::LOG(0, "Invalid gfx_mem_limit setting %d ignored", limitMB);
+		} else {
+			_maxMemUsage = (uint32)limitMB * 1024 * 1024;
+		}
+	}
+
+	// Let the global budget coordinator ask us to unload surfaces
+	MemStats.setShrinkProc(MemStats.registerPool("wintermute gfx"), shrinkCallback, this);
 }
 
 
 //////////////////////////////////////////////////////////////////////
 BaseSurfaceStorage::~BaseSurfaceStorage() {
+	MemStats.setShrinkProc(MemStats.registerPool("wintermute gfx"), nullptr, nullptr);
 	cleanup(true);
 }
 
@@ -80,11 +98,52 @@ bool BaseSurfaceStorage::initLoop() {
 				_surfaces[i]->invalidate();
 			}
 		}
+
+		// Even when no surface has outlived its lifetime yet, keep the total
+		// pixel memory below the budget by unloading the least recently used
+		// surfaces first.
+		if (_maxMemUsage > 0) {
+			shrinkToFit(_maxMemUsage);
+		}
 	}
 	return STATUS_OK;
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::shrinkToFit(uint32 targetBytes) {
+	sortSurfaces();
+
+	uint32 usedMem = 0;
+	for (uint32 i = 0; i < _surfaces.size(); i++) {
+		usedMem += _surfaces[i]->getMemUsage();
+	}
+
+	// The list is in eviction order from the sort above: least recently
+	// used first, surfaces that never expire at the end.
+	for (uint32 i = 0; i < _surfaces.size() && usedMem > targetBytes; i++) {
+		if (_surfaces[i]->_lifeTime <= 0) {
+			break;
+		}
+
+		if (_surfaces[i]->_valid) {
+			uint32 size = _surfaces[i]->getMemUsage();
+			if (DID_SUCCEED(_surfaces[i]->invalidate())) {
+				usedMem -= size;
+			}
+		}
+	}
+
+	return STATUS_OK;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::shrinkCallback(void *refCon, uint32 targetBytes) {
+	((BaseSurfaceStorage *)refCon)->shrinkToFit(targetBytes);
+}
+
+
 //////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 	for (uint32 i = 0; i < _surfaces.size(); i++) {
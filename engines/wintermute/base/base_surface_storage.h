@@ -37,9 +37,12 @@ class BaseSurface;
 class BaseSurfaceStorage : public BaseClass {
 public:
 	uint32 _lastCleanupTime;
+	uint32 _maxMemUsage;
 	bool initLoop();
+	bool shrinkToFit(uint32 targetBytes);
 	bool sortSurfaces();
 	static bool surfaceSortCB(const BaseSurface *arg1, const BaseSurface *arg2);
+	static void shrinkCallback(void *refCon, uint32 targetBytes);
 	bool cleanup(bool warn = false);
 	//DECLARE_PERSISTENT(BaseSurfaceStorage, BaseClass);
 
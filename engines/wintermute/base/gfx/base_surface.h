@@ -79,6 +79,14 @@ public:
 	virtual int getHeight() {
 		return _height;
 	}
+	/**
+	 * Approximate number of bytes the pixel data of this surface occupies.
+	 * Unlike getWidth()/getHeight() this never forces a lazily loaded
+	 * surface into memory.
+	 */
+	uint32 getMemUsage() const {
+		return _valid ? _width * _height * 4 : 0;
+	}
 	Common::String getFileNameStr() { return _filename; }
 	const char* getFileName() { return _filename.c_str(); }
 	//void SetWidth(int Width) { _width = Width;    }
@@ -286,6 +286,33 @@ bool BaseSurfaceOSystem::create(int width, int height) {
 	return STATUS_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceOSystem::invalidate() {
+	if (!_valid) {
+		return STATUS_OK;
+	}
+
+	// Only surfaces backed by a file can be unloaded; anything else has
+	// nowhere to restore its pixels from.
+	if (!_loaded || _filename.empty()) {
+		return STATUS_FAILED;
+	}
+
+	_surface->free();
+
+	delete[] _alphaMask;
+	_alphaMask = nullptr;
+
+	_gameRef->addMem(-_width * _height * 4);
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+	renderer->invalidateTicketsFromSurface(this);
+
+	_loaded = false;
+	_valid = false;
+
+	return STATUS_OK;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceOSystem::isTransparentAt(int x, int y) {
 	return isTransparentAtLite(x, y);
@@ -386,6 +386,43 @@ InterfaceScene::InterfaceScene(XeenEngine *vm): _vm(vm) {
 	_isAnimReset = false;
 	_overallFrame = 0;
 	_openDoor = false;
+	_backgroundKeyMazeId = -1;
+	_backgroundValid = false;
+}
+
+void InterfaceScene::drawBackground(DrawStruct *items, int count) {
+	Windows &windows = *_vm->_windows;
+	const Common::Rect sceneRect(8, 8, 224, 140);
+	int mazeId = _vm->_party->_mazeId;
+
+	assert(count <= (int)ARRAYSIZE(_backgroundKey));
+
+	// Check whether the draw list would compose the same image as last
+	// time. The maze id is part of the key because a map change reloads
+	// new graphics into the same sprite resources
+	bool valid = _backgroundValid && mazeId == _backgroundKeyMazeId;
+	for (int idx = 0; valid && idx < count; ++idx) {
+		const DrawStruct &oldItem = _backgroundKey[idx];
+		const DrawStruct &newItem = items[idx];
+		valid = oldItem._sprites == newItem._sprites && oldItem._frame == newItem._frame
+			&& oldItem._flags == newItem._flags && oldItem._scale == newItem._scale;
+	}
+
+	if (valid) {
+		// Restore the previously composed background with a single blit
+		windows[3].blitFrom(_backgroundBuffer, Common::Point(sceneRect.left, sceneRect.top));
+		return;
+	}
+
+	windows[3].drawList(items, count);
+
+	// Keep a copy of the composed background and of the list that made it
+	if (_backgroundBuffer.empty())
+		_backgroundBuffer.create(sceneRect.width(), sceneRect.height());
+	_backgroundBuffer.blitFrom(windows[3], sceneRect, Common::Point(0, 0));
+	Common::copy(items, items + count, _backgroundKey);
+	_backgroundKeyMazeId = mazeId;
+	_backgroundValid = true;
 }
 
 void InterfaceScene::drawScene() {
@@ -4374,8 +4411,11 @@ void InterfaceScene::drawIndoors() {
 	_indoorList._ground._flags = _flipDefaultGround ? SPRFLAG_HORIZ_FLIPPED : 0;
 	_indoorList._horizon._frame = 7;
 
-	// Finally draw the darn indoor scene
-	windows[3].drawList(&_indoorList[0], _indoorList.size());
+	// Finally draw the darn indoor scene. The sky and ground layers come
+	// first in the list and only change when the party moves, so they are
+	// drawn through the composed background cache
+	drawBackground(&_indoorList[0], 28);
+	windows[3].drawList(&_indoorList[28], _indoorList.size() - 28);
 
 	// Check for any character shooting
 	_isAttacking = false;
@@ -4455,8 +4495,10 @@ void InterfaceScene::drawOutdoors() {
 	_outdoorList._sky1._flags = _outdoorList._sky2._flags = _flipSky ? SPRFLAG_HORIZ_FLIPPED : 0;
 	_outdoorList._groundSprite._flags = _flipWater ? SPRFLAG_HORIZ_FLIPPED : 0;
 
-	// Finally render the outdoor scene
-	windows[3].drawList(&_outdoorList[0], _outdoorList.size());
+	// Finally render the outdoor scene. As indoors, the sky and ground
+	// tile prefix of the list goes through the composed background cache
+	drawBackground(&_outdoorList[0], 28);
+	windows[3].drawList(&_outdoorList[28], _outdoorList.size() - 28);
 
 	// Check for any character shooting
 	_isAttacking = false;
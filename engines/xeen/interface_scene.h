@@ -93,8 +93,23 @@ private:
 	XeenEngine *_vm;
 	int _combatFloatCounter;
 
+	// Cache of the composed background (sky and ground) layers of the
+	// scene view, together with the draw list prefix that produced it.
+	// While the prefix is unchanged, the background costs a single blit
+	// instead of being recomposed from dozens of sprite draws
+	XSurface _backgroundBuffer;
+	DrawStruct _backgroundKey[28];
+	int _backgroundKeyMazeId;
+	bool _backgroundValid;
+
 	void initDrawStructs();
 
+	/**
+	 * Draws the background (sky and ground) prefix of a scene draw list,
+	 * reusing the previously composed version when it is unchanged
+	 */
+	void drawBackground(DrawStruct *items, int count);
+
 	/**
 	 * Helper method for setIndoorsMonsters to set a draw structure
 	 * with the deatils for a given monster
@@ -33,7 +33,12 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 	  _renderState(FLAT) {
 	assert(numRows != 0 && numColumns != 0);
 
-	_internalBuffer = new Common::Point[numRows * numColumns];
+	_internalBuffer = new uint32[numRows * numColumns];
+
+	// Identity mapping until a lookup table is generated
+	for (uint i = 0; i < numRows * numColumns; ++i) {
+		_internalBuffer[i] = i;
+	}
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -72,30 +77,22 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 		return Common::Point(x, y);
 	}
 
-	uint32 index = point.y * _numColumns + point.x;
-
-	Common::Point newPoint(point);
-	newPoint.x += _internalBuffer[index].x;
-	newPoint.y += _internalBuffer[index].y;
+	uint32 sourceIndex = _internalBuffer[point.y * _numColumns + point.x];
 
-	return newPoint;
+	return Common::Point(sourceIndex % _numColumns, sourceIndex / _numColumns);
 }
 
 void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
 	uint32 destOffset = 0;
 
 	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const uint32 *indexRow = &_internalBuffer[y * _numColumns];
 
 		for (int16 x = subRect.left; x < subRect.right; ++x) {
 			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
+			// The table holds the absolute source pixel index
+			destBuffer[destOffset + normalizedX] = sourceBuffer[indexRow[x]];
 		}
 
 		destOffset += destWidth;
@@ -109,16 +106,11 @@ void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcB
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
 
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const uint32 *indexRow = &_internalBuffer[y * _numColumns];
 
 		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
-
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
+			// The table holds the absolute source pixel index
+			destBuffer[destOffset] = sourceBuffer[indexRow[x]];
 			destOffset++;
 		}
 	}
@@ -139,8 +131,6 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	memset(_internalBuffer, 0, _numRows * _numColumns * sizeof(uint16));
-
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -163,11 +153,9 @@ void RenderTable::generatePanoramaLookupTable() {
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
 			int32 yInCylinderCoords = int32(floor(halfHeight + ((float)y - halfHeight) * cosAlpha));
 
-			uint32 index = y * _numColumns + x;
-
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			// Store the absolute source position so the warp itself is a
+			// plain lookup
+			_internalBuffer[y * _numColumns + x] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
@@ -198,11 +186,9 @@ void RenderTable::generateTiltLookupTable() {
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
 			int32 xInCylinderCoords = int32(floor(halfWidth + ((float)x - halfWidth) * cosAlpha));
 
-			uint32 index = columnIndex + x;
-
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			// Store the absolute source position so the warp itself is a
+			// plain lookup
+			_internalBuffer[columnIndex + x] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
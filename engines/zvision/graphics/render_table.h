@@ -42,7 +42,10 @@ public:
 
 private:
 	uint _numColumns, _numRows;
-	Common::Point *_internalBuffer;
+	// Absolute source pixel index for every destination pixel, so the per
+	// frame warp is a single table lookup per pixel. The trigonometry only
+	// runs when the table is (re)generated.
+	uint32 *_internalBuffer;
 	RenderState _renderState;
 
 	struct {
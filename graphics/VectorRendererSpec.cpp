@@ -540,6 +540,7 @@ VectorRendererSpec(PixelFormat format) :
 
 	_bitmapAlphaColor = _format.RGBToColor(255, 0, 255);
 	_clippingArea = Common::Rect(0, 0, 32767, 32767);
+	_gradientCacheWrite = 0;
 }
 
 /****************************
@@ -588,6 +589,19 @@ void VectorRendererSpec<PixelType>::
 precalcGradient(int h) {
 	PixelType prevcolor = 0, color;
 
+	// Check whether these exact tables were computed recently; widgets are
+	// redrawn with the same geometry and colors frame after frame, so this
+	// hits nearly always outside theme changes.
+	for (int i = 0; i < kGradientCacheEntries; i++) {
+		const GradientCacheEntry &entry = _gradientCache[i];
+		if (entry.height == h && entry.factor == Base::_gradientFactor &&
+		    entry.start == _gradientStart && entry.end == _gradientEnd) {
+			_gradCache = entry.cache;
+			_gradIndexes = entry.indexes;
+			return;
+		}
+	}
+
 	_gradCache.resize(0);
 	_gradIndexes.resize(0);
 
@@ -599,6 +613,16 @@ precalcGradient(int h) {
 			_gradIndexes.push_back(i);
 		}
 	}
+
+	// Remember the tables, evicting round-robin
+	GradientCacheEntry &slot = _gradientCache[_gradientCacheWrite];
+	_gradientCacheWrite = (_gradientCacheWrite + 1) % kGradientCacheEntries;
+	slot.height = h;
+	slot.factor = Base::_gradientFactor;
+	slot.start = _gradientStart;
+	slot.end = _gradientEnd;
+	slot.cache = _gradCache;
+	slot.indexes = _gradIndexes;
 }
 
 template<typename PixelType>
@@ -321,6 +321,26 @@ protected:
 	Common::Array<PixelType> _gradCache;
 	Common::Array<int> _gradIndexes;
 
+	/**
+	 * Memoized results of precalcGradient. The GUI recomputes the exact
+	 * same gradient tables for every widget on every redraw, so keep the
+	 * tables of recently used (height, colors, factor) combinations
+	 * around and reuse them instead.
+	 */
+	struct GradientCacheEntry {
+		int height;
+		int factor;
+		PixelType start, end;
+		Common::Array<PixelType> cache;
+		Common::Array<int> indexes;
+
+		GradientCacheEntry() : height(-1), factor(0), start(0), end(0) {}
+	};
+
+	enum { kGradientCacheEntries = 16 };
+	GradientCacheEntry _gradientCache[kGradientCacheEntries];
+	int _gradientCacheWrite;
+
 	PixelType _bevelColor;
 	PixelType _bitmapAlphaColor;
 };
@@ -122,6 +122,20 @@ void CursorManager::replaceCursor(const void *buf, uint w, uint h, int hotspotX,
 	uint size = w * h;
 #endif
 
+	// Engines that animate the cursor tend to re-push it every frame even
+	// when nothing changed, and every push makes the backend re-convert and
+	// re-scale the pixels. Drop replacements that are identical to the
+	// cursor that is already set.
+	if (buf && cur->_data && size <= cur->_size &&
+			cur->_width == w && cur->_height == h &&
+			cur->_hotspotX == hotspotX && cur->_hotspotY == hotspotY &&
+			cur->_keycolor == keycolor && cur->_dontScale == dontScale &&
+#ifdef USE_RGB_COLOR
+			cur->_format == (format ? *format : Graphics::PixelFormat::createFormatCLUT8()) &&
+#endif
+			!memcmp(cur->_data, buf, size))
+		return;
+
 	if (cur->_size < size) {
 		delete[] cur->_data;
 		cur->_data = new byte[size];
@@ -212,6 +226,15 @@ void CursorManager::replaceCursorPalette(const byte *colors, uint start, uint nu
 	Palette *pal = _cursorPaletteStack.top();
 	uint size = 3 * num;
 
+	// As with replaceCursor, skip palette replacements that match what is
+	// already set; the backend would re-blit the cursor otherwise. A
+	// disabled palette still has to go through, since setting it in the
+	// backend is what re-enables it.
+	if (num && !pal->_disabled && pal->_data &&
+			pal->_start == start && pal->_num == num &&
+			!memcmp(pal->_data, colors, size))
+		return;
+
 	if (pal->_size < size) {
 		// Could not re-use the old buffer. Create a new one.
 		delete[] pal->_data;
@@ -21,6 +21,7 @@
  */
 
 #include "graphics/font.h"
+#include "graphics/fontman.h"
 #include "graphics/managed_surface.h"
 
 #include "common/array.h"
@@ -28,6 +29,11 @@
 
 namespace Graphics {
 
+Font::~Font() {
+	// Make sure no cached glyphs rendered from this font stay behind
+	FontMan.glyphCache().removeFont(this);
+}
+
 int Font::getKerningOffset(uint32 left, uint32 right) const {
 	return 0;
 }
@@ -116,8 +122,15 @@ void drawStringImpl(const Font &font, Surface *dst, const StringType &str, int x
 		w = font.getCharWidth(cur);
 		if (x+w > rightX)
 			break;
-		if (x+w >= leftX)
-			font.drawChar(dst, cur, x, y, color);
+		if (x+w >= leftX) {
+			// Try the glyph cache first; fonts whose output cannot be
+			// cached faithfully (e.g. anti-aliased ones) return 0 here
+			const GlyphCache::Glyph *glyph = FontMan.glyphCache().getGlyph(&font, cur, color, dst->format);
+			if (glyph)
+				GlyphCache::drawGlyph(glyph, dst, x, y);
+			else
+				font.drawChar(dst, cur, x, y, color);
+		}
 		x += w;
 	}
 }
@@ -52,7 +52,7 @@ enum TextAlign {
 class Font {
 public:
 	Font() {}
-	virtual ~Font() {}
+	virtual ~Font();
 
 	/**
 	 * Query the height of the font.
@@ -218,4 +218,213 @@ Common::String FontManager::genLocalizedFontFilename(const Common::String &filen
 #endif
 }
 
+#pragma mark -
+
+namespace {
+
+// Cap on the pixel data held by the glyph cache; when exceeded the cache is
+// simply flushed, since rebuilding the working set of glyphs is cheap.
+const uint kGlyphCacheMaxSize = 512 * 1024;
+
+template<typename PixelInt>
+bool analyzeGlyph(const Surface &a, const Surface &b, PixelInt bgA, PixelInt bgB, byte *mask, bool &solid) {
+	solid = true;
+
+	for (int y = 0; y < a.h; ++y) {
+		const PixelInt *pa = (const PixelInt *)a.getBasePtr(0, y);
+		const PixelInt *pb = (const PixelInt *)b.getBasePtr(0, y);
+
+		for (int x = 0; x < a.w; ++x, ++mask) {
+			if (pa[x] == pb[x]) {
+				// Written identically over both backgrounds: a glyph pixel
+				*mask = 1;
+			} else if (pa[x] == bgA && pb[x] == bgB) {
+				// Untouched background
+				*mask = 0;
+				solid = false;
+			} else {
+				// Output depends on the background (anti-aliasing or other
+				// blending); this glyph cannot be reproduced from a cache
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+template<typename PixelInt>
+void drawGlyphRows(const Surface &src, const byte *mask, bool solid, Surface *dst,
+		int dstX, int dstY, int srcX, int srcY, int width, int height) {
+	for (int y = 0; y < height; ++y) {
+		const PixelInt *srcP = (const PixelInt *)src.getBasePtr(srcX, srcY + y);
+		PixelInt *dstP = (PixelInt *)dst->getBasePtr(dstX, dstY + y);
+
+		if (solid) {
+			memcpy(dstP, srcP, width * sizeof(PixelInt));
+		} else {
+			const byte *m = mask + (srcY + y) * src.w + srcX;
+			for (int x = 0; x < width; ++x) {
+				if (m[x])
+					dstP[x] = srcP[x];
+			}
+		}
+	}
+}
+
+} // End of anonymous namespace
+
+GlyphCache::GlyphCache() : _totalSize(0) {
+}
+
+GlyphCache::~GlyphCache() {
+	clear();
+}
+
+void GlyphCache::clear() {
+	for (GlyphMap::iterator it = _glyphs.begin(); it != _glyphs.end(); ++it)
+		delete it->_value;
+	_glyphs.clear();
+	_totalSize = 0;
+}
+
+void GlyphCache::removeFont(const Font *font) {
+	Common::Array<Key> doomed;
+	for (GlyphMap::iterator it = _glyphs.begin(); it != _glyphs.end(); ++it) {
+		if (it->_key.font == font)
+			doomed.push_back(it->_key);
+	}
+
+	for (uint i = 0; i < doomed.size(); ++i) {
+		GlyphMap::iterator it = _glyphs.find(doomed[i]);
+		if (it->_value)
+			_totalSize -= it->_value->surface.w * it->_value->surface.h * (it->_value->surface.format.bytesPerPixel + 1);
+		delete it->_value;
+		_glyphs.erase(doomed[i]);
+	}
+}
+
+GlyphCache::Glyph *GlyphCache::rasterizeGlyph(const Font *font, uint32 chr, uint32 color, const PixelFormat &format) {
+	const Common::Rect bbox = font->getBoundingBox(chr);
+	const int left = MIN<int>(0, bbox.left);
+	const int top = MIN<int>(0, bbox.top);
+	const int right = MAX<int>(font->getCharWidth(chr), bbox.right);
+	const int bottom = MAX<int>(font->getFontHeight(), bbox.bottom);
+	const int width = right - left;
+	const int height = bottom - top;
+
+	if (width <= 0 || height <= 0)
+		return 0;
+
+	// Render the glyph over two different backgrounds. Pixels that come out
+	// identical were written opaquely by the font; pixels equal to the
+	// respective background were left alone; anything else is blended and
+	// makes the glyph uncacheable.
+	const uint32 bgA = color ^ 1;
+	const uint32 bgB = color ^ 3;
+
+	Surface a, b;
+	a.create(width, height, format);
+	b.create(width, height, format);
+	a.fillRect(Common::Rect(width, height), bgA);
+	b.fillRect(Common::Rect(width, height), bgB);
+
+	font->drawChar(&a, chr, -left, -top, color);
+	font->drawChar(&b, chr, -left, -top, color);
+
+	Glyph *glyph = new Glyph();
+	glyph->mask.resize(width * height);
+	glyph->xOffset = left;
+	glyph->yOffset = top;
+
+	bool ok;
+	switch (format.bytesPerPixel) {
+	case 1:
+		ok = analyzeGlyph<byte>(a, b, bgA, bgB, glyph->mask.begin(), glyph->solid);
+		break;
+	case 2:
+		ok = analyzeGlyph<uint16>(a, b, bgA, bgB, glyph->mask.begin(), glyph->solid);
+		break;
+	case 4:
+		ok = analyzeGlyph<uint32>(a, b, bgA, bgB, glyph->mask.begin(), glyph->solid);
+		break;
+	default:
+		ok = false;
+		break;
+	}
+
+	b.free();
+
+	if (!ok) {
+		a.free();
+		delete glyph;
+		return 0;
+	}
+
+	// Hand the first render over to the glyph; pixels outside the mask are
+	// never copied, so the background in them does not matter
+	glyph->surface = a;
+
+	return glyph;
+}
+
+const GlyphCache::Glyph *GlyphCache::getGlyph(const Font *font, uint32 chr, uint32 color, const PixelFormat &format) {
+	const Key key(font, chr, color, format);
+
+	GlyphMap::iterator it = _glyphs.find(key);
+	if (it != _glyphs.end())
+		return it->_value;
+
+	if (_totalSize > kGlyphCacheMaxSize)
+		clear();
+
+	Glyph *glyph = rasterizeGlyph(font, chr, color, format);
+	if (glyph)
+		_totalSize += glyph->surface.w * glyph->surface.h * (format.bytesPerPixel + 1);
+
+	// Remember failures too, so uncacheable glyphs are only probed once
+	_glyphs[key] = glyph;
+	return glyph;
+}
+
+void GlyphCache::drawGlyph(const Glyph *glyph, Surface *dst, int x, int y) {
+	x += glyph->xOffset;
+	y += glyph->yOffset;
+
+	int srcX = 0, srcY = 0;
+	int width = glyph->surface.w, height = glyph->surface.h;
+
+	if (x < 0) {
+		srcX = -x;
+		width -= srcX;
+		x = 0;
+	}
+	if (y < 0) {
+		srcY = -y;
+		height -= srcY;
+		y = 0;
+	}
+	if (x + width > dst->w)
+		width = dst->w - x;
+	if (y + height > dst->h)
+		height = dst->h - y;
+
+	if (width <= 0 || height <= 0)
+		return;
+
+	switch (glyph->surface.format.bytesPerPixel) {
+	case 1:
+		drawGlyphRows<byte>(glyph->surface, glyph->mask.begin(), glyph->solid, dst, x, y, srcX, srcY, width, height);
+		break;
+	case 2:
+		drawGlyphRows<uint16>(glyph->surface, glyph->mask.begin(), glyph->solid, dst, x, y, srcX, srcY, width, height);
+		break;
+	case 4:
+		drawGlyphRows<uint32>(glyph->surface, glyph->mask.begin(), glyph->solid, dst, x, y, srcX, srcY, width, height);
+		break;
+	default:
+		break;
+	}
+}
+
 } // End of namespace Graphics
@@ -26,8 +26,11 @@
 #include "common/scummsys.h"
 #include "common/singleton.h"
 #include "common/str.h"
+#include "common/array.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
+#include "graphics/pixelformat.h"
+#include "graphics/surface.h"
 
 
 namespace Graphics {
@@ -35,6 +38,85 @@ namespace Graphics {
 class Font;
 class BdfFont;
 
+/**
+ * A cache of rendered glyphs, keyed on (font, character, color, pixel
+ * format). Each glyph is rasterized once through Font::drawChar and
+ * subsequent draws of the same glyph become a masked row copy, which makes
+ * repainting the same strings every frame (launcher list, subtitles, GUI
+ * labels) considerably cheaper for non-trivial font renderers.
+ *
+ * Only glyphs whose output can be reproduced faithfully are cached: the
+ * glyph is rendered against two different backgrounds and any pixel that
+ * depends on the background (i.e. anti-aliased or otherwise blended
+ * output) marks the glyph as uncacheable, so such fonts transparently stay
+ * on the drawChar path.
+ */
+class GlyphCache {
+public:
+	struct Glyph {
+		Surface surface;          ///< glyph pixels, in the cached pixel format
+		Common::Array<byte> mask; ///< non-zero entries mark pixels belonging to the glyph
+		int xOffset, yOffset;     ///< position of the image relative to the pen position
+		bool solid;               ///< set when every pixel of the image belongs to the glyph
+
+		Glyph() : xOffset(0), yOffset(0), solid(false) {}
+		~Glyph() { surface.free(); }
+	};
+
+	GlyphCache();
+	~GlyphCache();
+
+	/**
+	 * Look up a glyph, rasterizing it on first use. Returns 0 when the
+	 * glyph cannot be cached faithfully; the caller must then fall back
+	 * to Font::drawChar.
+	 */
+	const Glyph *getGlyph(const Font *font, uint32 chr, uint32 color, const PixelFormat &format);
+
+	/**
+	 * Blit a cached glyph with the pen position at (x, y), clipped against
+	 * the destination surface.
+	 */
+	static void drawGlyph(const Glyph *glyph, Surface *dst, int x, int y);
+
+	/**
+	 * Drop all cached glyphs of a font. Called from ~Font so cache entries
+	 * can never outlive the font they were rendered from.
+	 */
+	void removeFont(const Font *font);
+
+	void clear();
+
+private:
+	struct Key {
+		const Font *font;
+		uint32 chr;
+		uint32 color;
+		PixelFormat format;
+
+		Key() : font(0), chr(0), color(0) {}
+		Key(const Font *f, uint32 c, uint32 col, const PixelFormat &fmt) :
+			font(f), chr(c), color(col), format(fmt) {}
+
+		bool operator==(const Key &k) const {
+			return font == k.font && chr == k.chr && color == k.color && format == k.format;
+		}
+	};
+
+	struct KeyHash {
+		uint operator()(const Key &k) const {
+			return (uint)((uintptr)k.font >> 4) ^ (k.chr * 7919) ^ (k.color * 31) ^ k.format.bytesPerPixel;
+		}
+	};
+
+	Glyph *rasterizeGlyph(const Font *font, uint32 chr, uint32 color, const PixelFormat &format);
+
+	// Entries mapped to 0 record glyphs known to be uncacheable
+	typedef Common::HashMap<Key, Glyph *, KeyHash> GlyphMap;
+	GlyphMap _glyphs;
+	uint _totalSize;
+};
+
 class FontManager : public Common::Singleton<FontManager> {
 public:
 	enum FontUsage {
@@ -105,6 +187,12 @@ public:
 	 */
 	Common::String genLocalizedFontFilename(const Common::String &filename) const;
 
+	/**
+	 * Returns the glyph cache shared by all text rendering going through
+	 * Font::drawString.
+	 */
+	GlyphCache &glyphCache() { return _glyphCache; }
+
 	//const Font *getFontBySize(int size???) const;
 
 private:
@@ -115,6 +203,7 @@ private:
 	Common::HashMap<Common::String, const Font *> _fontMap;
 	Common::Array<const Font *> _ownedFonts;
 	Common::String _localizedFontName;
+	GlyphCache _glyphCache;
 };
 
 
@@ -134,14 +134,19 @@ bool MacWindow::draw(ManagedSurface *g, bool forceRedraw) {
 	if (!_borderIsDirty && !_contentIsDirty && !forceRedraw)
 		return false;
 
-	if (_borderIsDirty || forceRedraw)
-		drawBorder();
-
-	_contentIsDirty = false;
-
-	// Compose
-	_composeSurface.blitFrom(_surface, Common::Rect(0, 0, _surface.w - 2, _surface.h - 2), Common::Point(2, 2));
-	_composeSurface.transBlitFrom(_borderSurface, kColorGreen);
+	// _composeSurface retains the previous composition, so an unchanged
+	// window that is only redrawn because the desktop was refreshed gets
+	// away with the blit below and skips the per-window compositing.
+	if (_borderIsDirty || _contentIsDirty) {
+		if (_borderIsDirty)
+			drawBorder();
+
+		_contentIsDirty = false;
+
+		// Compose
+		_composeSurface.blitFrom(_surface, Common::Rect(0, 0, _surface.w - 2, _surface.h - 2), Common::Point(2, 2));
+		_composeSurface.transBlitFrom(_borderSurface, kColorGreen);
+	}
 
 	g->transBlitFrom(_composeSurface, _composeSurface.getBounds(), Common::Point(_dims.left - 2, _dims.top - 2), kColorGreen2);
 
@@ -159,13 +164,26 @@ const int arrowPixels[ARROW_H][ARROW_W] = {
 		{0,1,1,1,1,1,1,1,1,1,1,0},
 		{1,1,1,1,1,1,1,1,1,1,1,1}};
 
-static void drawPixelInverted(int x, int y, int color, void *data) {
+static void drawSpanInverted(int x, int y, int width, int color, void *data) {
 	ManagedSurface *surface = (ManagedSurface *)data;
 
-	if (x >= 0 && x < surface->w && y >= 0 && y < surface->h) {
-		byte *p = (byte *)surface->getBasePtr(x, y);
+	if (y < 0 || y >= surface->h)
+		return;
+
+	// Clip the run against the surface, then walk the row directly
+	if (x < 0) {
+		width += x;
+		x = 0;
+	}
+	if (x + width > surface->w)
+		width = surface->w - x;
+	if (width <= 0)
+		return;
 
+	byte *p = (byte *)surface->getBasePtr(x, y);
+	while (width--) {
 		*p = *p == kColorWhite ? kColorBlack : kColorWhite;
+		p++;
 	}
 }
 
@@ -263,7 +281,7 @@ void MacWindow::drawSimpleBorder(ManagedSurface *g) {
 				int ry2 = ry1 + _dims.height() * _scrollSize;
 				Common::Rect rr(rx1, ry1, rx2, ry2);
 
-				Graphics::drawFilledRect(rr, kColorBlack, drawPixelInverted, g);
+				Graphics::drawFilledRect(rr, kColorBlack, drawSpanInverted, g);
 			}
 		}
 		if (closeable) {
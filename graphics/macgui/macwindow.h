@@ -226,7 +226,8 @@ public:
 	/**
 	 * Similar to that described in BaseMacWindow.
 	 * @param g See BaseMacWindow.
-	 * @param forceRedraw If true, the borders are guarranteed to redraw.
+	 * @param forceRedraw If true, the window is blitted to the target even
+	 *                    if it is unchanged (e.g. after a desktop refresh).
 	 */
 	virtual bool draw(ManagedSurface *g, bool forceRedraw = false);
 
@@ -246,7 +247,7 @@ public:
 	 * Mutator to change the title of the window.
 	 * @param title Target title of the window.
 	 */
-	void setTitle(Common::String &title) { _title = title; }
+	void setTitle(Common::String &title) { _title = title; _borderIsDirty = true; }
 	/**
 	 * Highlight the target part of the window.
 	 * Used for the default borders.
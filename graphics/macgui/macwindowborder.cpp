@@ -40,6 +40,9 @@ MacWindowBorder::~MacWindowBorder() {
 		delete _activeBorder;
 	if (_inactiveBorder)
 		delete _inactiveBorder;
+
+	_activeRaster.free();
+	_inactiveRaster.free();
 }
 
 bool MacWindowBorder::hasBorder(bool active) {
@@ -76,18 +79,24 @@ int MacWindowBorder::getOffset(MacBorderOffset offset) {
 
 void MacWindowBorder::blitBorderInto(ManagedSurface &destination, bool active) {
 
-	TransparentSurface srf;
+	TransparentSurface &srf = active ? _activeRaster : _inactiveRaster;
 	NinePatchBitmap *src = active ? _activeBorder : _inactiveBorder;
 
-	srf.create(destination.w, destination.h, destination.format);
-	srf.fillRect(Common::Rect(0, 0, srf.w, srf.h), kColorGreen2);
+	// Stretching the nine-patch is by far the most expensive part of the
+	// border drawing, and its result only depends on the target size, so
+	// keep the raster around and redo it only when the window is resized.
+	if (srf.w != destination.w || srf.h != destination.h) {
+		srf.free();
+		srf.create(destination.w, destination.h, destination.format);
+		srf.fillRect(Common::Rect(0, 0, srf.w, srf.h), kColorGreen2);
+
+		byte palette[kColorCount];
+		g_system->getPaletteManager()->grabPalette(palette, 0, kColorCount);
 
-	byte palette[kColorCount];
-	g_system->getPaletteManager()->grabPalette(palette, 0, kColorCount);
+		src->blit(srf, 0, 0, srf.w, srf.h, palette, kColorCount);
+	}
 
-	src->blit(srf, 0, 0, srf.w, srf.h, palette, kColorCount);
 	destination.transBlitFrom(srf, kColorGreen2);
-	srf.free();
 }
 
 } // End of namespace Graphics
@@ -112,6 +112,11 @@ private:
 	NinePatchBitmap *_activeBorder;
 	NinePatchBitmap *_inactiveBorder;
 
+	// Rasterized borders, kept between draws so that the nine-patch only
+	// has to be stretched again when the window size changes.
+	TransparentSurface _activeRaster;
+	TransparentSurface _inactiveRaster;
+
 	bool _activeInitialized;
 	bool _inactiveInitialized;
 
@@ -30,30 +30,30 @@ const int SCALE_THRESHOLD = 0x100;
 
 ManagedSurface::ManagedSurface() :
 		w(_innerSurface.w), h(_innerSurface.h), pitch(_innerSurface.pitch), format(_innerSurface.format),
-		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr) {
+		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr), _dirtyTracking(false) {
 }
 
 ManagedSurface::ManagedSurface(ManagedSurface &surf) :
 		w(_innerSurface.w), h(_innerSurface.h), pitch(_innerSurface.pitch), format(_innerSurface.format),
-		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr) {
+		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr), _dirtyTracking(false) {
 	*this = surf;
 }
 
 ManagedSurface::ManagedSurface(int width, int height) :
 		w(_innerSurface.w), h(_innerSurface.h), pitch(_innerSurface.pitch), format(_innerSurface.format),
-		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr) {
+		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr), _dirtyTracking(false) {
 	create(width, height);
 }
 
 ManagedSurface::ManagedSurface(int width, int height, const Graphics::PixelFormat &pixelFormat) :
 		w(_innerSurface.w), h(_innerSurface.h), pitch(_innerSurface.pitch), format(_innerSurface.format),
-		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr) {
+		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr), _dirtyTracking(false) {
 	create(width, height, pixelFormat);
 }
 
 ManagedSurface::ManagedSurface(ManagedSurface &surf, const Common::Rect &bounds) :
 		w(_innerSurface.w), h(_innerSurface.h), pitch(_innerSurface.pitch), format(_innerSurface.format),
-		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr) {
+		_disposeAfterUse(DisposeAfterUse::NO), _owner(nullptr), _dirtyTracking(false) {
 	create(surf, bounds);
 }
 
@@ -161,65 +161,75 @@ void ManagedSurface::blitFrom(const Surface &src, const Common::Point &destPos)
 	blitFrom(src, Common::Rect(0, 0, src.w, src.h), destPos);
 }
 
+template<typename TSRC, typename TDEST>
+static void convertBlit(const Surface &src, Surface &dest, const Common::Rect &srcBounds,
+		const Common::Rect &destBounds) {
+	const Graphics::PixelFormat &srcFormat = src.format;
+	const Graphics::PixelFormat &destFormat = dest.format;
+	byte rSrc, gSrc, bSrc, aSrc;
+	byte rDest, gDest, bDest;
+	double alpha;
+
+	for (int y = 0; y < srcBounds.height(); ++y) {
+		const TSRC *srcP = (const TSRC *)src.getBasePtr(srcBounds.left, srcBounds.top + y);
+		TDEST *destP = (TDEST *)dest.getBasePtr(destBounds.left, destBounds.top + y);
+
+		for (int x = 0; x < srcBounds.width(); ++x, ++srcP, ++destP) {
+			srcFormat.colorToARGB(*srcP, aSrc, rSrc, gSrc, bSrc);
+
+			if (aSrc == 0) {
+				// Completely transparent, so skip
+				continue;
+			} else if (aSrc == 0xff) {
+				// Completely opaque, so copy RGB values over
+				rDest = rSrc;
+				gDest = gSrc;
+				bDest = bSrc;
+			} else {
+				// Partially transparent, so calculate new pixel colors
+				destFormat.colorToRGB(*destP, rDest, gDest, bDest);
+				alpha = (double)aSrc / 255.0;
+				rDest = static_cast<byte>((rSrc * alpha) + (rDest * (1.0 - alpha)));
+				gDest = static_cast<byte>((gSrc * alpha) + (gDest * (1.0 - alpha)));
+				bDest = static_cast<byte>((bSrc * alpha) + (bDest * (1.0 - alpha)));
+			}
+
+			*destP = (TDEST)destFormat.ARGBToColor(0xff, rDest, gDest, bDest);
+		}
+	}
+}
+
 void ManagedSurface::blitFrom(const Surface &src, const Common::Rect &srcRect,
 		const Common::Point &destPos) {
 	Common::Rect srcBounds = srcRect;
 	Common::Rect destBounds(destPos.x, destPos.y, destPos.x + srcRect.width(),
 		destPos.y + srcRect.height());
-	uint destPixel;
-	byte rSrc, gSrc, bSrc, aSrc;
-	byte rDest, gDest, bDest;
-	double alpha;
 
 	if (!srcRect.isValidRect() || !clip(srcBounds, destBounds))
 		return;
 
-	if (format != src.format) {
-		// When the pixel format differs, both source an dest must be
-		// 2 or 4 bytes per pixel
-		assert(format.bytesPerPixel == 2 || format.bytesPerPixel == 4);
-		assert(src.format.bytesPerPixel == 2 || src.format.bytesPerPixel == 4);
-	}
-
-	for (int y = 0; y < srcBounds.height(); ++y) {
-		const byte *srcP = (const byte *)src.getBasePtr(srcBounds.left, srcBounds.top + y);
-		byte *destP = (byte *)getBasePtr(destBounds.left, destBounds.top + y);
+	if (src.format == format) {
+		// Matching surface formats, so we can do a straight copy
+		for (int y = 0; y < srcBounds.height(); ++y) {
+			const byte *srcP = (const byte *)src.getBasePtr(srcBounds.left, srcBounds.top + y);
+			byte *destP = (byte *)getBasePtr(destBounds.left, destBounds.top + y);
 
-		if (src.format == format) {
-			// Matching surface formats, so we can do a straight copy
 			Common::copy(srcP, srcP + srcBounds.width() * format.bytesPerPixel, destP);
-		} else {
-			for (int x = 0; x < srcBounds.width(); ++x,
-					srcP += src.format.bytesPerPixel,
-					destP += format.bytesPerPixel) {
-				src.format.colorToARGB(src.format.bytesPerPixel == 2 ? *(const uint16 *)srcP : *(const uint32 *)srcP,
-					aSrc, rSrc, gSrc, bSrc);
-				format.colorToRGB(format.bytesPerPixel == 2 ? *(const uint16 *)destP : *(const uint32 *)destP,
-					rDest, gDest, bDest);
-
-				if (aSrc == 0) {
-					// Completely transparent, so skip
-					continue;
-				} else if (aSrc == 0xff) {
-					// Completely opaque, so copy RGB values over
-					rDest = rSrc;
-					gDest = gSrc;
-					bDest = bSrc;
-				} else {
-					// Partially transparent, so calculate new pixel colors
-					alpha = (double)aSrc / 255.0;
-					rDest = static_cast<byte>((rSrc * alpha) + (rDest * (1.0 - alpha)));
-					gDest = static_cast<byte>((gSrc * alpha) + (gDest * (1.0 - alpha)));
-					bDest = static_cast<byte>((bSrc * alpha) + (bDest * (1.0 - alpha)));
-				}
-
-				destPixel = format.ARGBToColor(0xff, rDest, gDest, bDest);
-				if (format.bytesPerPixel == 2)
-					*(uint16 *)destP = destPixel;
-				else
-					*(uint32 *)destP = destPixel;
-			}
 		}
+	} else {
+		// When the pixel format differs, both source an dest must be
+		// 2 or 4 bytes per pixel. The conversion kernel is resolved once
+		// for the format pair rather than re-checking it per pixel.
+		if (src.format.bytesPerPixel == 2 && format.bytesPerPixel == 2)
+			convertBlit<uint16, uint16>(src, _innerSurface, srcBounds, destBounds);
+		else if (src.format.bytesPerPixel == 2 && format.bytesPerPixel == 4)
+			convertBlit<uint16, uint32>(src, _innerSurface, srcBounds, destBounds);
+		else if (src.format.bytesPerPixel == 4 && format.bytesPerPixel == 2)
+			convertBlit<uint32, uint16>(src, _innerSurface, srcBounds, destBounds);
+		else if (src.format.bytesPerPixel == 4 && format.bytesPerPixel == 4)
+			convertBlit<uint32, uint32>(src, _innerSurface, srcBounds, destBounds);
+		else
+			error("ManagedSurface::blitFrom: bytesPerPixel must be 2 or 4 when converting");
 	}
 
 	addDirtyRect(Common::Rect(0, 0, this->w, this->h));
@@ -248,6 +258,8 @@ void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, c
 	int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
 	const Graphics::PixelFormat &srcFormat = src.format;
 	const Graphics::PixelFormat &destFormat = dest.format;
+	// Decide once per blit whether pixels need conversion, not once per pixel
+	const bool sameFormat = (srcFormat == destFormat);
 	byte aSrc, rSrc, gSrc, bSrc;
 	byte rDest, gDest, bDest;
 	double alpha;
@@ -268,13 +280,12 @@ void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, c
 			if (srcVal == transColor)
 				continue;
 
-			if (srcFormat == destFormat) {
+			if (sameFormat) {
 				// Matching formats, so we can do a straight copy
 				destLine[xCtr] = overrideColor ? overrideColor : srcVal;
 			} else {
 				// Otherwise we have to manually decode and re-encode each pixel
-				srcFormat.colorToARGB(*srcLine, aSrc, rSrc, gSrc, bSrc);
-				destFormat.colorToRGB(destLine[xCtr], rDest, gDest, bDest);
+				srcFormat.colorToARGB(srcVal, aSrc, rSrc, gSrc, bSrc);
 
 				if (aSrc == 0) {
 					// Completely transparent, so skip
@@ -286,6 +297,7 @@ void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, c
 					bDest = bSrc;
 				} else {
 					// Partially transparent, so calculate new pixel colors
+					destFormat.colorToRGB(destLine[xCtr], rDest, gDest, bDest);
 					alpha = (double)aSrc / 255.0;
 					rDest = static_cast<byte>((rSrc * alpha) + (rDest * (1.0 - alpha)));
 					gDest = static_cast<byte>((gSrc * alpha) + (gDest * (1.0 - alpha)));
@@ -326,12 +338,43 @@ void ManagedSurface::markAllDirty() {
 }
 
 void ManagedSurface::addDirtyRect(const Common::Rect &r) {
+	Common::Rect bounds = r;
+	bounds.clip(Common::Rect(0, 0, this->w, this->h));
+	if (bounds.isEmpty())
+		return;
+
 	if (_owner) {
-		Common::Rect bounds = r;
-		bounds.clip(Common::Rect(0, 0, this->w, this->h));
-		bounds.translate(_offsetFromOwner.x, _offsetFromOwner.y);
-		_owner->addDirtyRect(bounds);
+		Common::Rect ownerBounds = bounds;
+		ownerBounds.translate(_offsetFromOwner.x, _offsetFromOwner.y);
+		_owner->addDirtyRect(ownerBounds);
+	}
+
+	if (!_dirtyTracking)
+		return;
+
+	// Grow an existing rect rather than adding overlapping entries, so the
+	// list stays short for the usual pattern of localized redraws
+	for (uint idx = 0; idx < _dirtyRects.size(); ++idx) {
+		Common::Rect &dr = _dirtyRects[idx];
+		if (dr.contains(bounds))
+			return;
+		if (dr.intersects(bounds)) {
+			dr.extend(bounds);
+			return;
+		}
 	}
+
+	// Past a sane list size the per-rect bookkeeping costs more than the
+	// extra pixels, so collapse everything into a single bounding rect
+	if (_dirtyRects.size() >= 50) {
+		for (uint idx = 1; idx < _dirtyRects.size(); ++idx)
+			_dirtyRects[0].extend(_dirtyRects[idx]);
+		_dirtyRects[0].extend(bounds);
+		_dirtyRects.resize(1);
+		return;
+	}
+
+	_dirtyRects.push_back(bounds);
 }
 
 void ManagedSurface::clear(uint color) {
@@ -25,6 +25,7 @@
 
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
+#include "common/array.h"
 #include "common/rect.h"
 #include "common/types.h"
 
@@ -61,6 +62,18 @@ private:
 	 * the offset from the parent's top-left corner this sub-surface starts at
 	 */
 	Common::Point _offsetFromOwner;
+
+	/**
+	 * Set when the surface accumulates the areas touched by draw and blit
+	 * operations, for retrieval via getDirtyRects
+	 */
+	bool _dirtyTracking;
+
+	/**
+	 * Accumulated dirty areas when dirty tracking is enabled. Once the list
+	 * grows beyond a sane size it is collapsed into a single bounding rect.
+	 */
+	Common::Array<Common::Rect> _dirtyRects;
 protected:
 	/**
 	 * Clips the given source bounds so the passed destBounds will be entirely on-screen
@@ -197,7 +210,7 @@ public:
 	/**
 	 * Clears any pending dirty rects that have been generated for the surface
 	 */
-	virtual void clearDirtyRects() {}
+	virtual void clearDirtyRects() { _dirtyRects.clear(); }
 
 	/**
 	 * When the managed surface is a sub-section of a parent surface, returns the
@@ -287,6 +300,34 @@ public:
 	 */
 	void markAllDirty();
 
+	/**
+	 * Enable or disable dirty rect accumulation. When enabled, every draw
+	 * and blit operation records the area it touched, so the changed
+	 * regions can later be pushed to the backend in one batch via
+	 * OSystem::copyRectsToScreen. Tracking is off by default.
+	 */
+	void setDirtyTracking(bool enable) {
+		_dirtyTracking = enable;
+		if (!enable)
+			_dirtyRects.clear();
+	}
+
+	/**
+	 * Returns whether dirty rect accumulation is enabled
+	 */
+	bool isDirtyTracking() const { return _dirtyTracking; }
+
+	/**
+	 * Manually mark an area as dirty, for code that writes to the surface
+	 * data directly rather than through the drawing methods
+	 */
+	void markDirty(const Common::Rect &r) { addDirtyRect(r); }
+
+	/**
+	 * Returns the accumulated dirty areas since the last clearDirtyRects call
+	 */
+	const Common::Array<Common::Rect> &getDirtyRects() const { return _dirtyRects; }
+
 	/**
 	 * Copies a bitmap to the Surface internal buffer. The pixel format
 	 * of buffer must match the pixel format of the Surface.
@@ -28,6 +28,7 @@ MODULE_OBJS := \
 	scaler/thumbnail_intern.o \
 	screen.o \
 	sjis.o \
+	spanblit.o \
 	surface.o \
 	transform_struct.o \
 	transform_tools.o \
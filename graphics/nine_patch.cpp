@@ -133,6 +133,18 @@ void NinePatchSide::calcOffsets(int len) {
 		if (j + 1 < _m.size())
 			_m[j + 1]->dest_offset += remaining_stretch;
 	}
+
+	/* build the stretch map: the source offset every destination pixel
+	   takes its color from. Fixed regions map one to one, stretched
+	   regions repeat the nearest neighbour arithmetic of
+	   TransparentSurface::scale() so the result stays identical to a
+	   per-region scaled blit */
+	_runMap.resize(len);
+	for (i = 0; i < _m.size(); ++i) {
+		for (int k = 0; k < _m[i]->dest_length; ++k)
+			_runMap[_m[i]->dest_offset + k] = _m[i]->offset +
+				(_m[i]->ratio == 0 ? k : (k * _m[i]->length) / _m[i]->dest_length);
+	}
 }
 
 NinePatchBitmap::NinePatchBitmap(Graphics::TransparentSurface *bmp, bool owns_bitmap) {
@@ -145,6 +157,7 @@ NinePatchBitmap::NinePatchBitmap(Graphics::TransparentSurface *bmp, bool owns_bi
 	_v._m.clear();
 	_cached_dw = 0;
 	_cached_dh = 0;
+	_cached_bmp = nullptr;
 	_width = bmp->w - 2;
 	_height = bmp->h - 2;
 
@@ -216,13 +229,15 @@ void NinePatchBitmap::blit(Graphics::Surface &target, int dx, int dy, int dw, in
 		return;
 	}
 
-	/* only recalculate the offsets if they have changed since the last draw */
+	/* only restretch the bitmap if the size has changed since the last draw */
 	if (_cached_dw != dw || _cached_dh != dh) {
 		_h.calcOffsets(dw);
 		_v.calcOffsets(dh);
 
 		_cached_dw = dw;
 		_cached_dh = dh;
+
+		rebuildCachedBitmap();
 	}
 
 	/* Handle CLUT8 */
@@ -264,22 +279,40 @@ NinePatchBitmap::~NinePatchBitmap() {
 		_bmp->free();
 		delete _bmp;
 	}
+
+	if (_cached_bmp) {
+		_cached_bmp->free();
+		delete _cached_bmp;
+	}
 }
 
-void NinePatchBitmap::drawRegions(Graphics::Surface &target, int dx, int dy, int dw, int dh) {
-	/* draw each region */
-	for (uint i = 0; i < _v._m.size(); ++i) {
-		for (uint j = 0; j < _h._m.size(); ++j) {
-			Common::Rect r(_h._m[j]->offset, _v._m[i]->offset,
-						_h._m[j]->offset + _h._m[j]->length, _v._m[i]->offset + _v._m[i]->length);
-
-			_bmp->blit(target, dx + _h._m[j]->dest_offset, dy + _v._m[i]->dest_offset,
-					Graphics::FLIP_NONE, &r, TS_ARGB(255, 255, 255, 255),
-					_h._m[j]->dest_length, _v._m[i]->dest_length);
-		}
+void NinePatchBitmap::rebuildCachedBitmap() {
+	if (!_cached_bmp)
+		_cached_bmp = new TransparentSurface();
+	else
+		_cached_bmp->free();
+
+	_cached_bmp->create(_cached_dw, _cached_dh, _bmp->format);
+	_cached_bmp->setAlphaMode(_bmp->getAlphaMode());
+
+	/* compose the stretched bitmap from the two run maps. Every
+	   destination pixel takes its color straight from the source pixel
+	   the maps point at, so this is plain copying without any blending */
+	for (int y = 0; y < _cached_dh; ++y) {
+		const uint32 *src = (const uint32 *)_bmp->getBasePtr(0, _v._runMap[y]);
+		uint32 *dst = (uint32 *)_cached_bmp->getBasePtr(0, y);
+
+		for (int x = 0; x < _cached_dw; ++x)
+			dst[x] = src[_h._runMap[x]];
 	}
 }
 
+void NinePatchBitmap::drawRegions(Graphics::Surface &target, int dx, int dy, int dw, int dh) {
+	/* the cached bitmap is already stretched to dw x dh, so all that is
+	   left of the region drawing is a plain blit to the target position */
+	_cached_bmp->blit(target, dx, dy);
+}
+
 void NinePatchBitmap::blitClip(Graphics::Surface &target, Common::Rect clip, int dx, int dy, int dw, int dh) {
 	/* don't draw bitmaps that are smaller than the fixed area */
 	if (dw < _h._fix || dh < _v._fix)
@@ -293,26 +326,18 @@ void NinePatchBitmap::blitClip(Graphics::Surface &target, Common::Rect clip, int
 		return;
 	}
 
-	/* only recalculate the offsets if they have changed since the last draw */
+	/* only restretch the bitmap if the size has changed since the last draw */
 	if (_cached_dw != dw || _cached_dh != dh) {
 		_h.calcOffsets(dw);
 		_v.calcOffsets(dh);
 
 		_cached_dw = dw;
 		_cached_dh = dh;
-	}
-
-	/* draw each region */
-	for (uint i = 0; i < _v._m.size(); ++i) {
-		for (uint j = 0; j < _h._m.size(); ++j) {
-			Common::Rect r(_h._m[j]->offset, _v._m[i]->offset,
-				_h._m[j]->offset + _h._m[j]->length, _v._m[i]->offset + _v._m[i]->length);
 
-			_bmp->blitClip(target, clip, dx + _h._m[j]->dest_offset, dy + _v._m[i]->dest_offset,
-				Graphics::FLIP_NONE, &r, TS_ARGB(255, 255, 255, 255),
-				_h._m[j]->dest_length, _v._m[i]->dest_length);
-		}
+		rebuildCachedBitmap();
 	}
+
+	_cached_bmp->blitClip(target, clip, dx, dy);
 }
 
 byte NinePatchBitmap::getColorIndex(uint32 target, byte* palette) {
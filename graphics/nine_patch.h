@@ -68,6 +68,10 @@ public:
 	Common::Array<NinePatchMark *> _m;
 	int _fix;
 
+	// Stretch map for the last target length handed to calcOffsets: the
+	// source offset along this side for every destination pixel.
+	Common::Array<int> _runMap;
+
 	NinePatchSide() : _fix(0) {}
 	~NinePatchSide();
 
@@ -82,6 +86,7 @@ class NinePatchBitmap {
 	bool _destroy_bmp;
 	int _width, _height;
 	int _cached_dw, _cached_dh;
+	Graphics::TransparentSurface *_cached_bmp;
 	Common::HashMap<uint32, int> _cached_colors;
 
 public:
@@ -101,6 +106,7 @@ public:
 private:
 
 	void drawRegions(Graphics::Surface &target, int dx, int dy, int dw, int dh);
+	void rebuildCachedBitmap();
 
 	// Assumes color is in the palette
 	byte getColorIndex(uint32 target, byte *palette);
@@ -72,6 +72,13 @@ void drawHLine(int x1, int x2, int y, int color, void (*plotProc)(int, int, int,
 		(*plotProc)(x, y, color, data);
 }
 
+void drawHLine(int x1, int x2, int y, int color, void (*spanProc)(int, int, int, int, void *), void *data) {
+	if (x1 > x2)
+		SWAP(x1, x2);
+
+	(*spanProc)(x1, y, x2 - x1 + 1, color, data);
+}
+
 void drawVLine(int x, int y1, int y2, int color, void (*plotProc)(int, int, int, void *), void *data) {
 	if (y1 > y2)
 		SWAP(y1, y2);
@@ -249,6 +256,11 @@ void drawFilledRect(Common::Rect &rect, int color, void (*plotProc)(int, int, in
 		drawHLine(rect.left, rect.right, y, color, plotProc, data);
 }
 
+void drawFilledRect(Common::Rect &rect, int color, void (*spanProc)(int, int, int, int, void *), void *data) {
+	for (int y = rect.top; y <= rect.bottom; y++)
+		drawHLine(rect.left, rect.right, y, color, spanProc, data);
+}
+
 // http://members.chello.at/easyfilter/bresenham.html
 void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data) {
 	if (rect.height() < rect.width()) {
@@ -346,7 +358,11 @@ void drawRoundRect(Common::Rect &rect, int arc, int color, bool filled, void (*p
 
 // Based on public-domain code by Darel Rex Finley, 2007
 // http://alienryderflex.com/polygon_fill/
-void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, void (*plotProc)(int, int, int, void *), void *data) {
+//
+// Shared by the per-pixel and the span-based entry points below; the
+// drawHLine overload matching the callback type does the actual plotting.
+template<typename ProcType>
+static void drawPolygonScanImpl(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, ProcType proc, void *data) {
 	int *nodeX = (int *)calloc(npoints, sizeof(int));
 	int i, j;
 
@@ -375,7 +391,7 @@ void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, in
 				nodeX[i] = MAX<int16>(nodeX[i], bbox.left);
 				nodeX[i + 1] = MIN<int16>(nodeX[i + 1], bbox.right);
 
-				drawHLine(nodeX[i], nodeX[i + 1], pixelY, color, plotProc, data);
+				drawHLine(nodeX[i], nodeX[i + 1], pixelY, color, proc, data);
 			}
 		}
 	}
@@ -383,6 +399,14 @@ void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, in
 	free(nodeX);
 }
 
+void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, void (*plotProc)(int, int, int, void *), void *data) {
+	drawPolygonScanImpl(polyX, polyY, npoints, bbox, color, plotProc, data);
+}
+
+void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color, void (*spanProc)(int, int, int, int, void *), void *data) {
+	drawPolygonScanImpl(polyX, polyY, npoints, bbox, color, spanProc, data);
+}
+
 // http://members.chello.at/easyfilter/bresenham.html
 void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data) {
 	int a = abs(x1-x0), b = abs(y1-y0), b1 = b&1; /* values of diameter */
@@ -39,6 +39,19 @@ void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, in
 								void (*plotProc)(int, int, int, void *), void *data);
 void drawEllipse(int x0, int y0, int x1, int y1, int color, bool filled, void (*plotProc)(int, int, int, void *), void *data);
 
+/**
+ * Span-based variants of the fill primitives above. Instead of calling a
+ * plot callback once per pixel they hand each horizontal run to
+ * spanProc(x, y, width, color, data) once, so a filler writing into a
+ * surface can blit the whole run at memset speed rather than paying a
+ * function call per pixel. The pixels covered are exactly the same as
+ * with the per-pixel variants.
+ */
+void drawHLine(int x1, int x2, int y, int color, void (*spanProc)(int, int, int, int, void *), void *data);
+void drawFilledRect(Common::Rect &rect, int color, void (*spanProc)(int, int, int, int, void *), void *data);
+void drawPolygonScan(int *polyX, int *polyY, int npoints, Common::Rect &bbox, int color,
+								void (*spanProc)(int, int, int, int, void *), void *data);
+
 } // End of namespace Graphics
 
 #endif
@@ -53,37 +53,42 @@ void Super2xSaITemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uin
 		bP = (const uint16 *)srcPtr;
 		dP = (uint16 *)dstPtr;
 
-		for (int i = 0; i < width; ++i) {
-			unsigned color4, color5, color6;
-			unsigned color1, color2, color3;
-			unsigned colorA0, colorA1, colorA2, colorA3;
-			unsigned colorB0, colorB1, colorB2, colorB3;
-			unsigned colorS1, colorS2;
-			unsigned product1a, product1b, product2a, product2b;
+		unsigned color4, color5, color6;
+		unsigned color1, color2, color3;
+		unsigned colorA0, colorA1, colorA2, colorA3;
+		unsigned colorB0, colorB1, colorB2, colorB3;
+		unsigned colorS1, colorS2;
 
 //---------------------------------------    B1 B2
 //                                         4  5  6 S2
 //                                         1  2  3 S1
 //                                           A1 A2
 
-			colorB0 = *(bP - nextlineSrc - 1);
-			colorB1 = *(bP - nextlineSrc);
-			colorB2 = *(bP - nextlineSrc + 1);
-			colorB3 = *(bP - nextlineSrc + 2);
+		// Preload the neighborhood of the first pixel. From then on each
+		// iteration only fetches the incoming right-hand column and shifts
+		// the previously loaded pixels one column to the left.
+		colorB0 = *(bP - nextlineSrc - 1);
+		colorB1 = *(bP - nextlineSrc);
+		colorB2 = *(bP - nextlineSrc + 1);
 
-			color4 = *(bP - 1);
-			color5 = *(bP);
-			color6 = *(bP + 1);
-			colorS2 = *(bP + 2);
+		color4 = *(bP - 1);
+		color5 = *(bP);
+		color6 = *(bP + 1);
 
-			color1 = *(bP + nextlineSrc - 1);
-			color2 = *(bP + nextlineSrc);
-			color3 = *(bP + nextlineSrc + 1);
-			colorS1 = *(bP + nextlineSrc + 2);
+		color1 = *(bP + nextlineSrc - 1);
+		color2 = *(bP + nextlineSrc);
+		color3 = *(bP + nextlineSrc + 1);
 
-			colorA0 = *(bP + 2 * nextlineSrc - 1);
-			colorA1 = *(bP + 2 * nextlineSrc);
-			colorA2 = *(bP + 2 * nextlineSrc + 1);
+		colorA0 = *(bP + 2 * nextlineSrc - 1);
+		colorA1 = *(bP + 2 * nextlineSrc);
+		colorA2 = *(bP + 2 * nextlineSrc + 1);
+
+		for (int i = 0; i < width; ++i) {
+			unsigned product1a, product1b, product2a, product2b;
+
+			colorB3 = *(bP - nextlineSrc + 2);
+			colorS2 = *(bP + 2);
+			colorS1 = *(bP + nextlineSrc + 2);
 			colorA3 = *(bP + 2 * nextlineSrc + 2);
 
 //--------------------------------------
@@ -141,6 +146,11 @@ void Super2xSaITemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uin
 			*(dP + dstPitch/2 + 0) = (uint16) product2a;
 			*(dP + dstPitch/2 + 1) = (uint16) product2b;
 
+			colorB0 = colorB1; colorB1 = colorB2; colorB2 = colorB3;
+			color4 = color5; color5 = color6; color6 = colorS2;
+			color1 = color2; color2 = color3; color3 = colorS1;
+			colorA0 = colorA1; colorA1 = colorA2; colorA2 = colorA3;
+
 			bP += 1;
 			dP += 2;
 		}
@@ -167,26 +177,32 @@ void SuperEagleTemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uin
 	while (height--) {
 		bP = (const uint16 *)srcPtr;
 		dP = (uint16 *)dstPtr;
+
+		unsigned color4, color5, color6;
+		unsigned color1, color2, color3;
+		unsigned colorA1, colorA2, colorB1, colorB2, colorS1, colorS2;
+
+		// Preload the neighborhood of the first pixel. From then on each
+		// iteration only fetches the incoming right-hand column and shifts
+		// the previously loaded pixels one column to the left.
+		colorB1 = *(bP - nextlineSrc);
+
+		color4 = *(bP - 1);
+		color5 = *(bP);
+		color6 = *(bP + 1);
+
+		color1 = *(bP + nextlineSrc - 1);
+		color2 = *(bP + nextlineSrc);
+		color3 = *(bP + nextlineSrc + 1);
+
+		colorA1 = *(bP + 2 * nextlineSrc);
+
 		for (int i = 0; i < width; ++i) {
-			unsigned color4, color5, color6;
-			unsigned color1, color2, color3;
-			unsigned colorA1, colorA2, colorB1, colorB2, colorS1, colorS2;
 			unsigned product1a, product1b, product2a, product2b;
 
-			colorB1 = *(bP - nextlineSrc);
 			colorB2 = *(bP - nextlineSrc + 1);
-
-			color4 = *(bP - 1);
-			color5 = *(bP);
-			color6 = *(bP + 1);
 			colorS2 = *(bP + 2);
-
-			color1 = *(bP + nextlineSrc - 1);
-			color2 = *(bP + nextlineSrc);
-			color3 = *(bP + nextlineSrc + 1);
 			colorS1 = *(bP + nextlineSrc + 2);
-
-			colorA1 = *(bP + 2 * nextlineSrc);
 			colorA2 = *(bP + 2 * nextlineSrc + 1);
 
 			// --------------------------------------
@@ -252,6 +268,11 @@ void SuperEagleTemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uin
 			*(dP + dstPitch/2 + 0) = (uint16) product2a;
 			*(dP + dstPitch/2 + 1) = (uint16) product2b;
 
+			colorB1 = colorB2;
+			color4 = color5; color5 = color6; color6 = colorS2;
+			color1 = color2; color2 = color3; color3 = colorS1;
+			colorA1 = colorA2;
+
 			bP += 1;
 			dP += 2;
 		}
@@ -280,34 +301,39 @@ void _2xSaITemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32
 		bP = (const uint16 *)srcPtr;
 		dP = (uint16 *)dstPtr;
 
-		for (int i = 0; i < width; ++i) {
-
-			unsigned colorA, colorB, colorC, colorD,
-				colorE, colorF, colorG, colorH, colorI, colorJ, colorK, colorL, colorM, colorN, colorO;
-			unsigned product, product1, product2;
+		unsigned colorA, colorB, colorC, colorD,
+			colorE, colorF, colorG, colorH, colorI, colorJ, colorK, colorL, colorM, colorN, colorO;
 
 //---------------------------------------
 // Map of the pixels:                    I|E F|J
 //                                       G|A B|K
 //                                       H|C D|L
 //                                       M|N O|P
-			colorI = *(bP - nextlineSrc - 1);
-			colorE = *(bP - nextlineSrc);
-			colorF = *(bP - nextlineSrc + 1);
-			colorJ = *(bP - nextlineSrc + 2);
 
-			colorG = *(bP - 1);
-			colorA = *(bP);
-			colorB = *(bP + 1);
-			colorK = *(bP + 2);
+		// Preload the neighborhood of the first pixel. From then on each
+		// iteration only fetches the incoming right-hand column and shifts
+		// the previously loaded pixels one column to the left.
+		colorI = *(bP - nextlineSrc - 1);
+		colorE = *(bP - nextlineSrc);
+		colorF = *(bP - nextlineSrc + 1);
 
-			colorH = *(bP + nextlineSrc - 1);
-			colorC = *(bP + nextlineSrc);
-			colorD = *(bP + nextlineSrc + 1);
-			colorL = *(bP + nextlineSrc + 2);
+		colorG = *(bP - 1);
+		colorA = *(bP);
+		colorB = *(bP + 1);
+
+		colorH = *(bP + nextlineSrc - 1);
+		colorC = *(bP + nextlineSrc);
+		colorD = *(bP + nextlineSrc + 1);
+
+		colorM = *(bP + 2 * nextlineSrc - 1);
+		colorN = *(bP + 2 * nextlineSrc);
+
+		for (int i = 0; i < width; ++i) {
+			unsigned product, product1, product2;
 
-			colorM = *(bP + 2 * nextlineSrc - 1);
-			colorN = *(bP + 2 * nextlineSrc);
+			colorJ = *(bP - nextlineSrc + 2);
+			colorK = *(bP + 2);
+			colorL = *(bP + nextlineSrc + 2);
 			colorO = *(bP + 2 * nextlineSrc + 1);
 
 			if ((colorA == colorD) && (colorB != colorC)) {
@@ -393,6 +419,11 @@ void _2xSaITemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32
 			*(dP + dstPitch/2 + 0) = (uint16) product1;
 			*(dP + dstPitch/2 + 1) = (uint16) product2;
 
+			colorI = colorE; colorE = colorF; colorF = colorJ;
+			colorG = colorA; colorA = colorB; colorB = colorK;
+			colorH = colorC; colorC = colorD; colorD = colorL;
+			colorM = colorN; colorN = colorO;
+
 			bP += 1;
 			dP += 2;
 		}
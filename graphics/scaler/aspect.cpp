@@ -347,4 +347,98 @@ void Normal2xAspect(const uint8  *srcPtr,
 	}
 }
 
+#else	// !USE_ARM_SCALER_ASM
+
+/**
+ * Write a source line to the destination doubled horizontally.
+ */
+static inline void doubleLine(uint16 *dst, const uint16 *src, int width) {
+	while (width--) {
+		const uint16 color = *src++;
+		dst[0] = color;
+		dst[1] = color;
+		dst += 2;
+	}
+}
+
+/**
+ * Like interpolate5Line(), but writes every interpolated pixel twice,
+ * doubling the line horizontally in the same pass.
+ */
+template<typename ColorMask, int scale>
+static inline void interpolate5DoubleLine(uint16 *dst, const uint16 *srcA, const uint16 *srcB, int width) {
+	if (srcA == srcB) {
+		// Both vertical taps fall on the same source line, so the blend
+		// degenerates to a copy.
+		doubleLine(dst, srcA, width);
+		return;
+	}
+
+	while (width--) {
+		uint16 color;
+		if (scale == 1)
+			color = interpolate16_7_1<ColorMask>(*srcB++, *srcA++);
+		else
+			color = interpolate16_5_3<ColorMask>(*srcB++, *srcA++);
+		dst[0] = color;
+		dst[1] = color;
+		dst += 2;
+	}
+}
+
+/**
+ * A 2x scaler which also does aspect ratio correction, producing the
+ * same result as Normal2x followed by the 6/5 vertical stretch but in a
+ * single pass, so e.g. a 320x200 surface becomes 640x480 without the
+ * intermediate frame being read back and rewritten. Because a line of
+ * the doubled image is just a source line written twice horizontally,
+ * the vertical blend is done at source width and each blended pixel is
+ * stored twice.
+ */
+template<typename ColorMask>
+void Normal2xAspectTemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
+	const int scaledHeight = 2 * height;
+
+#define SRC_LINE(i)	((const uint16 *)(const void *)(srcPtr + ((i) >> 1) * srcPitch))
+
+	for (int y = 0; y < scaledHeight * 6 / 5; ++y) {
+		// First doubled line of the five this output group is built from
+		const int base = (y / 6) * 5;
+		uint16 *dst = (uint16 *)(void *)(dstPtr + y * dstPitch);
+
+		// Bilinear filter five doubled input lines onto six output lines,
+		// like Normal1xAspect does on the unscaled image
+		switch (y % 6) {
+		case 0:
+			doubleLine(dst, SRC_LINE(base), width);
+			break;
+		case 1:
+			interpolate5DoubleLine<ColorMask, 1>(dst, SRC_LINE(base), SRC_LINE(base + 1), width);
+			break;
+		case 2:
+			interpolate5DoubleLine<ColorMask, 2>(dst, SRC_LINE(base + 1), SRC_LINE(base + 2), width);
+			break;
+		case 3:
+			interpolate5DoubleLine<ColorMask, 2>(dst, SRC_LINE(base + 3), SRC_LINE(base + 2), width);
+			break;
+		case 4:
+			interpolate5DoubleLine<ColorMask, 1>(dst, SRC_LINE(base + 4), SRC_LINE(base + 3), width);
+			break;
+		case 5:
+			doubleLine(dst, SRC_LINE(base + 4), width);
+			break;
+		}
+	}
+
+#undef SRC_LINE
+}
+
+void Normal2xAspect(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height) {
+	extern int gBitFormat;
+	if (gBitFormat == 565)
+		Normal2xAspectTemplate<Graphics::ColorMasks<565> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+	else
+		Normal2xAspectTemplate<Graphics::ColorMasks<555> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
+}
+
 #endif	// USE_ARM_SCALER_ASM
@@ -67,8 +67,12 @@ int stretch200To240(uint8 *buf,
  */
 DECLARE_SCALER(Normal1xAspect);
 
-#ifdef USE_ARM_SCALER_ASM
+/**
+ * A 2x scaler with fused aspect ratio correction: it produces the same
+ * image as Normal2x followed by the 6/5 vertical stretch, but in a
+ * single pass, so a 320x200 surface is scaled straight to 640x480
+ * without the intermediate frame being touched a second time.
+ */
 DECLARE_SCALER(Normal2xAspect);
-#endif
 
 #endif
@@ -143,3 +143,54 @@ void DownscaleHorizByThreeQuarters(const uint8 *srcPtr, uint32 srcPitch, uint8 *
 	else
 		DownscaleHorizByThreeQuartersTemplate<Graphics::ColorMasks<555> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
 }
+
+/**
+ * This filter (down)scales the source image to an arbitrary smaller
+ * resolution with a box filter: every destination pixel is the rounded
+ * average of the source pixels its box maps onto. See the header for
+ * details.
+ */
+template<typename ColorMask>
+void DownscaleByAreaTemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, int dstWidth, int dstHeight) {
+	for (int y = 0; y < dstHeight; y++) {
+		const int sy0 = y * height / dstHeight;
+		int sy1 = (y + 1) * height / dstHeight;
+		if (sy1 == sy0)
+			sy1 = sy0 + 1;
+
+		uint16 *work = (uint16 *)(void *)(dstPtr + y * dstPitch);
+
+		for (int x = 0; x < dstWidth; x++) {
+			const int sx0 = x * width / dstWidth;
+			int sx1 = (x + 1) * width / dstWidth;
+			if (sx1 == sx0)
+				sx1 = sx0 + 1;
+
+			uint32 red = 0, green = 0, blue = 0;
+			for (int sy = sy0; sy < sy1; sy++) {
+				const uint16 *src = ((const uint16 *)(const void *)(srcPtr + sy * srcPitch)) + sx0;
+				for (int sx = sx0; sx < sx1; sx++) {
+					const uint32 color = *src++;
+					red += (color & ColorMask::kRedMask) >> ColorMask::kRedShift;
+					green += (color & ColorMask::kGreenMask) >> ColorMask::kGreenShift;
+					blue += (color & ColorMask::kBlueMask) >> ColorMask::kBlueShift;
+				}
+			}
+
+			const uint32 area = (sx1 - sx0) * (sy1 - sy0);
+			red = (red + area / 2) / area;
+			green = (green + area / 2) / area;
+			blue = (blue + area / 2) / area;
+
+			*work++ = (uint16)((red << ColorMask::kRedShift) | (green << ColorMask::kGreenShift) | (blue << ColorMask::kBlueShift));
+		}
+	}
+}
+
+void DownscaleByArea(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, int dstWidth, int dstHeight) {
+	extern int gBitFormat;
+	if (gBitFormat == 565)
+		DownscaleByAreaTemplate<Graphics::ColorMasks<565> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height, dstWidth, dstHeight);
+	else
+		DownscaleByAreaTemplate<Graphics::ColorMasks<555> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height, dstWidth, dstHeight);
+}
@@ -44,4 +44,15 @@ DECLARE_SCALER(DownscaleHorizByHalf);
  */
 DECLARE_SCALER(DownscaleHorizByThreeQuarters);
 
+/**
+ * This filter (down)scales the source image to an arbitrary smaller
+ * resolution, e.g. a 640x480 game onto a 480x272 handheld screen. Every
+ * destination pixel is the rounded average of the source pixels its box
+ * maps onto, which keeps detail that nearest neighbour sampling drops.
+ * Unlike the fixed ratio filters above this takes the destination size
+ * explicitly. It can only shrink: dstWidth and dstHeight must not
+ * exceed width and height.
+ */
+void DownscaleByArea(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, int dstWidth, int dstHeight);
+
 #endif
@@ -139,8 +139,15 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
 			const int yuv5 = YUV(5);
+#ifdef USE_HQ_SCALER_SSE2
+			// The scalar w5 != wN tests are merely a short cut: identical
+			// pixels always map to identical YUV values, so the vector
+			// kernel can compare all eight neighbours unconditionally.
+			int pattern = diffYUVPattern(yuv5, YUV(1), YUV(2), YUV(3), YUV(4),
+			                             YUV(6), YUV(7), YUV(8), YUV(9));
+#else
+			int pattern = 0;
 			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
 			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
 			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
@@ -149,6 +156,7 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
 			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
 			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
+#endif
 
 			switch (pattern) {
 			case 0:
@@ -143,8 +143,14 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
 			const int yuv5 = YUV(5);
+#ifdef USE_HQ_SCALER_SSE2
+			// See HQ2x_implementation: identical pixels can never exceed the
+			// YUV thresholds, so the w5 != wN short cuts are not needed here.
+			int pattern = diffYUVPattern(yuv5, YUV(1), YUV(2), YUV(3), YUV(4),
+			                             YUV(6), YUV(7), YUV(8), YUV(9));
+#else
+			int pattern = 0;
 			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
 			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
 			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
@@ -153,6 +159,7 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
 			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
 			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
+#endif
 
 			switch (pattern) {
 			case 0:
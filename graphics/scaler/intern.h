@@ -218,4 +218,49 @@ static inline bool diffYUV(int yuv1, int yuv2) {
 */
 }
 
+#ifdef __SSE2__
+#define USE_HQ_SCALER_SSE2
+#include <emmintrin.h>
+
+/**
+ * Compute the hq scaler neighbour pattern for all eight pixels surrounding
+ * the center pixel in one go. This is equivalent to performing diffYUV()
+ * against each neighbour and setting the corresponding pattern bit, but does
+ * the 24 threshold tests with two 16-lane byte compares instead.
+ *
+ * The YUV values are encoded 8-8-8 (as produced by the RGBtoYUV table), so
+ * each channel occupies exactly one byte and the per-channel thresholds can
+ * be applied with saturating byte arithmetic.
+ */
+static inline int diffYUVPattern(uint32 yuv5,
+                                 uint32 yuv1, uint32 yuv2, uint32 yuv3, uint32 yuv4,
+                                 uint32 yuv6, uint32 yuv7, uint32 yuv8, uint32 yuv9) {
+	// Per-byte thresholds, matching trY/trU/trV in diffYUV().
+	const __m128i thr = _mm_set1_epi32(0x00300706);
+	const __m128i center = _mm_set1_epi32(yuv5);
+	const __m128i lo = _mm_set_epi32(yuv4, yuv3, yuv2, yuv1);
+	const __m128i hi = _mm_set_epi32(yuv9, yuv8, yuv7, yuv6);
+
+	// Per-byte absolute differences against the center pixel.
+	const __m128i dLo = _mm_or_si128(_mm_subs_epu8(lo, center), _mm_subs_epu8(center, lo));
+	const __m128i dHi = _mm_or_si128(_mm_subs_epu8(hi, center), _mm_subs_epu8(center, hi));
+
+	// After the saturating subtraction only bytes exceeding their threshold
+	// are non-zero, so cmpeq against zero yields 0xFF for "within threshold".
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i okLo = _mm_cmpeq_epi8(_mm_subs_epu8(dLo, thr), zero);
+	const __m128i okHi = _mm_cmpeq_epi8(_mm_subs_epu8(dHi, thr), zero);
+
+	// One nibble per neighbour; a clear bit marks a channel over threshold.
+	const uint32 mask = (~((_mm_movemask_epi8(okHi) << 16) | _mm_movemask_epi8(okLo)));
+
+	int pattern = 0;
+	for (int i = 0; i < 8; ++i) {
+		if ((mask >> (4 * i)) & 0xF)
+			pattern |= 1 << i;
+	}
+	return pattern;
+}
+#endif
+
 #endif
@@ -39,59 +39,82 @@
 /***************************************************************************/
 /* Scale2x C implementation */
 
-static inline void scale2x_8_def_single(scale2x_uint8* __restrict__ dst, const scale2x_uint8* __restrict__ src0, const scale2x_uint8* __restrict__ src1, const scale2x_uint8* __restrict__ src2, unsigned count) {
+/*
+ * The "whole" functions compute both destination rows in a single pass over
+ * the three source rows. This produces exactly the same pixels as running
+ * the row kernel once per destination row (with the upper and lower source
+ * rows swapped for the second one), but every source pixel is loaded only
+ * once instead of twice.
+ */
+
+static inline void scale2x_8_def_whole(scale2x_uint8* __restrict__ dst0, scale2x_uint8* __restrict__ dst1, const scale2x_uint8* __restrict__ src0, const scale2x_uint8* __restrict__ src1, const scale2x_uint8* __restrict__ src2, unsigned count) {
 	/* central pixels */
 	while (count) {
 		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = src1[-1] == src0[0] ? src0[0] : src1[0];
-			dst[1] = src1[1] == src0[0] ? src0[0] : src1[0];
+			dst0[0] = src1[-1] == src0[0] ? src0[0] : src1[0];
+			dst0[1] = src1[1] == src0[0] ? src0[0] : src1[0];
+			dst1[0] = src1[-1] == src2[0] ? src2[0] : src1[0];
+			dst1[1] = src1[1] == src2[0] ? src2[0] : src1[0];
 		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
+			dst0[0] = src1[0];
+			dst0[1] = src1[0];
+			dst1[0] = src1[0];
+			dst1[1] = src1[0];
 		}
 
 		++src0;
 		++src1;
 		++src2;
-		dst += 2;
+		dst0 += 2;
+		dst1 += 2;
 		--count;
 	}
 }
 
-static inline void scale2x_16_def_single(scale2x_uint16* __restrict__ dst, const scale2x_uint16* __restrict__ src0, const scale2x_uint16* __restrict__ src1, const scale2x_uint16* __restrict__ src2, unsigned count) {
+static inline void scale2x_16_def_whole(scale2x_uint16* __restrict__ dst0, scale2x_uint16* __restrict__ dst1, const scale2x_uint16* __restrict__ src0, const scale2x_uint16* __restrict__ src1, const scale2x_uint16* __restrict__ src2, unsigned count) {
 	/* central pixels */
 	while (count) {
 		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = src1[-1] == src0[0] ? src0[0] : src1[0];
-			dst[1] = src1[1] == src0[0] ? src0[0] : src1[0];
+			dst0[0] = src1[-1] == src0[0] ? src0[0] : src1[0];
+			dst0[1] = src1[1] == src0[0] ? src0[0] : src1[0];
+			dst1[0] = src1[-1] == src2[0] ? src2[0] : src1[0];
+			dst1[1] = src1[1] == src2[0] ? src2[0] : src1[0];
 		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
+			dst0[0] = src1[0];
+			dst0[1] = src1[0];
+			dst1[0] = src1[0];
+			dst1[1] = src1[0];
 		}
 
 		++src0;
 		++src1;
 		++src2;
-		dst += 2;
+		dst0 += 2;
+		dst1 += 2;
 		--count;
 	}
 }
 
-static inline void scale2x_32_def_single(scale2x_uint32* __restrict__ dst, const scale2x_uint32* __restrict__ src0, const scale2x_uint32* __restrict__ src1, const scale2x_uint32* __restrict__ src2, unsigned count) {
+static inline void scale2x_32_def_whole(scale2x_uint32* __restrict__ dst0, scale2x_uint32* __restrict__ dst1, const scale2x_uint32* __restrict__ src0, const scale2x_uint32* __restrict__ src1, const scale2x_uint32* __restrict__ src2, unsigned count) {
 	/* central pixels */
 	while (count) {
 		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = src1[-1] == src0[0] ? src0[0] : src1[0];
-			dst[1] = src1[1] == src0[0] ? src0[0] : src1[0];
+			dst0[0] = src1[-1] == src0[0] ? src0[0] : src1[0];
+			dst0[1] = src1[1] == src0[0] ? src0[0] : src1[0];
+			dst1[0] = src1[-1] == src2[0] ? src2[0] : src1[0];
+			dst1[1] = src1[1] == src2[0] ? src2[0] : src1[0];
 		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
+			dst0[0] = src1[0];
+			dst0[1] = src1[0];
+			dst1[0] = src1[0];
+			dst1[1] = src1[0];
 		}
 
 		++src0;
 		++src1;
 		++src2;
-		dst += 2;
+		dst0 += 2;
+		dst1 += 2;
 		--count;
 	}
 }
@@ -110,8 +133,7 @@ static inline void scale2x_32_def_single(scale2x_uint32* __restrict__ dst, const
  * @param dst1 Second destination row, double length in pixels.
  */
 void scale2x_8_def(scale2x_uint8* dst0, scale2x_uint8* dst1, const scale2x_uint8* src0, const scale2x_uint8* src1, const scale2x_uint8* src2, unsigned count) {
-	scale2x_8_def_single(dst0, src0, src1, src2, count);
-	scale2x_8_def_single(dst1, src2, src1, src0, count);
+	scale2x_8_def_whole(dst0, dst1, src0, src1, src2, count);
 }
 
 /**
@@ -126,8 +148,7 @@ void scale2x_8_def(scale2x_uint8* dst0, scale2x_uint8* dst1, const scale2x_uint8
  * @param dst1 Second destination row, double length in pixels.
  */
 void scale2x_16_def(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_uint16* src0, const scale2x_uint16* src1, const scale2x_uint16* src2, unsigned count) {
-	scale2x_16_def_single(dst0, src0, src1, src2, count);
-	scale2x_16_def_single(dst1, src2, src1, src0, count);
+	scale2x_16_def_whole(dst0, dst1, src0, src1, src2, count);
 }
 
 /**
@@ -142,8 +163,7 @@ void scale2x_16_def(scale2x_uint16* dst0, scale2x_uint16* dst1, const scale2x_ui
  * @param dst1 Second destination row, double length in pixels.
  */
 void scale2x_32_def(scale2x_uint32* dst0, scale2x_uint32* dst1, const scale2x_uint32* src0, const scale2x_uint32* src1, const scale2x_uint32* src2, unsigned count) {
-	scale2x_32_def_single(dst0, src0, src1, src2, count);
-	scale2x_32_def_single(dst1, src2, src1, src0, count);
+	scale2x_32_def_whole(dst0, dst1, src0, src1, src2, count);
 }
 
 /***************************************************************************/
@@ -39,128 +39,117 @@
 /***************************************************************************/
 /* Scale3x C implementation */
 
-static inline void scale3x_8_def_border(scale3x_uint8* __restrict__ dst, const scale3x_uint8* __restrict__ src0, const scale3x_uint8* __restrict__ src1, const scale3x_uint8* __restrict__ src2, unsigned count) {
-	/* central pixels */
-	while (count) {
-		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = src1[-1] == src0[0] ? src1[-1] : src1[0];
-			dst[1] = (src1[-1] == src0[0] && src1[0] != src0[1]) || (src1[1] == src0[0] && src1[0] != src0[-1]) ? src0[0] : src1[0];
-			dst[2] = src1[1] == src0[0] ? src1[1] : src1[0];
-		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
-			dst[2] = src1[0];
-		}
-
-		++src0;
-		++src1;
-		++src2;
-		dst += 3;
-		--count;
-	}
-}
-
-static inline void scale3x_8_def_center(scale3x_uint8* __restrict__ dst, const scale3x_uint8* __restrict__ src0, const scale3x_uint8* __restrict__ src1, const scale3x_uint8* __restrict__ src2, unsigned count) {
-	/* central pixels */
-	while (count) {
-		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = (src1[-1] == src0[0] && src1[0] != src2[-1]) || (src1[-1] == src2[0] && src1[0] != src0[-1]) ? src1[-1] : src1[0];
-			dst[1] = src1[0];
-			dst[2] = (src1[1] == src0[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src0[1]) ? src1[1] : src1[0];
-		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
-			dst[2] = src1[0];
-		}
-
-		++src0;
-		++src1;
-		++src2;
-		dst += 3;
-		--count;
-	}
-}
-
-static inline void scale3x_16_def_border(scale3x_uint16* __restrict__ dst, const scale3x_uint16* __restrict__ src0, const scale3x_uint16* __restrict__ src1, const scale3x_uint16* __restrict__ src2, unsigned count) {
-	/* central pixels */
-	while (count) {
-		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = src1[-1] == src0[0] ? src1[-1] : src1[0];
-			dst[1] = (src1[-1] == src0[0] && src1[0] != src0[1]) || (src1[1] == src0[0] && src1[0] != src0[-1]) ? src0[0] : src1[0];
-			dst[2] = src1[1] == src0[0] ? src1[1] : src1[0];
-		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
-			dst[2] = src1[0];
-		}
-
-		++src0;
-		++src1;
-		++src2;
-		dst += 3;
-		--count;
-	}
-}
+/*
+ * The "whole" functions compute all three destination rows in a single pass
+ * over the three source rows. This produces exactly the same pixels as
+ * running the border kernel for the first row, the center kernel for the
+ * second and the border kernel with the upper and lower source rows swapped
+ * for the third, but every source pixel is loaded only once instead of
+ * three times and the edge condition is evaluated once instead of three
+ * times.
+ */
 
-static inline void scale3x_16_def_center(scale3x_uint16* __restrict__ dst, const scale3x_uint16* __restrict__ src0, const scale3x_uint16* __restrict__ src1, const scale3x_uint16* __restrict__ src2, unsigned count) {
+static inline void scale3x_8_def_whole(scale3x_uint8* __restrict__ dst0, scale3x_uint8* __restrict__ dst1, scale3x_uint8* __restrict__ dst2, const scale3x_uint8* __restrict__ src0, const scale3x_uint8* __restrict__ src1, const scale3x_uint8* __restrict__ src2, unsigned count) {
 	/* central pixels */
 	while (count) {
 		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = (src1[-1] == src0[0] && src1[0] != src2[-1]) || (src1[-1] == src2[0] && src1[0] != src0[-1]) ? src1[-1] : src1[0];
-			dst[1] = src1[0];
-			dst[2] = (src1[1] == src0[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src0[1]) ? src1[1] : src1[0];
+			dst0[0] = src1[-1] == src0[0] ? src1[-1] : src1[0];
+			dst0[1] = (src1[-1] == src0[0] && src1[0] != src0[1]) || (src1[1] == src0[0] && src1[0] != src0[-1]) ? src0[0] : src1[0];
+			dst0[2] = src1[1] == src0[0] ? src1[1] : src1[0];
+			dst1[0] = (src1[-1] == src0[0] && src1[0] != src2[-1]) || (src1[-1] == src2[0] && src1[0] != src0[-1]) ? src1[-1] : src1[0];
+			dst1[1] = src1[0];
+			dst1[2] = (src1[1] == src0[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src0[1]) ? src1[1] : src1[0];
+			dst2[0] = src1[-1] == src2[0] ? src1[-1] : src1[0];
+			dst2[1] = (src1[-1] == src2[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src2[-1]) ? src2[0] : src1[0];
+			dst2[2] = src1[1] == src2[0] ? src1[1] : src1[0];
 		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
-			dst[2] = src1[0];
+			dst0[0] = src1[0];
+			dst0[1] = src1[0];
+			dst0[2] = src1[0];
+			dst1[0] = src1[0];
+			dst1[1] = src1[0];
+			dst1[2] = src1[0];
+			dst2[0] = src1[0];
+			dst2[1] = src1[0];
+			dst2[2] = src1[0];
 		}
 
 		++src0;
 		++src1;
 		++src2;
-		dst += 3;
+		dst0 += 3;
+		dst1 += 3;
+		dst2 += 3;
 		--count;
 	}
 }
 
-static inline void scale3x_32_def_border(scale3x_uint32* __restrict__ dst, const scale3x_uint32* __restrict__ src0, const scale3x_uint32* __restrict__ src1, const scale3x_uint32* __restrict__ src2, unsigned count) {
+static inline void scale3x_16_def_whole(scale3x_uint16* __restrict__ dst0, scale3x_uint16* __restrict__ dst1, scale3x_uint16* __restrict__ dst2, const scale3x_uint16* __restrict__ src0, const scale3x_uint16* __restrict__ src1, const scale3x_uint16* __restrict__ src2, unsigned count) {
 	/* central pixels */
 	while (count) {
 		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = src1[-1] == src0[0] ? src1[-1] : src1[0];
-			dst[1] = (src1[-1] == src0[0] && src1[0] != src0[1]) || (src1[1] == src0[0] && src1[0] != src0[-1]) ? src0[0] : src1[0];
-			dst[2] = src1[1] == src0[0] ? src1[1] : src1[0];
+			dst0[0] = src1[-1] == src0[0] ? src1[-1] : src1[0];
+			dst0[1] = (src1[-1] == src0[0] && src1[0] != src0[1]) || (src1[1] == src0[0] && src1[0] != src0[-1]) ? src0[0] : src1[0];
+			dst0[2] = src1[1] == src0[0] ? src1[1] : src1[0];
+			dst1[0] = (src1[-1] == src0[0] && src1[0] != src2[-1]) || (src1[-1] == src2[0] && src1[0] != src0[-1]) ? src1[-1] : src1[0];
+			dst1[1] = src1[0];
+			dst1[2] = (src1[1] == src0[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src0[1]) ? src1[1] : src1[0];
+			dst2[0] = src1[-1] == src2[0] ? src1[-1] : src1[0];
+			dst2[1] = (src1[-1] == src2[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src2[-1]) ? src2[0] : src1[0];
+			dst2[2] = src1[1] == src2[0] ? src1[1] : src1[0];
 		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
-			dst[2] = src1[0];
+			dst0[0] = src1[0];
+			dst0[1] = src1[0];
+			dst0[2] = src1[0];
+			dst1[0] = src1[0];
+			dst1[1] = src1[0];
+			dst1[2] = src1[0];
+			dst2[0] = src1[0];
+			dst2[1] = src1[0];
+			dst2[2] = src1[0];
 		}
 
 		++src0;
 		++src1;
 		++src2;
-		dst += 3;
+		dst0 += 3;
+		dst1 += 3;
+		dst2 += 3;
 		--count;
 	}
 }
 
-static inline void scale3x_32_def_center(scale3x_uint32* __restrict__ dst, const scale3x_uint32* __restrict__ src0, const scale3x_uint32* __restrict__ src1, const scale3x_uint32* __restrict__ src2, unsigned count) {
+static inline void scale3x_32_def_whole(scale3x_uint32* __restrict__ dst0, scale3x_uint32* __restrict__ dst1, scale3x_uint32* __restrict__ dst2, const scale3x_uint32* __restrict__ src0, const scale3x_uint32* __restrict__ src1, const scale3x_uint32* __restrict__ src2, unsigned count) {
 	/* central pixels */
 	while (count) {
 		if (src0[0] != src2[0] && src1[-1] != src1[1]) {
-			dst[0] = (src1[-1] == src0[0] && src1[0] != src2[-1]) || (src1[-1] == src2[0] && src1[0] != src0[-1]) ? src1[-1] : src1[0];
-			dst[1] = src1[0];
-			dst[2] = (src1[1] == src0[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src0[1]) ? src1[1] : src1[0];
+			dst0[0] = src1[-1] == src0[0] ? src1[-1] : src1[0];
+			dst0[1] = (src1[-1] == src0[0] && src1[0] != src0[1]) || (src1[1] == src0[0] && src1[0] != src0[-1]) ? src0[0] : src1[0];
+			dst0[2] = src1[1] == src0[0] ? src1[1] : src1[0];
+			dst1[0] = (src1[-1] == src0[0] && src1[0] != src2[-1]) || (src1[-1] == src2[0] && src1[0] != src0[-1]) ? src1[-1] : src1[0];
+			dst1[1] = src1[0];
+			dst1[2] = (src1[1] == src0[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src0[1]) ? src1[1] : src1[0];
+			dst2[0] = src1[-1] == src2[0] ? src1[-1] : src1[0];
+			dst2[1] = (src1[-1] == src2[0] && src1[0] != src2[1]) || (src1[1] == src2[0] && src1[0] != src2[-1]) ? src2[0] : src1[0];
+			dst2[2] = src1[1] == src2[0] ? src1[1] : src1[0];
 		} else {
-			dst[0] = src1[0];
-			dst[1] = src1[0];
-			dst[2] = src1[0];
+			dst0[0] = src1[0];
+			dst0[1] = src1[0];
+			dst0[2] = src1[0];
+			dst1[0] = src1[0];
+			dst1[1] = src1[0];
+			dst1[2] = src1[0];
+			dst2[0] = src1[0];
+			dst2[1] = src1[0];
+			dst2[2] = src1[0];
 		}
 
 		++src0;
 		++src1;
 		++src2;
-		dst += 3;
+		dst0 += 3;
+		dst1 += 3;
+		dst2 += 3;
 		--count;
 	}
 }
@@ -180,9 +169,7 @@ static inline void scale3x_32_def_center(scale3x_uint32* __restrict__ dst, const
  * @param dst2 Third destination row, triple length in pixels.
  */
 void scale3x_8_def(scale3x_uint8* dst0, scale3x_uint8* dst1, scale3x_uint8* dst2, const scale3x_uint8* src0, const scale3x_uint8* src1, const scale3x_uint8* src2, unsigned count) {
-	scale3x_8_def_border(dst0, src0, src1, src2, count);
-	scale3x_8_def_center(dst1, src0, src1, src2, count);
-	scale3x_8_def_border(dst2, src2, src1, src0, count);
+	scale3x_8_def_whole(dst0, dst1, dst2, src0, src1, src2, count);
 }
 
 /**
@@ -198,9 +185,7 @@ void scale3x_8_def(scale3x_uint8* dst0, scale3x_uint8* dst1, scale3x_uint8* dst2
  * @param dst2 Third destination row, triple length in pixels.
  */
 void scale3x_16_def(scale3x_uint16* dst0, scale3x_uint16* dst1, scale3x_uint16* dst2, const scale3x_uint16* src0, const scale3x_uint16* src1, const scale3x_uint16* src2, unsigned count) {
-	scale3x_16_def_border(dst0, src0, src1, src2, count);
-	scale3x_16_def_center(dst1, src0, src1, src2, count);
-	scale3x_16_def_border(dst2, src2, src1, src0, count);
+	scale3x_16_def_whole(dst0, dst1, dst2, src0, src1, src2, count);
 }
 
 /**
@@ -216,7 +201,5 @@ void scale3x_16_def(scale3x_uint16* dst0, scale3x_uint16* dst1, scale3x_uint16*
  * @param dst2 Third destination row, triple length in pixels.
  */
 void scale3x_32_def(scale3x_uint32* dst0, scale3x_uint32* dst1, scale3x_uint32* dst2, const scale3x_uint32* src0, const scale3x_uint32* src1, const scale3x_uint32* src2, unsigned count) {
-	scale3x_32_def_border(dst0, src0, src1, src2, count);
-	scale3x_32_def_center(dst1, src0, src1, src2, count);
-	scale3x_32_def_border(dst2, src2, src1, src0, count);
+	scale3x_32_def_whole(dst0, dst1, dst2, src0, src1, src2, count);
 }
@@ -176,39 +176,53 @@ static bool grabScreen565(Graphics::Surface *surf) {
 	assert(screen->getPixels() != 0);
 
 	Graphics::PixelFormat screenFormat = g_system->getScreenFormat();
+	const Graphics::PixelFormat format565(2, 5, 6, 5, 0, 11, 5, 0, 0);
 
-	surf->create(screen->w, screen->h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+	surf->create(screen->w, screen->h, format565);
 
-	byte *palette = 0;
+	// This runs synchronously on the frame path (e.g. on every autosave),
+	// so the conversion is done with one specialised loop per screen format
+	// instead of dispatching on the format for every single pixel.
 	if (screenFormat.bytesPerPixel == 1) {
-		palette = new byte[256 * 3];
-		assert(palette);
+		// Convert the palette to RGB565 once, the screen itself then only
+		// needs a table lookup per pixel.
+		byte palette[256 * 3];
+		uint16 colors[256];
 		g_system->getPaletteManager()->grabPalette(palette, 0, 256);
-	}
-
-	for (uint y = 0; y < screen->h; ++y) {
-		for (uint x = 0; x < screen->w; ++x) {
-			byte r = 0, g = 0, b = 0;
+		for (uint i = 0; i < 256; ++i)
+			colors[i] = Graphics::RGBToColor<Graphics::ColorMasks<565> >(palette[i * 3 + 0], palette[i * 3 + 1], palette[i * 3 + 2]);
 
-			if (screenFormat.bytesPerPixel == 1) {
-				uint8 pixel = *(uint8 *)screen->getBasePtr(x, y);
-				r = palette[pixel * 3 + 0];
-				g = palette[pixel * 3 + 1];
-				b = palette[pixel * 3 + 2];
-			} else if (screenFormat.bytesPerPixel == 2) {
+		for (uint y = 0; y < screen->h; ++y) {
+			const uint8 *src = (const uint8 *)screen->getBasePtr(0, y);
+			uint16 *dst = (uint16 *)surf->getBasePtr(0, y);
+			for (uint x = 0; x < screen->w; ++x)
+				*dst++ = colors[*src++];
+		}
+	} else if (screenFormat == format565) {
+		// The screen is already in the thumbnail format, grab it with one
+		// straight copy per line.
+		for (uint y = 0; y < screen->h; ++y)
+			memcpy(surf->getBasePtr(0, y), screen->getBasePtr(0, y), screen->w * 2);
+	} else if (screenFormat.bytesPerPixel == 2) {
+		for (uint y = 0; y < screen->h; ++y) {
+			for (uint x = 0; x < screen->w; ++x) {
+				byte r, g, b;
 				uint16 col = READ_UINT16(screen->getBasePtr(x, y));
 				screenFormat.colorToRGB(col, r, g, b);
-			} else if (screenFormat.bytesPerPixel == 4) {
+				*((uint16 *)surf->getBasePtr(x, y)) = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
+			}
+		}
+	} else {
+		for (uint y = 0; y < screen->h; ++y) {
+			for (uint x = 0; x < screen->w; ++x) {
+				byte r, g, b;
 				uint32 col = READ_UINT32(screen->getBasePtr(x, y));
 				screenFormat.colorToRGB(col, r, g, b);
+				*((uint16 *)surf->getBasePtr(x, y)) = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
 			}
-
-			*((uint16 *)surf->getBasePtr(x, y)) = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
 		}
 	}
 
-	delete[] palette;
-
 	g_system->unlockScreen();
 	return true;
 }
@@ -244,15 +258,17 @@ bool createThumbnail(Graphics::Surface *surf, const uint8 *pixels, int w, int h,
 	Graphics::Surface screen;
 	screen.create(w, h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
 
-	for (uint y = 0; y < screen.h; ++y) {
-		for (uint x = 0; x < screen.w; ++x) {
-			byte r, g, b;
-			r = palette[pixels[y * w + x] * 3];
-			g = palette[pixels[y * w + x] * 3 + 1];
-			b = palette[pixels[y * w + x] * 3 + 2];
+	// Like in grabScreen565(), convert the palette up front so the pixel
+	// loop is a plain table lookup.
+	uint16 colors[256];
+	for (uint i = 0; i < 256; ++i)
+		colors[i] = Graphics::RGBToColor<Graphics::ColorMasks<565> >(palette[i * 3 + 0], palette[i * 3 + 1], palette[i * 3 + 2]);
 
-			*((uint16 *)screen.getBasePtr(x, y)) = Graphics::RGBToColor<Graphics::ColorMasks<565> >(r, g, b);
-		}
+	for (uint y = 0; y < screen.h; ++y) {
+		const uint8 *src = pixels + y * w;
+		uint16 *dst = (uint16 *)screen.getBasePtr(0, y);
+		for (uint x = 0; x < screen.w; ++x)
+			*dst++ = colors[*src++];
 	}
 
 	return createThumbnail(*surf, screen);
@@ -44,9 +44,8 @@ void Screen::update() {
 	mergeDirtyRects();
 
 	// Loop through copying dirty areas to the physical screen
-	Common::List<Common::Rect>::iterator i;
-	for (i = _dirtyRects.begin(); i != _dirtyRects.end(); ++i) {
-		const Common::Rect &r = *i;
+	for (uint idx = 0; idx < _dirtyRects.size(); ++idx) {
+		const Common::Rect &r = _dirtyRects[idx];
 		const byte *srcP = (const byte *)getBasePtr(r.left, r.top);
 		g_system->copyRectToScreen(srcP, pitch, r.left, r.top,
 			r.width(), r.height());
@@ -54,7 +53,7 @@ void Screen::update() {
 
 	// Signal the physical screen to update
 	g_system->updateScreen();
-	_dirtyRects.clear();
+	_dirtyRects.resize(0);
 }
 
 
@@ -72,22 +71,20 @@ void Screen::makeAllDirty() {
 }
 
 void Screen::mergeDirtyRects() {
-	Common::List<Common::Rect>::iterator rOuter, rInner;
-
 	// Process the dirty rect list to find any rects to merge
-	for (rOuter = _dirtyRects.begin(); rOuter != _dirtyRects.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != _dirtyRects.end()) {
+	for (uint rOuter = 0; rOuter < _dirtyRects.size(); ++rOuter) {
+		for (uint rInner = rOuter + 1; rInner < _dirtyRects.size(); ) {
 
-			if ((*rOuter).intersects(*rInner)) {
+			if (_dirtyRects[rOuter].intersects(_dirtyRects[rInner])) {
 				// These two rectangles overlap, so merge them
-				unionRectangle(*rOuter, *rOuter, *rInner);
-
-				// remove the inner rect from the list
-				_dirtyRects.erase(rInner);
-
-				// move back to beginning of list
-				rInner = rOuter;
+				unionRectangle(_dirtyRects[rOuter], _dirtyRects[rOuter], _dirtyRects[rInner]);
+
+				// remove the inner rect from the list and rescan it against
+				// the now larger outer rect
+				_dirtyRects.remove_at(rInner);
+				rInner = rOuter + 1;
+			} else {
+				++rInner;
 			}
 		}
 	}
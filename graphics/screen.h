@@ -25,7 +25,7 @@
 
 #include "graphics/managed_surface.h"
 #include "graphics/pixelformat.h"
-#include "common/list.h"
+#include "common/array.h"
 #include "common/rect.h"
 
 namespace Graphics {
@@ -44,7 +44,7 @@ private:
 	/**
 	 * List of affected areas of the screen
 	 */
-	Common::List<Common::Rect> _dirtyRects;
+	Common::Array<Common::Rect> _dirtyRects;
 private:
 	/**
 	* Merges together overlapping dirty areas of the screen
@@ -78,9 +78,10 @@ public:
 	void makeAllDirty();
 
 	/**
-	 * Clear the current dirty rects list
+	 * Clear the current dirty rects list. The capacity of the list is kept,
+	 * since it gets refilled every frame
 	 */
-	virtual void clearDirtyRects() { _dirtyRects.clear(); }
+	virtual void clearDirtyRects() { _dirtyRects.resize(0); }
 
 	/**
 	 * Updates the screen by copying any affected areas to the system
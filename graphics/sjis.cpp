@@ -72,6 +72,8 @@ void FontSJIS::drawChar(Graphics::Surface &dst, uint16 ch, int x, int y, uint32
 
 FontSJISBase::FontSJISBase()
 	: _drawMode(kDefaultMode), _flippedMode(false), _fontWidth(16), _fontHeight(16), _bitPosNewLineMask(0) {
+	for (int i = 0; i < kOutlineCacheSize; ++i)
+		_outlineCache[i].valid = false;
 }
 
 void FontSJISBase::setDrawingMode(DrawingMode mode) {
@@ -177,6 +179,22 @@ void FontSJISBase::createOutline(uint8 *outline, const uint8 *glyph, const int w
 	}
 }
 
+const uint8 *FontSJISBase::getOutline(uint16 ch, const uint8 *glyph, const int w, const int h) const {
+	// Direct mapped cache, folding the high byte into the index so that
+	// double byte characters sharing the same low byte do not all collide.
+	OutlineCacheEntry &entry = _outlineCache[((ch >> 8) ^ ch) % kOutlineCacheSize];
+
+	if (!entry.valid || entry.ch != ch) {
+		assert((w + 9) / 8 * (h + 2) <= kOutlineCacheEntrySize);
+		memset(entry.outline, 0, sizeof(entry.outline));
+		createOutline(entry.outline, glyph, w, h);
+		entry.ch = ch;
+		entry.valid = true;
+	}
+
+	return entry.outline;
+}
+
 #ifndef DISABLE_FLIPPED_MODE
 const uint8 *FontSJISBase::flipCharacter(const uint8 *glyph, const int w) const {
 	static const uint8 flipData[] = {
@@ -248,10 +266,22 @@ void FontSJISBase::drawChar(void *dst, uint16 ch, int pitch, int bpp, uint32 c1,
 		glyphSource = flipCharacter(glyphSource, width);
 #endif
 
-	uint8 outline[18 * 18];
+	uint8 outlineBuffer[18 * 18];
+	const uint8 *outline = 0;
 	if (_drawMode == kOutlineMode) {
-		memset(outline, 0, sizeof(outline));
-		createOutline(outline, glyphSource, width, height);
+		bool cacheable = (outlineXOffset == 0 && outlineYOffset == 0);
+#ifndef DISABLE_FLIPPED_MODE
+		// Flipped glyphs come from a single scratch buffer, thus they can
+		// not be told apart by their character code alone.
+		cacheable = cacheable && !_flippedMode;
+#endif
+		if (cacheable) {
+			outline = getOutline(ch, glyphSource, width, height);
+		} else {
+			memset(outlineBuffer, 0, sizeof(outlineBuffer));
+			createOutline(outlineBuffer, glyphSource, width, height);
+			outline = outlineBuffer;
+		}
 	}
 
 	if (bpp == 1) {
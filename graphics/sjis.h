@@ -159,6 +159,27 @@ private:
 	void blitCharacter(const uint8 *glyph, const int w, const int h, uint8 *dst, int pitch, Color c) const;
 	void createOutline(uint8 *outline, const uint8 *glyph, const int w, const int h) const;
 
+	enum {
+		kOutlineCacheSize = 64,
+		// Enough for the widest case, a 16x16 glyph: an outline is
+		// (w + 2) x (h + 2) pixels packed at (w + 9) / 8 bytes per line.
+		kOutlineCacheEntrySize = 3 * 18
+	};
+
+	// Cache for the generated outline bitmaps, so that repeated draws of
+	// the same character in kOutlineMode do not recompute the outline
+	// every call. The outline only depends on the (immutable) glyph data,
+	// colors are applied at blit time, thus the cache is keyed on the
+	// character code alone. Sized to cover roughly one page of text.
+	struct OutlineCacheEntry {
+		uint16 ch;
+		bool valid;
+		uint8 outline[kOutlineCacheEntrySize];
+	};
+
+	mutable OutlineCacheEntry _outlineCache[kOutlineCacheSize];
+	const uint8 *getOutline(uint16 ch, const uint8 *glyph, const int w, const int h) const;
+
 #ifndef DISABLE_FLIPPED_MODE
 	// This is used in the FM-Towns version of Monkey Island 1
 	// when Guybrush gets shot out of the cannon in the circus tent.
@@ -0,0 +1,123 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/spanblit.h"
+#include "graphics/surface.h"
+
+namespace Graphics {
+
+SpanSprite::SpanSprite() : _width(0), _height(0) {
+}
+
+void SpanSprite::compile(const Surface &src, byte keyColor) {
+	assert(src.format.bytesPerPixel == 1);
+
+	compile((const byte *)src.getPixels(), src.w, src.h, src.pitch, keyColor);
+}
+
+void SpanSprite::compile(const byte *pixels, uint16 w, uint16 h, uint32 pitch, byte keyColor) {
+	create(w, h);
+
+	for (uint16 y = 0; y < h; y++) {
+		const byte *row = pixels + y * pitch;
+
+		uint16 x = 0;
+		while (x < w) {
+			while (x < w && row[x] == keyColor)
+				x++;
+
+			const uint16 start = x;
+			while (x < w && row[x] != keyColor)
+				x++;
+
+			if (x > start)
+				addSpan(start, y, row + start, x - start);
+		}
+	}
+}
+
+void SpanSprite::create(uint16 w, uint16 h) {
+	clear();
+
+	_width  = w;
+	_height = h;
+}
+
+void SpanSprite::addSpan(uint16 x, uint16 y, const byte *pixels, uint16 length) {
+	if (!length)
+		return;
+
+	Span span;
+	span.x          = x;
+	span.y          = y;
+	span.length     = length;
+	span.dataOffset = _pixels.size();
+
+	_pixels.resize(span.dataOffset + length);
+	memcpy(&_pixels[span.dataOffset], pixels, length);
+
+	_spans.push_back(span);
+}
+
+void SpanSprite::clear() {
+	_spans.clear();
+	_pixels.clear();
+
+	_width  = 0;
+	_height = 0;
+}
+
+void SpanSprite::blit(Surface &dst, int x, int y) const {
+	blit(dst, x, y, Common::Rect(dst.w, dst.h));
+}
+
+void SpanSprite::blit(Surface &dst, int x, int y, const Common::Rect &clip) const {
+	assert(dst.format.bytesPerPixel == 1);
+
+	for (uint i = 0; i < _spans.size(); i++) {
+		const Span &span = _spans[i];
+
+		const int dstY = y + span.y;
+		if (dstY < clip.top || dstY >= clip.bottom)
+			continue;
+
+		int dstX = x + span.x;
+		const byte *src = &_pixels[span.dataOffset];
+		int length = span.length;
+
+		if (dstX < clip.left) {
+			src    += clip.left - dstX;
+			length -= clip.left - dstX;
+			dstX    = clip.left;
+		}
+
+		if (dstX + length > clip.right)
+			length = clip.right - dstX;
+
+		if (length <= 0)
+			continue;
+
+		memcpy((byte *)dst.getBasePtr(dstX, dstY), src, length);
+	}
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,138 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_SPANBLIT_H
+#define GRAPHICS_SPANBLIT_H
+
+#include "common/array.h"
+#include "common/rect.h"
+#include "common/scummsys.h"
+
+namespace Graphics {
+
+struct Surface;
+
+/**
+ * A sprite compiled into spans of opaque pixels.
+ *
+ * Colorkeyed sprites spend most of their blit time testing pixels whose
+ * transparency never changes between draws. Compiling a sprite once into
+ * a list of opaque runs turns every subsequent draw into a short walk of
+ * memcpy calls, and clipping only has to be applied per run instead of
+ * per pixel.
+ *
+ * Sprites can be compiled from a colorkeyed surface, or engines whose
+ * sprite data is already run length encoded can feed their decoded runs
+ * in directly through create() and addSpan().
+ *
+ * Only 8bpp sprites are supported, which is what the engines drawing
+ * colorkeyed sprites use.
+ */
+class SpanSprite {
+public:
+	SpanSprite();
+
+	/**
+	 * Compile a sprite from a colorkeyed CLUT8 surface.
+	 *
+	 * @param src      Surface to compile. Must be 1 byte per pixel.
+	 * @param keyColor Pixel value treated as transparent.
+	 */
+	void compile(const Surface &src, byte keyColor);
+
+	/**
+	 * Compile a sprite from raw 8bpp pixel data.
+	 *
+	 * @param pixels   Pixel data to compile.
+	 * @param w        Width of the sprite.
+	 * @param h        Height of the sprite.
+	 * @param pitch    Number of bytes between the start of two lines.
+	 * @param keyColor Pixel value treated as transparent.
+	 */
+	void compile(const byte *pixels, uint16 w, uint16 h, uint32 pitch, byte keyColor);
+
+	/**
+	 * Start a new sprite of the given dimensions with no spans.
+	 *
+	 * Use together with addSpan() to build a sprite from data that is
+	 * already run length encoded.
+	 */
+	void create(uint16 w, uint16 h);
+
+	/**
+	 * Append one opaque run to the sprite. The pixel data is copied.
+	 *
+	 * @param x      Horizontal start of the run within the sprite.
+	 * @param y      Line of the run within the sprite.
+	 * @param pixels The run's pixel data.
+	 * @param length Number of pixels in the run.
+	 */
+	void addSpan(uint16 x, uint16 y, const byte *pixels, uint16 length);
+
+	/**
+	 * Drop all compiled data.
+	 */
+	void clear();
+
+	/**
+	 * Whether the sprite contains no opaque pixels.
+	 */
+	bool empty() const { return _spans.empty(); }
+
+	uint16 getWidth() const { return _width; }
+	uint16 getHeight() const { return _height; }
+
+	/**
+	 * Draw the sprite to a CLUT8 surface, clipped against the surface
+	 * dimensions.
+	 *
+	 * @param dst Surface to draw to. Must be 1 byte per pixel.
+	 * @param x   Destination x coordinate; may be negative.
+	 * @param y   Destination y coordinate; may be negative.
+	 */
+	void blit(Surface &dst, int x, int y) const;
+
+	/**
+	 * Draw the sprite to a CLUT8 surface, clipped against the given
+	 * rectangle in destination coordinates.
+	 */
+	void blit(Surface &dst, int x, int y, const Common::Rect &clip) const;
+
+private:
+	/**
+	 * One horizontal run of opaque pixels.
+	 */
+	struct Span {
+		uint16 x;          ///< Horizontal start within the sprite.
+		uint16 y;          ///< Line within the sprite.
+		uint16 length;     ///< Number of pixels.
+		uint32 dataOffset; ///< Offset of the pixel data within _pixels.
+	};
+
+	Common::Array<Span> _spans;
+	Common::Array<byte> _pixels;
+	uint16 _width, _height;
+};
+
+} // End of namespace Graphics
+
+#endif
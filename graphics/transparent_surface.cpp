@@ -140,6 +140,84 @@ void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32
  * @inoStep width in bytes of every row on the *input* surface / kind of like pitch
  * @color colormod in 0xAARRGGBB format - 0xFFFFFFFF for no colormod
  */
+#ifdef __SSE2__
+#define USE_TRANSPARENT_SURFACE_SIMD
+#include <emmintrin.h>
+
+enum { kAlphaBlendBlockPixels = 4 };
+
+// Replicates the alpha lane of each pixel across its four 16-bit channel lanes
+#define ALPHA_SHUFFLE _MM_SHUFFLE(kAIndex, kAIndex, kAIndex, kAIndex)
+
+/**
+ * Blend a block of four source pixels onto the destination, equivalent to
+ * the per-channel (in * a + out * (255 - a)) >> 8 of the scalar loop in
+ * doBlitAlphaBlend, including the rule that pixels with zero source alpha
+ * leave the destination untouched.
+ */
+static inline void blitAlphaBlendBlock(byte *out, const byte *in) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32(0xFF << (kAIndex * 8));
+	const __m128i c255 = _mm_set1_epi16(255);
+
+	const __m128i src = _mm_loadu_si128((const __m128i *)in);
+	const __m128i dst = _mm_loadu_si128((const __m128i *)out);
+
+	const __m128i sLo = _mm_unpacklo_epi8(src, zero);
+	const __m128i sHi = _mm_unpackhi_epi8(src, zero);
+	const __m128i dLo = _mm_unpacklo_epi8(dst, zero);
+	const __m128i dHi = _mm_unpackhi_epi8(dst, zero);
+
+	const __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, ALPHA_SHUFFLE), ALPHA_SHUFFLE);
+	const __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, ALPHA_SHUFFLE), ALPHA_SHUFFLE);
+
+	// in * a + out * (255 - a) never exceeds 255 * 255, so the 16-bit
+	// lanes cannot overflow
+	const __m128i rLo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(sLo, aLo),
+			_mm_mullo_epi16(dLo, _mm_sub_epi16(c255, aLo))), 8);
+	const __m128i rHi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(sHi, aHi),
+			_mm_mullo_epi16(dHi, _mm_sub_epi16(c255, aHi))), 8);
+
+	// Force the destination alpha to opaque, as the scalar loop does
+	__m128i res = _mm_or_si128(_mm_packus_epi16(rLo, rHi), alphaMask);
+
+	// Keep the old destination pixel wherever the source alpha is zero
+	const __m128i keep = _mm_cmpeq_epi32(_mm_and_si128(src, alphaMask), zero);
+	res = _mm_or_si128(_mm_and_si128(keep, dst), _mm_andnot_si128(keep, res));
+
+	_mm_storeu_si128((__m128i *)out, res);
+}
+
+#undef ALPHA_SHUFFLE
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define USE_TRANSPARENT_SURFACE_SIMD
+#include <arm_neon.h>
+
+enum { kAlphaBlendBlockPixels = 8 };
+
+static inline void blitAlphaBlendBlock(byte *out, const byte *in) {
+	const uint8x8x4_t s = vld4_u8(in);
+	const uint8x8x4_t d = vld4_u8(out);
+
+	const uint8x8_t a = s.val[kAIndex];
+	const uint8x8_t na = vmvn_u8(a);
+	const uint8x8_t keep = vceq_u8(a, vdup_n_u8(0));
+
+	uint8x8x4_t r;
+	r.val[kRIndex] = vshrn_n_u16(vmlal_u8(vmull_u8(s.val[kRIndex], a), d.val[kRIndex], na), 8);
+	r.val[kGIndex] = vshrn_n_u16(vmlal_u8(vmull_u8(s.val[kGIndex], a), d.val[kGIndex], na), 8);
+	r.val[kBIndex] = vshrn_n_u16(vmlal_u8(vmull_u8(s.val[kBIndex], a), d.val[kBIndex], na), 8);
+
+	r.val[kAIndex] = vbsl_u8(keep, d.val[kAIndex], vdup_n_u8(255));
+	r.val[kRIndex] = vbsl_u8(keep, d.val[kRIndex], r.val[kRIndex]);
+	r.val[kGIndex] = vbsl_u8(keep, d.val[kGIndex], r.val[kGIndex]);
+	r.val[kBIndex] = vbsl_u8(keep, d.val[kBIndex], r.val[kBIndex]);
+
+	vst4_u8(out, r);
+}
+#endif
+
 void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
 	byte *in;
 	byte *out;
@@ -149,7 +227,22 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+
+#ifdef USE_TRANSPARENT_SURFACE_SIMD
+			// The vector kernel handles the common unflipped case where
+			// source pixels are consecutive; mirrored blits fall through
+			// to the scalar loop
+			if (inStep == 4) {
+				for (; j + kAlphaBlendBlockPixels <= width; j += kAlphaBlendBlockPixels) {
+					blitAlphaBlendBlock(out, in);
+					in += 4 * kAlphaBlendBlockPixels;
+					out += 4 * kAlphaBlendBlockPixels;
+				}
+			}
+#endif
+
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kAIndex] = 255;
@@ -196,6 +196,127 @@ const YUVToRGBLookup *YUVToRGBManager::getLookup(Graphics::PixelFormat format, Y
 	L = &rgbToPix[(s)]; \
 	*((PixelInt *)(d)) = (L[cr_r] | L[crb_g] | L[cb_b])
 
+#ifdef __SSE2__
+#define USE_YUV_TO_RGB_SIMD
+#include <emmintrin.h>
+
+/**
+ * Convert 8 luma samples of one row into 32-bit pixels. The delta vectors
+ * hold the chroma contributions as 16-bit lanes, already duplicated for
+ * each pair of luma samples; posR/posG/posB/posA are the destination byte
+ * positions derived from the pixel format shifts.
+ */
+static inline void convertYUVBlock8(byte *dst, const byte *ySrc,
+		const int16 *dr, const int16 *dg, const int16 *db,
+		int posR, int posG, int posB, int posA) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i y = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)ySrc), zero);
+	// Saturating pack performs the same clamp the spread-out lookup
+	// tables implement in the scalar path.
+	const __m128i r = _mm_packus_epi16(_mm_add_epi16(y, _mm_loadu_si128((const __m128i *)dr)), zero);
+	const __m128i g = _mm_packus_epi16(_mm_add_epi16(y, _mm_loadu_si128((const __m128i *)dg)), zero);
+	const __m128i b = _mm_packus_epi16(_mm_add_epi16(y, _mm_loadu_si128((const __m128i *)db)), zero);
+
+	__m128i planes[4];
+	planes[posR] = r;
+	planes[posG] = g;
+	planes[posB] = b;
+	planes[posA] = _mm_set1_epi8((char)0xFF);
+
+	const __m128i lo = _mm_unpacklo_epi8(planes[0], planes[1]);
+	const __m128i hi = _mm_unpacklo_epi8(planes[2], planes[3]);
+	_mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi16(lo, hi));
+	_mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi16(lo, hi));
+}
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define USE_YUV_TO_RGB_SIMD
+#include <arm_neon.h>
+
+static inline void convertYUVBlock8(byte *dst, const byte *ySrc,
+		const int16 *dr, const int16 *dg, const int16 *db,
+		int posR, int posG, int posB, int posA) {
+	const int16x8_t y = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ySrc)));
+
+	uint8x8x4_t out;
+	out.val[posR] = vqmovun_s16(vaddq_s16(y, vld1q_s16(dr)));
+	out.val[posG] = vqmovun_s16(vaddq_s16(y, vld1q_s16(dg)));
+	out.val[posB] = vqmovun_s16(vaddq_s16(y, vld1q_s16(db)));
+	out.val[posA] = vdup_n_u8(0xFF);
+	vst4_u8(dst, out);
+}
+#endif
+
+#ifdef USE_YUV_TO_RGB_SIMD
+/**
+ * Vectorized 4:2:0 conversion for 32-bit formats with byte-aligned
+ * channels. Instead of going through the rgbToPix tables this adds the
+ * chroma deltas (recovered from colorTab, see YUVToRGBManager's
+ * constructor) to the luma directly and clamps with a saturating pack,
+ * which yields bit-identical output to the table walk for these formats.
+ */
+static void convertYUV420ToRGB32SIMD(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup,
+		const Graphics::PixelFormat &format, int16 *colorTab,
+		const byte *ySrc, const byte *uSrc, const byte *vSrc,
+		int yWidth, int yHeight, int yPitch, int uvPitch) {
+	const int halfHeight = yHeight >> 1;
+	const int halfWidth = yWidth >> 1;
+
+	const int16 *Cr_r_tab = colorTab;
+	const int16 *Cr_g_tab = Cr_r_tab + 256;
+	const int16 *Cb_g_tab = Cr_g_tab + 256;
+	const int16 *Cb_b_tab = Cb_g_tab + 256;
+	const uint32 *rgbToPix = lookup->getRGBToPix();
+
+	const int posR = format.rShift >> 3;
+	const int posG = format.gShift >> 3;
+	const int posB = format.bShift >> 3;
+	const int posA = format.aShift >> 3;
+
+	for (int h = 0; h < halfHeight; h++) {
+		int w = 0;
+
+		for (; w + 4 <= halfWidth; w += 4) {
+			int16 dr[8], dg[8], db[8];
+			for (int k = 0; k < 4; ++k) {
+				const int u = uSrc[w + k];
+				const int v = vSrc[w + k];
+				// Strip the rgbToPix base offsets the tables carry
+				// for the scalar path.
+				dr[2 * k] = dr[2 * k + 1] = Cr_r_tab[v] - 256;
+				dg[2 * k] = dg[2 * k + 1] = Cr_g_tab[v] + Cb_g_tab[u] - (768 + 256);
+				db[2 * k] = db[2 * k + 1] = Cb_b_tab[u] - (2 * 768 + 256);
+			}
+
+			convertYUVBlock8(dstPtr + w * 8, ySrc + w * 2, dr, dg, db, posR, posG, posB, posA);
+			convertYUVBlock8(dstPtr + dstPitch + w * 8, ySrc + yPitch + w * 2, dr, dg, db, posR, posG, posB, posA);
+		}
+
+		// Scalar tail for widths that are not a multiple of 8
+		for (; w < halfWidth; ++w) {
+			const uint32 *L;
+			typedef uint32 PixelInt;
+
+			int16 cr_r  = Cr_r_tab[vSrc[w]];
+			int16 crb_g = Cr_g_tab[vSrc[w]] + Cb_g_tab[uSrc[w]];
+			int16 cb_b  = Cb_b_tab[uSrc[w]];
+
+			byte *dst = dstPtr + w * 8;
+			const byte *y = ySrc + w * 2;
+			PUT_PIXEL(*y, dst);
+			PUT_PIXEL(*(y + yPitch), dst + dstPitch);
+			PUT_PIXEL(*(y + 1), dst + 4);
+			PUT_PIXEL(*(y + 1 + yPitch), dst + dstPitch + 4);
+		}
+
+		dstPtr += dstPitch * 2;
+		ySrc += yPitch << 1;
+		uSrc += uvPitch;
+		vSrc += uvPitch;
+	}
+}
+#endif
+
 template<typename PixelInt>
 void convertYUV444ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	// Keep the tables in pointers here to avoid a dereference on each pixel
@@ -291,6 +412,20 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
+#ifdef USE_YUV_TO_RGB_SIMD
+	// Take the vector path for full-range luma and 32-bit formats whose
+	// channels sit on byte boundaries (RGBA, BGRA, ARGB, ...); everything
+	// else goes through the generic lookup code below.
+	if (scale == kScaleFull && dst->format.bytesPerPixel == 4 &&
+	    dst->format.rLoss == 0 && dst->format.gLoss == 0 &&
+	    dst->format.bLoss == 0 && dst->format.aLoss == 0 &&
+	    (dst->format.rShift & 7) == 0 && (dst->format.gShift & 7) == 0 &&
+	    (dst->format.bShift & 7) == 0 && (dst->format.aShift & 7) == 0) {
+		convertYUV420ToRGB32SIMD((byte *)dst->getPixels(), dst->pitch, lookup, dst->format, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+		return;
+	}
+#endif
+
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
 		convertYUV420ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
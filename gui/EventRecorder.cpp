@@ -294,6 +294,11 @@ void EventRecorder::init(Common::String recordFileName, RecordMode mode) {
 	if (_recordMode == kRecorderPlayback) {
 		applyPlaybackSettings();
 		_nextEvent = _playbackFile->getNextEvent();
+		// Unattended regression runs want the whole session replayed at
+		// full speed without opening the control panel first.
+		if (ConfMan.hasKey("fast_playback")) {
+			_fastPlayback = ConfMan.getBool("fast_playback");
+		}
 	}
 	if (_recordMode == kRecorderRecord) {
 		getConfig();
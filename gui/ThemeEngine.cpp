@@ -376,6 +376,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(0), _vectorRenderer(0),
 	_buffering(false), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
 	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
+	_loadedThemeWidth(0), _loadedThemeHeight(0),
 	_cursor(0) {
 
 	_system = g_system;
@@ -543,12 +544,27 @@ bool ThemeEngine::init() {
 			_themeFiles.add("theme_archive", _themeArchive, 1, true);
 	}
 
+	// The parsed theme data only depends on the overlay geometry and
+	// pixel format (layouts in the STX files are resolution-gated), so
+	// a re-init that kept both - e.g. a refresh after returning from a
+	// game running at the same resolution - can reuse the loaded theme
+	// instead of re-parsing every STX file.
+	if (_themeOk && _screen.w == _loadedThemeWidth && _screen.h == _loadedThemeHeight
+			&& _overlayFormat == _loadedThemeFormat)
+		return ready();
+
 	// Load the theme
 	// We pass the theme file here by default, so the user will
 	// have a descriptive error message. The only exception will
 	// be the builtin theme which has no filename.
 	loadTheme(_themeFile.empty() ? _themeId : _themeFile);
 
+	if (_themeOk) {
+		_loadedThemeWidth = _screen.w;
+		_loadedThemeHeight = _screen.h;
+		_loadedThemeFormat = _overlayFormat;
+	}
+
 	return ready();
 }
 
@@ -37,7 +37,7 @@
 #include "graphics/pixelformat.h"
 
 
-#define SCUMMVM_THEME_VERSION_STR "SCUMMVM_STX0.8.23"
+#define SCUMMVM_THEME_VERSION_STR "SCUMMVM_STX0.8.24"
 
 class OSystem;
 
@@ -739,6 +739,15 @@ protected:
 
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
+
+	/**
+	 * The overlay geometry and pixel format the loaded theme data was
+	 * parsed for. Theme parsing is resolution-gated, so a re-init that
+	 * keeps both can reuse the loaded data instead of re-parsing all
+	 * the STX files.
+	 */
+	int16 _loadedThemeWidth, _loadedThemeHeight;
+	Graphics::PixelFormat _loadedThemeFormat;
 	bool _enabled; ///< Whether the Theme is currently shown on the overlay
 
 	Common::String _themeName; ///< Name of the currently loaded theme
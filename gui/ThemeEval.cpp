@@ -48,9 +48,17 @@ void ThemeEval::reset() {
 		delete i->_value;
 
 	_layouts.clear();
+	_widgetCache.clear();
 }
 
-bool ThemeEval::getWidgetData(const Common::String &widget, int16 &x, int16 &y, uint16 &w, uint16 &h) {
+const ThemeEval::CachedWidget *ThemeEval::lookupWidget(const Common::String &widget) {
+	WidgetCacheMap::iterator it = _widgetCache.find(widget);
+	if (it != _widgetCache.end())
+		return &it->_value;
+
+	// Not looked up before; resolve the widget in the layout tree and
+	// remember the result, so repeated dialog reflows don't search the
+	// tree again.
 	Common::StringTokenizer tokenizer(widget, ".");
 
 	if (widget.hasPrefix("Dialog."))
@@ -59,25 +67,36 @@ bool ThemeEval::getWidgetData(const Common::String &widget, int16 &x, int16 &y,
 	Common::String dialogName = "Dialog." + tokenizer.nextToken();
 	Common::String widgetName = tokenizer.nextToken();
 
-	if (!_layouts.contains(dialogName))
-		return false;
+	CachedWidget &cached = _widgetCache[widget];
+	cached.found = false;
+	cached.x = cached.y = 0;
+	cached.w = cached.h = 0;
+	cached.align = Graphics::kTextAlignInvalid;
 
-	return _layouts[dialogName]->getWidgetData(widgetName, x, y, w, h);
-}
+	if (_layouts.contains(dialogName)) {
+		ThemeLayout *layout = _layouts[dialogName];
+		cached.found = layout->getWidgetData(widgetName, cached.x, cached.y, cached.w, cached.h);
+		cached.align = layout->getWidgetTextHAlign(widgetName);
+	}
 
-Graphics::TextAlign ThemeEval::getWidgetTextHAlign(const Common::String &widget) {
-	Common::StringTokenizer tokenizer(widget, ".");
+	return &cached;
+}
 
-	if (widget.hasPrefix("Dialog."))
-		tokenizer.nextToken();
+bool ThemeEval::getWidgetData(const Common::String &widget, int16 &x, int16 &y, uint16 &w, uint16 &h) {
+	const CachedWidget *cached = lookupWidget(widget);
 
-	Common::String dialogName = "Dialog." + tokenizer.nextToken();
-	Common::String widgetName = tokenizer.nextToken();
+	if (!cached->found)
+		return false;
 
-	if (!_layouts.contains(dialogName))
-		return Graphics::kTextAlignInvalid;
+	x = cached->x;
+	y = cached->y;
+	w = cached->w;
+	h = cached->h;
+	return true;
+}
 
-	return _layouts[dialogName]->getWidgetTextHAlign(widgetName);
+Graphics::TextAlign ThemeEval::getWidgetTextHAlign(const Common::String &widget) {
+	return lookupWidget(widget)->align;
 }
 
 void ThemeEval::addWidget(const Common::String &name, int w, int h, const Common::String &type, bool enabled, Graphics::TextAlign align) {
@@ -129,6 +148,7 @@ void ThemeEval::addDialog(const Common::String &name, const Common::String &over
 		delete _layouts[name];
 
 	_layouts[name] = layout;
+	_widgetCache.clear();
 
 	layout->setPadding(
 		getVar("Globals.Padding.Left", 0),
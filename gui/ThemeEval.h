@@ -40,6 +40,22 @@ class ThemeEval {
 	typedef Common::HashMap<Common::String, int> VariablesMap;
 	typedef Common::HashMap<Common::String, ThemeLayout *> LayoutsMap;
 
+	/**
+	 * Resolved position and size of a widget, as looked up in the layout
+	 * tree. Widget geometry only changes while a theme is being parsed
+	 * (the layouts are reflowed when their dialog is closed by the
+	 * parser), but dialogs query it through getWidgetData() on every
+	 * open and resize, so we cache the results of the recursive layout
+	 * search here. The cache is flushed whenever a layout is (re)built.
+	 */
+	struct CachedWidget {
+		bool found;
+		int16 x, y;
+		uint16 w, h;
+		Graphics::TextAlign align;
+	};
+	typedef Common::HashMap<Common::String, CachedWidget> WidgetCacheMap;
+
 public:
 	ThemeEval() {
 		buildBuiltinVars();
@@ -83,7 +99,7 @@ public:
 	void addPadding(int16 l, int16 r, int16 t, int16 b) { _curLayout.top()->setPadding(l, r, t, b); }
 
 	void closeLayout() { _curLayout.pop(); }
-	void closeDialog() { _curLayout.pop()->reflowLayout(); _curDialog.clear(); }
+	void closeDialog() { _curLayout.pop()->reflowLayout(); _curDialog.clear(); _widgetCache.clear(); }
 
 	bool getWidgetData(const Common::String &widget, int16 &x, int16 &y, uint16 &w, uint16 &h);
 
@@ -98,10 +114,13 @@ public:
 	void reset();
 
 private:
+	const CachedWidget *lookupWidget(const Common::String &widget);
+
 	VariablesMap _vars;
 	VariablesMap _builtin;
 
 	LayoutsMap _layouts;
+	WidgetCacheMap _widgetCache;
 	Common::Stack<ThemeLayout *> _curLayout;
 	Common::String _curDialog;
 };
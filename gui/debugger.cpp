@@ -25,6 +25,9 @@
 
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/file.h"
+#include "common/memstats.h"
+#include "common/profiler.h"
 #include "common/system.h"
 
 #ifndef DISABLE_MD5
@@ -78,6 +81,9 @@ Debugger::Debugger() {
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
 	registerCmd("debugflag_enable",	WRAP_METHOD(Debugger, cmdDebugFlagEnable));
 	registerCmd("debugflag_disable",	WRAP_METHOD(Debugger, cmdDebugFlagDisable));
+	registerCmd("frame_profile",	WRAP_METHOD(Debugger, cmdFrameProfile));
+	registerCmd("memory_stats",		WRAP_METHOD(Debugger, cmdMemoryStats));
+	registerCmd("memory_shrink",	WRAP_METHOD(Debugger, cmdMemoryShrink));
 }
 
 Debugger::~Debugger() {
@@ -781,6 +787,106 @@ bool Debugger::cmdDebugFlagDisable(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdFrameProfile(int argc, const char **argv) {
+	Common::Profiler &prof = ProfMan;
+	int frames = prof.getHistoryLength();
+
+	if (frames == 0) {
+		debugPrintf("No frames have been profiled yet\n");
+		return true;
+	}
+
+	if (argc >= 2 && !scumm_stricmp(argv[1], "csv")) {
+		// Dump the raw per-frame history as CSV
+		const char *filename = (argc >= 3) ? argv[2] : "frame_profile.csv";
+		Common::DumpFile file;
+		if (!file.open(filename)) {
+			debugPrintf("Failed to open '%s' for writing\n", filename);
+			return true;
+		}
+
+		file.writeString("frame_ms");
+		for (int zone = 0; zone < prof.getZoneCount(); zone++)
+			file.writeString(Common::String::format(",%s", prof.getZoneName(zone)));
+		file.writeString("\n");
+
+		for (int frame = 0; frame < frames; frame++) {
+			file.writeString(Common::String::format("%u", prof.getFrameTime(frame)));
+			for (int zone = 0; zone < prof.getZoneCount(); zone++)
+				file.writeString(Common::String::format(",%u", prof.getZoneTime(frame, zone)));
+			file.writeString("\n");
+		}
+
+		file.close();
+		debugPrintf("Dumped %d frames to '%s'\n", frames, filename);
+		return true;
+	}
+
+	// Print average and peak times over the stored frames
+	uint32 frameTotal = 0, frameMax = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		uint32 t = prof.getFrameTime(frame);
+		frameTotal += t;
+		if (t > frameMax)
+			frameMax = t;
+	}
+
+	debugPrintf("Last %d frames: %u ms avg, %u ms peak\n", frames, frameTotal / frames, frameMax);
+	debugPrintf("%-24s %8s %8s\n", "zone", "avg(ms)", "max(ms)");
+
+	for (int zone = 0; zone < prof.getZoneCount(); zone++) {
+		uint32 zoneTotal = 0, zoneMax = 0;
+		for (int frame = 0; frame < frames; frame++) {
+			uint32 t = prof.getZoneTime(frame, zone);
+			zoneTotal += t;
+			if (t > zoneMax)
+				zoneMax = t;
+		}
+		debugPrintf("%-24s %8u %8u\n", prof.getZoneName(zone), zoneTotal / frames, zoneMax);
+	}
+
+	debugPrintf("Use \"frame_profile csv [<file>]\" to dump the raw frames\n");
+	return true;
+}
+
+bool Debugger::cmdMemoryStats(int argc, const char **argv) {
+	Common::MemoryStats &stats = MemStats;
+
+	if (stats.getPoolCount() == 0) {
+		debugPrintf("No memory pools have been registered\n");
+		return true;
+	}
+
+	debugPrintf("%-24s %10s %10s %10s %s\n", "pool", "cur(KB)", "peak(KB)", "allocs", "shrinkable");
+
+	uint32 totalCurrent = 0, totalPeak = 0;
+	for (int pool = 0; pool < stats.getPoolCount(); pool++) {
+		debugPrintf("%-24s %10u %10u %10u %s\n", stats.getPoolName(pool),
+				stats.getCurrent(pool) / 1024, stats.getPeak(pool) / 1024,
+				stats.getAllocCount(pool),
+				stats.isShrinkable(pool) ? "yes" : "no");
+		totalCurrent += stats.getCurrent(pool);
+		totalPeak += stats.getPeak(pool);
+	}
+
+	debugPrintf("%-24s %10u %10u\n", "total", totalCurrent / 1024, totalPeak / 1024);
+	return true;
+}
+
+bool Debugger::cmdMemoryShrink(int argc, const char **argv) {
+	if (argc != 2) {
+		debugPrintf("Asks shrinkable memory pools to give memory back until the\n");
+		debugPrintf("total tracked use is at or below the given target.\n");
+		debugPrintf("Usage: %s <target KB>\n", argv[0]);
+		return true;
+	}
+
+	uint32 target = (uint32)atoi(argv[1]) * 1024;
+	uint32 total = MemStats.shrinkToTarget(target);
+	debugPrintf("Total tracked memory is now %u KB\n", total / 1024);
+	return true;
+}
+
 // Console handler
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 bool Debugger::debuggerInputCallback(GUI::ConsoleDialog *console, const char *input, void *refCon) {
@@ -232,6 +232,9 @@ protected:
 	bool cmdDebugFlagsList(int argc, const char **argv);
 	bool cmdDebugFlagEnable(int argc, const char **argv);
 	bool cmdDebugFlagDisable(int argc, const char **argv);
+	bool cmdFrameProfile(int argc, const char **argv);
+	bool cmdMemoryStats(int argc, const char **argv);
+	bool cmdMemoryShrink(int argc, const char **argv);
 
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 private:
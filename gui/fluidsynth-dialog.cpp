@@ -44,6 +44,8 @@ enum {
 	kReverbWidthChangedCmd		= 'rwic',
 	kReverbLevelChangedCmd		= 'rlec',
 
+	kMiscPolyphonyChangedCmd	= 'mpoc',
+
 	kResetSettingsCmd		= 'rese'
 };
 
@@ -145,6 +147,14 @@ FluidSynthSettingsDialog::FluidSynthSettingsDialog()
 	_miscInterpolationPopUp->appendEntry(_("Fourth-order"), kInterpolation4thOrder);
 	_miscInterpolationPopUp->appendEntry(_("Seventh-order"), kInterpolation7thOrder);
 
+	_miscPolyphonyDesc = new StaticTextWidget(_tabWidget, "FluidSynthSettings_Misc.PolyphonyText", _("Voices:"));
+	_miscPolyphonySlider = new SliderWidget(_tabWidget, "FluidSynthSettings_Misc.PolyphonySlider", 0, kMiscPolyphonyChangedCmd);
+	// 32 - 1024, Default: 256. This is the polyphony limit of the synth;
+	// lowering it caps the CPU cost of dense scores on weak hardware.
+	_miscPolyphonySlider->setMinValue(32);
+	_miscPolyphonySlider->setMaxValue(1024);
+	_miscPolyphonyLabel = new StaticTextWidget(_tabWidget, "FluidSynthSettings_Misc.PolyphonyLabel", "256");
+
 	_tabWidget->setActiveTab(0);
 
 	new ButtonWidget(this, "FluidSynthSettings.ResetSettings", _("Reset"), _("Reset all FluidSynth settings to their default values."), kResetSettingsCmd);
@@ -213,6 +223,10 @@ void FluidSynthSettingsDialog::handleCommand(CommandSender *sender, uint32 cmd,
 		_reverbLevelLabel->setLabel(Common::String::format("%d", _reverbLevelSlider->getValue()));
 		_reverbLevelLabel->draw();
 		break;
+	case kMiscPolyphonyChangedCmd:
+		_miscPolyphonyLabel->setLabel(Common::String::format("%d", _miscPolyphonySlider->getValue()));
+		_miscPolyphonyLabel->draw();
+		break;
 	case kResetSettingsCmd: {
 		MessageDialog alert(_("Do you really want to reset all FluidSynth settings to their default values?"), _("Yes"), _("No"));
 		if (alert.runModal() == GUI::kMessageOK) {
@@ -301,6 +315,9 @@ void FluidSynthSettingsDialog::readSettings() {
 		_miscInterpolationPopUp->setSelectedTag(kInterpolation7thOrder);
 	}
 
+	_miscPolyphonySlider->setValue(ConfMan.getInt("fluidsynth_misc_polyphony", _domain));
+	_miscPolyphonyLabel->setLabel(Common::String::format("%d", _miscPolyphonySlider->getValue()));
+
 	// This may trigger redrawing, so don't do it until all sliders have
 	// their proper values. Otherwise, the dialog may crash because of
 	// invalid slider values.
@@ -343,6 +360,8 @@ void FluidSynthSettingsDialog::writeSettings() {
 		ConfMan.removeKey("fluidsynth_misc_interpolation", _domain);
 	}
 
+	ConfMan.setInt("fluidsynth_misc_polyphony", _miscPolyphonySlider->getValue(), _domain);
+
 	// The main options dialog is responsible for writing the config file.
 	// That's why we don't actually flush the settings to the file here.
 }
@@ -362,6 +381,7 @@ void FluidSynthSettingsDialog::resetSettings() {
 	ConfMan.removeKey("fluidsynth_reverb_level", _domain);
 
 	ConfMan.removeKey("fluidsynth_misc_interpolation", _domain);
+	ConfMan.removeKey("fluidsynth_misc_polyphony", _domain);
 }
 
 } // End of namespace GUI
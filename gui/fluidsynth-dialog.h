@@ -98,6 +98,10 @@ private:
 
 	StaticTextWidget *_miscInterpolationPopUpDesc;
 	PopUpWidget *_miscInterpolationPopUp;
+
+	StaticTextWidget *_miscPolyphonyDesc;
+	SliderWidget *_miscPolyphonySlider;
+	StaticTextWidget *_miscPolyphonyLabel;
 };
 
 } // End of namespace GUI
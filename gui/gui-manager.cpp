@@ -323,7 +323,12 @@ void GuiManager::runLoop() {
 
 		Common::Event event;
 
-		while (eventMan->pollEvent(event)) {
+		// Wait for the first event instead of sleeping unconditionally at
+		// the bottom of the loop: an idle GUI (e.g. the launcher) then
+		// only wakes when there is actually something to do, while input
+		// is still handled without the old 10 ms worst-case delay.
+		for (bool haveEvent = eventMan->waitEventWithTimeout(event, 10);
+				haveEvent; haveEvent = eventMan->pollEvent(event)) {
 			// We will need to check whether the screen changed while polling
 			// for an event here. While we do send EVENT_SCREEN_CHANGED
 			// whenever this happens we still cannot be sure that we get such
@@ -379,8 +384,6 @@ void GuiManager::runLoop() {
 			}
 		}
 
-		// Delay for a moment
-		_system->delayMillis(10);
 	}
 
 	// WORKAROUND: When quitting we might not properly close the dialogs on
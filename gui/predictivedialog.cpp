@@ -67,7 +67,12 @@ enum {
 	kModeAbc = 2
 };
 
-PredictiveDialog::PredictiveDialog() : Dialog("Predictive") {
+PredictiveDialog::Dict &PredictiveDialog::predictiveDictCache() {
+	static Dict dict;
+	return dict;
+}
+
+PredictiveDialog::PredictiveDialog() : Dialog("Predictive"), _predictiveDict(predictiveDictCache()) {
 	new StaticTextWidget(this, "Predictive.Headline", "Enter Text");
 
 	_button[kCancelAct] =  new ButtonWidget(this, "Predictive.Cancel",  _("Cancel")   , 0, kCancelCmd);
@@ -107,6 +112,8 @@ PredictiveDialog::PredictiveDialog() : Dialog("Predictive") {
 	_userDict.nameDict = "user_dictionary";
 	_userDict.defaultFilename = "user.dic";
 
+	// The main dictionary survives in the cache across dialog instances,
+	// so this only does work the first time around.
 	if (!_predictiveDict.dictText) {
 		loadAllDictionary(_predictiveDict);
 		if (!_predictiveDict.dictText)
@@ -152,7 +159,6 @@ PredictiveDialog::~PredictiveDialog() {
 		free(_memoryList[i]);
 	}
 	free(_userDict.dictLine);
-	free(_predictiveDict.dictLine);
 	free(_unitedDict.dictLine);
 }
 
@@ -111,9 +111,17 @@ private:
 	void mergeDicts();
 
 	void updateHighLightedButton(ButtonId active);
+
+	/**
+	 * The main predictive dictionary (pred.dic) is read-only and can be
+	 * several megabytes, so it is loaded and indexed only once and then
+	 * kept for the rest of the session, instead of being re-read every
+	 * time the dialog is opened.
+	 */
+	static Dict &predictiveDictCache();
 private:
 	Dict _unitedDict;
-	Dict _predictiveDict;
+	Dict &_predictiveDict;
 	Dict _userDict;
 
 	int _mode;
@@ -26,6 +26,7 @@
 #include "gui/dialog.h"
 #include "gui/widgets/list.h"
 
+#include "common/hashmap.h"
 #include "engines/metaengine.h"
 
 namespace GUI {
@@ -110,6 +111,15 @@ protected:
 	*/
 	virtual void listSaves();
 
+	/**
+	 * Wrapper around MetaEngine::querySaveMetaInfos which caches the
+	 * descriptors by slot. Querying the meta infos decompresses the save
+	 * header and thumbnail, so doing it anew on every page flip or
+	 * selection change makes big save lists feel sluggish. The cache is
+	 * dropped whenever the save list is refreshed.
+	 */
+	SaveStateDescriptor querySaveMetaInfos(int slot);
+
 	const bool				_saveMode;
 	const MetaEngine		*_metaEngine;
 	bool					_delSupport;
@@ -120,6 +130,7 @@ protected:
 	Common::String			_target;
 	bool _dialogWasShown;
 	SaveStateList			_saveList;
+	Common::HashMap<int, SaveStateDescriptor> _metaInfoCache;
 
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	ButtonWidget *_listButton;
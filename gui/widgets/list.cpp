@@ -170,6 +170,14 @@ void ListWidget::setList(const StringArray &list, const ColorList *colors) {
 	_listIndex.clear();
 	_listColors.clear();
 
+	// Keep a lowercased copy of every entry around, so that the filter
+	// does not have to lowercase the whole list on each keystroke.
+	_dataListLowered.resize(list.size());
+	for (uint i = 0; i < list.size(); ++i) {
+		_dataListLowered[i] = list[i];
+		_dataListLowered[i].toLowercase();
+	}
+
 	if (colors) {
 		_listColors = *colors;
 		assert(_listColors.size() == _dataList.size());
@@ -200,9 +208,20 @@ void ListWidget::append(const String &s, ThemeEngine::FontColor color) {
 	}
 
 	_dataList.push_back(s);
-	_list.push_back(s);
 
-	setFilter(_filter, false);
+	String lowered = s;
+	lowered.toLowercase();
+	_dataListLowered.push_back(lowered);
+
+	// Insert the new entry into the displayed list only if it matches the
+	// active filter, so entries can be streamed in (e.g. while a mass add
+	// scan proceeds) without rebuilding the whole list.
+	if (_filter.empty()) {
+		_list.push_back(s);
+	} else if (matchesFilter(lowered)) {
+		_list.push_back(s);
+		_listIndex.push_back(_dataList.size() - 1);
+	}
 
 	scrollBarRecalc();
 }
@@ -681,6 +700,17 @@ void ListWidget::reflowLayout() {
 	}
 }
 
+bool ListWidget::matchesFilter(const String &lowered) const {
+	Common::StringTokenizer tok(_filter);
+
+	while (!tok.empty()) {
+		if (!lowered.contains(tok.nextToken()))
+			return false;
+	}
+
+	return true;
+}
+
 void ListWidget::setFilter(const String &filter, bool redraw) {
 	// FIXME: This method does not deal correctly with edit mode!
 	// Until we fix that, let's make sure it isn't called while editing takes place
@@ -692,6 +722,7 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 	if (_filter == filt) // Filter was not changed
 		return;
 
+	const String oldFilter = _filter;
 	_filter = filt;
 
 	if (_filter.empty()) {
@@ -702,30 +733,26 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 		// Restrict the list to everything which contains all words in _filter
 		// as substrings, ignoring case.
 
-		Common::StringTokenizer tok(_filter);
-		String tmp;
-		int n = 0;
+		// If the new filter only extends the old one (the common case: the
+		// user typed on), every match is already in the currently displayed
+		// list, so it suffices to rescan that instead of the whole data list.
+		const bool refine = !oldFilter.empty() && _filter.hasPrefix(oldFilter);
+		const uint count = refine ? _listIndex.size() : _dataList.size();
 
-		_list.clear();
-		_listIndex.clear();
+		StringArray filteredList;
+		Common::Array<int> filteredIndex;
 
-		for (StringArray::iterator i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = *i;
-			tmp.toLowercase();
-			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
-					matches = false;
-					break;
-				}
-			}
+		for (uint i = 0; i < count; ++i) {
+			const int n = refine ? _listIndex[i] : (int)i;
 
-			if (matches) {
-				_list.push_back(*i);
-				_listIndex.push_back(n);
+			if (matchesFilter(_dataListLowered[n])) {
+				filteredList.push_back(_dataList[n]);
+				filteredIndex.push_back(n);
 			}
 		}
+
+		_list = filteredList;
+		_listIndex = filteredIndex;
 	}
 
 	_currentPos = 0;
@@ -55,6 +55,7 @@ public:
 protected:
 	StringArray		_list;
 	StringArray		_dataList;
+	StringArray		_dataListLowered;
 	ColorList		_listColors;
 	Common::Array<int>		_listIndex;
 	bool			_editable;
@@ -139,6 +140,10 @@ protected:
 
 	/// Finds the item at position (x,y). Returns -1 if there is no item there.
 	int findItem(int x, int y) const;
+
+	/// Checks a lowercased entry against the current (non-empty) filter.
+	bool matchesFilter(const String &lowered) const;
+
 	void scrollBarRecalc();
 
 	void abortEditMode();
@@ -57,86 +57,140 @@ inline uint16 createDitherTableIndex(const byte *clipTable, byte y, int8 u, int8
 	       ((b & 0xF0) >> 4);
 }
 
-/**
- * Put a raw pixel to the destination surface
- */
-template<typename PixelInt>
-inline void putPixelRaw(PixelInt *dst, const byte *clipTable, const Graphics::PixelFormat &format, byte y, byte u, byte v) {
-	*dst = convertYUVToColor(clipTable, format, y, u, v);
+inline byte getRGBLookupEntry(const byte *colorMap, uint16 index) {
+	return colorMap[s_defaultPaletteLookup[CLIP<int>(index, 0, 1023)]];
 }
 
-/**
- * Specialized putPixelRaw for palettized 8bpp output
- */
-template<>
-inline void putPixelRaw(byte *dst, const byte *clipTable, const Graphics::PixelFormat &format, byte y, byte u, byte v) {
-	*dst = y;
+inline void ditherCodebookDetail(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
+	int uLookup = (byte)codebook.u * 2;
+	int vLookup = (byte)codebook.v * 2;
+	uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
+	uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
+
+	int yLookup1 = codebook.y[0] * 2;
+	int yLookup2 = codebook.y[1] * 2;
+	int yLookup3 = codebook.y[2] * 2;
+	int yLookup4 = codebook.y[3] * 2;
+
+	uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
+	uint32 pixelGroup2 = uv2 | s_yLookup[yLookup2 + 1];
+	uint32 pixelGroup3 = uv1 | s_yLookup[yLookup3];
+	uint32 pixelGroup4 = uv1 | s_yLookup[yLookup4];
+	uint32 pixelGroup5 = uv1 | s_yLookup[yLookup1];
+	uint32 pixelGroup6 = uv1 | s_yLookup[yLookup2];
+	uint32 pixelGroup7 = uv2 | s_yLookup[yLookup3 + 1];
+	uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
+
+	dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
+	dst[1] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
+	dst[2] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
+	dst[3] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
+	dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
+	dst[5] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
+	dst[6] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
+	dst[7] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
+	dst[8] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
+	dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
+	dst[10] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
+	dst[11] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
+	dst[12] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
+	dst[13] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
+	dst[14] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
+	dst[15] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
+}
+
+inline void ditherCodebookSmooth(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
+	int uLookup = (byte)codebook.u * 2;
+	int vLookup = (byte)codebook.v * 2;
+	uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
+	uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
+
+	int yLookup1 = codebook.y[0] * 2;
+	int yLookup2 = codebook.y[1] * 2;
+	int yLookup3 = codebook.y[2] * 2;
+	int yLookup4 = codebook.y[3] * 2;
+
+	uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
+	uint32 pixelGroup2 = uv1 | s_yLookup[yLookup2];
+	uint32 pixelGroup3 = uv1 | s_yLookup[yLookup1];
+	uint32 pixelGroup4 = uv2 | s_yLookup[yLookup2 + 1];
+	uint32 pixelGroup5 = uv2 | s_yLookup[yLookup3 + 1];
+	uint32 pixelGroup6 = uv1 | s_yLookup[yLookup3];
+	uint32 pixelGroup7 = uv1 | s_yLookup[yLookup4];
+	uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
+
+	dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
+	dst[1] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
+	dst[2] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
+	dst[3] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
+	dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
+	dst[5] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
+	dst[6] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
+	dst[7] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
+	dst[8] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
+	dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
+	dst[10] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
+	dst[11] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
+	dst[12] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
+	dst[13] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
+	dst[14] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
+	dst[15] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
 }
 
 /**
  * The default codebook converter: raw output.
+ *
+ * The colors were already converted to the output format when the
+ * codebook entries were loaded (see expandCodebookEntry()), so only
+ * ready-made pixels are copied here.
  */
 struct CodebookConverterRaw {
 	template<typename PixelInt>
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, PixelInt *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		putPixelRaw(rows[0] + 0, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-		putPixelRaw(rows[0] + 1, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 0, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 1, clipTable, format, codebook.y[0], codebook.u, codebook.v);
-
-		putPixelRaw(rows[0] + 2, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-		putPixelRaw(rows[0] + 3, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 2, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-		putPixelRaw(rows[1] + 3, clipTable, format, codebook.y[1], codebook.u, codebook.v);
-
-		putPixelRaw(rows[2] + 0, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-		putPixelRaw(rows[2] + 1, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 0, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 1, clipTable, format, codebook.y[2], codebook.u, codebook.v);
-
-		putPixelRaw(rows[2] + 2, clipTable, format, codebook.y[3], codebook.u, codebook.v);
-		putPixelRaw(rows[2] + 3, clipTable, format, codebook.y[3], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 2, clipTable, format, codebook.y[3], codebook.u, codebook.v);
-		putPixelRaw(rows[3] + 3, clipTable, format, codebook.y[3], codebook.u, codebook.v);
+		const uint32 *colors = strip.v1_color + codebookIndex * 4;
+		rows[0][0] = rows[0][1] = rows[1][0] = rows[1][1] = (PixelInt)colors[0];
+		rows[0][2] = rows[0][3] = rows[1][2] = rows[1][3] = (PixelInt)colors[1];
+		rows[2][0] = rows[2][1] = rows[3][0] = rows[3][1] = (PixelInt)colors[2];
+		rows[2][2] = rows[2][3] = rows[3][2] = rows[3][3] = (PixelInt)colors[3];
 	}
 
 	template<typename PixelInt>
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, PixelInt *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook1 = strip.v4_codebook[codebookIndex[0]];
-		putPixelRaw(rows[0] + 0, clipTable, format, codebook1.y[0], codebook1.u, codebook1.v);
-		putPixelRaw(rows[0] + 1, clipTable, format, codebook1.y[1], codebook1.u, codebook1.v);
-		putPixelRaw(rows[1] + 0, clipTable, format, codebook1.y[2], codebook1.u, codebook1.v);
-		putPixelRaw(rows[1] + 1, clipTable, format, codebook1.y[3], codebook1.u, codebook1.v);
-
-		const CinepakCodebook &codebook2 = strip.v4_codebook[codebookIndex[1]];
-		putPixelRaw(rows[0] + 2, clipTable, format, codebook2.y[0], codebook2.u, codebook2.v);
-		putPixelRaw(rows[0] + 3, clipTable, format, codebook2.y[1], codebook2.u, codebook2.v);
-		putPixelRaw(rows[1] + 2, clipTable, format, codebook2.y[2], codebook2.u, codebook2.v);
-		putPixelRaw(rows[1] + 3, clipTable, format, codebook2.y[3], codebook2.u, codebook2.v);
-
-		const CinepakCodebook &codebook3 = strip.v4_codebook[codebookIndex[2]];
-		putPixelRaw(rows[2] + 0, clipTable, format, codebook3.y[0], codebook3.u, codebook3.v);
-		putPixelRaw(rows[2] + 1, clipTable, format, codebook3.y[1], codebook3.u, codebook3.v);
-		putPixelRaw(rows[3] + 0, clipTable, format, codebook3.y[2], codebook3.u, codebook3.v);
-		putPixelRaw(rows[3] + 1, clipTable, format, codebook3.y[3], codebook3.u, codebook3.v);
-
-		const CinepakCodebook &codebook4 = strip.v4_codebook[codebookIndex[3]];
-		putPixelRaw(rows[2] + 2, clipTable, format, codebook4.y[0], codebook4.u, codebook4.v);
-		putPixelRaw(rows[2] + 3, clipTable, format, codebook4.y[1], codebook4.u, codebook4.v);
-		putPixelRaw(rows[3] + 2, clipTable, format, codebook4.y[2], codebook4.u, codebook4.v);
-		putPixelRaw(rows[3] + 3, clipTable, format, codebook4.y[3], codebook4.u, codebook4.v);
+		const uint32 *colors = strip.v4_color + codebookIndex[0] * 4;
+		rows[0][0] = (PixelInt)colors[0];
+		rows[0][1] = (PixelInt)colors[1];
+		rows[1][0] = (PixelInt)colors[2];
+		rows[1][1] = (PixelInt)colors[3];
+
+		colors = strip.v4_color + codebookIndex[1] * 4;
+		rows[0][2] = (PixelInt)colors[0];
+		rows[0][3] = (PixelInt)colors[1];
+		rows[1][2] = (PixelInt)colors[2];
+		rows[1][3] = (PixelInt)colors[3];
+
+		colors = strip.v4_color + codebookIndex[2] * 4;
+		rows[2][0] = (PixelInt)colors[0];
+		rows[2][1] = (PixelInt)colors[1];
+		rows[3][0] = (PixelInt)colors[2];
+		rows[3][1] = (PixelInt)colors[3];
+
+		colors = strip.v4_color + codebookIndex[3] * 4;
+		rows[2][2] = (PixelInt)colors[0];
+		rows[2][3] = (PixelInt)colors[1];
+		rows[3][2] = (PixelInt)colors[2];
+		rows[3][3] = (PixelInt)colors[3];
 	}
 };
 
 /**
  * Codebook converter that dithers in VFW-style
+ *
+ * The dithered blocks were already computed when the codebook entries
+ * were loaded (see CinepakDecoder::ditherCodebookVFW()).
  */
 struct CodebookConverterDitherVFW {
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, byte *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		byte blockBuffer[16];
-		ditherCodebookSmooth(codebook, blockBuffer, colorMap);
+		const byte *blockBuffer = strip.v1_vfwDither + codebookIndex * 16;
 		rows[0][0] = blockBuffer[0];
 		rows[0][1] = blockBuffer[1];
 		rows[0][2] = blockBuffer[2];
@@ -156,112 +210,30 @@ struct CodebookConverterDitherVFW {
 	}
 
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, byte *(&rows)[4], const byte *clipTable, const byte *colorMap, const Graphics::PixelFormat &format) {
-		byte blockBuffer[16];
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[0]], blockBuffer, colorMap);
+		const byte *blockBuffer = strip.v4_vfwDither + codebookIndex[0] * 16;
 		rows[0][0] = blockBuffer[0];
 		rows[0][1] = blockBuffer[1];
 		rows[1][0] = blockBuffer[4];
 		rows[1][1] = blockBuffer[5];
 
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[1]], blockBuffer, colorMap);
+		blockBuffer = strip.v4_vfwDither + codebookIndex[1] * 16;
 		rows[0][2] = blockBuffer[2];
 		rows[0][3] = blockBuffer[3];
 		rows[1][2] = blockBuffer[6];
 		rows[1][3] = blockBuffer[7];
 
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[2]], blockBuffer, colorMap);
+		blockBuffer = strip.v4_vfwDither + codebookIndex[2] * 16;
 		rows[2][0] = blockBuffer[8];
 		rows[2][1] = blockBuffer[9];
 		rows[3][0] = blockBuffer[12];
 		rows[3][1] = blockBuffer[13];
 
-		ditherCodebookDetail(strip.v4_codebook[codebookIndex[3]], blockBuffer, colorMap);
+		blockBuffer = strip.v4_vfwDither + codebookIndex[3] * 16;
 		rows[2][2] = blockBuffer[10];
 		rows[2][3] = blockBuffer[11];
 		rows[3][2] = blockBuffer[14];
 		rows[3][3] = blockBuffer[15];
 	}
-
-private:
-	static inline void ditherCodebookDetail(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
-		int uLookup = (byte)codebook.u * 2;
-		int vLookup = (byte)codebook.v * 2;
-		uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
-		uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
-
-		int yLookup1 = codebook.y[0] * 2;
-		int yLookup2 = codebook.y[1] * 2;
-		int yLookup3 = codebook.y[2] * 2;
-		int yLookup4 = codebook.y[3] * 2;
-
-		uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
-		uint32 pixelGroup2 = uv2 | s_yLookup[yLookup2 + 1];
-		uint32 pixelGroup3 = uv1 | s_yLookup[yLookup3];
-		uint32 pixelGroup4 = uv1 | s_yLookup[yLookup4];
-		uint32 pixelGroup5 = uv1 | s_yLookup[yLookup1];
-		uint32 pixelGroup6 = uv1 | s_yLookup[yLookup2];
-		uint32 pixelGroup7 = uv2 | s_yLookup[yLookup3 + 1];
-		uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
-
-		dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
-		dst[1] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
-		dst[2] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
-		dst[3] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
-		dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
-		dst[5] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
-		dst[6] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
-		dst[7] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
-		dst[8] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
-		dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
-		dst[10] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
-		dst[11] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
-		dst[12] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
-		dst[13] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
-		dst[14] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
-		dst[15] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
-	}
-
-	static inline void ditherCodebookSmooth(const CinepakCodebook &codebook, byte *dst, const byte *colorMap) {
-		int uLookup = (byte)codebook.u * 2;
-		int vLookup = (byte)codebook.v * 2;
-		uint32 uv1 = s_uLookup[uLookup] | s_vLookup[vLookup];
-		uint32 uv2 = s_uLookup[uLookup + 1] | s_vLookup[vLookup + 1];
-
-		int yLookup1 = codebook.y[0] * 2;
-		int yLookup2 = codebook.y[1] * 2;
-		int yLookup3 = codebook.y[2] * 2;
-		int yLookup4 = codebook.y[3] * 2;
-
-		uint32 pixelGroup1 = uv2 | s_yLookup[yLookup1 + 1];
-		uint32 pixelGroup2 = uv1 | s_yLookup[yLookup2];
-		uint32 pixelGroup3 = uv1 | s_yLookup[yLookup1];
-		uint32 pixelGroup4 = uv2 | s_yLookup[yLookup2 + 1];
-		uint32 pixelGroup5 = uv2 | s_yLookup[yLookup3 + 1];
-		uint32 pixelGroup6 = uv1 | s_yLookup[yLookup3];
-		uint32 pixelGroup7 = uv1 | s_yLookup[yLookup4];
-		uint32 pixelGroup8 = uv2 | s_yLookup[yLookup4 + 1];
-
-		dst[0] = getRGBLookupEntry(colorMap, pixelGroup1 & 0xFFFF);
-		dst[1] = getRGBLookupEntry(colorMap, pixelGroup1 >> 16);
-		dst[2] = getRGBLookupEntry(colorMap, pixelGroup2 & 0xFFFF);
-		dst[3] = getRGBLookupEntry(colorMap, pixelGroup2 >> 16);
-		dst[4] = getRGBLookupEntry(colorMap, pixelGroup3 & 0xFFFF);
-		dst[5] = getRGBLookupEntry(colorMap, pixelGroup3 >> 16);
-		dst[6] = getRGBLookupEntry(colorMap, pixelGroup4 & 0xFFFF);
-		dst[7] = getRGBLookupEntry(colorMap, pixelGroup4 >> 16);
-		dst[8] = getRGBLookupEntry(colorMap, pixelGroup5 >> 16);
-		dst[9] = getRGBLookupEntry(colorMap, pixelGroup6 & 0xFFFF);
-		dst[10] = getRGBLookupEntry(colorMap, pixelGroup7 >> 16);
-		dst[11] = getRGBLookupEntry(colorMap, pixelGroup8 & 0xFFFF);
-		dst[12] = getRGBLookupEntry(colorMap, pixelGroup6 >> 16);
-		dst[13] = getRGBLookupEntry(colorMap, pixelGroup5 & 0xFFFF);
-		dst[14] = getRGBLookupEntry(colorMap, pixelGroup8 >> 16);
-		dst[15] = getRGBLookupEntry(colorMap, pixelGroup7 & 0xFFFF);
-	}
-
-	static inline byte getRGBLookupEntry(const byte *colorMap, uint16 index) {
-		return colorMap[s_defaultPaletteLookup[CLIP<int>(index, 0, 1023)]];
-	}
 };
 
 /**
@@ -435,6 +407,12 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 				_curFrame.strips[i].v4_codebook[j] = _curFrame.strips[i - 1].v4_codebook[j];
 			}
 
+			// Copy the precomputed codebook expansions
+			memcpy(_curFrame.strips[i].v1_color, _curFrame.strips[i - 1].v1_color, 256 * 4 * sizeof(uint32));
+			memcpy(_curFrame.strips[i].v4_color, _curFrame.strips[i - 1].v4_color, 256 * 4 * sizeof(uint32));
+			memcpy(_curFrame.strips[i].v1_vfwDither, _curFrame.strips[i - 1].v1_vfwDither, 256 * 16);
+			memcpy(_curFrame.strips[i].v4_vfwDither, _curFrame.strips[i - 1].v4_vfwDither, 256 * 16);
+
 			// Copy the QuickTime dither tables
 			memcpy(_curFrame.strips[i].v1_dither, _curFrame.strips[i - 1].v1_dither, 256 * 4 * 4 * 4);
 			memcpy(_curFrame.strips[i].v4_dither, _curFrame.strips[i - 1].v4_dither, 256 * 4 * 4 * 4);
@@ -533,9 +511,14 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 				codebook[i].v = 0;
 			}
 
-			// Dither the codebook if we're dithering for QuickTime
+			// Precompute the expansion of the entry: the dithered block
+			// when dithering, the converted output colors otherwise
 			if (_ditherType == kDitherTypeQT)
 				ditherCodebookQT(strip, codebookType, i);
+			else if (_ditherType == kDitherTypeVFW)
+				ditherCodebookVFW(strip, codebookType, i);
+			else
+				expandCodebookEntry(strip, codebookType, i);
 		}
 	}
 }
@@ -598,6 +581,31 @@ void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 co
 	}
 }
 
+void CinepakDecoder::ditherCodebookVFW(uint16 strip, byte codebookType, uint16 codebookIndex) {
+	if (codebookType == 1)
+		ditherCodebookSmooth(_curFrame.strips[strip].v1_codebook[codebookIndex], _curFrame.strips[strip].v1_vfwDither + codebookIndex * 16, _colorMap);
+	else
+		ditherCodebookDetail(_curFrame.strips[strip].v4_codebook[codebookIndex], _curFrame.strips[strip].v4_vfwDither + codebookIndex * 16, _colorMap);
+}
+
+void CinepakDecoder::expandCodebookEntry(uint16 strip, byte codebookType, uint16 codebookIndex) {
+	const CinepakCodebook &codebook = (codebookType == 1) ?
+			_curFrame.strips[strip].v1_codebook[codebookIndex] :
+			_curFrame.strips[strip].v4_codebook[codebookIndex];
+	uint32 *colors = ((codebookType == 1) ?
+			_curFrame.strips[strip].v1_color :
+			_curFrame.strips[strip].v4_color) + codebookIndex * 4;
+
+	if (_pixelFormat.bytesPerPixel == 1) {
+		// Palettized output uses the luma values directly
+		for (int i = 0; i < 4; i++)
+			colors[i] = codebook.y[i];
+	} else {
+		for (int i = 0; i < 4; i++)
+			colors[i] = convertYUVToColor(_clipTable, _pixelFormat, codebook.y[i], codebook.u, codebook.v);
+	}
+}
+
 void CinepakDecoder::decodeVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize) {
 	if (_curFrame.surface->format.bytesPerPixel == 1) {
 		decodeVectorsTmpl<byte, CodebookConverterRaw>(_curFrame, _clipTable, _colorMap, stream, strip, chunkID, chunkSize);
@@ -46,6 +46,16 @@ struct CinepakStrip {
 	uint16 length;
 	Common::Rect rect;
 	CinepakCodebook v1_codebook[256], v4_codebook[256];
+
+	// Precomputed expansions of the codebooks, filled in as entries are
+	// loaded so the per-block vector expansion is reduced to copying
+	// contiguous, ready-made pixels:
+	// the converted output colors for the raw path ([entry * 4 + pixel], in
+	// the output format) and the dithered block bytes for the VFW path
+	// ([entry * 16 + pixel])
+	uint32 v1_color[256 * 4], v4_color[256 * 4];
+	byte v1_vfwDither[256 * 16], v4_vfwDither[256 * 16];
+
 	byte v1_dither[256 * 4 * 4 * 4], v4_dither[256 * 4 * 4 * 4];
 };
 
@@ -100,6 +110,8 @@ private:
 	byte findNearestRGB(int index) const;
 	void ditherVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
 	void ditherCodebookQT(uint16 strip, byte codebookType, uint16 codebookIndex);
+	void ditherCodebookVFW(uint16 strip, byte codebookType, uint16 codebookIndex);
+	void expandCodebookEntry(uint16 strip, byte codebookType, uint16 codebookIndex);
 };
 
 } // End of namespace Image
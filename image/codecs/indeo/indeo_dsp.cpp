@@ -28,6 +28,16 @@
 
 #include "image/codecs/indeo/indeo_dsp.h"
 
+// Vectorized column passes for the inverse slant transforms. The scalar
+// code remains as the fallback.
+#ifdef __SSE2__
+#include <emmintrin.h>
+#define USE_IVI_SLANT_SIMD
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define USE_IVI_SLANT_SIMD
+#endif
+
 namespace Image {
 namespace Indeo {
 
@@ -321,29 +331,133 @@ void IndeoDSP::ffIviDcHaar2d(const int32 *in, int16 *out, uint32 pitch,
 	d3 = COMPENSATE(t3);\
 	d4 = COMPENSATE(t4);}
 
+#ifdef USE_IVI_SLANT_SIMD
+
+/**
+ * Four int32 lanes with just enough operators overloaded for the slant
+ * transform macros above, so the same butterfly code runs on four
+ * columns at once. The multiplications only ever see the power-of-two
+ * factors the macros use.
+ */
+struct IviVec {
+#ifdef __SSE2__
+	__m128i v;
+#else
+	int32x4_t v;
+#endif
+};
+
+#ifdef __SSE2__
+
+static inline IviVec operator+(IviVec a, IviVec b) { IviVec r; r.v = _mm_add_epi32(a.v, b.v); return r; }
+static inline IviVec operator-(IviVec a, IviVec b) { IviVec r; r.v = _mm_sub_epi32(a.v, b.v); return r; }
+static inline IviVec operator-(IviVec a) { IviVec r; r.v = _mm_sub_epi32(_mm_setzero_si128(), a.v); return r; }
+static inline IviVec operator+(IviVec a, int b) { IviVec r; r.v = _mm_add_epi32(a.v, _mm_set1_epi32(b)); return r; }
+static inline IviVec operator*(IviVec a, int b) { IviVec r; r.v = _mm_slli_epi32(a.v, b == 4 ? 2 : 1); return r; }
+static inline IviVec operator>>(IviVec a, int b) { IviVec r; r.v = _mm_srai_epi32(a.v, b); return r; }
+
+static inline IviVec iviVecLoad(const int32 *src) { IviVec r; r.v = _mm_loadu_si128((const __m128i *)src); return r; }
+static inline void iviVecStore(int32 *dst, IviVec a) { _mm_storeu_si128((__m128i *)dst, a.v); }
+
+/** Store four lanes as int16, truncating like the scalar assignment */
+static inline void iviVecStore16(int16 *dst, IviVec a) {
+	const __m128i w = _mm_srai_epi32(_mm_slli_epi32(a.v, 16), 16);
+	_mm_storel_epi64((__m128i *)dst, _mm_packs_epi32(w, w));
+}
+
+/** All-ones lanes for non-empty columns, zero lanes for empty ones */
+static inline IviVec iviVecFlagMask(const uint8 *flags) {
+	IviVec r;
+	r.v = _mm_set_epi32(flags[3] ? -1 : 0, flags[2] ? -1 : 0, flags[1] ? -1 : 0, flags[0] ? -1 : 0);
+	return r;
+}
+
+static inline IviVec iviVecAnd(IviVec a, IviVec mask) { IviVec r; r.v = _mm_and_si128(a.v, mask.v); return r; }
+
+#else
+
+static inline IviVec operator+(IviVec a, IviVec b) { IviVec r; r.v = vaddq_s32(a.v, b.v); return r; }
+static inline IviVec operator-(IviVec a, IviVec b) { IviVec r; r.v = vsubq_s32(a.v, b.v); return r; }
+static inline IviVec operator-(IviVec a) { IviVec r; r.v = vnegq_s32(a.v); return r; }
+static inline IviVec operator+(IviVec a, int b) { IviVec r; r.v = vaddq_s32(a.v, vdupq_n_s32(b)); return r; }
+static inline IviVec operator*(IviVec a, int b) { IviVec r; r.v = vshlq_s32(a.v, vdupq_n_s32(b == 4 ? 2 : 1)); return r; }
+static inline IviVec operator>>(IviVec a, int b) { IviVec r; r.v = vshlq_s32(a.v, vdupq_n_s32(-b)); return r; }
+
+static inline IviVec iviVecLoad(const int32 *src) { IviVec r; r.v = vld1q_s32(src); return r; }
+static inline void iviVecStore(int32 *dst, IviVec a) { vst1q_s32(dst, a.v); }
+
+static inline void iviVecStore16(int16 *dst, IviVec a) {
+	vst1_s16(dst, vmovn_s32(a.v));
+}
+
+static inline IviVec iviVecFlagMask(const uint8 *flags) {
+	int32 m[4];
+	for (int i = 0; i < 4; i++)
+		m[i] = flags[i] ? -1 : 0;
+	IviVec r;
+	r.v = vld1q_s32(m);
+	return r;
+}
+
+static inline IviVec iviVecAnd(IviVec a, IviVec mask) { IviVec r; r.v = vandq_s32(a.v, mask.v); return r; }
+
+#endif
+
+#endif // USE_IVI_SLANT_SIMD
+
 void IndeoDSP::ffIviInverseSlant8x8(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
 	int32 tmp[64];
 	int t0, t1, t2, t3, t4, t5, t6, t7, t8;
 
+#ifdef USE_IVI_SLANT_SIMD
+	// apply the InvSlant8 to four columns at a time, zeroing the lanes
+	// of empty columns afterwards to match the scalar path
 #define COMPENSATE(x) (x)
-	const int32 *src = in;
-	int32 *dst = tmp;
-	for (int i = 0; i < 8; i++) {
-		if (flags[i]) {
-			IVI_INV_SLANT8(src[0], src[8], src[16], src[24], src[32], src[40], src[48], src[56],
-						   dst[0], dst[8], dst[16], dst[24], dst[32], dst[40], dst[48], dst[56],
-						   t0, t1, t2, t3, t4, t5, t6, t7, t8);
-		} else {
-			dst[0] = dst[8] = dst[16] = dst[24] = dst[32] = dst[40] = dst[48] = dst[56] = 0;
+	for (int i = 0; i < 8; i += 4) {
+		const IviVec mask = iviVecFlagMask(flags + i);
+		IviVec d1, d2, d3, d4, d5, d6, d7, d8;
+		IviVec vt0, vt1, vt2, vt3, vt4, vt5, vt6, vt7, vt8;
+
+		IVI_INV_SLANT8(iviVecLoad(in + i),      iviVecLoad(in + i + 8),
+					   iviVecLoad(in + i + 16), iviVecLoad(in + i + 24),
+					   iviVecLoad(in + i + 32), iviVecLoad(in + i + 40),
+					   iviVecLoad(in + i + 48), iviVecLoad(in + i + 56),
+					   d1, d2, d3, d4, d5, d6, d7, d8,
+					   vt0, vt1, vt2, vt3, vt4, vt5, vt6, vt7, vt8);
+
+		iviVecStore(tmp + i,      iviVecAnd(d1, mask));
+		iviVecStore(tmp + i + 8,  iviVecAnd(d2, mask));
+		iviVecStore(tmp + i + 16, iviVecAnd(d3, mask));
+		iviVecStore(tmp + i + 24, iviVecAnd(d4, mask));
+		iviVecStore(tmp + i + 32, iviVecAnd(d5, mask));
+		iviVecStore(tmp + i + 40, iviVecAnd(d6, mask));
+		iviVecStore(tmp + i + 48, iviVecAnd(d7, mask));
+		iviVecStore(tmp + i + 56, iviVecAnd(d8, mask));
+	}
+#undef COMPENSATE
+#else
+#define COMPENSATE(x) (x)
+	{
+		const int32 *src = in;
+		int32 *dst = tmp;
+		for (int i = 0; i < 8; i++) {
+			if (flags[i]) {
+				IVI_INV_SLANT8(src[0], src[8], src[16], src[24], src[32], src[40], src[48], src[56],
+							   dst[0], dst[8], dst[16], dst[24], dst[32], dst[40], dst[48], dst[56],
+							   t0, t1, t2, t3, t4, t5, t6, t7, t8);
+			} else {
+				dst[0] = dst[8] = dst[16] = dst[24] = dst[32] = dst[40] = dst[48] = dst[56] = 0;
+			}
+
+			src++;
+			dst++;
 		}
-
-		src++;
-		dst++;
 	}
 #undef COMPENSATE
+#endif
 
 #define COMPENSATE(x) (((x) + 1)>>1)
-	src = tmp;
+	const int32 *src = tmp;
 	for (int i = 0; i < 8; i++) {
 		if (!src[0] && !src[1] && !src[2] && !src[3] && !src[4] && !src[5] && !src[6] && !src[7]) {
 			memset(out, 0, 8*sizeof(out[0]));
@@ -362,24 +476,48 @@ void IndeoDSP::ffIviInverseSlant4x4(const int32 *in, int16 *out, uint32 pitch, c
 	int32 tmp[16];
 	int t0, t1, t2, t3, t4;
 
+#ifdef USE_IVI_SLANT_SIMD
+	// apply the InvSlant4 to all four columns at once, zeroing the
+	// lanes of empty columns afterwards to match the scalar path
 #define COMPENSATE(x) (x)
-	const int32 *src = in;
-	int32 *dst = tmp;
-	for (int i = 0; i < 4; i++) {
-		if (flags[i]) {
-			IVI_INV_SLANT4(src[0], src[4], src[8], src[12],
-						   dst[0], dst[4], dst[8], dst[12],
-						   t0, t1, t2, t3, t4);
-		} else {
-			dst[0] = dst[4] = dst[8] = dst[12] = 0;
+	{
+		const IviVec mask = iviVecFlagMask(flags);
+		IviVec d1, d2, d3, d4;
+		IviVec vt0, vt1, vt2, vt3, vt4;
+
+		IVI_INV_SLANT4(iviVecLoad(in), iviVecLoad(in + 4),
+					   iviVecLoad(in + 8), iviVecLoad(in + 12),
+					   d1, d2, d3, d4,
+					   vt0, vt1, vt2, vt3, vt4);
+
+		iviVecStore(tmp,      iviVecAnd(d1, mask));
+		iviVecStore(tmp + 4,  iviVecAnd(d2, mask));
+		iviVecStore(tmp + 8,  iviVecAnd(d3, mask));
+		iviVecStore(tmp + 12, iviVecAnd(d4, mask));
+	}
+#undef COMPENSATE
+#else
+#define COMPENSATE(x) (x)
+	{
+		const int32 *src = in;
+		int32 *dst = tmp;
+		for (int i = 0; i < 4; i++) {
+			if (flags[i]) {
+				IVI_INV_SLANT4(src[0], src[4], src[8], src[12],
+							   dst[0], dst[4], dst[8], dst[12],
+							   t0, t1, t2, t3, t4);
+			} else {
+				dst[0] = dst[4] = dst[8] = dst[12] = 0;
+			}
+			src++;
+			dst++;
 		}
-		src++;
-		dst++;
 	}
 #undef COMPENSATE
+#endif
 
 #define COMPENSATE(x) (((x) + 1)>>1)
-	src = tmp;
+	const int32 *src = tmp;
 	for (int i = 0; i < 4; i++) {
 		if (!src[0] && !src[1] && !src[2] && !src[3]) {
 			out[0] = out[1] = out[2] = out[3] = 0;
@@ -438,12 +576,39 @@ void IndeoDSP::ffIviDcRowSlant(const int32 *in, int16 *out, uint32 pitch, int bl
 }
 
 void IndeoDSP::ffIviColSlant8(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
-	int t0, t1, t2, t3, t4, t5, t6, t7, t8;
-
 	int row2 = pitch << 1;
 	int row4 = pitch << 2;
 	int row8 = pitch << 3;
 
+#ifdef USE_IVI_SLANT_SIMD
+	// apply the InvSlant8 to four columns at a time, zeroing the lanes
+	// of empty columns afterwards to match the scalar path
+#define COMPENSATE(x) (((x) + 1)>>1)
+	for (int i = 0; i < 8; i += 4) {
+		const IviVec mask = iviVecFlagMask(flags + i);
+		IviVec d1, d2, d3, d4, d5, d6, d7, d8;
+		IviVec vt0, vt1, vt2, vt3, vt4, vt5, vt6, vt7, vt8;
+
+		IVI_INV_SLANT8(iviVecLoad(in + i),      iviVecLoad(in + i + 8),
+					   iviVecLoad(in + i + 16), iviVecLoad(in + i + 24),
+					   iviVecLoad(in + i + 32), iviVecLoad(in + i + 40),
+					   iviVecLoad(in + i + 48), iviVecLoad(in + i + 56),
+					   d1, d2, d3, d4, d5, d6, d7, d8,
+					   vt0, vt1, vt2, vt3, vt4, vt5, vt6, vt7, vt8);
+
+		iviVecStore16(out + i,                iviVecAnd(d1, mask));
+		iviVecStore16(out + i + pitch,        iviVecAnd(d2, mask));
+		iviVecStore16(out + i + row2,         iviVecAnd(d3, mask));
+		iviVecStore16(out + i + row2 + pitch, iviVecAnd(d4, mask));
+		iviVecStore16(out + i + row4,         iviVecAnd(d5, mask));
+		iviVecStore16(out + i + row4 + pitch, iviVecAnd(d6, mask));
+		iviVecStore16(out + i + row4 + row2,  iviVecAnd(d7, mask));
+		iviVecStore16(out + i + row8 - pitch, iviVecAnd(d8, mask));
+	}
+#undef COMPENSATE
+#else
+	int t0, t1, t2, t3, t4, t5, t6, t7, t8;
+
 #define COMPENSATE(x) (((x) + 1)>>1)
 	for (int i = 0; i < 8; i++) {
 		if (flags[i]) {
@@ -460,6 +625,7 @@ void IndeoDSP::ffIviColSlant8(const int32 *in, int16 *out, uint32 pitch, const u
 		out++;
 	}
 #undef COMPENSATE
+#endif
 }
 
 void IndeoDSP::ffIviDcColSlant(const int32 *in, int16 *out, uint32 pitch, int blkSize) {
@@ -493,10 +659,31 @@ void IndeoDSP::ffIviRowSlant4(const int32 *in, int16 *out,
 
 void IndeoDSP::ffIviColSlant4(const int32 *in, int16 *out, uint32 pitch,
 		const uint8 *flags) {
-	int t0, t1, t2, t3, t4;
-
 	int row2 = pitch << 1;
 
+#ifdef USE_IVI_SLANT_SIMD
+	// apply the InvSlant4 to all four columns at once, zeroing the
+	// lanes of empty columns afterwards to match the scalar path
+#define COMPENSATE(x) (((x) + 1)>>1)
+	{
+		const IviVec mask = iviVecFlagMask(flags);
+		IviVec d1, d2, d3, d4;
+		IviVec vt0, vt1, vt2, vt3, vt4;
+
+		IVI_INV_SLANT4(iviVecLoad(in), iviVecLoad(in + 4),
+					   iviVecLoad(in + 8), iviVecLoad(in + 12),
+					   d1, d2, d3, d4,
+					   vt0, vt1, vt2, vt3, vt4);
+
+		iviVecStore16(out,                iviVecAnd(d1, mask));
+		iviVecStore16(out + pitch,        iviVecAnd(d2, mask));
+		iviVecStore16(out + row2,         iviVecAnd(d3, mask));
+		iviVecStore16(out + row2 + pitch, iviVecAnd(d4, mask));
+	}
+#undef COMPENSATE
+#else
+	int t0, t1, t2, t3, t4;
+
 #define COMPENSATE(x) (((x) + 1)>>1)
 	for (int i = 0; i < 4; i++) {
 		if (flags[i]) {
@@ -511,6 +698,7 @@ void IndeoDSP::ffIviColSlant4(const int32 *in, int16 *out, uint32 pitch,
 		out++;
 	}
 #undef COMPENSATE
+#endif
 }
 
 void IndeoDSP::ffIviPutPixels8x8(const int32 *in, int16 *out, uint32 pitch,
@@ -44,6 +44,17 @@ namespace Image {
 #define SVQ1_BLOCK_INTER_4V 2
 #define SVQ1_BLOCK_INTRA    3
 
+// The SVQ1 code tables are fixed, so the Huffman decoders built from them
+// are shared by all decoder instances instead of being rebuilt for every
+// video. The last decoder to go away frees them again.
+static int s_tableRefCount = 0;
+static Common::Huffman *s_blockType;
+static Common::Huffman *s_intraMultistage[6];
+static Common::Huffman *s_interMultistage[6];
+static Common::Huffman *s_intraMean;
+static Common::Huffman *s_interMean;
+static Common::Huffman *s_motionComponent;
+
 SVQ1Decoder::SVQ1Decoder(uint16 width, uint16 height) {
 	debug(1, "SVQ1Decoder::SVQ1Decoder(width:%d, height:%d)", width, height);
 	_width = width;
@@ -56,16 +67,27 @@ SVQ1Decoder::SVQ1Decoder(uint16 width, uint16 height) {
 	_last[2] = 0;
 
 	// Setup Variable Length Code Tables
-	_blockType = new Common::Huffman(0, 4, s_svq1BlockTypeCodes, s_svq1BlockTypeLengths);
+	if (s_tableRefCount++ == 0) {
+		s_blockType = new Common::Huffman(0, 4, s_svq1BlockTypeCodes, s_svq1BlockTypeLengths);
 
-	for (int i = 0; i < 6; i++) {
-		_intraMultistage[i] = new Common::Huffman(0, 8, s_svq1IntraMultistageCodes[i], s_svq1IntraMultistageLengths[i]);
-		_interMultistage[i] = new Common::Huffman(0, 8, s_svq1InterMultistageCodes[i], s_svq1InterMultistageLengths[i]);
+		for (int i = 0; i < 6; i++) {
+			s_intraMultistage[i] = new Common::Huffman(0, 8, s_svq1IntraMultistageCodes[i], s_svq1IntraMultistageLengths[i]);
+			s_interMultistage[i] = new Common::Huffman(0, 8, s_svq1InterMultistageCodes[i], s_svq1InterMultistageLengths[i]);
+		}
+
+		s_intraMean = new Common::Huffman(0, 256, s_svq1IntraMeanCodes, s_svq1IntraMeanLengths);
+		s_interMean = new Common::Huffman(0, 512, s_svq1InterMeanCodes, s_svq1InterMeanLengths);
+		s_motionComponent = new Common::Huffman(0, 33, s_svq1MotionComponentCodes, s_svq1MotionComponentLengths);
 	}
 
-	_intraMean = new Common::Huffman(0, 256, s_svq1IntraMeanCodes, s_svq1IntraMeanLengths);
-	_interMean = new Common::Huffman(0, 512, s_svq1InterMeanCodes, s_svq1InterMeanLengths);
-	_motionComponent = new Common::Huffman(0, 33, s_svq1MotionComponentCodes, s_svq1MotionComponentLengths);
+	_blockType = s_blockType;
+	for (int i = 0; i < 6; i++) {
+		_intraMultistage[i] = s_intraMultistage[i];
+		_interMultistage[i] = s_interMultistage[i];
+	}
+	_intraMean = s_intraMean;
+	_interMean = s_interMean;
+	_motionComponent = s_motionComponent;
 }
 
 SVQ1Decoder::~SVQ1Decoder() {
@@ -78,14 +100,16 @@ SVQ1Decoder::~SVQ1Decoder() {
 	delete[] _last[1];
 	delete[] _last[2];
 
-	delete _blockType;
-	delete _intraMean;
-	delete _interMean;
-	delete _motionComponent;
+	if (--s_tableRefCount == 0) {
+		delete s_blockType;
+		delete s_intraMean;
+		delete s_interMean;
+		delete s_motionComponent;
 
-	for (int i = 0; i < 6; i++) {
-		delete _intraMultistage[i];
-		delete _interMultistage[i];
+		for (int i = 0; i < 6; i++) {
+			delete s_intraMultistage[i];
+			delete s_interMultistage[i];
+		}
 	}
 }
 
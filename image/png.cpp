@@ -84,6 +84,57 @@ void pngFlushStream(png_structp pngPtr) {
 	Common::WriteStream *stream = (Common::WriteStream *)writeIOptr;
 	stream->flush();
 }
+
+/**
+ * Checks whether the given format is a byte-order permutation of 32bit RGBA
+ * that libpng can produce directly while defiltering, and determines the
+ * transformations needed to get there: swapping red and blue and/or placing
+ * the alpha (or filler) byte first.
+ */
+static bool pngFindTransforms(const Graphics::PixelFormat &format, bool &swapRedBlue, bool &alphaFirst) {
+	if (format.bytesPerPixel != 4)
+		return false;
+	if (format.rBits() != 8 || format.gBits() != 8 || format.bBits() != 8)
+		return false;
+	if (format.rShift % 8 != 0 || format.gShift % 8 != 0 || format.bShift % 8 != 0 || format.aShift % 8 != 0)
+		return false;
+
+	// libpng writes one byte per channel, so the position of each channel
+	// in memory is what decides the transformations.
+#ifdef SCUMM_LITTLE_ENDIAN
+	const byte rPos = format.rShift / 8;
+	const byte gPos = format.gShift / 8;
+	const byte bPos = format.bShift / 8;
+	const byte aPos = format.aShift / 8;
+#else
+	const byte rPos = 3 - format.rShift / 8;
+	const byte gPos = 3 - format.gShift / 8;
+	const byte bPos = 3 - format.bShift / 8;
+	const byte aPos = 3 - format.aShift / 8;
+#endif
+
+	if (rPos == 0 && gPos == 1 && bPos == 2) {
+		swapRedBlue = false;
+		alphaFirst = false;
+	} else if (bPos == 0 && gPos == 1 && rPos == 2) {
+		swapRedBlue = true;
+		alphaFirst = false;
+	} else if (rPos == 1 && gPos == 2 && bPos == 3) {
+		swapRedBlue = false;
+		alphaFirst = true;
+	} else if (bPos == 1 && gPos == 2 && rPos == 3) {
+		swapRedBlue = true;
+		alphaFirst = true;
+	} else {
+		return false;
+	}
+
+	// The alpha channel, if present, has to sit in the remaining byte
+	if (format.aBits() == 8 && aPos != (alphaFirst ? 0 : 3))
+		return false;
+
+	return true;
+}
 #endif
 
 /*
@@ -171,8 +222,26 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			isAlpha = true;
 			png_set_expand(pngPtr);
 		}
-		_outputSurface->create(width, height, Graphics::PixelFormat(4,
-		                       8, 8, 8, isAlpha ? 8 : 0, 24, 16, 8, 0));
+
+		// If the caller requested a format libpng can produce directly,
+		// decode straight into it; otherwise fall back to the default
+		// ARGB format. Either way the rows are defiltered and converted
+		// right into the destination surface, without an intermediate
+		// buffer or conversion pass.
+		bool swapRedBlue = false, alphaFirst = false;
+		Graphics::PixelFormat format(4, 8, 8, 8, isAlpha ? 8 : 0, 24, 16, 8, 0);
+		if (_requestedFormat.bytesPerPixel != 0) {
+			if (pngFindTransforms(_requestedFormat, swapRedBlue, alphaFirst)) {
+				format = _requestedFormat;
+			} else {
+				warning("PNGDecoder: cannot output in format %s, using the default", _requestedFormat.toString().c_str());
+				pngFindTransforms(format, swapRedBlue, alphaFirst);
+			}
+		} else {
+			pngFindTransforms(format, swapRedBlue, alphaFirst);
+		}
+
+		_outputSurface->create(width, height, format);
 		if (!_outputSurface->getPixels()) {
 			error("Could not allocate memory for output image.");
 		}
@@ -185,16 +254,12 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			png_set_gray_to_rgb(pngPtr);
 
 		// PNGs are Big-Endian:
-#ifdef SCUMM_LITTLE_ENDIAN
-		png_set_bgr(pngPtr);
-		png_set_swap_alpha(pngPtr);
-		if (colorType != PNG_COLOR_TYPE_RGB_ALPHA)
-			png_set_filler(pngPtr, 0xff, PNG_FILLER_BEFORE);
-#else
+		if (swapRedBlue)
+			png_set_bgr(pngPtr);
+		if (alphaFirst)
+			png_set_swap_alpha(pngPtr);
 		if (colorType != PNG_COLOR_TYPE_RGB_ALPHA)
-			png_set_filler(pngPtr, 0xff, PNG_FILLER_AFTER);
-#endif
-
+			png_set_filler(pngPtr, 0xff, alphaFirst ? PNG_FILLER_BEFORE : PNG_FILLER_AFTER);
 	}
 
 	// After the transformations have been registered, the image data is read again.
@@ -33,6 +33,7 @@
 
 #include "common/scummsys.h"
 #include "common/textconsole.h"
+#include "graphics/pixelformat.h"
 #include "image/image_decoder.h"
 
 namespace Common {
@@ -57,6 +58,19 @@ public:
 	const byte *getPalette() const { return _palette; }
 	uint16 getPaletteColorCount() const { return _paletteColorCount; }
 	void setSkipSignature(bool skip) { _skipSignature = skip; }
+
+	/**
+	 * Request the pixel format of the decoded surface.
+	 *
+	 * Only byte-order permutations of 32bit RGBA are supported, since those
+	 * can be produced by libpng itself while defiltering, so the image is
+	 * decoded directly into the destination surface without an intermediate
+	 * conversion pass. Unsupported formats are ignored with a warning, and
+	 * paletted images are always output as CLUT8.
+	 *
+	 * This must be called before loadStream().
+	 */
+	void setOutputPixelFormat(const Graphics::PixelFormat &format) { _requestedFormat = format; }
 private:
 	byte *_palette;
 	uint16 _paletteColorCount;
@@ -64,6 +78,9 @@ private:
 	// flag to skip the png signature check for headless png files
 	bool _skipSignature;
 
+	// requested output format (default constructed = use the decoder default)
+	Graphics::PixelFormat _requestedFormat;
+
 	Graphics::Surface *_outputSurface;
 };
 
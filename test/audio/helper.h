@@ -24,7 +24,7 @@ static T *createSine(const int sampleRate, const int time) {
 }
 
 template<typename T>
-static Audio::SeekableAudioStream *createSineStream(const int sampleRate, const int time, int16 **comp, bool le, bool isStereo) {
+static Audio::SeekableAudioStream *createSineStream(const int sampleRate, const int time, int16 **comp, bool le, bool isStereo, bool fromBuffer = false) {
 	T *sine = createSine<T>(sampleRate, time * (isStereo ? 2 : 1));
 
 	const bool isUnsigned = !std::numeric_limits<T>::is_signed;
@@ -54,13 +54,19 @@ static Audio::SeekableAudioStream *createSineStream(const int sampleRate, const
 		}
 	}
 
+	const byte flags = (is16Bits ? Audio::FLAG_16BITS : 0)
+	                   | (isUnsigned ? Audio::FLAG_UNSIGNED : 0)
+	                   | (le ? Audio::FLAG_LITTLE_ENDIAN : 0)
+	                   | (isStereo ? Audio::FLAG_STEREO : 0);
+
 	Audio::SeekableAudioStream *s = 0;
-	Common::SeekableReadStream *sD = new Common::MemoryReadStream((const byte *)sine, sizeof(T) * samples, DisposeAfterUse::YES);
-	s = Audio::makeRawStream(sD, sampleRate,
-	                             (is16Bits ? Audio::FLAG_16BITS : 0)
-	                             | (isUnsigned ? Audio::FLAG_UNSIGNED : 0)
-	                             | (le ? Audio::FLAG_LITTLE_ENDIAN : 0)
-	                             | (isStereo ? Audio::FLAG_STEREO : 0));
+	if (fromBuffer) {
+		// Exercise the memory buffer based stream implementation.
+		s = Audio::makeRawStream((const byte *)sine, sizeof(T) * samples, sampleRate, flags);
+	} else {
+		Common::SeekableReadStream *sD = new Common::MemoryReadStream((const byte *)sine, sizeof(T) * samples, DisposeAfterUse::YES);
+		s = Audio::makeRawStream(sD, sampleRate, flags);
+	}
 
 	return s;
 }
@@ -9,9 +9,9 @@ class RawStreamTestSuite : public CxxTest::TestSuite
 {
 private:
 	template<typename T>
-	void readBufferTestTemplate(const int sampleRate, const int time, const bool le, const bool isStereo) {
+	void readBufferTestTemplate(const int sampleRate, const int time, const bool le, const bool isStereo, const bool fromBuffer = false) {
 		int16 *sine;
-		Audio::SeekableAudioStream *s = createSineStream<int8>(sampleRate, time, &sine, le, isStereo);
+		Audio::SeekableAudioStream *s = createSineStream<int8>(sampleRate, time, &sine, le, isStereo, fromBuffer);
 
 		const int totalSamples = sampleRate * time * (isStereo ? 2 : 1);
 		int16 *buffer = new int16[totalSamples];
@@ -69,6 +69,14 @@ public:
 		readBufferTestTemplate<uint16>(11025, 2, true, true);
 	}
 
+	void test_read_buffer_8_bit_signed_mono_from_buffer() {
+		readBufferTestTemplate<int8>(11025, 2, false, false, true);
+	}
+
+	void test_read_buffer_16_bit_signed_le_stereo_from_buffer() {
+		readBufferTestTemplate<int16>(11025, 2, true, true, true);
+	}
+
 private:
 	void partialReadTest() {
 		const int sampleRate = 11025;
@@ -209,7 +217,7 @@ public:
 	}
 
 private:
-	void seekTest(const int sampleRate, const int time, const bool isStereo) {
+	void seekTest(const int sampleRate, const int time, const bool isStereo, const bool fromBuffer = false) {
 		const int totalFrames = sampleRate * time * (isStereo ? 2 : 1);
 		int readData = 0, offset = 0;
 
@@ -217,7 +225,7 @@ private:
 		Audio::SeekableAudioStream *s = 0;
 		int16 *sine = 0;
 
-		s = createSineStream<int8>(sampleRate, time, &sine, false, isStereo);
+		s = createSineStream<int8>(sampleRate, time, &sine, false, isStereo, fromBuffer);
 
 		// Seek to 500ms
 		const Audio::Timestamp a(0, 1, 2);
@@ -288,4 +296,12 @@ public:
 	void test_seek_stereo() {
 		seekTest(11025, 2, true);
 	}
+
+	void test_seek_mono_from_buffer() {
+		seekTest(11025, 2, false, true);
+	}
+
+	void test_seek_stereo_from_buffer() {
+		seekTest(11025, 2, true, true);
+	}
 };
@@ -0,0 +1,306 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+/*
+ * Microbenchmarks for hot kernels: scalers, rate conversion, hashmap
+ * lookup, YUV conversion and codec decoding. Built and run by the
+ * 'bench' target (see test/module.mk).
+ *
+ * Unlike the unit tests this does not assert anything; it prints
+ * ns/op and MB/s figures so performance regressions can be spotted by
+ * comparing runs across revisions. Each benchmark does a few warmup
+ * calls and then runs for a fixed minimum wall time, which keeps the
+ * numbers reasonably stable across runs.
+ */
+
+// This is a standalone host tool, so it talks to libc directly
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "common/scummsys.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/memstream.h"
+#include "common/str.h"
+
+#include "audio/audiostream.h"
+#include "audio/decoders/raw.h"
+#include "audio/rate.h"
+
+#include "graphics/pixelformat.h"
+#include "graphics/scaler.h"
+#include "graphics/scaler/downscaler.h"
+#include "graphics/surface.h"
+#include "graphics/yuv_to_rgb.h"
+
+#include "image/codecs/msrle.h"
+
+#include <stdio.h>
+#include <sys/time.h>
+
+static uint64 getNanos() {
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return (uint64)tv.tv_sec * 1000000000 + (uint64)tv.tv_usec * 1000;
+}
+
+typedef void (*BenchProc)();
+
+/**
+ * Runs proc a few times to warm up caches, then repeatedly until at
+ * least kMinRunNs of wall time has passed, and prints the average time
+ * per call plus the throughput implied by bytesPerCall (pass 0 when a
+ * byte rate makes no sense for the benchmark).
+ */
+static void runBench(const char *name, BenchProc proc, uint32 bytesPerCall) {
+	const uint64 kMinRunNs = 300000000;	// 0.3 seconds
+
+	for (int i = 0; i < 3; i++)
+		proc();
+
+	uint64 start = getNanos();
+	uint64 elapsed = 0;
+	uint32 calls = 0;
+	do {
+		proc();
+		calls++;
+		elapsed = getNanos() - start;
+	} while (elapsed < kMinRunNs);
+
+	printf("%-32s %10llu ns/op", name, (unsigned long long)(elapsed / calls));
+	if (bytesPerCall)
+		printf(" %10.1f MB/s", (double)bytesPerCall * calls * 1000000000.0 / elapsed / (1024.0 * 1024.0));
+	printf("\n");
+}
+
+// --- Scalers ----------------------------------------------------------
+
+// The smart scalers read neighbouring pixels, so the source frame gets
+// a two pixel border on each side like the SDL backend provides.
+enum {
+	kFrameWidth = 320,
+	kFrameHeight = 200,
+	kSrcPitch = (kFrameWidth + 4) * 2,
+	kDstPitch = (kFrameWidth + 4) * 2 * 2
+};
+
+static uint16 *g_scalerSrc;
+static uint16 *g_scalerDst;
+
+static const uint8 *scalerSrcPtr() {
+	return (const uint8 *)g_scalerSrc + kSrcPitch * 2 + 2 * 2;
+}
+
+static uint8 *scalerDstPtr() {
+	return (uint8 *)g_scalerDst + kDstPitch * 2 + 2 * 2;
+}
+
+static void benchNormal2x() {
+	Normal2x(scalerSrcPtr(), kSrcPitch, scalerDstPtr(), kDstPitch, kFrameWidth, kFrameHeight);
+}
+
+static void bench2xSaI() {
+	_2xSaI(scalerSrcPtr(), kSrcPitch, scalerDstPtr(), kDstPitch, kFrameWidth, kFrameHeight);
+}
+
+static void benchSuper2xSaI() {
+	Super2xSaI(scalerSrcPtr(), kSrcPitch, scalerDstPtr(), kDstPitch, kFrameWidth, kFrameHeight);
+}
+
+static void benchSuperEagle() {
+	SuperEagle(scalerSrcPtr(), kSrcPitch, scalerDstPtr(), kDstPitch, kFrameWidth, kFrameHeight);
+}
+
+#ifdef USE_HQ_SCALERS
+static void benchHQ2x() {
+	HQ2x(scalerSrcPtr(), kSrcPitch, scalerDstPtr(), kDstPitch, kFrameWidth, kFrameHeight);
+}
+#endif
+
+// The box downscaler shrinks a 640x480 frame onto a 480x272 handheld
+// screen, the ratio the arbitrary ratio path exists for.
+enum {
+	kDownscaleSrcWidth = 640,
+	kDownscaleSrcHeight = 480,
+	kDownscaleDstWidth = 480,
+	kDownscaleDstHeight = 272
+};
+
+static uint16 *g_downscaleSrc;
+static uint16 *g_downscaleDst;
+
+static void benchDownscaleByArea() {
+	DownscaleByArea((const uint8 *)g_downscaleSrc, kDownscaleSrcWidth * 2,
+			(uint8 *)g_downscaleDst, kDownscaleDstWidth * 2,
+			kDownscaleSrcWidth, kDownscaleSrcHeight, kDownscaleDstWidth, kDownscaleDstHeight);
+}
+
+// --- Rate conversion --------------------------------------------------
+
+static Audio::AudioStream *g_rateInput;
+static Audio::RateConverter *g_rateConverter;
+static Audio::st_sample_t g_rateOutput[4096];
+
+static void benchRateConvert() {
+	g_rateConverter->flow(*g_rateInput, g_rateOutput, 2048, 255, 255);
+}
+
+// --- HashMap lookup ---------------------------------------------------
+
+enum {
+	kHashMapKeys = 1000
+};
+
+static Common::HashMap<Common::String, int> *g_hashMap;
+static Common::String *g_hashKeys;
+static volatile int g_hashSink;
+
+static void benchHashMapLookup() {
+	int sum = 0;
+	for (int i = 0; i < kHashMapKeys; i++)
+		sum += (*g_hashMap)[g_hashKeys[i]];
+	g_hashSink = sum;
+}
+
+// --- YUV to RGB -------------------------------------------------------
+
+static Graphics::Surface *g_yuvDst;
+static byte *g_yuvY;
+static byte *g_yuvU;
+static byte *g_yuvV;
+
+static void benchYUVToRGB() {
+	YUVToRGBMan.convert420(g_yuvDst, Graphics::YUVToRGBManager::kScaleITU,
+			g_yuvY, g_yuvU, g_yuvV, kFrameWidth, kFrameHeight, kFrameWidth, kFrameWidth / 2);
+}
+
+// --- Codec decode -----------------------------------------------------
+
+static Image::MSRLEDecoder *g_rleDecoder;
+static byte *g_rleData;
+static uint32 g_rleSize;
+
+static void benchMSRLEDecode() {
+	Common::MemoryReadStream stream(g_rleData, g_rleSize);
+	g_rleDecoder->decodeFrame(stream);
+}
+
+// --- Setup ------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+	// Scalers: a 16bpp frame filled with a gradient so the smart
+	// scalers see realistic edges instead of a flat color
+	InitScalers(565);
+	g_scalerSrc = new uint16[(kFrameWidth + 4) * (kFrameHeight + 4)];
+	g_scalerDst = new uint16[(kFrameWidth + 4) * 2 * (kFrameHeight + 4) * 2];
+	for (int y = 0; y < kFrameHeight + 4; y++)
+		for (int x = 0; x < kFrameWidth + 4; x++)
+			g_scalerSrc[y * (kFrameWidth + 4) + x] = (uint16)((x * 7) ^ (y * 13));
+
+	g_downscaleSrc = new uint16[kDownscaleSrcWidth * kDownscaleSrcHeight];
+	g_downscaleDst = new uint16[kDownscaleDstWidth * kDownscaleDstHeight];
+	for (int i = 0; i < kDownscaleSrcWidth * kDownscaleSrcHeight; i++)
+		g_downscaleSrc[i] = (uint16)(i * 31);
+
+	// Rate conversion: a looping 22050 Hz stereo source upsampled to
+	// 44100 Hz, which is the common mixer configuration
+	const uint32 rawSize = 64 * 1024;
+	byte *rawData = (byte *)malloc(rawSize);
+	for (uint32 i = 0; i < rawSize; i++)
+		rawData[i] = (byte)(i * 31);
+	g_rateInput = Audio::makeLoopingAudioStream(
+			Audio::makeRawStream(rawData, rawSize, 22050,
+				Audio::FLAG_16BITS | Audio::FLAG_LITTLE_ENDIAN | Audio::FLAG_STEREO),
+			0);
+	g_rateConverter = Audio::makeRateConverter(22050, 44100, true);
+
+	// HashMap: string keys, the dominant key type in the tree
+	g_hashMap = new Common::HashMap<Common::String, int>();
+	g_hashKeys = new Common::String[kHashMapKeys];
+	for (int i = 0; i < kHashMapKeys; i++) {
+		g_hashKeys[i] = Common::String::format("key%d", i);
+		(*g_hashMap)[g_hashKeys[i]] = i;
+	}
+
+	// YUV: a 4:2:0 frame converted to 32bpp RGB
+	g_yuvDst = new Graphics::Surface();
+	g_yuvDst->create(kFrameWidth, kFrameHeight, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+	g_yuvY = new byte[kFrameWidth * kFrameHeight];
+	g_yuvU = new byte[(kFrameWidth / 2) * (kFrameHeight / 2)];
+	g_yuvV = new byte[(kFrameWidth / 2) * (kFrameHeight / 2)];
+	for (int i = 0; i < kFrameWidth * kFrameHeight; i++)
+		g_yuvY[i] = (byte)(i * 17);
+	for (int i = 0; i < (kFrameWidth / 2) * (kFrameHeight / 2); i++) {
+		g_yuvU[i] = (byte)(i * 5);
+		g_yuvV[i] = (byte)(i * 11);
+	}
+
+	// Codec: an 8bpp MS RLE frame built from short runs, which is what
+	// the decoder's inner loop mostly sees in real video data
+	g_rleDecoder = new Image::MSRLEDecoder(kFrameWidth, kFrameHeight, 8);
+	g_rleSize = kFrameHeight * (2 * (kFrameWidth / 8) + 2) + 2;
+	g_rleData = new byte[g_rleSize];
+	uint32 pos = 0;
+	for (int y = 0; y < kFrameHeight; y++) {
+		for (int x = 0; x < kFrameWidth; x += 8) {
+			g_rleData[pos++] = 8;			// run length
+			g_rleData[pos++] = (byte)(x ^ y);	// color
+		}
+		g_rleData[pos++] = 0;	// escape
+		g_rleData[pos++] = 0;	// end of line
+	}
+	g_rleData[pos++] = 0;	// escape
+	g_rleData[pos++] = 1;	// end of image
+
+	printf("%-32s %16s %15s\n", "benchmark", "time", "throughput");
+
+	runBench("scaler Normal2x 320x200", benchNormal2x, kFrameWidth * kFrameHeight * 2);
+	runBench("scaler 2xSaI 320x200", bench2xSaI, kFrameWidth * kFrameHeight * 2);
+	runBench("scaler Super2xSaI 320x200", benchSuper2xSaI, kFrameWidth * kFrameHeight * 2);
+	runBench("scaler SuperEagle 320x200", benchSuperEagle, kFrameWidth * kFrameHeight * 2);
+#ifdef USE_HQ_SCALERS
+	runBench("scaler HQ2x 320x200", benchHQ2x, kFrameWidth * kFrameHeight * 2);
+#endif
+	runBench("downscale box 640x480->480x272", benchDownscaleByArea, kDownscaleSrcWidth * kDownscaleSrcHeight * 2);
+	runBench("rate 22050->44100 stereo", benchRateConvert, 2048 * 2 * sizeof(Audio::st_sample_t));
+	runBench("hashmap lookup, 1000 keys", benchHashMapLookup, 0);
+	runBench("yuv420->rgb32 320x200", benchYUVToRGB, kFrameWidth * kFrameHeight * 4);
+	runBench("msrle decode 320x200", benchMSRLEDecode, kFrameWidth * kFrameHeight);
+
+	delete g_rleDecoder;
+	delete[] g_rleData;
+	delete[] g_yuvY;
+	delete[] g_yuvU;
+	delete[] g_yuvV;
+	g_yuvDst->free();
+	delete g_yuvDst;
+	delete[] g_hashKeys;
+	delete g_hashMap;
+	delete g_rateConverter;
+	delete g_rateInput;
+	delete[] g_scalerSrc;
+	delete[] g_scalerDst;
+	delete[] g_downscaleSrc;
+	delete[] g_downscaleDst;
+	DestroyScalers();
+
+	return 0;
+}
@@ -4,6 +4,14 @@
 #include "common/noncopyable.h"
 #include "common/str.h"
 
+struct DtorCounter {
+	static int count;
+
+	~DtorCounter() { count++; }
+};
+
+int DtorCounter::count = 0;
+
 class ArrayTestSuite : public CxxTest::TestSuite
 {
 	public:
@@ -410,6 +418,24 @@ class ArrayTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(array[1], 163);
 	}
 
+	void test_resize_shrink_destroys_elements() {
+		Common::Array<DtorCounter> array;
+
+		array.resize(10);
+		DtorCounter::count = 0;
+
+		// Shrinking must destroy the excess elements...
+		array.resize(3);
+		TS_ASSERT_EQUALS(array.size(), (unsigned int)3);
+		TS_ASSERT_EQUALS(DtorCounter::count, 7);
+
+		// ...and growing back within the kept capacity must not touch
+		// the remaining ones.
+		array.resize(10);
+		TS_ASSERT_EQUALS(array.size(), (unsigned int)10);
+		TS_ASSERT_EQUALS(DtorCounter::count, 7);
+	}
+
 };
 
 struct ListElement {
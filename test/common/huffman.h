@@ -95,6 +95,40 @@ class HuffmanTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[6]);
 	}
 
+	void test_get_lsb_order() {
+
+		/*
+		 * Decoding from an LSB-first bitstream, as the Bink decoder does.
+		 *
+		 * An LSB-first stream delivers the first stream bit in bit 0 of a
+		 * read value, so bit 0 of each code here is matched against the
+		 * stream first:
+		 * 0="0"
+		 * 1="1,0"
+		 * 2="1,1,0"
+		 * 3="1,1,1,0"
+		 * 4="1,1,1,1"
+		 */
+
+		uint32 codeCount = 5;
+		const uint8 lengths[] = {1,2,3,4,4};
+		const uint32 codes[]  = {0x0, 0x1, 0x3, 0x7, 0xF};
+
+		Common::Huffman h(0, codeCount, codes, lengths, 0);
+
+		byte input[] = {0xD9, 0x01};
+		// Stream bit order (LSB of each byte first):
+		// 10 0 110 1110 0 0 0 0 0 0 = 1 0 2 3 0 0 0 0 0 0
+		uint32 expected[] = {1, 0, 2, 3, 0, 0, 0, 0, 0, 0};
+
+		Common::MemoryReadStream ms(input, sizeof(input));
+		Common::BitStream8LSB bs(ms);
+
+		for (uint32 i = 0; i < ARRAYSIZE(expected); i++)
+			TS_ASSERT_EQUALS(h.getSymbol(bs), expected[i]);
+		TS_ASSERT_EQUALS(bs.pos(), bs.size());
+	}
+
 	void test_get_after_set_symbols() {
 
 		/*
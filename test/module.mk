@@ -5,8 +5,8 @@
 #
 ######################################################################
 
-TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h
-TEST_LIBS    := audio/libaudio.a common/libcommon.a
+TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/video/*.h
+TEST_LIBS    := video/libvideo.a graphics/libgraphics.a audio/libaudio.a common/libcommon.a
 
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
@@ -42,8 +42,18 @@ test/runner.cpp: $(TESTS)
 	@mkdir -p test
 	$(srcdir)/test/cxxtest/cxxtestgen.py $(TEST_FLAGS) -o $@ $+
 
+# Microbenchmarks for hot kernels (scalers, rate conversion, ...).
+# Use the 'bench' target to run them; compare the printed numbers
+# across revisions to spot performance regressions.
+BENCH_LIBS := image/libimage.a graphics/libgraphics.a audio/libaudio.a common/libcommon.a
+
+bench: test/bench
+	./test/bench
+test/bench: $(srcdir)/test/bench.cpp $(BENCH_LIBS)
+	$(QUIET_CXX)$(CXX) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) -o $@ $+ $(TEST_LDFLAGS)
+
 clean: clean-test
 clean-test:
-	-$(RM) test/runner.cpp test/runner
+	-$(RM) test/runner.cpp test/runner test/bench
 
-.PHONY: test clean-test
+.PHONY: test bench clean-test
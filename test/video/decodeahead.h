@@ -0,0 +1,168 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/system.h"
+#include "common/rational.h"
+#include "graphics/surface.h"
+#include "video/video_decoder.h"
+
+/**
+ * A test suite for the decode ahead queue in video/video_decoder.h
+ *
+ * A fake decoder with a synthetic fixed rate track stands in for a real
+ * container, and a minimal OSystem provides the getMillis() clock the
+ * playback state machine depends on.
+ */
+
+namespace {
+
+/** Just enough of an OSystem for VideoDecoder::start() and the frame
+ *  timing calls, which go through g_system->getMillis(). */
+class FakeTimeOSystem : public OSystem {
+public:
+	FakeTimeOSystem() : millis(0) {}
+
+	uint32 millis;
+
+	uint32 getMillis(bool skipRecord = false) { return millis; }
+
+	const GraphicsMode *getSupportedGraphicsModes() const {
+		static const GraphicsMode modes[] = { { 0, 0, 0 } };
+		return modes;
+	}
+	int getDefaultGraphicsMode() const { return 0; }
+	bool setGraphicsMode(int mode) { return false; }
+	int getGraphicsMode() const { return 0; }
+	Graphics::PixelFormat getScreenFormat() const { return Graphics::PixelFormat(); }
+	Common::List<Graphics::PixelFormat> getSupportedFormats() const { return Common::List<Graphics::PixelFormat>(); }
+	void initSize(uint width, uint height, const Graphics::PixelFormat *format = NULL) {}
+	int16 getHeight() { return 0; }
+	int16 getWidth() { return 0; }
+	PaletteManager *getPaletteManager() { return 0; }
+	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {}
+	Graphics::Surface *lockScreen() { return 0; }
+	void unlockScreen() {}
+	void fillScreen(uint32 col) {}
+	void updateScreen() {}
+	void setShakePos(int shakeOffset) {}
+	void showOverlay() {}
+	void hideOverlay() {}
+	Graphics::PixelFormat getOverlayFormat() const { return Graphics::PixelFormat(); }
+	void clearOverlay() {}
+	void grabOverlay(void *buf, int pitch) {}
+	void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) {}
+	int16 getOverlayHeight() { return 0; }
+	int16 getOverlayWidth() { return 0; }
+	bool showMouse(bool visible) { return false; }
+	void warpMouse(int x, int y) {}
+	void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale = false, const Graphics::PixelFormat *format = NULL) {}
+	void delayMillis(uint msecs) {}
+	void getTimeAndDate(TimeDate &t) const {}
+	MutexRef createMutex() { return 0; }
+	void lockMutex(MutexRef mutex) {}
+	void unlockMutex(MutexRef mutex) {}
+	void deleteMutex(MutexRef mutex) {}
+	Audio::Mixer *getMixer() { return 0; }
+	void quit() {}
+	void displayMessageOnOSD(const char *msg) {}
+	void displayActivityIconOnOSD(const Graphics::Surface *icon) {}
+	void logMessage(LogMessageType::Type type, const char *message) {}
+};
+
+/** A decoder with one synthetic 10 fps track whose frames are
+ *  recognizable: every pixel carries the frame number. */
+class FakeVideoDecoder : public Video::VideoDecoder {
+public:
+	class FakeVideoTrack : public FixedRateVideoTrack {
+	public:
+		FakeVideoTrack(int frameCount) : _curFrame(-1), _frameCount(frameCount) {
+			_surface.create(8, 8, Graphics::PixelFormat::createFormatCLUT8());
+		}
+		~FakeVideoTrack() { _surface.free(); }
+
+		uint16 getWidth() const { return _surface.w; }
+		uint16 getHeight() const { return _surface.h; }
+		Graphics::PixelFormat getPixelFormat() const { return _surface.format; }
+		int getCurFrame() const { return _curFrame; }
+		int getFrameCount() const { return _frameCount; }
+
+		const Graphics::Surface *decodeNextFrame() {
+			_curFrame++;
+			// Tag the pixels with the frame number so the test can tell
+			// which frame a queued surface belongs to.
+			memset(_surface.getPixels(), _curFrame, _surface.w * _surface.h);
+			return &_surface;
+		}
+
+	protected:
+		Common::Rational getFrameRate() const { return Common::Rational(10); }
+
+	private:
+		Graphics::Surface _surface;
+		int _curFrame;
+		int _frameCount;
+	};
+
+	bool loadStream(Common::SeekableReadStream *stream) {
+		close();
+		addTrack(new FakeVideoTrack(10));
+		enableDecodeAhead(2);
+		return true;
+	}
+};
+
+} // End of anonymous namespace
+
+class VideoDecodeAheadTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_decode_ahead_frame_flow() {
+
+		FakeTimeOSystem sys;
+		OSystem *oldSystem = g_system;
+		g_system = &sys;
+
+		{
+			FakeVideoDecoder decoder;
+			TS_ASSERT(decoder.loadStream(0));
+
+			// Decoding ahead only happens during playback.
+			TS_ASSERT(!decoder.decodeAheadFrame());
+			decoder.start();
+
+			// The queue holds two frames: two decodes ahead succeed, the
+			// third is refused.
+			TS_ASSERT(decoder.decodeAheadFrame());
+			TS_ASSERT(decoder.decodeAheadFrame());
+			TS_ASSERT(!decoder.decodeAheadFrame());
+
+			// The track ran ahead, but no frame has been handed out yet.
+			TS_ASSERT_EQUALS(decoder.getCurFrame(), -1);
+
+			// The queued frames come back out in decode order...
+			const Graphics::Surface *frame = decoder.decodeNextFrame();
+			TS_ASSERT(frame);
+			TS_ASSERT_EQUALS(*(const byte *)frame->getPixels(), 0);
+			TS_ASSERT_EQUALS(decoder.getCurFrame(), 0);
+
+			frame = decoder.decodeNextFrame();
+			TS_ASSERT(frame);
+			TS_ASSERT_EQUALS(*(const byte *)frame->getPixels(), 1);
+			TS_ASSERT_EQUALS(decoder.getCurFrame(), 1);
+
+			// ...and once the queue is drained, decoding falls through to
+			// the track again.
+			frame = decoder.decodeNextFrame();
+			TS_ASSERT(frame);
+			TS_ASSERT_EQUALS(*(const byte *)frame->getPixels(), 2);
+			TS_ASSERT_EQUALS(decoder.getCurFrame(), 2);
+
+			// The queue can be refilled after frames have been displayed.
+			TS_ASSERT(decoder.decodeAheadFrame());
+			frame = decoder.decodeNextFrame();
+			TS_ASSERT(frame);
+			TS_ASSERT_EQUALS(*(const byte *)frame->getPixels(), 3);
+			TS_ASSERT_EQUALS(decoder.getCurFrame(), 3);
+		}
+
+		g_system = oldSystem;
+	}
+};
@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/bufferedstream.h"
 #include "common/stream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -395,7 +396,10 @@ bool AVIDecoder::loadStream(Common::SeekableReadStream *stream) {
 		return false;
 	}
 
-	_fileStream = stream;
+	// Demuxing does lots of small header reads and short skips; a
+	// read-ahead buffer keeps those off the underlying medium, which
+	// can have high access latency (e.g. optical or USB drives).
+	_fileStream = Common::wrapBufferedSeekableReadStream(stream, 16384, DisposeAfterUse::YES);
 
 	// Go through all chunks in the file
 	while (_fileStream->pos() < fileSize && parseNextChunk())
@@ -461,6 +465,7 @@ void AVIDecoder::close() {
 	_indexEntries.clear();
 	memset(&_header, 0, sizeof(_header));
 
+	flushAllPendingChunks();
 	_videoTracks.clear();
 	_audioTracks.clear();
 
@@ -487,6 +492,36 @@ void AVIDecoder::readNextPacket() {
 }
 
 void AVIDecoder::handleNextPacket(TrackStatus &status) {
+	// Consume chunks another track's scan already captured for this
+	// track; they lie before chunkSearchOffset in the file.
+	if (status.track->getTrackType() == Track::kTrackTypeAudio) {
+		while (!status.pendingChunks.empty()) {
+			if (!shouldQueueAudio(status))
+				return;
+
+			PendingChunk pending = status.pendingChunks.pop();
+			assert(pending.chunk);
+			((AVIAudioTrack *)status.track)->queueSound(pending.chunk);
+		}
+	} else {
+		AVIVideoTrack *videoTrack0 = (AVIVideoTrack *)status.track;
+
+		// A direction change makes any captured chunks stale
+		if (videoTrack0->isReversed())
+			flushPendingChunks(status);
+
+		while (!status.pendingChunks.empty()) {
+			PendingChunk pending = status.pendingChunks.pop();
+
+			if (getStreamType(pending.tag) == kStreamTypePaletteChange) {
+				videoTrack0->loadPaletteFromChunk(pending.chunk);
+			} else {
+				videoTrack0->decodeFrame(pending.chunk);
+				return;
+			}
+		}
+	}
+
 	// If there's no more to search, bail out
 	if (status.chunkSearchOffset + 8 >= _movieListEnd) {
 		if (status.track->getTrackType() == Track::kTrackTypeVideo) {
@@ -521,6 +556,7 @@ void AVIDecoder::handleNextPacket(TrackStatus &status) {
 			break;
 		}
 
+		uint32 chunkStart = _fileStream->pos();
 		uint32 nextTag = _fileStream->readUint32BE();
 		uint32 size = _fileStream->readUint32LE();
 
@@ -529,16 +565,22 @@ void AVIDecoder::handleNextPacket(TrackStatus &status) {
 			if (_fileStream->readUint32BE() != ID_REC)
 				error("Expected 'rec ' LIST");
 
+			advanceOtherTrackOffsets(status, chunkStart, _fileStream->pos());
 			continue;
 		} else if (nextTag == ID_JUNK || nextTag == ID_IDX1) {
 			skipChunk(size);
+			advanceOtherTrackOffsets(status, chunkStart, _fileStream->pos());
 			continue;
 		}
 
 		// Only accept chunks for this stream
 		uint32 streamIndex = getStreamIndex(nextTag);
 		if (streamIndex != status.index) {
-			skipChunk(size);
+			// If the owning track's scan would resume exactly at this
+			// chunk, read it on its behalf now instead of forcing that
+			// track to seek back here later.
+			if (!captureChunk(status, nextTag, size, chunkStart))
+				skipChunk(size);
 			continue;
 		}
 
@@ -549,6 +591,9 @@ void AVIDecoder::handleNextPacket(TrackStatus &status) {
 			_fileStream->skip(size & 1);
 		}
 
+		// Tracks parked at this chunk would merely skip it
+		advanceOtherTrackOffsets(status, chunkStart, _fileStream->pos());
+
 		if (status.track->getTrackType() == Track::kTrackTypeAudio) {
 			if (getStreamType(nextTag) != kStreamTypeAudio)
 				error("Invalid audio track tag '%s'", tag2str(nextTag));
@@ -595,10 +640,89 @@ bool AVIDecoder::shouldQueueAudio(TrackStatus& status) {
 	return ((AVIAudioTrack *)status.track)->getCurChunk() < (uint32)(videoTrack->getCurFrame() + 3);
 }
 
+AVIDecoder::TrackStatus *AVIDecoder::getTrackStatus(uint32 streamIndex) {
+	for (uint i = 0; i < _videoTracks.size(); i++)
+		if (_videoTracks[i].index == streamIndex)
+			return &_videoTracks[i];
+
+	for (uint i = 0; i < _audioTracks.size(); i++)
+		if (_audioTracks[i].index == streamIndex)
+			return &_audioTracks[i];
+
+	if (_transparencyTrack.track && _transparencyTrack.index == streamIndex)
+		return &_transparencyTrack;
+
+	return nullptr;
+}
+
+bool AVIDecoder::captureChunk(TrackStatus &current, uint32 tag, uint32 size, uint32 chunkStart) {
+	TrackStatus *owner = getTrackStatus(getStreamIndex(tag));
+
+	// Only capture a chunk for a track whose own scan would resume
+	// exactly here; anything else is either already consumed or will
+	// be found by that track's scan in due course.
+	if (!owner || owner == &current || owner->chunkSearchOffset != chunkStart)
+		return false;
+
+	// A reversed video track walks its chunks via the index, not by
+	// scanning forward; leave it alone.
+	if (owner->track->getTrackType() == Track::kTrackTypeVideo && ((AVIVideoTrack *)owner->track)->isReversed())
+		return false;
+
+	PendingChunk pending;
+	pending.tag = tag;
+	pending.chunk = nullptr;
+
+	if (size != 0) {
+		pending.chunk = _fileStream->readStream(size);
+		_fileStream->skip(size & 1);
+	}
+
+	owner->pendingChunks.push(pending);
+	owner->chunkSearchOffset = _fileStream->pos();
+	return true;
+}
+
+void AVIDecoder::advanceOtherTrackOffsets(TrackStatus &current, uint32 chunkStart, uint32 newOffset) {
+	for (uint i = 0; i < _videoTracks.size(); i++) {
+		TrackStatus &other = _videoTracks[i];
+		if (&other != &current && other.chunkSearchOffset == chunkStart && !((AVIVideoTrack *)other.track)->isReversed())
+			other.chunkSearchOffset = newOffset;
+	}
+
+	for (uint i = 0; i < _audioTracks.size(); i++) {
+		TrackStatus &other = _audioTracks[i];
+		if (&other != &current && other.chunkSearchOffset == chunkStart)
+			other.chunkSearchOffset = newOffset;
+	}
+
+	if (_transparencyTrack.track && &_transparencyTrack != &current
+			&& _transparencyTrack.chunkSearchOffset == chunkStart
+			&& !((AVIVideoTrack *)_transparencyTrack.track)->isReversed())
+		_transparencyTrack.chunkSearchOffset = newOffset;
+}
+
+void AVIDecoder::flushPendingChunks(TrackStatus &status) {
+	while (!status.pendingChunks.empty())
+		delete status.pendingChunks.pop().chunk;
+}
+
+void AVIDecoder::flushAllPendingChunks() {
+	for (uint i = 0; i < _videoTracks.size(); i++)
+		flushPendingChunks(_videoTracks[i]);
+
+	for (uint i = 0; i < _audioTracks.size(); i++)
+		flushPendingChunks(_audioTracks[i]);
+
+	flushPendingChunks(_transparencyTrack);
+}
+
 bool AVIDecoder::rewind() {
 	if (!VideoDecoder::rewind())
 		return false;
 
+	flushAllPendingChunks();
+
 	for (uint32 i = 0; i < _videoTracks.size(); i++)
 		_videoTracks[i].chunkSearchOffset = getVideoTrackOffset(_videoTracks[i].index);
 
@@ -624,6 +748,9 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 	if (time > getDuration())
 		return false;
 
+	// Captured chunks are positional and become stale on a seek
+	flushAllPendingChunks();
+
 	// Get our video
 	AVIVideoTrack *videoTrack = (AVIVideoTrack *)_videoTracks[0].track;
 	uint32 videoIndex = _videoTracks[0].index;
@@ -773,6 +900,8 @@ void AVIDecoder::seekTransparencyFrame(int frame) {
 	TrackStatus &status = _transparencyTrack;
 	AVIVideoTrack *transTrack = static_cast<AVIVideoTrack *>(status.track);
 
+	flushPendingChunks(status);
+
 	// Find the index entry for the frame
 	int indexFrame = frame;
 	OldIndex *entry = nullptr;
@@ -24,6 +24,7 @@
 #define VIDEO_AVI_DECODER_H
 
 #include "common/array.h"
+#include "common/queue.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "common/str.h"
@@ -312,12 +313,30 @@ protected:
 		uint32 _curChunk;
 	};
 
+	/**
+	 * A chunk captured for a track while another track's scan passed
+	 * over it.
+	 */
+	struct PendingChunk {
+		uint32 tag;
+		Common::SeekableReadStream *chunk;
+	};
+
 	struct TrackStatus {
 		TrackStatus();
 
 		Track *track;
 		uint32 index;
 		uint32 chunkSearchOffset;
+
+		/**
+		 * Chunks already read from the file for this track, in file
+		 * order, to be consumed before scanning the file again. This
+		 * turns the per-frame demuxing into a mostly single pass over
+		 * the movi list instead of one scan (with its own seek) per
+		 * track, which matters on media with high seek latency.
+		 */
+		Common::Queue<PendingChunk> pendingChunks;
 	};
 
 	class IndexEntries : public Common::Array<OldIndex> {
@@ -355,6 +374,11 @@ protected:
 	void handleNextPacket(TrackStatus& status);
 	bool shouldQueueAudio(TrackStatus& status);
 	void seekTransparencyFrame(int frame);
+	TrackStatus *getTrackStatus(uint32 streamIndex);
+	bool captureChunk(TrackStatus &current, uint32 tag, uint32 size, uint32 chunkStart);
+	void advanceOtherTrackOffsets(TrackStatus &current, uint32 chunkStart, uint32 newOffset);
+	void flushPendingChunks(TrackStatus &status);
+	void flushAllPendingChunks();
 
 	Common::Array<TrackStatus> _videoTracks, _audioTracks;
 	TrackStatus _transparencyTrack;
@@ -141,6 +141,10 @@ bool BinkDecoder::loadStream(Common::SeekableReadStream *stream) {
 
 	_frames[frameCount - 1].size = _bink->size() - _frames[frameCount - 1].offset;
 
+	// Bink has a single, forward-only, non-paletted video track, so
+	// playback loops may decode frames ahead of their display time.
+	enableDecodeAhead();
+
 	return true;
 }
 
@@ -180,19 +184,15 @@ void BinkDecoder::readNextPacket() {
 		if (audioPacketLength >= 4) {
 			// Get our track - audio index plus one as the first track is video
 			BinkAudioTrack *audioTrack = (BinkAudioTrack *)getTrack(i + 1);
-			uint32 audioPacketStart = _bink->pos();
-			uint32 audioPacketEnd   = _bink->pos() + audioPacketLength;
+			uint32 audioPacketEnd = _bink->pos() + audioPacketLength;
 
 			//                  Number of samples in bytes
 			audio.sampleCount = _bink->readUint32LE() / (2 * audio.channels);
 
-			audio.bits = new Common::BitStream32LELSB(new Common::SeekableSubReadStream(_bink,
-					audioPacketStart + 4, audioPacketEnd), DisposeAfterUse::YES);
-
-			audioTrack->decodePacket();
-
-			delete audio.bits;
-			audio.bits = 0;
+			// Copy the packet out of the file stream and queue it on the
+			// track; it gets decoded on the mixer thread while we go on
+			// decoding the video
+			audioTrack->queuePacket(_bink->readStream(audioPacketLength - 4));
 
 			_bink->seek(audioPacketEnd);
 
@@ -1356,40 +1356,96 @@ void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int16 *block) {
 
 BinkDecoder::BinkAudioTrack::BinkAudioTrack(BinkDecoder::AudioInfo &audio, Audio::Mixer::SoundType soundType) :
 		AudioTrack(soundType),
-		_audioInfo(&audio) {
-	_audioStream = Audio::makeQueuingAudioStream(_audioInfo->outSampleRate, _audioInfo->outChannels == 2);
+		_audioInfo(&audio),
+		_bitsLeft(false),
+		_blockBuffer(0),
+		_blockBufferSize(0),
+		_blockBufferUsed(0) {
 }
 
 BinkDecoder::BinkAudioTrack::~BinkAudioTrack() {
-	delete _audioStream;
+	while (!_packets.empty())
+		delete _packets.pop();
+
+	free(_blockBuffer);
 }
 
 Audio::AudioStream *BinkDecoder::BinkAudioTrack::getAudioStream() const {
-	return _audioStream;
+	return const_cast<BinkAudioTrack *>(this);
+}
+
+void BinkDecoder::BinkAudioTrack::queuePacket(Common::SeekableReadStream *packet) {
+	Common::StackLock lock(_packetMutex);
+	_packets.push(packet);
 }
 
-void BinkDecoder::BinkAudioTrack::decodePacket() {
-	int outSize = _audioInfo->frameLen * _audioInfo->channels;
+bool BinkDecoder::BinkAudioTrack::endOfData() const {
+	// The current bitstream belongs to the mixer thread, so we can not
+	// inspect it here; _bitsLeft mirrors its state and is only updated
+	// while the mutex is held.
+	Common::StackLock lock(_packetMutex);
+	return _packets.empty() && _blockBufferUsed >= _blockBufferSize && !_bitsLeft;
+}
+
+bool BinkDecoder::BinkAudioTrack::decodeBlock() {
+	// Make sure there is a packet with data left in it
+	while (!_audioInfo->bits || _audioInfo->bits->pos() >= _audioInfo->bits->size()) {
+		Common::SeekableReadStream *packet;
+		{
+			Common::StackLock lock(_packetMutex);
+
+			delete _audioInfo->bits;
+			_audioInfo->bits = 0;
+			_bitsLeft = false;
+
+			if (_packets.empty())
+				return false;
+
+			packet = _packets.pop();
+			_bitsLeft = true;
+		}
+
+		_audioInfo->bits = new Common::BitStream32LELSB(packet, DisposeAfterUse::YES);
+	}
+
+	const int outSize = _audioInfo->frameLen * _audioInfo->channels;
+	if (!_blockBuffer)
+		_blockBuffer = (int16 *)malloc(outSize * 2);
+	memset(_blockBuffer, 0, outSize * 2);
+
+	audioBlock(_blockBuffer);
+
+	_blockBufferSize = _audioInfo->blockSize;
+	_blockBufferUsed = 0;
+
+	if (_audioInfo->bits->pos() & 0x1F) // next data block starts at a 32-byte boundary
+		_audioInfo->bits->skip(32 - (_audioInfo->bits->pos() & 0x1F));
 
-	while (_audioInfo->bits->pos() < _audioInfo->bits->size()) {
-		int16 *out = (int16 *)malloc(outSize * 2);
-		memset(out, 0, outSize * 2);
+	{
+		Common::StackLock lock(_packetMutex);
+		_bitsLeft = _audioInfo->bits->pos() < _audioInfo->bits->size();
+	}
 
-		audioBlock(out);
+	return true;
+}
 
-		byte flags = Audio::FLAG_16BITS;
-		if (_audioInfo->outChannels == 2)
-			flags |= Audio::FLAG_STEREO;
+int BinkDecoder::BinkAudioTrack::readBuffer(int16 *buffer, const int numSamples) {
+	int samplesRead = 0;
 
-#ifdef SCUMM_LITTLE_ENDIAN
-		flags |= Audio::FLAG_LITTLE_ENDIAN;
-#endif
+	while (samplesRead < numSamples) {
+		if (_blockBufferUsed >= _blockBufferSize) {
+			if (!decodeBlock())
+				break;
+		}
 
-		_audioStream->queueBuffer((byte *)out, _audioInfo->blockSize * 2, DisposeAfterUse::YES, flags);
+		int toCopy = MIN<int>(numSamples - samplesRead, _blockBufferSize - _blockBufferUsed);
+		memcpy(buffer + samplesRead, _blockBuffer + _blockBufferUsed, toCopy * 2);
 
-		if (_audioInfo->bits->pos() & 0x1F) // next data block starts at a 32-byte boundary
-			_audioInfo->bits->skip(32 - (_audioInfo->bits->pos() & 0x1F));
+		samplesRead += toCopy;
+		_blockBufferUsed += toCopy;
 	}
+
+	return samplesRead;
 }
 
 void BinkDecoder::BinkAudioTrack::audioBlock(int16 *out) {
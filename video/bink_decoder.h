@@ -33,17 +33,16 @@
 
 #include "common/array.h"
 #include "common/bitstream.h"
+#include "common/mutex.h"
+#include "common/queue.h"
 #include "common/rational.h"
 
+#include "audio/audiostream.h"
+
 #include "video/video_decoder.h"
 
 #include "graphics/surface.h"
 
-namespace Audio {
-class AudioStream;
-class QueuingAudioStream;
-}
-
 namespace Common {
 class SeekableReadStream;
 class Huffman;
@@ -323,20 +322,48 @@ private:
 		void IDCTAdd(DecodeContext &ctx, int16 *block);
 	};
 
-	class BinkAudioTrack : public AudioTrack {
+	class BinkAudioTrack : public AudioTrack, public Audio::AudioStream {
 	public:
 		BinkAudioTrack(AudioInfo &audio, Audio::Mixer::SoundType soundType);
 		~BinkAudioTrack();
 
-		/** Decode an audio packet. */
-		void decodePacket();
+		/** Queue one frame's worth of undecoded audio data. */
+		void queuePacket(Common::SeekableReadStream *packet);
+
+		// AudioStream API. The mixer pulls the decoded samples through
+		// readBuffer(), so the queued packets get decoded on the mixer
+		// thread, concurrently with the video decoding.
+		int readBuffer(int16 *buffer, const int numSamples);
+		bool isStereo() const { return _audioInfo->outChannels == 2; }
+		int getRate() const { return _audioInfo->outSampleRate; }
+		bool endOfData() const;
+		bool endOfStream() const { return false; } ///< The track is stopped explicitly, never removed by the mixer
 
 	protected:
 		Audio::AudioStream *getAudioStream() const;
 
 	private:
 		AudioInfo *_audioInfo;
-		Audio::QueuingAudioStream *_audioStream;
+
+		/** Packets queued for decoding, guarded by _packetMutex. */
+		Common::Queue<Common::SeekableReadStream *> _packets;
+		mutable Common::Mutex _packetMutex;
+
+		/**
+		 * Whether the current bitstream still holds undecoded data.
+		 *
+		 * The bitstream itself is owned by the mixer thread, so
+		 * endOfData() checks this mirror instead, which is only
+		 * updated with _packetMutex held.
+		 */
+		bool _bitsLeft;
+
+		int16 *_blockBuffer;     ///< Samples decoded from the current audio block.
+		uint32 _blockBufferSize; ///< Number of samples in the current block.
+		uint32 _blockBufferUsed; ///< How many of those were already read.
+
+		/** Decode the next audio block into _blockBuffer. */
+		bool decodeBlock();
 
 		float getFloat();
 
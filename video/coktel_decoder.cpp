@@ -85,6 +85,35 @@ bool CoktelDecoder::evaluateSeekFrame(int32 &frame, int whence) const {
 	return true;
 }
 
+void CoktelDecoder::coalesceDirtyRects() {
+	if (_dirtyRects.size() < 2)
+		return;
+
+	// Keep merging rects that overlap or touch each other until no more
+	// merges are possible. The rects are half-open, so comparing an edge
+	// with <= instead of < also catches directly adjacent rects.
+	bool merged = true;
+	while (merged) {
+		merged = false;
+
+		for (Common::List<Common::Rect>::iterator it = _dirtyRects.begin(); it != _dirtyRects.end(); ++it) {
+			Common::List<Common::Rect>::iterator candidate = it;
+			++candidate;
+
+			while (candidate != _dirtyRects.end()) {
+				if ((it->left <= candidate->right ) && (candidate->left <= it->right ) &&
+				    (it->top  <= candidate->bottom) && (candidate->top  <= it->bottom)) {
+
+					it->extend(*candidate);
+					candidate = _dirtyRects.erase(candidate);
+					merged = true;
+				} else
+					++candidate;
+			}
+		}
+	}
+}
+
 void CoktelDecoder::setSurfaceMemory(void *mem, uint16 width, uint16 height, uint8 bpp) {
 	freeSurface();
 
@@ -1371,6 +1400,7 @@ void IMDDecoder::processFrame() {
 		_soundStage = kSoundFinished;
 	}
 
+	coalesceDirtyRects();
 }
 
 Common::Rect IMDDecoder::calcFrameCoords(uint32 frame) {
@@ -1667,7 +1697,8 @@ VMDDecoder::VMDDecoder(Audio::Mixer *mixer, Audio::Mixer::SoundType soundType) :
 	_soundBytesPerSample(0), _soundStereo(0), _soundHeaderSize(0), _soundDataSize(0),
 	_soundLastFilledFrame(0), _audioFormat(kAudioFormat8bitRaw),
 	_hasVideo(false), _videoCodec(0), _blitMode(0), _bytesPerPixel(0),
-	_firstFramePos(0), _videoBufferSize(0), _externalCodec(false), _codec(0),
+	_firstFramePos(0), _videoBufferSize(0), _frameData(0), _frameDataSize(0),
+	_externalCodec(false), _codec(0),
 	_subtitle(-1), _isPaletted(true), _autoStartSound(true), _oldStereoBuffer(nullptr) {
 
 	_videoBuffer   [0] = 0;
@@ -2141,6 +2172,8 @@ void VMDDecoder::close() {
 	delete[] _videoBuffer[1];
 	delete[] _videoBuffer[2];
 
+	delete[] _frameData;
+
 	delete _codec;
 
 	_files.clear();
@@ -2182,6 +2215,9 @@ void VMDDecoder::close() {
 	_videoBufferLen[1] = 0;
 	_videoBufferLen[2] = 0;
 
+	_frameData     = 0;
+	_frameDataSize = 0;
+
 	_externalCodec = false;
 	_codec         = 0;
 
@@ -2215,7 +2251,21 @@ void VMDDecoder::processFrame() {
 
 	bool startSound = false;
 
+	// Read the whole frame's part data in one go and slice it up in memory
+	// afterwards, instead of issuing many small reads against the source
+	// stream; that matters when streaming from CD images
+	const uint32 frameDataSize = getFrameDataSize(_frames[_curFrame]);
+	if (frameDataSize > _frameDataSize) {
+		delete[] _frameData;
+
+		_frameData     = new byte[frameDataSize];
+		_frameDataSize = frameDataSize;
+	}
+
 	_stream->seek(_frames[_curFrame].offset, SEEK_SET);
+	uint32 frameDataRead = _stream->read(_frameData, frameDataSize);
+
+	Common::MemoryReadStream frameStream(_frameData, frameDataRead);
 
 	for (uint16 i = 0; i < _partsPerFrame; i++) {
 		Part &part = _frames[_curFrame].parts[i];
@@ -2226,26 +2276,26 @@ void VMDDecoder::processFrame() {
 				// Next sound slice data
 
 				if (_soundEnabled) {
-					filledSoundSlice(part.size);
+					filledSoundSlice(frameStream, part.size);
 
 					if (_soundStage == kSoundLoaded)
 						startSound = true;
 
 				} else
-					_stream->skip(part.size);
+					frameStream.skip(part.size);
 
 			} else if (part.flags == 2) {
 				// Initial sound data (all slices)
 
 				if (_soundEnabled) {
-					uint32 mask = _stream->readUint32LE();
-					filledSoundSlices(part.size - /* mask size */ 4, mask);
+					uint32 mask = frameStream.readUint32LE();
+					filledSoundSlices(frameStream, part.size - /* mask size */ 4, mask);
 
 					if (_soundStage == kSoundLoaded)
 						startSound = true;
 
 				} else
-					_stream->skip(part.size);
+					frameStream.skip(part.size);
 
 			} else if (part.flags == 3) {
 				// Empty sound slice
@@ -2258,20 +2308,20 @@ void VMDDecoder::processFrame() {
 						startSound = true;
 				}
 
-				_stream->skip(part.size);
+				frameStream.skip(part.size);
 			} else if (part.flags == 4) {
 				warning("VMDDecoder::processFrame(): TODO: Addy 5 sound type 4 (%d)", part.size);
 				disableSound();
-				_stream->skip(part.size);
+				frameStream.skip(part.size);
 			} else {
 				warning("VMDDecoder::processFrame(): Unknown sound type %d", part.flags);
-				_stream->skip(part.size);
+				frameStream.skip(part.size);
 			}
 
 		} else if ((part.type == kPartTypeVideo) && !_hasVideo) {
 
 			warning("VMDDecoder::processFrame(): Header claims there's no video, but video found (%d)", part.size);
-			_stream->skip(part.size);
+			frameStream.skip(part.size);
 
 		} else if ((part.type == kPartTypeVideo) && _hasVideo) {
 
@@ -2279,20 +2329,20 @@ void VMDDecoder::processFrame() {
 
 			// New palette
 			if (part.flags & 2) {
-				uint8 index = _stream->readByte();
-				uint8 count = _stream->readByte();
+				uint8 index = frameStream.readByte();
+				uint8 count = frameStream.readByte();
 
 				for (int j = 0; j < ((count + 1) * 3); j++)
-					_palette[index * 3 + j] = _stream->readByte() << 2;
+					_palette[index * 3 + j] = frameStream.readByte() << 2;
 
-				_stream->skip((255 - count) * 3);
+				frameStream.skip((255 - count) * 3);
 
 				_paletteDirty = true;
 
 				size -= (768 + 2);
 			}
 
-			_stream->read(_videoBuffer[0], size);
+			frameStream.read(_videoBuffer[0], size);
 			_videoBufferLen[0] = size;
 
 			Common::Rect rect(part.left, part.top, part.right + 1, part.bottom + 1);
@@ -2306,17 +2356,17 @@ void VMDDecoder::processFrame() {
 		} else if (part.type == kPartTypeFile) {
 
 			// Ignore
-			_stream->skip(part.size);
+			frameStream.skip(part.size);
 
 		} else if (part.type == kPartType4) {
 
 			// Unknown, ignore
-			_stream->skip(part.size);
+			frameStream.skip(part.size);
 
 		} else if (part.type == kPartTypeSubtitle) {
 
 			_subtitle = part.id;
-			_stream->skip(part.size);
+			frameStream.skip(part.size);
 
 		} else {
 
@@ -2340,6 +2390,25 @@ void VMDDecoder::processFrame() {
 		_audioStream->finish();
 		_soundStage = kSoundFinished;
 	}
+
+	coalesceDirtyRects();
+}
+
+uint32 VMDDecoder::getFrameDataSize(const Frame &frame) const {
+	// Everything processFrame() consumes is stored back-to-back at the
+	// frame's offset; separators and unknown part types carry no data
+	uint32 size = 0;
+
+	for (uint16 i = 0; i < _partsPerFrame; i++) {
+		const Part &part = frame.parts[i];
+
+		if ((part.type == kPartTypeAudio) || (part.type == kPartTypeVideo) ||
+		    (part.type == kPartTypeFile)  || (part.type == kPartType4)     ||
+		    (part.type == kPartTypeSubtitle))
+			size += part.size;
+	}
+
+	return size;
 }
 
 bool VMDDecoder::renderFrame(Common::Rect &rect) {
@@ -2580,16 +2649,16 @@ void VMDDecoder::emptySoundSlice(uint32 size) {
 	}
 }
 
-void VMDDecoder::filledSoundSlice(uint32 size) {
+void VMDDecoder::filledSoundSlice(Common::SeekableReadStream &frameStream, uint32 size) {
 	if (!_audioStream) {
-		_stream->skip(size);
+		frameStream.skip(size);
 		return;
 	}
 
 	if (_soundStereo == 1) {
 		void *buf = malloc(size);
 		assert(buf);
-		const uint32 numBytesRead = _stream->read(buf, size);
+		const uint32 numBytesRead = frameStream.read(buf, size);
 		assert(numBytesRead == size);
 		const uint32 numBytesWritten = _oldStereoBuffer->write(buf, size);
 		assert(numBytesWritten == size);
@@ -2597,7 +2666,7 @@ void VMDDecoder::filledSoundSlice(uint32 size) {
 		return;
 	}
 
-	Common::SeekableReadStream *data = _stream->readStream(size);
+	Common::SeekableReadStream *data = frameStream.readStream(size);
 	Audio::AudioStream *sliceStream = 0;
 
 	if (_audioFormat == kAudioFormat8bitRaw)
@@ -2611,7 +2680,7 @@ void VMDDecoder::filledSoundSlice(uint32 size) {
 		_audioStream->queueAudioStream(sliceStream);
 }
 
-void VMDDecoder::filledSoundSlices(uint32 size, uint32 mask) {
+void VMDDecoder::filledSoundSlices(Common::SeekableReadStream &frameStream, uint32 size, uint32 mask) {
 	bool fillInfo[32];
 
 	uint8 max;
@@ -2634,12 +2703,12 @@ void VMDDecoder::filledSoundSlices(uint32 size, uint32 mask) {
 
 	for (uint8 i = 0; i < max; i++)
 		if (fillInfo[i])
-			filledSoundSlice(_soundDataSize + extraSize);
+			filledSoundSlice(frameStream, _soundDataSize + extraSize);
 		else
 			emptySoundSlice(_soundDataSize * _soundBytesPerSample);
 
 	if (_soundSlicesCount > 32)
-		filledSoundSlice((_soundSlicesCount - 32) * _soundDataSize + _soundHeaderSize);
+		filledSoundSlice(frameStream, (_soundSlicesCount - 32) * _soundDataSize + _soundHeaderSize);
 }
 
 void VMDDecoder::createAudioStream() {
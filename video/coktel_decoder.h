@@ -247,6 +247,15 @@ protected:
 
 	bool evaluateSeekFrame(int32 &frame, int whence) const;
 
+	/**
+	 * Merge overlapping and adjacent dirty rects into larger ones.
+	 *
+	 * Formats rendering a frame as many small blocks (most notably VMD)
+	 * would otherwise hand one tiny rect per block to the caller, which
+	 * translates into one screen update call per block.
+	 */
+	void coalesceDirtyRects();
+
 	// Surface management
 	bool hasSurface();
 	void createSurface();
@@ -527,6 +536,9 @@ private:
 	byte  *_videoBuffer[3];    ///< Video buffers.
 	uint32 _videoBufferLen[3]; ///< Size of the video buffers filled.
 
+	byte  *_frameData;     ///< Buffer holding one frame's part data, read in a single go.
+	uint32 _frameDataSize; ///< Capacity of the frame data buffer.
+
 	Graphics::Surface _8bppSurface[3]; ///< Fake 8bpp surfaces over the video buffers.
 
 	bool _externalCodec;
@@ -545,6 +557,7 @@ private:
 
 	// Frame decoding
 	void processFrame();
+	uint32 getFrameDataSize(const Frame &frame) const;
 
 	// Video
 	bool renderFrame(Common::Rect &rect);
@@ -555,8 +568,8 @@ private:
 
 	// Sound
 	void emptySoundSlice  (uint32 size);
-	void filledSoundSlice (uint32 size);
-	void filledSoundSlices(uint32 size, uint32 mask);
+	void filledSoundSlice (Common::SeekableReadStream &frameStream, uint32 size);
+	void filledSoundSlices(Common::SeekableReadStream &frameStream, uint32 size, uint32 mask);
 	void createAudioStream();
 
 	uint8 evaluateMask(uint32 mask, bool *fillInfo, uint8 &max);
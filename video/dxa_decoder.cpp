@@ -34,6 +34,9 @@
   #include "common/zlib.h"
 #endif
 
+#define BLOCKW 4
+#define BLOCKH 4
+
 namespace Video {
 
 DXADecoder::DXADecoder() {
@@ -118,6 +121,12 @@ DXADecoder::DXAVideoTrack::DXAVideoTrack(Common::SeekableReadStream *stream) {
 		memset(_scaledBuffer, 0, _frameSize);
 	}
 
+	// Tracks which rows of blocks a delta frame touched, so the scale
+	// pass only needs to re-expand those rows
+	_blockRows = (_height + BLOCKH - 1) / BLOCKH;
+	_blockRowDirty = new byte[_blockRows];
+	memset(_blockRowDirty, 1, _blockRows);
+
 #ifdef DXA_EXPERIMENT_MAXD
 	// Check for an extended header
 	if (flags & 1) {
@@ -154,6 +163,7 @@ DXADecoder::DXAVideoTrack::~DXAVideoTrack() {
 	delete[] _frameBuffer1;
 	delete[] _frameBuffer2;
 	delete[] _scaledBuffer;
+	delete[] _blockRowDirty;
 	delete[] _inBuffer;
 	delete[] _decompBuffer;
 }
@@ -161,6 +171,7 @@ DXADecoder::DXAVideoTrack::~DXAVideoTrack() {
 bool DXADecoder::DXAVideoTrack::rewind() {
 	_curFrame = -1;
 	_fileStream->seek(_frameStartOffset);
+	memset(_blockRowDirty, 1, _blockRows);
 	return true;
 }
 
@@ -179,9 +190,6 @@ void DXADecoder::DXAVideoTrack::decodeZlib(byte *data, int size, int totalSize)
 #endif
 }
 
-#define BLOCKW 4
-#define BLOCKH 4
-
 void DXADecoder::DXAVideoTrack::decode12(int size) {
 #ifdef USE_ZLIB
 	if (!_decompBuffer) {
@@ -197,10 +205,15 @@ void DXADecoder::DXAVideoTrack::decode12(int size) {
 	memcpy(_frameBuffer2, _frameBuffer1, _frameSize);
 
 	for (uint32 by = 0; by < _height; by += BLOCKH) {
+		bool rowChanged = false;
+
 		for (uint32 bx = 0; bx < _width; bx += BLOCKW) {
 			byte type = *dat++;
 			byte *b2 = _frameBuffer1 + bx + by * _width;
 
+			if (type != 0 && type != 5)
+				rowChanged = true;
+
 			switch (type) {
 			case 0:
 				break;
@@ -277,6 +290,8 @@ void DXADecoder::DXAVideoTrack::decode12(int size) {
 				error("decode12: Unknown type %d", type);
 			}
 		}
+
+		_blockRowDirty[by / BLOCKH] = rowChanged ? 1 : 0;
 	}
 #endif
 }
@@ -308,10 +323,15 @@ void DXADecoder::DXAVideoTrack::decode13(int size) {
 	maskBuf = &motBuf[motSize];
 
 	for (uint32 by = 0; by < _curHeight; by += BLOCKH) {
+		bool rowChanged = false;
+
 		for (uint32 bx = 0; bx < _width; bx += BLOCKW) {
 			uint8 type = *codeBuf++;
 			uint8 *b2 = (uint8 *)_frameBuffer1 + bx + by * _width;
 
+			if (type != 0)
+				rowChanged = true;
+
 			switch (type) {
 			case 0:
 				break;
@@ -463,6 +483,8 @@ void DXADecoder::DXAVideoTrack::decode13(int size) {
 				error("decode13: Unknown type %d", type);
 			}
 		}
+
+		_blockRowDirty[by / BLOCKH] = rowChanged ? 1 : 0;
 	}
 #endif
 }
@@ -491,9 +513,11 @@ const Graphics::Surface *DXADecoder::DXAVideoTrack::decodeNextFrame() {
 		switch (type) {
 		case 2:
 			decodeZlib(_frameBuffer1, size, _frameSize);
+			memset(_blockRowDirty, 1, _blockRows);
 			break;
 		case 3:
 			decodeZlib(_frameBuffer2, size, _frameSize);
+			memset(_blockRowDirty, 1, _blockRows);
 			break;
 		case 12:
 			decode12(size);
@@ -506,27 +530,30 @@ const Graphics::Surface *DXADecoder::DXAVideoTrack::decodeNextFrame() {
 		}
 
 		if (type == 3) {
-			for (uint32 j = 0; j < _curHeight; ++j) {
-				for (uint32 i = 0; i < _width; ++i) {
-					const int offs = j * _width + i;
-					_frameBuffer1[offs] ^= _frameBuffer2[offs];
-				}
-			}
+			const uint32 pixelCount = _curHeight * _width;
+			for (uint32 i = 0; i < pixelCount; ++i)
+				_frameBuffer1[i] ^= _frameBuffer2[i];
 		}
 	}
 
+	// The scaled buffer persists between frames, so only the rows a delta
+	// frame actually touched need to be expanded again. The blank lines of
+	// the interlaced mode were zeroed when the buffer was allocated and
+	// are never written to afterwards.
 	switch (_scaleMode) {
 	case S_INTERLACED:
 		for (int cy = 0; cy < _curHeight; cy++) {
-			memcpy(&_scaledBuffer[2 * cy * _width], &_frameBuffer1[cy * _width], _width);
-			memset(&_scaledBuffer[((2 * cy) + 1) * _width], 0, _width);
+			if (_blockRowDirty[cy / BLOCKH])
+				memcpy(&_scaledBuffer[2 * cy * _width], &_frameBuffer1[cy * _width], _width);
 		}
 		_surface->setPixels(_scaledBuffer);
 		break;
 	case S_DOUBLE:
 		for (int cy = 0; cy < _curHeight; cy++) {
-			memcpy(&_scaledBuffer[2 * cy * _width], &_frameBuffer1[cy * _width], _width);
-			memcpy(&_scaledBuffer[((2 * cy) + 1) * _width], &_frameBuffer1[cy * _width], _width);
+			if (_blockRowDirty[cy / BLOCKH]) {
+				memcpy(&_scaledBuffer[2 * cy * _width], &_frameBuffer1[cy * _width], _width);
+				memcpy(&_scaledBuffer[((2 * cy) + 1) * _width], &_frameBuffer1[cy * _width], _width);
+			}
 		}
 		_surface->setPixels(_scaledBuffer);
 		break;
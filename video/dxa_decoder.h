@@ -94,6 +94,8 @@ private:
 		byte *_frameBuffer1;
 		byte *_frameBuffer2;
 		byte *_scaledBuffer;
+		byte *_blockRowDirty;
+		uint32 _blockRows;
 		byte *_inBuffer;
 		uint32 _inBufferSize;
 		byte *_decompBuffer;
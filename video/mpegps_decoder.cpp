@@ -176,18 +176,31 @@ int MPEGPSDecoder::findNextStartCode(uint32 &size) {
 	size = MAX_SYNC_SIZE;
 	int32 state = 0xFF;
 
+	// Scan in buffered chunks rather than one readByte() call per input
+	// byte; the stuffing between packs makes this loop run over a lot of
+	// data on some files.
+	byte buffer[1024];
+
 	while (size > 0) {
-		byte v = _stream->readByte();
+		uint32 bytesRead = _stream->read(buffer, MIN<uint32>(size, sizeof(buffer)));
 
-		if (_stream->eos())
+		if (bytesRead == 0)
 			return -1;
 
-		size--;
+		size -= bytesRead;
 
-		if (state == 0x1)
-			return ((state << 8) | v) & 0xFFFFFF;
+		for (uint32 i = 0; i < bytesRead; i++) {
+			byte v = buffer[i];
 
-		state = ((state << 8) | v) & 0xFFFFFF;
+			if (state == 0x1) {
+				// Hand back whatever we over-read past the start code
+				_stream->seek((int32)(i + 1) - (int32)bytesRead, SEEK_CUR);
+				size += bytesRead - (i + 1);
+				return ((state << 8) | v) & 0xFFFFFF;
+			}
+
+			state = ((state << 8) | v) & 0xFFFFFF;
+		}
 	}
 
 	return -1;
@@ -34,6 +34,16 @@
 
 #include "video/psx_decoder.h"
 
+// Vectorized dequantization, IDCT and block-store kernels for the MDEC
+// frame decoder. The scalar paths below remain as the fallback.
+#ifdef __SSE2__
+#include <emmintrin.h>
+#define USE_PSX_MDEC_SIMD
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define USE_PSX_MDEC_SIMD
+#endif
+
 namespace Video {
 
 // Here are the codes/lengths/symbols that are used for decoding
@@ -535,7 +545,65 @@ static const byte s_quantizationTable[8 * 8] = {
 	27, 29, 35, 38, 46, 56, 69, 83
 };
 
+#ifdef USE_PSX_MDEC_SIMD
+
+// s_quantizationTable in single precision for the vector dequantizer;
+// keep in sync with the table above
+static const float s_quantizationTableF[8 * 8] = {
+	 2, 16, 19, 22, 26, 27, 29, 34,
+	16, 16, 22, 24, 27, 29, 34, 37,
+	19, 22, 26, 27, 29, 34, 34, 38,
+	22, 22, 26, 27, 29, 34, 37, 40,
+	22, 26, 27, 29, 32, 35, 40, 48,
+	26, 27, 29, 32, 35, 40, 48, 58,
+	26, 27, 29, 34, 38, 46, 56, 69,
+	27, 29, 35, 38, 46, 56, 69, 83
+};
+
+/**
+ * Scale 64 already un-zig-zagged coefficients by the quantization table
+ * and the frame's scale factor, four at a time. Multiplying by 1/8 is
+ * exact, so this matches the scalar division bit for bit.
+ */
+static void dequantizeBlockSIMD(const int *coefficients, float *block, uint16 scale) {
+#ifdef __SSE2__
+	const __m128 scaleVec = _mm_set1_ps((float)scale);
+	const __m128 eighth = _mm_set1_ps(1.0f / 8.0f);
+
+	for (int i = 0; i < 8 * 8; i += 4) {
+		__m128 v = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(coefficients + i)));
+		v = _mm_mul_ps(v, _mm_loadu_ps(s_quantizationTableF + i));
+		v = _mm_mul_ps(_mm_mul_ps(v, scaleVec), eighth);
+		_mm_storeu_ps(block + i, v);
+	}
+#else
+	const float32x4_t scaleVec = vdupq_n_f32((float)scale);
+	const float32x4_t eighth = vdupq_n_f32(1.0f / 8.0f);
+
+	for (int i = 0; i < 8 * 8; i += 4) {
+		float32x4_t v = vcvtq_f32_s32(vld1q_s32(coefficients + i));
+		v = vmulq_f32(v, vld1q_f32(s_quantizationTableF + i));
+		v = vmulq_f32(vmulq_f32(v, scaleVec), eighth);
+		vst1q_f32(block + i, v);
+	}
+#endif
+}
+
+#endif // USE_PSX_MDEC_SIMD
+
 void PSXStreamDecoder::PSXVideoTrack::dequantizeBlock(int *coefficients, float *block, uint16 scale) {
+#ifdef USE_PSX_MDEC_SIMD
+	// Un-zig-zag with scalar moves, then scale all 64 coefficients with
+	// vector multiplies
+	int reordered[8 * 8];
+	for (int i = 0; i < 8 * 8; i++)
+		reordered[i] = coefficients[s_zigZagTable[i]];
+
+	dequantizeBlockSIMD(reordered, block, scale);
+
+	// Special case for the DC coefficient, which is not scaled
+	block[0] = coefficients[0] * s_quantizationTable[0];
+#else
 	// Dequantize the data, un-zig-zagging as we go along
 	for (int i = 0; i < 8 * 8; i++) {
 		if (i == 0) // Special case for the DC coefficient
@@ -543,6 +611,7 @@ void PSXStreamDecoder::PSXVideoTrack::dequantizeBlock(int *coefficients, float *
 		else
 			block[i] = (float)coefficients[s_zigZagTable[i]] * s_quantizationTable[i] * scale / 8;
 	}
+#endif
 }
 
 int PSXStreamDecoder::PSXVideoTrack::readDC(Common::BitStreamMemory16LEMSB *bits, uint16 version, PlaneType plane) {
@@ -632,7 +701,124 @@ static const double s_idct8x8[8][8] = {
 	{ 0.353553390593274, -0.490392640201615,  0.461939766255643, -0.415734806151273,  0.353553390593273, -0.277785116509801,  0.191341716182545, -0.097545161008064 }
 };
 
+#ifdef USE_PSX_MDEC_SIMD
+
+// The IDCT basis transposed and in single precision for the vector
+// kernel: s_idct8x8T[y][x] = (float)s_idct8x8[x][y]
+static const float s_idct8x8T[8][8] = {
+	{ 0.353553390593274f,  0.353553390593274f,  0.353553390593274f,  0.353553390593274f,  0.353553390593274f,  0.353553390593274f,  0.353553390593274f,  0.353553390593274f },
+	{ 0.490392640201615f,  0.415734806151273f,  0.277785116509801f,  0.097545161008064f, -0.097545161008064f, -0.277785116509801f, -0.415734806151273f, -0.490392640201615f },
+	{ 0.461939766255643f,  0.191341716182545f, -0.191341716182545f, -0.461939766255643f, -0.461939766255643f, -0.191341716182545f,  0.191341716182545f,  0.461939766255643f },
+	{ 0.415734806151273f, -0.097545161008064f, -0.490392640201615f, -0.277785116509801f,  0.277785116509801f,  0.490392640201615f,  0.097545161008064f, -0.415734806151273f },
+	{ 0.353553390593274f, -0.353553390593274f, -0.353553390593274f,  0.353553390593274f,  0.353553390593274f, -0.353553390593274f, -0.353553390593274f,  0.353553390593274f },
+	{ 0.277785116509801f, -0.490392640201615f,  0.097545161008064f,  0.415734806151273f, -0.415734806151273f, -0.097545161008064f,  0.490392640201615f, -0.277785116509801f },
+	{ 0.191341716182545f, -0.461939766255643f,  0.461939766255643f, -0.191341716182545f, -0.191341716182545f,  0.461939766255643f, -0.461939766255643f,  0.191341716182545f },
+	{ 0.097545161008064f, -0.277785116509801f,  0.415734806151273f, -0.490392640201615f,  0.490392640201615f, -0.415734806151273f,  0.277785116509801f, -0.097545161008064f }
+};
+
+/**
+ * Two-pass 8x8 IDCT with each output row computed as a sum of scaled
+ * basis rows, eight lanes wide. Accumulates in single instead of double
+ * precision; after the final clamp to [-128, 127] and truncation the
+ * difference from the scalar path is at most one level, well below what
+ * the lossy MDEC encoding loses to begin with.
+ */
+static void idctSIMD(const float *dequantData, float *result) {
+#ifdef __SSE2__
+	float tmp[8 * 8];
+
+	// Apply 1D IDCT to rows: tmp[y][x] = sum over k of
+	// dequantData[y][k] * s_idct8x8T[k][x]
+	for (int y = 0; y < 8; y++) {
+		const float *d = dequantData + y * 8;
+		__m128 acc0 = _mm_mul_ps(_mm_set1_ps(d[0]), _mm_loadu_ps(s_idct8x8T[0]));
+		__m128 acc1 = _mm_mul_ps(_mm_set1_ps(d[0]), _mm_loadu_ps(s_idct8x8T[0] + 4));
+
+		for (int k = 1; k < 8; k++) {
+			const __m128 s = _mm_set1_ps(d[k]);
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(s, _mm_loadu_ps(s_idct8x8T[k])));
+			acc1 = _mm_add_ps(acc1, _mm_mul_ps(s, _mm_loadu_ps(s_idct8x8T[k] + 4)));
+		}
+
+		_mm_storeu_ps(tmp + y * 8, acc0);
+		_mm_storeu_ps(tmp + y * 8 + 4, acc1);
+	}
+
+	// Apply 1D IDCT to columns: result[y][x] = sum over k of
+	// s_idct8x8T[k][y] * tmp[k][x]
+	for (int y = 0; y < 8; y++) {
+		__m128 acc0 = _mm_mul_ps(_mm_set1_ps(s_idct8x8T[0][y]), _mm_loadu_ps(tmp));
+		__m128 acc1 = _mm_mul_ps(_mm_set1_ps(s_idct8x8T[0][y]), _mm_loadu_ps(tmp + 4));
+
+		for (int k = 1; k < 8; k++) {
+			const __m128 s = _mm_set1_ps(s_idct8x8T[k][y]);
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(s, _mm_loadu_ps(tmp + k * 8)));
+			acc1 = _mm_add_ps(acc1, _mm_mul_ps(s, _mm_loadu_ps(tmp + k * 8 + 4)));
+		}
+
+		_mm_storeu_ps(result + y * 8, acc0);
+		_mm_storeu_ps(result + y * 8 + 4, acc1);
+	}
+#else
+	float tmp[8 * 8];
+
+	for (int y = 0; y < 8; y++) {
+		const float *d = dequantData + y * 8;
+		float32x4_t acc0 = vmulq_n_f32(vld1q_f32(s_idct8x8T[0]), d[0]);
+		float32x4_t acc1 = vmulq_n_f32(vld1q_f32(s_idct8x8T[0] + 4), d[0]);
+
+		for (int k = 1; k < 8; k++) {
+			acc0 = vmlaq_n_f32(acc0, vld1q_f32(s_idct8x8T[k]), d[k]);
+			acc1 = vmlaq_n_f32(acc1, vld1q_f32(s_idct8x8T[k] + 4), d[k]);
+		}
+
+		vst1q_f32(tmp + y * 8, acc0);
+		vst1q_f32(tmp + y * 8 + 4, acc1);
+	}
+
+	for (int y = 0; y < 8; y++) {
+		float32x4_t acc0 = vmulq_n_f32(vld1q_f32(tmp), s_idct8x8T[0][y]);
+		float32x4_t acc1 = vmulq_n_f32(vld1q_f32(tmp + 4), s_idct8x8T[0][y]);
+
+		for (int k = 1; k < 8; k++) {
+			acc0 = vmlaq_n_f32(acc0, vld1q_f32(tmp + k * 8), s_idct8x8T[k][y]);
+			acc1 = vmlaq_n_f32(acc1, vld1q_f32(tmp + k * 8 + 4), s_idct8x8T[k][y]);
+		}
+
+		vst1q_f32(result + y * 8, acc0);
+		vst1q_f32(result + y * 8 + 4, acc1);
+	}
+#endif
+}
+
+/**
+ * Clamp one row of IDCT output to [-128, 127], shift it into [0, 255]
+ * and store it as bytes, matching the scalar truncating conversion.
+ */
+static inline void storeBlockRowSIMD(byte *dst, const float *src) {
+#ifdef __SSE2__
+	const __m128 lo = _mm_set1_ps(-128.0f);
+	const __m128 hi = _mm_set1_ps(127.0f);
+	const __m128i a = _mm_cvttps_epi32(_mm_max_ps(lo, _mm_min_ps(hi, _mm_loadu_ps(src))));
+	const __m128i b = _mm_cvttps_epi32(_mm_max_ps(lo, _mm_min_ps(hi, _mm_loadu_ps(src + 4))));
+	const __m128i w = _mm_add_epi16(_mm_packs_epi32(a, b), _mm_set1_epi16(128));
+	_mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(w, w));
+#else
+	const float32x4_t lo = vdupq_n_f32(-128.0f);
+	const float32x4_t hi = vdupq_n_f32(127.0f);
+	const int32x4_t a = vcvtq_s32_f32(vmaxq_f32(lo, vminq_f32(hi, vld1q_f32(src))));
+	const int32x4_t b = vcvtq_s32_f32(vmaxq_f32(lo, vminq_f32(hi, vld1q_f32(src + 4))));
+	const int16x8_t w = vaddq_s16(vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)), vdupq_n_s16(128));
+	vst1_u8(dst, vqmovun_s16(w));
+#endif
+}
+
+#endif // USE_PSX_MDEC_SIMD
+
 void PSXStreamDecoder::PSXVideoTrack::idct(float *dequantData, float *result) {
+#ifdef USE_PSX_MDEC_SIMD
+	idctSIMD(dequantData, result);
+#else
 	// IDCT code based on JPEG's IDCT code
 	// TODO: Switch to the integer-based one mentioned in the docs
 	// This is by far the costliest operation here
@@ -669,6 +855,7 @@ void PSXStreamDecoder::PSXVideoTrack::idct(float *dequantData, float *result) {
 								+ u[7] * s_idct8x8[y][7];
 		}
 	}
+#endif
 }
 
 void PSXStreamDecoder::PSXVideoTrack::decodeBlock(Common::BitStreamMemory16LEMSB *bits, byte *block, int pitch, uint16 scale, uint16 version, PlaneType plane) {
@@ -691,8 +878,12 @@ void PSXStreamDecoder::PSXVideoTrack::decodeBlock(Common::BitStreamMemory16LEMSB
 		byte *dst = block + pitch * y;
 
 		// Convert the result to be in the range [0, 255]
+#ifdef USE_PSX_MDEC_SIMD
+		storeBlockRowSIMD(dst, idctData + y * 8);
+#else
 		for (int x = 0; x < 8; x++)
 			*dst++ = (int)CLIP<float>(idctData[y * 8 + x], -128.0f, 127.0f) + 128;
+#endif
 	}
 }
 
@@ -285,6 +285,8 @@ Audio::SeekableAudioStream *QuickTimeDecoder::AudioTrackHandler::getSeekableAudi
 }
 
 QuickTimeDecoder::VideoTrackHandler::VideoTrackHandler(QuickTimeDecoder *decoder, Common::QuickTimeParser::Track *parent) : _decoder(decoder), _parent(parent) {
+	buildSampleIndex();
+
 	_curEdit = 0;
 	enterNewEditList(false);
 
@@ -572,49 +574,45 @@ Common::Rational QuickTimeDecoder::VideoTrackHandler::getScaledHeight() const {
 	return Common::Rational(_parent->height) / _parent->scaleFactorY;
 }
 
-Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
-	// First, we have to track down which chunk holds the sample and which sample in the chunk contains the frame we are looking for.
-	int32 totalSampleCount = 0;
-	int32 sampleInChunk = 0;
-	int32 actualChunk = -1;
+void QuickTimeDecoder::VideoTrackHandler::buildSampleIndex() {
+	// Flatten the sample-to-chunk and sample size tables into one entry per
+	// frame, so that fetching a frame's data is a simple array lookup instead
+	// of a walk over the chunk tables. Seek-heavy games (e.g. Pegasus Prime)
+	// hit this path constantly.
+	_sampleIndex.resize(_parent->frameCount);
+
+	uint32 frame = 0;
 	uint32 sampleToChunkIndex = 0;
 
-	for (uint32 i = 0; i < _parent->chunkCount; i++) {
+	for (uint32 i = 0; i < _parent->chunkCount && frame < _parent->frameCount; i++) {
 		if (sampleToChunkIndex < _parent->sampleToChunkCount && i >= _parent->sampleToChunk[sampleToChunkIndex].first)
 			sampleToChunkIndex++;
 
-		totalSampleCount += _parent->sampleToChunk[sampleToChunkIndex - 1].count;
+		uint32 offset = _parent->chunkOffsets[i];
 
-		if (totalSampleCount > _curFrame) {
-			actualChunk = i;
-			descId = _parent->sampleToChunk[sampleToChunkIndex - 1].id;
-			sampleInChunk = _parent->sampleToChunk[sampleToChunkIndex - 1].count - totalSampleCount + _curFrame;
-			break;
+		for (uint32 j = 0; j < _parent->sampleToChunk[sampleToChunkIndex - 1].count && frame < _parent->frameCount; j++, frame++) {
+			const uint32 size = (_parent->sampleSize != 0) ? _parent->sampleSize : _parent->sampleSizes[frame];
+			_sampleIndex[frame].offset = offset;
+			_sampleIndex[frame].size = size;
+			_sampleIndex[frame].descId = _parent->sampleToChunk[sampleToChunkIndex - 1].id;
+			offset += size;
 		}
 	}
+}
 
-	if (actualChunk < 0)
+Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
+	// Look up the frame in the flat sample index built at load time
+	if (_curFrame < 0 || (uint32)_curFrame >= _sampleIndex.size())
 		error("Could not find data for frame %d", _curFrame);
 
-	// Next seek to that frame
-	Common::SeekableReadStream *stream = _decoder->_fd;
-	stream->seek(_parent->chunkOffsets[actualChunk]);
-
-	// Then, if the chunk holds more than one frame, seek to where the frame we want is located
-	for (int32 i = _curFrame - sampleInChunk; i < _curFrame; i++) {
-		if (_parent->sampleSize != 0)
-			stream->skip(_parent->sampleSize);
-		else
-			stream->skip(_parent->sampleSizes[i]);
-	}
-
-	// Finally, read in the raw data for the frame
-	//debug("Frame Data[%d]: Offset = %d, Size = %d", _curFrame, stream->pos(), _parent->sampleSizes[_curFrame]);
+	const SampleDataInfo &info = _sampleIndex[_curFrame];
+	descId = info.descId;
 
-	if (_parent->sampleSize != 0)
-		return stream->readStream(_parent->sampleSize);
+	//debug("Frame Data[%d]: Offset = %d, Size = %d", _curFrame, info.offset, info.size);
 
-	return stream->readStream(_parent->sampleSizes[_curFrame]);
+	Common::SeekableReadStream *stream = _decoder->_fd;
+	stream->seek(info.offset);
+	return stream->readStream(info.size);
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::getFrameDuration() {
@@ -633,12 +631,25 @@ uint32 QuickTimeDecoder::VideoTrackHandler::getFrameDuration() {
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
-	for (int i = _parent->keyframeCount - 1; i >= 0; i--)
-		if (_parent->keyframes[i] <= frame)
-			return _parent->keyframes[i];
+	// The keyframe list is sorted, so binary search for the last keyframe
+	// at or before the requested frame
+	int lo = 0;
+	int hi = (int)_parent->keyframeCount - 1;
 
 	// If none found, we'll assume the requested frame is a key frame
-	return frame;
+	uint32 keyFrame = frame;
+
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		if (_parent->keyframes[mid] <= frame) {
+			keyFrame = _parent->keyframes[mid];
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return keyFrame;
 }
 
 void QuickTimeDecoder::VideoTrackHandler::enterNewEditList(bool bufferFrames) {
@@ -32,6 +32,7 @@
 #define VIDEO_QT_DECODER_H
 
 #include "audio/decoders/quicktime_intern.h"
+#include "common/array.h"
 #include "common/scummsys.h"
 
 #include "video/video_decoder.h"
@@ -147,8 +148,18 @@ private:
 		Common::Rational getScaledHeight() const;
 
 	private:
+		// Flat per-frame index into the movie file, built once at load time
+		// so that fetching a frame does not have to walk the sample-to-chunk
+		// table again
+		struct SampleDataInfo {
+			uint32 offset;
+			uint32 size;
+			uint32 descId;
+		};
+
 		QuickTimeDecoder *_decoder;
 		Common::QuickTimeParser::Track *_parent;
+		Common::Array<SampleDataInfo> _sampleIndex;
 		uint32 _curEdit;
 		int32 _curFrame;
 		uint32 _nextFrameStartTime;
@@ -164,6 +175,7 @@ private:
 		Graphics::Surface *_ditherFrame;
 		const Graphics::Surface *forceDither(const Graphics::Surface &frame);
 
+		void buildSampleIndex();
 		Common::SeekableReadStream *getNextFramePacket(uint32 &descId);
 		uint32 getFrameDuration();
 		uint32 findKeyFrame(uint32 frame) const;
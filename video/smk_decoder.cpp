@@ -526,6 +526,7 @@ SmackerDecoder::SmackerVideoTrack::SmackerVideoTrack(uint32 width, uint32 height
 	_signature = signature;
 	_curFrame = -1;
 	_dirtyPalette = false;
+	_paletteSet = false;
 	_MMapTree = _MClrTree = _FullTree = _TypeTree = 0;
 	memset(_palette, 0, 3 * 256);
 }
@@ -680,8 +681,9 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(Common::BitStreamMemory8LSB
 			}
 			break;
 		case SMK_BLOCK_SKIP:
-			while (run-- && block < blocks)
-				block++;
+			// Unchanged blocks carry no data; the whole run can be
+			// skipped at once.
+			block += MIN<uint>(run, blocks - block);
 			break;
 		case SMK_BLOCK_FILL:
 			uint32 col;
@@ -749,7 +751,14 @@ void SmackerDecoder::SmackerVideoTrack::unpackPalette(Common::SeekableReadStream
 	stream->seek(startPos + len);
 	free(chunk);
 
-	_dirtyPalette = true;
+	// Most Smacker files carry a palette chunk on every frame, even when
+	// the palette did not change. Only mark it dirty when the contents
+	// actually differ, so callers skip the full palette upload to the
+	// backend otherwise.
+	if (!_paletteSet || memcmp(oldPalette, _palette, 3 * 256) != 0)
+		_dirtyPalette = true;
+
+	_paletteSet = true;
 }
 
 SmackerDecoder::SmackerAudioTrack::SmackerAudioTrack(const AudioInfo &audioInfo, Audio::Mixer::SoundType soundType) :
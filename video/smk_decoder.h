@@ -107,6 +107,7 @@ protected:
 
 		byte _palette[3 * 256];
 		mutable bool _dirtyPalette;
+		bool _paletteSet;
 
 		int _curFrame;
 		uint32 _frameCount;
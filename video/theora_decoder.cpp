@@ -194,6 +194,13 @@ bool TheoraDecoder::loadStream(Common::SeekableReadStream *stream) {
 
 	vorbis_comment_clear(&vorbisComment);
 
+	// Theora videos have a single, forward-only RGB video track, so
+	// playback loops may pipeline decoding ahead of the frame deadline.
+	// A Theora decode plus YUV conversion is expensive enough that a
+	// few frames of slack matter on weak CPUs.
+	if (_hasVideo)
+		enableDecodeAhead(3);
+
 	return true;
 }
 
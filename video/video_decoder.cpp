@@ -30,6 +30,7 @@
 #include "common/system.h"
 
 #include "graphics/palette.h"
+#include "graphics/surface.h"
 
 namespace Video {
 
@@ -49,6 +50,9 @@ VideoDecoder::VideoDecoder() {
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
 	_canSetDither = true;
+	_decodeAheadLimit = 0;
+	_aheadFrame = 0;
+	_aheadCurFrame = -1;
 
 	// Find the best format for output
 	_defaultHighColorFormat = g_system->getScreenFormat();
@@ -61,6 +65,23 @@ void VideoDecoder::close() {
 	if (isPlaying())
 		stop();
 
+	flushAheadQueue();
+
+	if (_aheadFrame) {
+		_aheadFrame->free();
+		delete _aheadFrame;
+		_aheadFrame = 0;
+	}
+
+	for (uint i = 0; i < _aheadPool.size(); i++) {
+		_aheadPool[i]->free();
+		delete _aheadPool[i];
+	}
+	_aheadPool.clear();
+
+	_decodeAheadLimit = 0;
+	_aheadCurFrame = -1;
+
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		delete *it;
 
@@ -185,6 +206,10 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	_needsUpdate = false;
 	_canSetDither = false;
 
+	// Serve a frame that has already been decoded ahead, if present.
+	if (!_aheadQueue.empty())
+		return popAheadFrame();
+
 	readNextPacket();
 
 	// If we have no next video track at this point, there shouldn't be
@@ -199,17 +224,133 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 		_dirtyPalette = true;
 	}
 
+	if (_decodeAheadLimit > 0)
+		_aheadCurFrame = _nextVideoTrack->getCurFrame();
+
 	// Look for the next video track here for the next decode.
 	findNextVideoTrack();
 
 	return frame;
 }
 
+bool VideoDecoder::decodeAheadFrame() {
+	if (_decodeAheadLimit == 0 || (uint)_aheadQueue.size() >= _decodeAheadLimit)
+		return false;
+
+	// Only decode ahead while playing forwards and not paused; a paused
+	// or reversed video may be seeked or change direction before the
+	// queued frame would be shown.
+	if (!_nextVideoTrack || _nextVideoTrack->isReversed() || !isPlaying() || isPaused())
+		return false;
+
+	_canSetDither = false;
+
+	PreDecodedFrame entry;
+	entry.startTime = _nextVideoTrack->getNextFrameStartTime();
+
+	readNextPacket();
+	const Graphics::Surface *frame = _nextVideoTrack->decodeNextFrame();
+
+	if (_nextVideoTrack->hasDirtyPalette()) {
+		_palette = _nextVideoTrack->getPalette();
+		_dirtyPalette = true;
+	}
+
+	entry.curFrame = _nextVideoTrack->getCurFrame();
+
+	// Look for the next video track here for the next decode.
+	findNextVideoTrack();
+
+	if (!frame)
+		return false;
+
+	// Copy the frame, since the track reuses its surface for the next
+	// decode.
+	entry.surface = acquireAheadSurface(*frame);
+	_aheadQueue.push(entry);
+	return true;
+}
+
+Graphics::Surface *VideoDecoder::acquireAheadSurface(const Graphics::Surface &src) {
+	Graphics::Surface *surface;
+
+	if (_aheadPool.empty()) {
+		surface = new Graphics::Surface();
+	} else {
+		surface = _aheadPool.back();
+		_aheadPool.pop_back();
+	}
+
+	// Copy the pixels in place when the recycled surface already has
+	// the right dimensions; copyFrom() would free and reallocate.
+	if (surface->w == src.w && surface->h == src.h && surface->format == src.format) {
+		if (surface->pitch == src.pitch) {
+			memcpy(surface->getPixels(), src.getPixels(), src.h * src.pitch);
+		} else {
+			const byte *srcP = (const byte *)src.getPixels();
+			byte *dstP = (byte *)surface->getPixels();
+			for (int y = src.h; y > 0; --y) {
+				memcpy(dstP, srcP, src.w * src.format.bytesPerPixel);
+				srcP += src.pitch;
+				dstP += surface->pitch;
+			}
+		}
+	} else {
+		surface->copyFrom(src);
+	}
+
+	return surface;
+}
+
+void VideoDecoder::recycleAheadSurface(Graphics::Surface *surface) {
+	// Keep just enough surfaces around to refill the queue plus the
+	// frame handed out to the caller.
+	if (_aheadPool.size() <= _decodeAheadLimit) {
+		_aheadPool.push_back(surface);
+	} else {
+		surface->free();
+		delete surface;
+	}
+}
+
+const Graphics::Surface *VideoDecoder::popAheadFrame() {
+	// Recycle the previously handed out frame; the caller must not keep
+	// a surface across decodeNextFrame() calls anyway.
+	if (_aheadFrame)
+		recycleAheadSurface(_aheadFrame);
+
+	PreDecodedFrame entry = _aheadQueue.pop();
+	_aheadFrame = entry.surface;
+	_aheadCurFrame = entry.curFrame;
+	return _aheadFrame;
+}
+
+void VideoDecoder::flushAheadQueue() {
+	while (!_aheadQueue.empty())
+		recycleAheadSurface(_aheadQueue.pop().surface);
+
+	// Resynchronize the reported frame number with the track.
+	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
+		if ((*it)->getTrackType() == Track::kTrackTypeVideo) {
+			_aheadCurFrame = ((const VideoTrack *)*it)->getCurFrame();
+			break;
+		}
+	}
+}
+
+void VideoDecoder::enableDecodeAhead(uint maxFrames) {
+	_decodeAheadLimit = maxFrames;
+}
+
 bool VideoDecoder::setReverse(bool reverse) {
 	// Can only reverse video-only videos
 	if (reverse && hasAudio())
 		return false;
 
+	// Frames decoded ahead are only valid for forward playback
+	if (reverse)
+		flushAheadQueue();
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)*it)->isReversed() != reverse) {
@@ -230,6 +371,11 @@ const byte *VideoDecoder::getPalette() {
 }
 
 int VideoDecoder::getCurFrame() const {
+	// With decode ahead buffering the track is ahead of what has been
+	// handed out, so report the last frame given to the caller instead.
+	if (_decodeAheadLimit > 0)
+		return _aheadCurFrame;
+
 	int32 frame = -1;
 
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
@@ -271,7 +417,22 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
-	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
+	if (endOfVideo() || _needsUpdate)
+		return 0;
+
+	// The next frame to display is the head of the decode ahead queue,
+	// if any frames are waiting in it.
+	if (!_aheadQueue.empty()) {
+		uint32 currentTime = getTime();
+		uint32 nextFrameStartTime = _aheadQueue.front().startTime;
+
+		if (nextFrameStartTime <= currentTime)
+			return 0;
+
+		return nextFrameStartTime - currentTime;
+	}
+
+	if (!_nextVideoTrack)
 		return 0;
 
 	uint32 currentTime = getTime();
@@ -293,6 +454,11 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 }
 
 bool VideoDecoder::endOfVideo() const {
+	// Frames decoded ahead but not yet displayed count as remaining
+	// video, even if the underlying track has already been fully read.
+	if (!_aheadQueue.empty() && (!_endTimeSet || _aheadQueue.front().startTime < (uint)_endTime.msecs()))
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		const Track *track = *it;
 
@@ -332,6 +498,8 @@ bool VideoDecoder::rewind() {
 	if (isPlaying())
 		startAudio();
 
+	flushAheadQueue();
+
 	_lastTimeChange = 0;
 	_startTime = g_system->getMillis();
 	resetPauseStartTime();
@@ -362,6 +530,9 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (!seekIntern(time))
 		return false;
 
+	// Any frames decoded ahead are now stale
+	flushAheadQueue();
+
 	// Seek any external track too
 	for (TrackListIterator it = _externalTracks.begin(); it != _externalTracks.end(); it++)
 		if (!(*it)->seek(time))
@@ -915,6 +1086,11 @@ bool VideoDecoder::hasFramesLeft() const {
 	// This is similar to endOfVideo(), except it doesn't take Audio into account (and returns true if not the end of the video)
 	// This is only used for needsUpdate() atm so that setEndTime() works properly
 	// And unlike endOfVideoTracks(), this takes into account _endTime
+
+	// Frames waiting in the decode ahead queue still need to be shown.
+	if (!_aheadQueue.empty() && (!_endTimeSet || _aheadQueue.front().startTime < (uint)_endTime.msecs()))
+		return true;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() != Track::kTrackTypeVideo)
 			continue;
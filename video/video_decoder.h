@@ -26,6 +26,7 @@
 #include "audio/mixer.h"
 #include "audio/timestamp.h"	// TODO: Move this to common/ ?
 #include "common/array.h"
+#include "common/queue.h"
 #include "common/rational.h"
 #include "common/str.h"
 #include "graphics/pixelformat.h"
@@ -355,6 +356,22 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Decode one frame ahead of its display time, if the decoder has
+	 * opted into decode ahead buffering.
+	 *
+	 * Playback loops may call this while waiting for the next frame to
+	 * become due (i.e. while needsUpdate() returns false), instead of
+	 * just sleeping. The decoded frame is copied into a small queue and
+	 * handed out by the following decodeNextFrame() call, so decoding
+	 * cost is moved into otherwise idle time and frame deadlines are
+	 * less likely to be missed on slow systems.
+	 *
+	 * @return true if a frame was decoded ahead, false if the queue is
+	 *         full, the feature is disabled, or no frame is available
+	 */
+	bool decodeAheadFrame();
+
 	/**
 	 * Set the default high color format for videos that convert from YUV.
 	 *
@@ -826,6 +843,20 @@ protected:
 	 */
 	virtual void readNextPacket() {}
 
+	/**
+	 * Allow this decoder to buffer frames decoded ahead of their
+	 * display time via decodeAheadFrame().
+	 *
+	 * This is only valid for formats with a single, forward-playing
+	 * video track which does not change its palette mid-video, since
+	 * queued frames would otherwise be shown with the wrong palette.
+	 * Each queued frame holds a full copy of the output surface, so the
+	 * queue is kept small.
+	 *
+	 * @param maxFrames The maximum number of frames to queue
+	 */
+	void enableDecodeAhead(uint maxFrames = 2);
+
 	/**
 	 * Define a track to be used by this class.
 	 *
@@ -946,6 +977,31 @@ private:
 	// Enforcement of not being able to set dither
 	bool _canSetDither;
 
+	// Decode ahead buffering (see enableDecodeAhead())
+	struct PreDecodedFrame {
+		Graphics::Surface *surface; ///< Copy of the decoded frame
+		uint32 startTime;           ///< Time (in ms) the frame should be shown
+		int curFrame;               ///< Frame number as reported by the track
+	};
+
+	uint _decodeAheadLimit;
+	Common::Queue<PreDecodedFrame> _aheadQueue;
+	Graphics::Surface *_aheadFrame; ///< The queued frame currently handed out
+	int _aheadCurFrame;             ///< Frame number of the last frame handed out
+
+	/**
+	 * Pool of surfaces recycled between the decode ahead queue and the
+	 * frame handed out to the caller, so steady-state playback does not
+	 * allocate and release a full frame buffer per frame.
+	 */
+	Common::Array<Graphics::Surface *> _aheadPool;
+
+	Graphics::Surface *acquireAheadSurface(const Graphics::Surface &src);
+	void recycleAheadSurface(Graphics::Surface *surface);
+
+	const Graphics::Surface *popAheadFrame();
+	void flushAheadQueue();
+
 	// Default PixelFormat settings
 	Graphics::PixelFormat _defaultHighColorFormat;
 